@@ -173,6 +173,7 @@
         'src/core/lib/gpr/env_linux.cc',
         'src/core/lib/gpr/env_posix.cc',
         'src/core/lib/gpr/env_windows.cc',
+        'src/core/lib/gpr/epoch_reclaim.cc',
         'src/core/lib/gpr/fork.cc',
         'src/core/lib/gpr/host_port.cc',
         'src/core/lib/gpr/log.cc',
@@ -255,6 +256,7 @@
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
         'src/core/lib/iomgr/ev_epollsig_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -295,6 +297,7 @@
         'src/core/lib/iomgr/tcp_client_posix.cc',
         'src/core/lib/iomgr/tcp_client_uv.cc',
         'src/core/lib/iomgr/tcp_client_windows.cc',
+        'src/core/lib/iomgr/tcp_io_uring_linux.cc',
         'src/core/lib/iomgr/tcp_posix.cc',
         'src/core/lib/iomgr/tcp_server_posix.cc',
         'src/core/lib/iomgr/tcp_server_utils_posix_common.cc',
@@ -305,10 +308,12 @@
         'src/core/lib/iomgr/tcp_uv.cc',
         'src/core/lib/iomgr/tcp_windows.cc',
         'src/core/lib/iomgr/time_averaged_stats.cc',
+        'src/core/lib/iomgr/timer.cc',
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
         'src/core/lib/iomgr/timer_uv.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/udp_server.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
         'src/core/lib/iomgr/unix_sockets_posix_noop.cc',
@@ -353,6 +358,7 @@
         'src/core/lib/transport/error_utils.cc',
         'src/core/lib/transport/metadata.cc',
         'src/core/lib/transport/metadata_batch.cc',
+        'src/core/lib/transport/network_timeline.cc',
         'src/core/lib/transport/pid_controller.cc',
         'src/core/lib/transport/service_config.cc',
         'src/core/lib/transport/static_metadata.cc',
@@ -450,6 +456,9 @@
         'src/core/ext/transport/chttp2/client/insecure/channel_create_posix.cc',
         'src/core/ext/transport/inproc/inproc_plugin.cc',
         'src/core/ext/transport/inproc/inproc_transport.cc',
+        'src/core/ext/transport/shm/shm_endpoint.cc',
+        'src/core/ext/transport/shm/shm_plugin.cc',
+        'src/core/ext/transport/shm/shm_transport.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/client_load_reporting_filter.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_channel_secure.cc',
@@ -551,6 +560,7 @@
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
         'src/core/lib/iomgr/ev_epollsig_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -591,6 +601,7 @@
         'src/core/lib/iomgr/tcp_client_posix.cc',
         'src/core/lib/iomgr/tcp_client_uv.cc',
         'src/core/lib/iomgr/tcp_client_windows.cc',
+        'src/core/lib/iomgr/tcp_io_uring_linux.cc',
         'src/core/lib/iomgr/tcp_posix.cc',
         'src/core/lib/iomgr/tcp_server_posix.cc',
         'src/core/lib/iomgr/tcp_server_utils_posix_common.cc',
@@ -601,10 +612,12 @@
         'src/core/lib/iomgr/tcp_uv.cc',
         'src/core/lib/iomgr/tcp_windows.cc',
         'src/core/lib/iomgr/time_averaged_stats.cc',
+        'src/core/lib/iomgr/timer.cc',
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
         'src/core/lib/iomgr/timer_uv.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/udp_server.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
         'src/core/lib/iomgr/unix_sockets_posix_noop.cc',
@@ -649,6 +662,7 @@
         'src/core/lib/transport/error_utils.cc',
         'src/core/lib/transport/metadata.cc',
         'src/core/lib/transport/metadata_batch.cc',
+        'src/core/lib/transport/network_timeline.cc',
         'src/core/lib/transport/pid_controller.cc',
         'src/core/lib/transport/service_config.cc',
         'src/core/lib/transport/static_metadata.cc',
@@ -765,6 +779,7 @@
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
         'src/core/lib/iomgr/ev_epollsig_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -805,6 +820,7 @@
         'src/core/lib/iomgr/tcp_client_posix.cc',
         'src/core/lib/iomgr/tcp_client_uv.cc',
         'src/core/lib/iomgr/tcp_client_windows.cc',
+        'src/core/lib/iomgr/tcp_io_uring_linux.cc',
         'src/core/lib/iomgr/tcp_posix.cc',
         'src/core/lib/iomgr/tcp_server_posix.cc',
         'src/core/lib/iomgr/tcp_server_utils_posix_common.cc',
@@ -815,10 +831,12 @@
         'src/core/lib/iomgr/tcp_uv.cc',
         'src/core/lib/iomgr/tcp_windows.cc',
         'src/core/lib/iomgr/time_averaged_stats.cc',
+        'src/core/lib/iomgr/timer.cc',
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
         'src/core/lib/iomgr/timer_uv.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/udp_server.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
         'src/core/lib/iomgr/unix_sockets_posix_noop.cc',
@@ -863,6 +881,7 @@
         'src/core/lib/transport/error_utils.cc',
         'src/core/lib/transport/metadata.cc',
         'src/core/lib/transport/metadata_batch.cc',
+        'src/core/lib/transport/network_timeline.cc',
         'src/core/lib/transport/pid_controller.cc',
         'src/core/lib/transport/service_config.cc',
         'src/core/lib/transport/static_metadata.cc',
@@ -961,6 +980,7 @@
         'src/core/lib/iomgr/ev_epoll1_linux.cc',
         'src/core/lib/iomgr/ev_epollex_linux.cc',
         'src/core/lib/iomgr/ev_epollsig_linux.cc',
+        'src/core/lib/iomgr/ev_io_uring_linux.cc',
         'src/core/lib/iomgr/ev_poll_posix.cc',
         'src/core/lib/iomgr/ev_posix.cc',
         'src/core/lib/iomgr/ev_windows.cc',
@@ -1001,6 +1021,7 @@
         'src/core/lib/iomgr/tcp_client_posix.cc',
         'src/core/lib/iomgr/tcp_client_uv.cc',
         'src/core/lib/iomgr/tcp_client_windows.cc',
+        'src/core/lib/iomgr/tcp_io_uring_linux.cc',
         'src/core/lib/iomgr/tcp_posix.cc',
         'src/core/lib/iomgr/tcp_server_posix.cc',
         'src/core/lib/iomgr/tcp_server_utils_posix_common.cc',
@@ -1011,10 +1032,12 @@
         'src/core/lib/iomgr/tcp_uv.cc',
         'src/core/lib/iomgr/tcp_windows.cc',
         'src/core/lib/iomgr/time_averaged_stats.cc',
+        'src/core/lib/iomgr/timer.cc',
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
         'src/core/lib/iomgr/timer_uv.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/udp_server.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
         'src/core/lib/iomgr/unix_sockets_posix_noop.cc',
@@ -1059,6 +1082,7 @@
         'src/core/lib/transport/error_utils.cc',
         'src/core/lib/transport/metadata.cc',
         'src/core/lib/transport/metadata_batch.cc',
+        'src/core/lib/transport/network_timeline.cc',
         'src/core/lib/transport/pid_controller.cc',
         'src/core/lib/transport/service_config.cc',
         'src/core/lib/transport/static_metadata.cc',
@@ -1124,6 +1148,9 @@
         'src/core/ext/filters/deadline/deadline_filter.cc',
         'src/core/ext/transport/inproc/inproc_plugin.cc',
         'src/core/ext/transport/inproc/inproc_transport.cc',
+        'src/core/ext/transport/shm/shm_endpoint.cc',
+        'src/core/ext/transport/shm/shm_plugin.cc',
+        'src/core/ext/transport/shm/shm_transport.cc',
         'src/core/ext/filters/client_channel/resolver/dns/c_ares/dns_resolver_ares.cc',
         'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_ev_driver_posix.cc',
         'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper.cc',
@@ -2476,6 +2503,7 @@
         'test/core/end2end/tests/max_message_length.cc',
         'test/core/end2end/tests/negative_deadline.cc',
         'test/core/end2end/tests/network_status_change.cc',
+        'test/core/end2end/tests/network_timeline.cc',
         'test/core/end2end/tests/no_logging.cc',
         'test/core/end2end/tests/no_op.cc',
         'test/core/end2end/tests/payload.cc',
@@ -2549,6 +2577,7 @@
         'test/core/end2end/tests/max_message_length.cc',
         'test/core/end2end/tests/negative_deadline.cc',
         'test/core/end2end/tests/network_status_change.cc',
+        'test/core/end2end/tests/network_timeline.cc',
         'test/core/end2end/tests/no_logging.cc',
         'test/core/end2end/tests/no_op.cc',
         'test/core/end2end/tests/payload.cc',
@@ -49,6 +49,7 @@
 #include <grpc++/impl/codegen/string_ref.h>
 #include <grpc++/impl/codegen/time.h>
 #include <grpc/impl/codegen/compression_types.h>
+#include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/impl/codegen/propagation_bits.h>
 
 struct census_context;
@@ -319,6 +320,15 @@ class ClientContext {
   /// \return The call's peer URI.
   grpc::string peer() const;
 
+  /// Get the kernel timestamps of the call's network traffic, if the channel
+  /// was created with GRPC_ARG_TCP_TIMESTAMPING and the platform supports it.
+  /// Read it once the call has finished; timestamps for its final writes may
+  /// still arrive after that.
+  ///
+  /// \param timeline Filled in with the call's timestamps.
+  /// \return false if no timestamps were recorded.
+  bool GetNetworkTimeline(grpc_call_network_timeline* timeline) const;
+
   /// Get and set census context.
   void set_census_context(struct census_context* ccp) { census_context_ = ccp; }
   struct census_context* census_context() const {
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include <grpc/impl/codegen/compression_types.h>
+#include <grpc/impl/codegen/grpc_types.h>
 
 #include <grpc++/impl/codegen/call.h>
 #include <grpc++/impl/codegen/completion_queue_tag.h>
@@ -216,6 +217,14 @@ class ServerContext {
   /// Get the census context associated with this server call.
   const struct census_context* census_context() const;
 
+  /// Get the kernel timestamps of the call's network traffic, if the server
+  /// was built with GRPC_ARG_TCP_TIMESTAMPING and the platform supports it.
+  /// Read it once the call has finished; timestamps for its final writes may
+  /// still arrive after that.
+  ///
+  /// \return false if no timestamps were recorded.
+  bool GetNetworkTimeline(grpc_call_network_timeline* timeline) const;
+
   /// Async only. Has to be called before the rpc starts.
   /// Returns the tag in completion queue when the rpc finishes.
   /// IsCancelled() can then be called to check whether the rpc was cancelled.
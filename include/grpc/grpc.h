@@ -265,6 +265,13 @@ GRPCAPI grpc_call_error grpc_call_start_batch(grpc_call* call,
     functionality. Instead, use grpc_auth_context. */
 GRPCAPI char* grpc_call_get_peer(grpc_call* call);
 
+/** Fill \a timeline with the kernel timestamps recorded for \a call's
+    traffic, which requires GRPC_ARG_TCP_TIMESTAMPING on the channel or server.
+    Returns 0 if none were recorded. Call only once the call has completed on
+    this side; timestamps for its final writes may still arrive after that. */
+GRPCAPI int grpc_call_get_network_timeline(
+    grpc_call* call, grpc_call_network_timeline* timeline);
+
 struct census_context;
 
 /** Set census context for a call; Must be called before first call to
@@ -239,6 +239,13 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** The time, in ms, the pick_first LB policy waits for a connection attempt
+    to an address to succeed before also starting an attempt to the next one
+    (RFC 8305 "Happy Eyeballs").  The first attempt to become ready is used
+    and the others are cancelled.  0 tries addresses one at a time.  Defaults
+    to 250. */
+#define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
+  "grpc.happy_eyeballs_connection_attempt_delay_ms"
 /** The timeout used on servers for finishing handshaking on an incoming
     connection.  Defaults to 120 seconds. */
 #define GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS "grpc.server_handshake_timeout_ms"
@@ -255,6 +262,12 @@ typedef struct {
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** If non-zero, and SO_REUSEPORT is in use, a server's listening sockets (one
+    per completion queue) ask the kernel to queue connections received on CPU
+    i for the i'th completion queue, which then polls them: run the threads
+    serving that queue on CPU i to keep all the work for a connection on one
+    core. Other connections are spread as usual. (default 0) */
+#define GRPC_ARG_REUSEPORT_CPU_AFFINITY "grpc.so_reuseport_cpu_affinity"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -288,6 +301,54 @@ typedef struct {
   "grpc.experimental.tcp_min_read_chunk_size"
 #define GRPC_ARG_TCP_MAX_READ_CHUNK_SIZE \
   "grpc.experimental.tcp_max_read_chunk_size"
+/** If non-zero, enable MSG_ZEROCOPY sends on TCP endpoints where the kernel
+ * supports it (Linux 4.14+). Large writes then skip the user to kernel copy;
+ * the slices being written are kept alive until the kernel reports their
+ * transmission on the socket error queue. Defaults to off. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_tx_zerocopy_enabled"
+/** Channel arg (integer) setting the minimum number of bytes a single
+ * sendmsg must carry before MSG_ZEROCOPY is used for it. Smaller writes are
+ * copied as usual, since page pinning and completion notification cost more
+ * than the copy they save. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_tx_zerocopy_send_bytes_threshold"
+/** Channel arg (integer) setting how many MSG_ZEROCOPY sends may be awaiting
+ * completion on a single endpoint at any one time. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULTANEOUS_SENDS \
+  "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/** If non-zero, and the io_uring polling engine is in use, TCP endpoints
+ * submit their reads and writes to the engine's ring instead of issuing
+ * recvmsg/sendmsg on readiness. Reads land in buffers registered with the
+ * ring where one is free. Ignored under other polling engines. Defaults to
+ * off. */
+#define GRPC_ARG_TCP_IO_URING_ENABLED "grpc.experimental.tcp_io_uring_enabled"
+/** Channel arg (integer) setting SO_BUSY_POLL, in microseconds, on the TCP
+ * sockets of connected and accepted connections: blocking reads then busy
+ * poll the device queue before sleeping. Raising it above the
+ * net.core.busy_read sysctl requires CAP_NET_ADMIN. Defaults to 0 (off). */
+#define GRPC_ARG_TCP_BUSY_POLL_US "grpc.experimental.tcp_busy_poll_us"
+/** Channel/server arg (integer): if positive, sets TCP_NOTSENT_LOWAT to this
+ * many bytes on TCP sockets and paces writes to it: an endpoint write
+ * completes only once the kernel holds fewer unsent bytes than this, and the
+ * HTTP/2 transport hands the endpoint about this much at a time, so pending
+ * data stays in user space where later frames can still be prioritized ahead
+ * of it. Defaults to 0 (off). */
+#define GRPC_ARG_TCP_NOTSENT_LOWAT "grpc.experimental.tcp_notsent_lowat"
+/** Channel/server arg (boolean): enable SO_TIMESTAMPING on TCP sockets. The
+ * kernel then timestamps the data each read returns and the last byte of each
+ * write as it is scheduled, sent and acknowledged; the HTTP/2 transport
+ * attributes these to the calls whose frames the bytes carried (see
+ * grpc_call_get_network_timeline). Defaults to false. Linux only. */
+#define GRPC_ARG_TCP_TIMESTAMPING "grpc.experimental.tcp_timestamping"
+/** Server arg (integer): microseconds a polling thread for the completion
+ * queues registered with this server spins on a non-blocking poll before going
+ * to sleep, set once when the server starts. Trades CPU for wake-up latency;
+ * only honored by the epoll1 polling engine. Defaults to 0 (off). Client
+ * completion queues take it as an attribute when created (cq_spin_budget_us).
+ */
+#define GRPC_ARG_POLLSET_SPIN_BUDGET_US \
+  "grpc.experimental.pollset_spin_budget_us"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -579,6 +640,25 @@ typedef struct {
   char** service_config_json;
 } grpc_channel_info;
 
+/** Kernel timestamps for the network traffic of a call, recorded when its
+ * channel or server sets GRPC_ARG_TCP_TIMESTAMPING (see
+ * grpc_call_get_network_timeline). Times are GPR_CLOCK_REALTIME; anything
+ * not reported is gpr_inf_past. Writes are timestamped at their last byte,
+ * and may carry frames of other calls too. */
+typedef struct {
+  /** the latest write carrying the call's frames entered the kernel's packet
+   * scheduler */
+  gpr_timespec sent_scheduled;
+  /** ... was handed to the network device */
+  gpr_timespec sent;
+  /** ... was acknowledged by the peer */
+  gpr_timespec acked;
+  /** the first read carrying the call's frames was received by the kernel */
+  gpr_timespec first_received;
+  /** the latest such read was received by the kernel */
+  gpr_timespec last_received;
+} grpc_call_network_timeline;
+
 typedef struct grpc_resource_quota grpc_resource_quota;
 
 /** Completion queues internally MAY maintain a set of file descriptors in a
@@ -616,7 +696,7 @@ typedef enum {
   GRPC_CQ_PLUCK
 } grpc_cq_completion_type;
 
-#define GRPC_CQ_CURRENT_VERSION 1
+#define GRPC_CQ_CURRENT_VERSION 2
 typedef struct grpc_completion_queue_attributes {
   /** The version number of this structure. More fields might be added to this
      structure in future. */
@@ -625,6 +705,14 @@ typedef struct grpc_completion_queue_attributes {
   grpc_cq_completion_type cq_completion_type;
 
   grpc_cq_polling_type cq_polling_type;
+  /* END OF VERSION 1 CQ ATTRIBUTES */
+
+  /* EXPERIMENTAL: START OF VERSION 2 CQ ATTRIBUTES */
+  /** Microseconds a thread polling on behalf of this completion queue spins
+     on a non-blocking poll before going to sleep (see
+     GRPC_ARG_POLLSET_SPIN_BUDGET_US). 0 disables spinning. */
+  int cq_spin_budget_us;
+  /* END OF VERSION 2 CQ ATTRIBUTES */
 } grpc_completion_queue_attributes;
 
 /** The completion queue factory structure is opaque to the callers of grpc */
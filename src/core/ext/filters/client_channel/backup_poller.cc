@@ -20,8 +20,10 @@
 
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
+#include <grpc/support/useful.h>
 #include "src/core/ext/filters/client_channel/client_channel.h"
 #include "src/core/lib/gpr/env.h"
 #include "src/core/lib/gpr/string.h"
@@ -32,27 +34,51 @@
 #include "src/core/lib/surface/completion_queue.h"
 
 #define DEFAULT_POLL_INTERVAL_MS 5000
+#define MAX_POLLER_SHARDS 16
+/* While polls keep finding work, the interval shrinks down to this fraction of
+   the configured one */
+#define MIN_POLL_INTERVAL_DIVISOR 16
 
 namespace {
+/* One shard of the backup poller: its pollset is in the interested parties of
+   every channel assigned to the shard. The timer is only armed while one of
+   those channels has calls in flight or is not idle; each poll that finds work
+   halves the interval (nobody else is polling for it), each one that does not
+   doubles it back towards g_poll_interval_ms */
 struct backup_poller {
   grpc_timer polling_timer;
   grpc_closure run_poller_closure;
   grpc_closure shutdown_closure;
   gpr_mu* pollset_mu;
-  grpc_pollset* pollset;  // guarded by pollset_mu
-  bool shutting_down;     // guarded by pollset_mu
+  grpc_pollset* pollset;   // guarded by pollset_mu
+  bool shutting_down;      // guarded by pollset_mu
+  bool armed;              // guarded by pollset_mu
+  grpc_millis interval;    // guarded by pollset_mu
+  size_t shard;
+  /* calls in flight plus non-idle channels: the timer is armed when this
+     leaves zero, and disarms itself when it finds it back at zero */
+  gpr_atm active;
   gpr_refcount refs;
   gpr_refcount shutdown_refs;
 };
 }  // namespace
 
+/* What one client channel needs to drive its shard */
+struct grpc_client_channel_backup_poller {
+  backup_poller* poller;
+  gpr_atm connected;
+};
+
 static gpr_once g_once = GPR_ONCE_INIT;
 static gpr_mu g_poller_mu;
-static backup_poller* g_poller = nullptr;  // guarded by g_poller_mu
-// g_poll_interval_ms is set only once at the first time
-// grpc_client_channel_start_backup_polling() is called, after that it is
-// treated as const.
+static backup_poller* g_pollers[MAX_POLLER_SHARDS];  // guarded by g_poller_mu
+// g_poll_interval_ms, g_min_poll_interval_ms and g_num_shards are set only once
+// at the first time grpc_client_channel_start_backup_polling() is called, after
+// that they are treated as const.
 static int g_poll_interval_ms = DEFAULT_POLL_INTERVAL_MS;
+static int g_min_poll_interval_ms;
+static size_t g_num_shards;
+static gpr_atm g_next_shard;
 
 static void init_globals() {
   gpr_mu_init(&g_poller_mu);
@@ -69,6 +95,9 @@ static void init_globals() {
     }
   }
   gpr_free(env);
+  g_min_poll_interval_ms =
+      GPR_MAX(1, g_poll_interval_ms / MIN_POLL_INTERVAL_DIVISOR);
+  g_num_shards = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_POLLER_SHARDS);
 }
 
 static void backup_poller_shutdown_unref(backup_poller* p) {
@@ -83,24 +112,33 @@ static void done_poller(void* arg, grpc_error* error) {
   backup_poller_shutdown_unref((backup_poller*)arg);
 }
 
-static void g_poller_unref() {
+static void poller_unref(backup_poller* p) {
   gpr_mu_lock(&g_poller_mu);
-  if (gpr_unref(&g_poller->refs)) {
-    backup_poller* p = g_poller;
-    g_poller = nullptr;
+  if (gpr_unref(&p->refs)) {
+    g_pollers[p->shard] = nullptr;
     gpr_mu_unlock(&g_poller_mu);
     gpr_mu_lock(p->pollset_mu);
     p->shutting_down = true;
+    bool armed = p->armed;
     grpc_pollset_shutdown(
         p->pollset, GRPC_CLOSURE_INIT(&p->shutdown_closure, done_poller, p,
                                       grpc_schedule_on_exec_ctx));
     gpr_mu_unlock(p->pollset_mu);
-    grpc_timer_cancel(&p->polling_timer);
+    if (armed) grpc_timer_cancel(&p->polling_timer);
   } else {
     gpr_mu_unlock(&g_poller_mu);
   }
 }
 
+/* Called with p->pollset_mu held: the armed timer holds a shutdown ref */
+static void arm_timer_locked(backup_poller* p) {
+  p->armed = true;
+  gpr_ref(&p->shutdown_refs);
+  grpc_timer_init(&p->polling_timer,
+                  grpc_core::ExecCtx::Get()->Now() + p->interval,
+                  &p->run_poller_closure);
+}
+
 static void run_poller(void* arg, grpc_error* error) {
   backup_poller* p = (backup_poller*)arg;
   if (error != GRPC_ERROR_NONE) {
@@ -112,57 +150,147 @@ static void run_poller(void* arg, grpc_error* error) {
   }
   gpr_mu_lock(p->pollset_mu);
   if (p->shutting_down) {
+    p->armed = false;
     gpr_mu_unlock(p->pollset_mu);
     backup_poller_shutdown_unref(p);
     return;
   }
-  grpc_error* err =
-      grpc_pollset_work(p->pollset, nullptr, grpc_core::ExecCtx::Get()->Now());
-  gpr_mu_unlock(p->pollset_mu);
-  GRPC_LOG_IF_ERROR("Run client channel backup poller", err);
+  /* The poll runs the closures of the events it finds in an exec_ctx of its
+     own (the engines flush it before grpc_pollset_work() returns): if it ran
+     any, the poll did something that no other poller was doing */
+  bool found_work;
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_error* err = grpc_pollset_work(p->pollset, nullptr, exec_ctx.Now());
+    gpr_mu_unlock(p->pollset_mu);
+    GRPC_LOG_IF_ERROR("Run client channel backup poller", err);
+    exec_ctx.Flush();
+    found_work = exec_ctx.closures_run() > 0;
+  }
+  gpr_mu_lock(p->pollset_mu);
+  if (p->shutting_down || gpr_atm_acq_load(&p->active) == 0) {
+    /* shutting down, or nothing left to poll for: stay disarmed until a
+       channel needs us */
+    p->armed = false;
+    p->interval = g_poll_interval_ms;
+    gpr_mu_unlock(p->pollset_mu);
+    backup_poller_shutdown_unref(p);
+    return;
+  }
+  if (found_work) {
+    p->interval = GPR_MAX(p->interval / 2, g_min_poll_interval_ms);
+  } else {
+    p->interval = GPR_MIN(p->interval * 2, g_poll_interval_ms);
+  }
   grpc_timer_init(&p->polling_timer,
-                  grpc_core::ExecCtx::Get()->Now() + g_poll_interval_ms,
+                  grpc_core::ExecCtx::Get()->Now() + p->interval,
                   &p->run_poller_closure);
+  gpr_mu_unlock(p->pollset_mu);
+}
+
+static void poller_activate(backup_poller* p) {
+  if (gpr_atm_full_fetch_add(&p->active, 1) != 0) return;
+  gpr_mu_lock(p->pollset_mu);
+  if (!p->armed && !p->shutting_down) {
+    arm_timer_locked(p);
+  }
+  gpr_mu_unlock(p->pollset_mu);
 }
 
-void grpc_client_channel_start_backup_polling(
+static void poller_deactivate(backup_poller* p) {
+  /* no need to disarm: the timer notices when it next fires */
+  gpr_atm_full_fetch_add(&p->active, -1);
+}
+
+grpc_client_channel_backup_poller* grpc_client_channel_start_backup_polling(
     grpc_pollset_set* interested_parties) {
   gpr_once_init(&g_once, init_globals);
   if (g_poll_interval_ms == 0) {
-    return;
+    return nullptr;
   }
+  size_t shard =
+      (size_t)gpr_atm_no_barrier_fetch_add(&g_next_shard, 1) % g_num_shards;
   gpr_mu_lock(&g_poller_mu);
-  if (g_poller == nullptr) {
-    g_poller = (backup_poller*)gpr_zalloc(sizeof(backup_poller));
-    g_poller->pollset = (grpc_pollset*)gpr_zalloc(grpc_pollset_size());
-    g_poller->shutting_down = false;
-    grpc_pollset_init(g_poller->pollset, &g_poller->pollset_mu);
-    gpr_ref_init(&g_poller->refs, 0);
-    // one for timer cancellation, one for pollset shutdown
-    gpr_ref_init(&g_poller->shutdown_refs, 2);
-    GRPC_CLOSURE_INIT(&g_poller->run_poller_closure, run_poller, g_poller,
+  backup_poller* p = g_pollers[shard];
+  if (p == nullptr) {
+    p = (backup_poller*)gpr_zalloc(sizeof(backup_poller));
+    p->pollset = (grpc_pollset*)gpr_zalloc(grpc_pollset_size());
+    p->shutting_down = false;
+    p->armed = false;
+    p->interval = g_poll_interval_ms;
+    p->shard = shard;
+    gpr_atm_no_barrier_store(&p->active, 0);
+    grpc_pollset_init(p->pollset, &p->pollset_mu);
+    gpr_ref_init(&p->refs, 0);
+    // one for pollset shutdown; the timer takes one more while armed
+    gpr_ref_init(&p->shutdown_refs, 1);
+    GRPC_CLOSURE_INIT(&p->run_poller_closure, run_poller, p,
                       grpc_schedule_on_exec_ctx);
-    grpc_timer_init(&g_poller->polling_timer,
-                    grpc_core::ExecCtx::Get()->Now() + g_poll_interval_ms,
-                    &g_poller->run_poller_closure);
+    g_pollers[shard] = p;
   }
-
-  gpr_ref(&g_poller->refs);
-  /* Get a reference to g_poller->pollset before releasing g_poller_mu to make
-   * TSAN happy. Otherwise, reading from g_poller (i.e g_poller->pollset) after
-   * releasing the lock and setting g_poller to NULL in g_poller_unref() is
-   * being flagged as a data-race by TSAN */
-  grpc_pollset* pollset = g_poller->pollset;
+  gpr_ref(&p->refs);
+  /* Get a reference to p->pollset before releasing g_poller_mu to make TSAN
+   * happy. Otherwise, reading from p (i.e p->pollset) after releasing the lock
+   * and freeing p in poller_unref() is being flagged as a data-race by TSAN */
+  grpc_pollset* pollset = p->pollset;
   gpr_mu_unlock(&g_poller_mu);
 
   grpc_pollset_set_add_pollset(interested_parties, pollset);
+
+  grpc_client_channel_backup_poller* channel_poller =
+      (grpc_client_channel_backup_poller*)gpr_malloc(
+          sizeof(*channel_poller));
+  channel_poller->poller = p;
+  gpr_atm_no_barrier_store(&channel_poller->connected, 0);
+  return channel_poller;
 }
 
 void grpc_client_channel_stop_backup_polling(
+    grpc_client_channel_backup_poller* channel_poller,
     grpc_pollset_set* interested_parties) {
-  if (g_poll_interval_ms == 0) {
+  if (channel_poller == nullptr) {
+    return;
+  }
+  backup_poller* p = channel_poller->poller;
+  grpc_client_channel_backup_poller_set_connected(channel_poller, false);
+  grpc_pollset_set_del_pollset(interested_parties, p->pollset);
+  poller_unref(p);
+  gpr_free(channel_poller);
+}
+
+void grpc_client_channel_backup_poller_call_started(
+    grpc_client_channel_backup_poller* channel_poller) {
+  if (channel_poller != nullptr) poller_activate(channel_poller->poller);
+}
+
+void grpc_client_channel_backup_poller_call_finished(
+    grpc_client_channel_backup_poller* channel_poller) {
+  if (channel_poller != nullptr) poller_deactivate(channel_poller->poller);
+}
+
+void grpc_client_channel_backup_poller_set_connected(
+    grpc_client_channel_backup_poller* channel_poller, bool connected) {
+  if (channel_poller == nullptr) return;
+  if (gpr_atm_full_xchg(&channel_poller->connected, connected) == connected) {
     return;
   }
-  grpc_pollset_set_del_pollset(interested_parties, g_poller->pollset);
-  g_poller_unref();
+  if (connected) {
+    poller_activate(channel_poller->poller);
+  } else {
+    poller_deactivate(channel_poller->poller);
+  }
+}
+
+grpc_pollset* grpc_client_channel_backup_poller_get_pollset_for_testing(
+    grpc_client_channel_backup_poller* channel_poller) {
+  return channel_poller->poller->pollset;
+}
+
+grpc_millis grpc_client_channel_backup_poller_get_interval_for_testing(
+    grpc_client_channel_backup_poller* channel_poller) {
+  backup_poller* p = channel_poller->poller;
+  gpr_mu_lock(p->pollset_mu);
+  grpc_millis interval = p->armed ? p->interval : 0;
+  gpr_mu_unlock(p->pollset_mu);
+  return interval;
 }
@@ -23,12 +23,37 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 
-/* Start polling \a interested_parties periodically in the timer thread  */
-void grpc_client_channel_start_backup_polling(
+/* Per-channel handle on the backup poller */
+typedef struct grpc_client_channel_backup_poller
+    grpc_client_channel_backup_poller;
+
+/* Start polling \a interested_parties periodically in the timer thread, while
+   the channel has calls in flight or is connected (see below). Returns NULL if
+   backup polling is disabled; the other functions accept that */
+grpc_client_channel_backup_poller* grpc_client_channel_start_backup_polling(
     grpc_pollset_set* interested_parties);
 
-/* Stop polling \a interested_parties */
+/* Stop polling \a interested_parties, and destroy \a poller */
 void grpc_client_channel_stop_backup_polling(
+    grpc_client_channel_backup_poller* poller,
     grpc_pollset_set* interested_parties);
 
+/* Track the calls in flight on the channel */
+void grpc_client_channel_backup_poller_call_started(
+    grpc_client_channel_backup_poller* poller);
+void grpc_client_channel_backup_poller_call_finished(
+    grpc_client_channel_backup_poller* poller);
+
+/* Track whether the channel is connected (i.e. neither idle nor shut down): a
+   connected channel needs polling to notice disconnections */
+void grpc_client_channel_backup_poller_set_connected(
+    grpc_client_channel_backup_poller* poller, bool connected);
+
+/* For testing only: the pollset of the shard \a poller was assigned to, and
+   the current polling interval of that shard (0 while it is disarmed) */
+grpc_pollset* grpc_client_channel_backup_poller_get_pollset_for_testing(
+    grpc_client_channel_backup_poller* poller);
+grpc_millis grpc_client_channel_backup_poller_get_interval_for_testing(
+    grpc_client_channel_backup_poller* poller);
+
 #endif /* GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_BACKUP_POLLER_H */
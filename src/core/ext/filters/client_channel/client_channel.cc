@@ -195,6 +195,8 @@ typedef struct client_channel_channel_data {
   grpc_channel_stack* owning_stack;
   /** interested parties (owned) */
   grpc_pollset_set* interested_parties;
+  /** backup poller for interested_parties (owned; NULL if disabled) */
+  grpc_client_channel_backup_poller* backup_poller;
 
   /* external_connectivity_watcher_list head is guarded by its own mutex, since
    * counts need to be grabbed immediately without polling on a cq */
@@ -257,6 +259,9 @@ static void set_channel_connectivity_state_locked(channel_data* chand,
     gpr_log(GPR_DEBUG, "chand=%p: setting connectivity state to %s", chand,
             grpc_connectivity_state_name(state));
   }
+  grpc_client_channel_backup_poller_set_connected(
+      chand->backup_poller,
+      state != GRPC_CHANNEL_IDLE && state != GRPC_CHANNEL_SHUTDOWN);
   grpc_connectivity_state_set(&chand->state_tracker, state, error, reason);
 }
 
@@ -728,7 +733,8 @@ static grpc_error* cc_init_channel_elem(grpc_channel_element* elem,
   chand->interested_parties = grpc_pollset_set_create();
   grpc_connectivity_state_init(&chand->state_tracker, GRPC_CHANNEL_IDLE,
                                "client_channel");
-  grpc_client_channel_start_backup_polling(chand->interested_parties);
+  chand->backup_poller =
+      grpc_client_channel_start_backup_polling(chand->interested_parties);
   // Record client channel factory.
   const grpc_arg* arg = grpc_channel_args_find(args->channel_args,
                                                GRPC_ARG_CLIENT_CHANNEL_FACTORY);
@@ -805,7 +811,8 @@ static void cc_destroy_channel_elem(grpc_channel_element* elem) {
   if (chand->method_params_table != nullptr) {
     grpc_slice_hash_table_unref(chand->method_params_table);
   }
-  grpc_client_channel_stop_backup_polling(chand->interested_parties);
+  grpc_client_channel_stop_backup_polling(chand->backup_poller,
+                                          chand->interested_parties);
   grpc_connectivity_state_destroy(&chand->state_tracker);
   grpc_pollset_set_destroy(chand->interested_parties);
   GRPC_COMBINER_UNREF(chand->combiner, "client_channel");
@@ -1435,6 +1442,7 @@ static grpc_error* cc_init_call_elem(grpc_call_element* elem,
     grpc_deadline_state_init(elem, args->call_stack, args->call_combiner,
                              calld->deadline);
   }
+  grpc_client_channel_backup_poller_call_started(chand->backup_poller);
   return GRPC_ERROR_NONE;
 }
 
@@ -1447,6 +1455,7 @@ static void cc_destroy_call_elem(grpc_call_element* elem,
   if (chand->deadline_checking_enabled) {
     grpc_deadline_state_destroy(elem);
   }
+  grpc_client_channel_backup_poller_call_finished(chand->backup_poller);
   grpc_slice_unref_internal(calld->path);
   if (calld->method_params != nullptr) {
     method_parameters_unref(calld->method_params);
@@ -16,6 +16,7 @@
  *
  */
 
+#include <limits.h>
 #include <string.h>
 
 #include <grpc/support/alloc.h>
@@ -27,8 +28,11 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/sockaddr_utils.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/transport/connectivity_state.h"
 
+#define GRPC_PICK_FIRST_DEFAULT_CONNECTION_ATTEMPT_DELAY_MS 250
+
 grpc_core::TraceFlag grpc_lb_pick_first_trace(false, "pick_first");
 
 typedef struct {
@@ -48,6 +52,16 @@ typedef struct {
   grpc_lb_policy_pick_state* pending_picks;
   /** our connectivity state tracker */
   grpc_connectivity_state_tracker state_tracker;
+  /** how long to wait on a connection attempt before racing the next
+      subchannel against it (0 if attempts are made one at a time) */
+  grpc_millis connection_attempt_delay_ms;
+  /** when the next connection attempt may be started */
+  grpc_millis next_attempt_time;
+  /** timer that starts the next connection attempt */
+  grpc_timer attempt_timer;
+  grpc_closure on_attempt_timer;
+  /** is the callback associated with \a attempt_timer pending? */
+  bool attempt_timer_callback_pending;
 } pick_first_lb_policy;
 
 static void pf_destroy(grpc_lb_policy* pol) {
@@ -71,6 +85,9 @@ static void pf_shutdown_locked(grpc_lb_policy* pol,
     gpr_log(GPR_DEBUG, "Pick First %p Shutting down", p);
   }
   p->shutdown = true;
+  if (p->attempt_timer_callback_pending) {
+    grpc_timer_cancel(&p->attempt_timer);
+  }
   grpc_lb_policy_pick_state* pick;
   while ((pick = p->pending_picks) != nullptr) {
     p->pending_picks = pick->next;
@@ -147,20 +164,91 @@ static void pf_cancel_picks_locked(grpc_lb_policy* pol,
   GRPC_ERROR_UNREF(error);
 }
 
+static void start_attempt_timer_locked(pick_first_lb_policy* p) {
+  if (p->connection_attempt_delay_ms == 0) return;
+  p->next_attempt_time =
+      grpc_core::ExecCtx::Get()->Now() + p->connection_attempt_delay_ms;
+  // If the timer is already running, it will be re-armed for the new
+  // deadline when it fires.
+  if (p->attempt_timer_callback_pending) return;
+  GRPC_LB_POLICY_REF(&p->base, "pick_first_attempt_timer");
+  p->attempt_timer_callback_pending = true;
+  grpc_timer_init(&p->attempt_timer, p->next_attempt_time,
+                  &p->on_attempt_timer);
+}
+
+// Starts connecting to the first subchannel at or after index \a start
+// that is not already being connected to, racing it against any attempts
+// already in progress.  Returns false if there is no such subchannel.
+static bool start_connection_attempt_locked(
+    pick_first_lb_policy* p, grpc_lb_subchannel_list* subchannel_list,
+    size_t start) {
+  for (size_t i = start; i < subchannel_list->num_subchannels; ++i) {
+    grpc_lb_subchannel_data* sd = &subchannel_list->subchannels[i];
+    if (sd->subchannel == nullptr || sd->connectivity_notification_pending) {
+      continue;
+    }
+    if (grpc_lb_pick_first_trace.enabled()) {
+      gpr_log(GPR_DEBUG,
+              "Pick First %p starting connection attempt to subchannel %p "
+              "(%" PRIuPTR " of %" PRIuPTR ")",
+              (void*)p, (void*)sd->subchannel, i,
+              subchannel_list->num_subchannels);
+    }
+    subchannel_list->checking_subchannel = i;
+    grpc_lb_subchannel_list_ref_for_connectivity_watch(
+        subchannel_list, "connectivity_watch+attempt");
+    grpc_lb_subchannel_data_start_connectivity_watch(sd);
+    start_attempt_timer_locked(p);
+    return true;
+  }
+  return false;
+}
+
+static bool connection_attempts_pending(
+    grpc_lb_subchannel_list* subchannel_list) {
+  for (size_t i = 0; i < subchannel_list->num_subchannels; ++i) {
+    if (subchannel_list->subchannels[i].connectivity_notification_pending) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns the subchannel list we are trying to select a subchannel from,
+// or null if we are not currently connecting.
+static grpc_lb_subchannel_list* connecting_subchannel_list(
+    pick_first_lb_policy* p) {
+  if (!p->started_picking) return nullptr;
+  if (p->latest_pending_subchannel_list != nullptr) {
+    return p->latest_pending_subchannel_list;
+  }
+  return p->selected == nullptr ? p->subchannel_list : nullptr;
+}
+
+static void on_attempt_timer_locked(void* arg, grpc_error* error) {
+  pick_first_lb_policy* p = (pick_first_lb_policy*)arg;
+  p->attempt_timer_callback_pending = false;
+  grpc_lb_subchannel_list* subchannel_list = connecting_subchannel_list(p);
+  if (!p->shutdown && error == GRPC_ERROR_NONE && subchannel_list != nullptr) {
+    if (grpc_core::ExecCtx::Get()->Now() < p->next_attempt_time) {
+      // Another attempt was started since the timer was armed; give it
+      // its full delay before starting the next one.  Keeps our ref.
+      p->attempt_timer_callback_pending = true;
+      grpc_timer_init(&p->attempt_timer, p->next_attempt_time,
+                      &p->on_attempt_timer);
+      return;
+    }
+    start_connection_attempt_locked(p, subchannel_list,
+                                    subchannel_list->checking_subchannel + 1);
+  }
+  GRPC_LB_POLICY_UNREF(&p->base, "pick_first_attempt_timer");
+}
+
 static void start_picking_locked(pick_first_lb_policy* p) {
   p->started_picking = true;
-  if (p->subchannel_list != nullptr &&
-      p->subchannel_list->num_subchannels > 0) {
-    p->subchannel_list->checking_subchannel = 0;
-    for (size_t i = 0; i < p->subchannel_list->num_subchannels; ++i) {
-      if (p->subchannel_list->subchannels[i].subchannel != nullptr) {
-        grpc_lb_subchannel_list_ref_for_connectivity_watch(
-            p->subchannel_list, "connectivity_watch+start_picking");
-        grpc_lb_subchannel_data_start_connectivity_watch(
-            &p->subchannel_list->subchannels[i]);
-        break;
-      }
-    }
+  if (p->subchannel_list != nullptr) {
+    start_connection_attempt_locked(p, p->subchannel_list, 0);
   }
 }
 
@@ -191,10 +279,18 @@ static int pf_pick_locked(grpc_lb_policy* pol,
 static void destroy_unselected_subchannels_locked(pick_first_lb_policy* p) {
   for (size_t i = 0; i < p->subchannel_list->num_subchannels; ++i) {
     grpc_lb_subchannel_data* sd = &p->subchannel_list->subchannels[i];
-    if (p->selected != sd) {
-      grpc_lb_subchannel_data_unref_subchannel(sd,
-                                               "selected_different_subchannel");
+    if (p->selected == sd) continue;
+    // Stop watching any connection attempt that lost the race; the callback
+    // only drops the subchannel list's ref.
+    if (sd->connectivity_notification_pending) {
+      grpc_lb_subchannel_data_cancel_connectivity_watch(
+          sd, "selected_different_subchannel");
     }
+    // Unref the subchannel now rather than from that callback: unless
+    // another channel shares it, this disconnects it, shutting down the
+    // connection attempt it still has in flight.
+    grpc_lb_subchannel_data_unref_subchannel(sd,
+                                             "selected_different_subchannel");
   }
 }
 
@@ -339,10 +435,7 @@ static void pf_update_locked(grpc_lb_policy* policy,
   // If we've started picking, start trying to connect to the first
   // subchannel in the new list.
   if (p->started_picking) {
-    grpc_lb_subchannel_list_ref_for_connectivity_watch(
-        subchannel_list, "connectivity_watch+update");
-    grpc_lb_subchannel_data_start_connectivity_watch(
-        &subchannel_list->subchannels[0]);
+    start_connection_attempt_locked(p, subchannel_list, 0);
   }
 }
 
@@ -433,6 +526,16 @@ static void pf_connectivity_changed_locked(void* arg, grpc_error* error) {
     }
     return;
   }
+  // A connection attempt that lost the race to the selected subchannel but
+  // completed before it could be cancelled.
+  if (p->selected != nullptr &&
+      p->selected->subchannel_list == sd->subchannel_list) {
+    grpc_lb_subchannel_data_stop_connectivity_watch(sd);
+    grpc_lb_subchannel_data_unref_subchannel(sd, "pf_lost_race");
+    grpc_lb_subchannel_list_unref_for_connectivity_watch(sd->subchannel_list,
+                                                         "pf_lost_race");
+    return;
+  }
   // If we get here, there are two possible cases:
   // 1. We do not currently have a selected subchannel, and the update is
   //    for a subchannel in p->subchannel_list that we're trying to
@@ -482,24 +585,24 @@ static void pf_connectivity_changed_locked(void* arg, grpc_error* error) {
       break;
     }
     case GRPC_CHANNEL_TRANSIENT_FAILURE: {
+      grpc_lb_subchannel_list* subchannel_list = sd->subchannel_list;
       grpc_lb_subchannel_data_stop_connectivity_watch(sd);
-      do {
-        sd->subchannel_list->checking_subchannel =
-            (sd->subchannel_list->checking_subchannel + 1) %
-            sd->subchannel_list->num_subchannels;
-        sd = &sd->subchannel_list
-                  ->subchannels[sd->subchannel_list->checking_subchannel];
-      } while (sd->subchannel == nullptr);
-      // Case 1: Only set state to TRANSIENT_FAILURE if we've tried
-      // all subchannels.
-      if (sd->subchannel_list->checking_subchannel == 0 &&
-          sd->subchannel_list == p->subchannel_list) {
-        grpc_connectivity_state_set(
-            &p->state_tracker, GRPC_CHANNEL_TRANSIENT_FAILURE,
-            GRPC_ERROR_REF(error), "connecting_transient_failure");
+      // Don't wait out the attempt delay: start racing the next subchannel
+      // right away.
+      if (!start_connection_attempt_locked(
+              p, subchannel_list, subchannel_list->checking_subchannel + 1) &&
+          !connection_attempts_pending(subchannel_list)) {
+        // Case 1: Only set state to TRANSIENT_FAILURE once every
+        // subchannel has failed, then start over from the beginning.
+        if (subchannel_list == p->subchannel_list) {
+          grpc_connectivity_state_set(
+              &p->state_tracker, GRPC_CHANNEL_TRANSIENT_FAILURE,
+              GRPC_ERROR_REF(error), "connecting_transient_failure");
+        }
+        start_connection_attempt_locked(p, subchannel_list, 0);
       }
-      // Reuses the connectivity refs from the previous watch.
-      grpc_lb_subchannel_data_start_connectivity_watch(sd);
+      grpc_lb_subchannel_list_unref_for_connectivity_watch(
+          subchannel_list, "connecting_transient_failure");
       break;
     }
     case GRPC_CHANNEL_CONNECTING:
@@ -551,8 +654,14 @@ static grpc_lb_policy* create_pick_first(grpc_lb_policy_factory* factory,
   if (grpc_lb_pick_first_trace.enabled()) {
     gpr_log(GPR_DEBUG, "Pick First %p created.", (void*)p);
   }
+  const grpc_arg* arg = grpc_channel_args_find(
+      args->args, GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS);
+  p->connection_attempt_delay_ms = grpc_channel_arg_get_integer(
+      arg, {GRPC_PICK_FIRST_DEFAULT_CONNECTION_ATTEMPT_DELAY_MS, 0, INT_MAX});
   pf_update_locked(&p->base, args);
   grpc_lb_policy_init(&p->base, &pick_first_lb_policy_vtable, args->combiner);
+  GRPC_CLOSURE_INIT(&p->on_attempt_timer, on_attempt_timer_locked, p,
+                    grpc_combiner_scheduler(args->combiner));
   grpc_subchannel_index_ref();
   return &p->base;
 }
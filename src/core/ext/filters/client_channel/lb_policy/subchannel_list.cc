@@ -220,7 +220,7 @@ void grpc_lb_subchannel_list_unref_for_connectivity_watch(
   grpc_lb_subchannel_list_unref(subchannel_list, reason);
 }
 
-static void subchannel_data_cancel_connectivity_watch(
+void grpc_lb_subchannel_data_cancel_connectivity_watch(
     grpc_lb_subchannel_data* sd, const char* reason) {
   if (sd->subchannel_list->tracer->enabled()) {
     gpr_log(GPR_DEBUG,
@@ -250,7 +250,7 @@ void grpc_lb_subchannel_list_shutdown_and_unref(
     // the callback is responsible for unreffing the subchannel.
     // Otherwise, unref the subchannel directly.
     if (sd->connectivity_notification_pending) {
-      subchannel_data_cancel_connectivity_watch(sd, reason);
+      grpc_lb_subchannel_data_cancel_connectivity_watch(sd, reason);
     } else if (sd->subchannel != nullptr) {
       grpc_lb_subchannel_data_unref_subchannel(sd, reason);
     }
@@ -80,6 +80,12 @@ void grpc_lb_subchannel_data_start_connectivity_watch(
 void grpc_lb_subchannel_data_stop_connectivity_watch(
     grpc_lb_subchannel_data* sd);
 
+/// Cancels a pending connectivity watch.  The connectivity_changed_cb
+/// callback will be invoked with GRPC_ERROR_CANCELLED and is responsible
+/// for unreffing the subchannel.
+void grpc_lb_subchannel_data_cancel_connectivity_watch(
+    grpc_lb_subchannel_data* sd, const char* reason);
+
 struct grpc_lb_subchannel_list {
   /** backpointer to owning policy */
   grpc_lb_policy* policy;
@@ -90,8 +96,9 @@ struct grpc_lb_subchannel_list {
   size_t num_subchannels;
   grpc_lb_subchannel_data* subchannels;
 
-  /** Index into subchannels of the one we're currently checking.
-   * Used when connecting to subchannels serially instead of in parallel. */
+  /** Index into subchannels of the one we most recently started checking.
+   * Used when connecting to subchannels in order (pick_first) instead of
+   * all at once (round_robin). */
   // TODO(roth): When we have time, we can probably make this go away
   // and compute the index dynamically by subtracting
   // subchannel_list->subchannels from the subchannel_data pointer.
@@ -21,6 +21,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/transport/chttp2/server/chttp2_server.h"
+#include "src/core/ext/transport/shm/shm_transport.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/lib/surface/server.h"
@@ -30,9 +31,12 @@ int grpc_server_add_insecure_http2_port(grpc_server* server, const char* addr) {
   int port_num = 0;
   GRPC_API_TRACE("grpc_server_add_insecure_http2_port(server=%p, addr=%s)", 2,
                  (server, addr));
-  grpc_error* err = grpc_chttp2_server_add_port(
-      server, addr,
-      grpc_channel_args_copy(grpc_server_get_channel_args(server)), &port_num);
+  grpc_channel_args* args =
+      grpc_channel_args_copy(grpc_server_get_channel_args(server));
+  grpc_error* err =
+      grpc_shm_is_address(addr)
+          ? grpc_shm_server_add_port(server, addr, args, &port_num)
+          : grpc_chttp2_server_add_port(server, addr, args, &port_num);
   if (err != GRPC_ERROR_NONE) {
     const char* msg = grpc_error_string(err);
     gpr_log(GPR_ERROR, "%s", msg);
@@ -20,6 +20,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 
@@ -82,6 +83,13 @@ bool grpc_base64_decode_partial(struct grpc_base64_decode_context* ctx) {
     return false;
   }
 
+  // Process as many blocks as possible in bulk
+  size_t bulk = grpc_base64_decode_bulk(
+      ctx->input_cur, (size_t)(ctx->input_end - ctx->input_cur),
+      ctx->output_cur, (size_t)(ctx->output_end - ctx->output_cur));
+  ctx->input_cur += bulk;
+  ctx->output_cur += bulk / 4 * 3;
+
   // Process a block of 4 input characters and 3 output bytes
   while (ctx->input_end >= ctx->input_cur + 4 &&
          ctx->output_end >= ctx->output_cur + 3) {
@@ -21,7 +21,9 @@
 #include <string.h>
 
 #include <grpc/support/log.h>
+#include <grpc/support/useful.h>
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+#include "src/core/lib/slice/b64.h"
 
 static const char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -46,6 +48,22 @@ static const b64_huff_sym huff_alphabet[64] = {
 
 static const uint8_t tail_xtra[3] = {0, 2, 3};
 
+/* Encode \a triplets full triplets from \a in to \a out: in bulk first, then
+   byte at a time */
+static void encode_triplets(const uint8_t* in, size_t triplets, char* out) {
+  size_t bulk = grpc_base64_encode_bulk(in, triplets * 3, out, false);
+  in += bulk;
+  out += bulk / 3 * 4;
+  for (size_t i = bulk / 3; i < triplets; i++) {
+    out[0] = alphabet[in[0] >> 2];
+    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
+    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
+    out[3] = alphabet[in[2] & 0x3f];
+    out += 4;
+    in += 3;
+  }
+}
+
 grpc_slice grpc_chttp2_base64_encode(grpc_slice input) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
   size_t input_triplets = input_length / 3;
@@ -54,17 +72,11 @@ grpc_slice grpc_chttp2_base64_encode(grpc_slice input) {
   grpc_slice output = GRPC_SLICE_MALLOC(output_length);
   uint8_t* in = GRPC_SLICE_START_PTR(input);
   char* out = (char*)GRPC_SLICE_START_PTR(output);
-  size_t i;
 
   /* encode full triplets */
-  for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
-    out += 4;
-    in += 3;
-  }
+  encode_triplets(in, input_triplets, out);
+  out += input_triplets * 4;
+  in += input_triplets * 3;
 
   /* encode the remaining bytes */
   switch (tail_case) {
@@ -90,76 +102,114 @@ grpc_slice grpc_chttp2_base64_encode(grpc_slice input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(grpc_slice input) {
-  size_t nbits;
-  uint8_t* in;
+/* Huffman codes are gathered in a 64 bit accumulator, and written out a 64 bit
+   word at a time */
+typedef struct {
+  uint64_t temp;
+  uint32_t temp_length;
   uint8_t* out;
-  grpc_slice output;
-  uint32_t temp = 0;
-  uint32_t temp_length = 0;
+} huff_out;
 
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
+/* Append the \a length (less than 64) bits of \a bits */
+static void enc_add_bits(huff_out* out, uint64_t bits, uint32_t length) {
+  if (out->temp_length + length < 64) {
+    out->temp = (out->temp << length) | bits;
+    out->temp_length += length;
+    return;
   }
+  /* fill the accumulator up, write it out, and keep what did not fit */
+  const uint32_t spill = out->temp_length + length - 64;
+  const uint64_t word =
+      (out->temp << (64 - out->temp_length)) | (bits >> spill);
+  uint8_t* p = out->out;
+  p[0] = (uint8_t)(word >> 56);
+  p[1] = (uint8_t)(word >> 48);
+  p[2] = (uint8_t)(word >> 40);
+  p[3] = (uint8_t)(word >> 32);
+  p[4] = (uint8_t)(word >> 24);
+  p[5] = (uint8_t)(word >> 16);
+  p[6] = (uint8_t)(word >> 8);
+  p[7] = (uint8_t)word;
+  out->out = p + 8;
+  out->temp = bits;
+  out->temp_length = spill;
+}
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = (uint8_t)(temp >> temp_length);
-    }
+/* Write out the remaining bits, padded with the most significant bits of EOS
+   (all ones) */
+static void enc_finish(huff_out* out) {
+  while (out->temp_length >= 8) {
+    out->temp_length -= 8;
+    *out->out++ = (uint8_t)(out->temp >> out->temp_length);
   }
-
-  if (temp_length) {
+  if (out->temp_length) {
     /* NB: the following integer arithmetic operation needs to be in its
      * expanded form due to the "integral promotion" performed (see section
      * 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
      * is then required to avoid the compiler warning */
-    *out++ = (uint8_t)((uint8_t)(temp << (8u - temp_length)) |
-                       (uint8_t)(0xffu >> temp_length));
-  }
-
-  GPR_ASSERT(out == GRPC_SLICE_END_PTR(output));
-
-  return output;
-}
-
-typedef struct {
-  uint32_t temp;
-  uint32_t temp_length;
-  uint8_t* out;
-} huff_out;
-
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = (uint8_t)(out->temp >> out->temp_length);
+    *out->out++ = (uint8_t)((uint8_t)(out->temp << (8u - out->temp_length)) |
+                            (uint8_t)(0xffu >> out->temp_length));
+    out->temp_length = 0;
   }
 }
 
 static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
   b64_huff_sym sa = huff_alphabet[a];
   b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              ((uint32_t)sa.bits << sb.length) | sb.bits;
-  out->temp_length += (uint32_t)sa.length + (uint32_t)sb.length;
-  enc_flush_some(out);
+  enc_add_bits(out, ((uint32_t)sa.bits << sb.length) | sb.bits,
+               (uint32_t)sa.length + (uint32_t)sb.length);
 }
 
 static void enc_add1(huff_out* out, uint8_t a) {
   b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+  enc_add_bits(out, sa.bits, sa.length);
+}
+
+/* Append the huffman codes of \a n (a multiple of 4) base64 characters */
+static void enc_add_chars(huff_out* out, const char* chars, size_t n) {
+  for (size_t i = 0; i < n; i += 4) {
+    const grpc_chttp2_huffsym* s0 = &grpc_chttp2_huffsyms[(uint8_t)chars[i]];
+    const grpc_chttp2_huffsym* s1 =
+        &grpc_chttp2_huffsyms[(uint8_t)chars[i + 1]];
+    const grpc_chttp2_huffsym* s2 =
+        &grpc_chttp2_huffsyms[(uint8_t)chars[i + 2]];
+    const grpc_chttp2_huffsym* s3 =
+        &grpc_chttp2_huffsyms[(uint8_t)chars[i + 3]];
+    /* at most 4 * 11 bits */
+    const uint64_t bits =
+        ((uint64_t)s0->bits << (s1->length + s2->length + s3->length)) |
+        ((uint64_t)s1->bits << (s2->length + s3->length)) |
+        ((uint64_t)s2->bits << s3->length) | s3->bits;
+    enc_add_bits(out, bits, s0->length + s1->length + s2->length + s3->length);
+  }
+}
+
+grpc_slice grpc_chttp2_huffman_compress(grpc_slice input) {
+  size_t nbits;
+  uint8_t* in;
+  grpc_slice output;
+  huff_out out;
+
+  nbits = 0;
+  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
+       ++in) {
+    nbits += grpc_chttp2_huffsyms[*in].length;
+  }
+
+  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
+  out.temp = 0;
+  out.temp_length = 0;
+  out.out = GRPC_SLICE_START_PTR(output);
+  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
+       ++in) {
+    enc_add_bits(&out, grpc_chttp2_huffsyms[*in].bits,
+                 grpc_chttp2_huffsyms[*in].length);
+  }
+  enc_finish(&out);
+
+  GPR_ASSERT(out.out == GRPC_SLICE_END_PTR(output));
+
+  return output;
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(grpc_slice input) {
@@ -173,22 +223,20 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(grpc_slice input) {
   uint8_t* in = GRPC_SLICE_START_PTR(input);
   uint8_t* start_out = GRPC_SLICE_START_PTR(output);
   huff_out out;
-  size_t i;
 
   out.temp = 0;
   out.temp_length = 0;
   out.out = start_out;
 
-  /* encode full triplets */
-  for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = (uint8_t)((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
-
-    const uint8_t a = (uint8_t)((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f);
-    in += 3;
+  /* encode full triplets: base64 encode a chunk of them at a time, then
+     huffman code the characters */
+  while (input_triplets > 0) {
+    char chunk[256];
+    size_t triplets = GPR_MIN(input_triplets, sizeof(chunk) / 4);
+    encode_triplets(in, triplets, chunk);
+    enc_add_chars(&out, chunk, triplets * 4);
+    in += triplets * 3;
+    input_triplets -= triplets;
   }
 
   /* encode the remaining bytes */
@@ -209,14 +257,7 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(grpc_slice input) {
     }
   }
 
-  if (out.temp_length) {
-    /* NB: the following integer arithmetic operation needs to be in its
-     * expanded form due to the "integral promotion" performed (see section
-     * 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-     * is then required to avoid the compiler warning */
-    *out.out++ = (uint8_t)((uint8_t)(out.temp << (8u - out.temp_length)) |
-                           (uint8_t)(0xffu >> out.temp_length));
-  }
+  enc_finish(&out);
 
   GPR_ASSERT(out.out <= GRPC_SLICE_END_PTR(output));
   GRPC_SLICE_SET_LENGTH(output, out.out - start_out);
@@ -160,11 +160,29 @@ bool g_flow_control_enabled = true;
  * CONSTRUCTION/DESTRUCTION/REFCOUNTING
  */
 
+static void free_traced_write(grpc_chttp2_traced_write* w) {
+  for (size_t i = 0; i < w->count; i++) {
+    grpc_network_timeline_unref(w->timelines[i]);
+  }
+  gpr_free(w->timelines);
+  gpr_free(w);
+}
+
 static void destruct_transport(grpc_chttp2_transport* t) {
   size_t i;
 
   grpc_endpoint_destroy(t->ep);
 
+  if (t->timestamping) {
+    /* the endpoint is gone, so no more reports can arrive */
+    while (t->traced_writes_head != nullptr) {
+      grpc_chttp2_traced_write* next = t->traced_writes_head->next;
+      free_traced_write(t->traced_writes_head);
+      t->traced_writes_head = next;
+    }
+    gpr_mu_destroy(&t->timestamps_mu);
+  }
+
   grpc_slice_buffer_destroy_internal(&t->qbuf);
 
   grpc_slice_buffer_destroy_internal(&t->outbuf);
@@ -234,6 +252,102 @@ void grpc_chttp2_unref_transport(grpc_chttp2_transport* t) {
 void grpc_chttp2_ref_transport(grpc_chttp2_transport* t) { gpr_ref(&t->refs); }
 #endif
 
+/*******************************************************************************
+ * KERNEL TIMESTAMPING
+ */
+
+/* Cap on writes awaiting timestamps: the kernel drops reports when the
+   socket's error queue overflows, so the oldest may never be retired */
+#define MAX_TRACED_WRITES 1024
+
+static void tracer_on_read(grpc_endpoint_tracer* tracer, gpr_timespec ts) {
+  grpc_chttp2_transport* t = ((grpc_chttp2_endpoint_tracer*)tracer)->t;
+  gpr_mu_lock(&t->timestamps_mu);
+  t->last_read_timestamp = ts;
+  gpr_mu_unlock(&t->timestamps_mu);
+}
+
+static void tracer_on_write(grpc_endpoint_tracer* tracer, uint64_t seq,
+                            grpc_endpoint_write_stage stage, gpr_timespec ts) {
+  grpc_chttp2_transport* t = ((grpc_chttp2_endpoint_tracer*)tracer)->t;
+  gpr_mu_lock(&t->timestamps_mu);
+  for (grpc_chttp2_traced_write* w = t->traced_writes_head;
+       w != nullptr && w->seq <= seq; w = w->next) {
+    if (w->seq == seq) {
+      for (size_t i = 0; i < w->count; i++) {
+        grpc_network_timeline_note_write(w->timelines[i], stage, ts);
+      }
+    }
+  }
+  if (stage == GRPC_ENDPOINT_WRITE_ACKED) {
+    /* acks are cumulative: no earlier write will report again */
+    while (t->traced_writes_head != nullptr &&
+           t->traced_writes_head->seq <= seq) {
+      grpc_chttp2_traced_write* next = t->traced_writes_head->next;
+      free_traced_write(t->traced_writes_head);
+      t->traced_writes_head = next;
+      t->traced_writes_count--;
+    }
+    if (t->traced_writes_head == nullptr) t->traced_writes_tail = nullptr;
+  }
+  gpr_mu_unlock(&t->timestamps_mu);
+}
+
+static const grpc_endpoint_tracer_vtable tracer_vtable = {tracer_on_read,
+                                                          tracer_on_write};
+
+void grpc_chttp2_note_traced_write(grpc_chttp2_transport* t,
+                                   grpc_network_timeline** timelines,
+                                   size_t count) {
+  uint64_t seq = ++t->write_seq;
+  if (count == 0) {
+    gpr_free(timelines);
+    return;
+  }
+  grpc_chttp2_traced_write* w =
+      (grpc_chttp2_traced_write*)gpr_malloc(sizeof(*w));
+  w->seq = seq;
+  w->timelines = timelines;
+  w->count = count;
+  w->next = nullptr;
+  gpr_mu_lock(&t->timestamps_mu);
+  if (t->traced_writes_tail == nullptr) {
+    t->traced_writes_head = w;
+  } else {
+    t->traced_writes_tail->next = w;
+  }
+  t->traced_writes_tail = w;
+  if (++t->traced_writes_count > MAX_TRACED_WRITES) {
+    grpc_chttp2_traced_write* oldest = t->traced_writes_head;
+    t->traced_writes_head = oldest->next;
+    t->traced_writes_count--;
+    free_traced_write(oldest);
+  }
+  gpr_mu_unlock(&t->timestamps_mu);
+}
+
+static void destroy_network_timeline(void* timeline) {
+  grpc_network_timeline_unref((grpc_network_timeline*)timeline);
+}
+
+/* Share the stream's timeline with the call, or have the stream join the
+   one the call already has (from an earlier attempt). The call only reads it
+   once its batches have completed. */
+static void maybe_trace_stream(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
+                               grpc_transport_stream_op_batch* op) {
+  if (!t->timestamping || op->payload->context == nullptr) return;
+  grpc_call_context_element* ctx =
+      &op->payload->context[GRPC_CONTEXT_NETWORK_TIMELINE];
+  if (ctx->value == nullptr) {
+    if (s->timeline == nullptr) s->timeline = grpc_network_timeline_create();
+    ctx->value = grpc_network_timeline_ref(s->timeline);
+    ctx->destroy = destroy_network_timeline;
+  } else if (s->timeline == nullptr) {
+    s->timeline =
+        grpc_network_timeline_ref((grpc_network_timeline*)ctx->value);
+  }
+}
+
 static const grpc_transport_vtable* get_vtable(void);
 
 static void init_transport(grpc_chttp2_transport* t,
@@ -268,10 +382,10 @@ static void init_transport(grpc_chttp2_transport* t,
   GRPC_CLOSURE_INIT(&t->read_action_locked, read_action_locked, t,
                     grpc_combiner_scheduler(t->combiner));
   GRPC_CLOSURE_INIT(&t->benign_reclaimer_locked, benign_reclaimer_locked, t,
-                    grpc_combiner_scheduler(t->combiner));
+                    grpc_combiner_background_scheduler(t->combiner));
   GRPC_CLOSURE_INIT(&t->destructive_reclaimer_locked,
                     destructive_reclaimer_locked, t,
-                    grpc_combiner_scheduler(t->combiner));
+                    grpc_combiner_background_scheduler(t->combiner));
   GRPC_CLOSURE_INIT(&t->retry_initiate_ping_locked, retry_initiate_ping_locked,
                     t, grpc_combiner_scheduler(t->combiner));
   GRPC_CLOSURE_INIT(&t->start_bdp_ping_locked, start_bdp_ping_locked, t,
@@ -280,9 +394,9 @@ static void init_transport(grpc_chttp2_transport* t,
                     grpc_combiner_scheduler(t->combiner));
   GRPC_CLOSURE_INIT(&t->next_bdp_ping_timer_expired_locked,
                     next_bdp_ping_timer_expired_locked, t,
-                    grpc_combiner_scheduler(t->combiner));
+                    grpc_combiner_background_scheduler(t->combiner));
   GRPC_CLOSURE_INIT(&t->init_keepalive_ping_locked, init_keepalive_ping_locked,
-                    t, grpc_combiner_scheduler(t->combiner));
+                    t, grpc_combiner_background_scheduler(t->combiner));
   GRPC_CLOSURE_INIT(&t->start_keepalive_ping_locked,
                     start_keepalive_ping_locked, t,
                     grpc_combiner_scheduler(t->combiner));
@@ -318,6 +432,10 @@ static void init_transport(grpc_chttp2_transport* t,
   t->force_send_settings = 1 << GRPC_CHTTP2_SETTINGS_INITIAL_WINDOW_SIZE;
   t->sent_local_settings = 0;
   t->write_buffer_size = grpc_core::chttp2::kDefaultWindow;
+  t->write_pacing_size = 0;
+  t->timestamping = false;
+  t->write_seq = 0;
+  t->read_timestamp = gpr_inf_past(GPR_CLOCK_REALTIME);
 
   if (is_client) {
     grpc_slice_buffer_add(&t->outbuf, grpc_slice_from_copied_string(
@@ -424,6 +542,14 @@ static void init_transport(grpc_chttp2_transport* t,
                              GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)) {
         t->write_buffer_size = (uint32_t)grpc_channel_arg_get_integer(
             &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE});
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_NOTSENT_LOWAT)) {
+        t->write_pacing_size = (uint32_t)grpc_channel_arg_get_integer(
+            &channel_args->args[i], {0, 0, INT_MAX});
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TIMESTAMPING)) {
+        t->timestamping =
+            grpc_channel_arg_get_bool(&channel_args->args[i], false);
       } else if (0 ==
                  strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_BDP_PROBE)) {
         enable_bdp = grpc_channel_arg_get_bool(&channel_args->args[i], true);
@@ -529,6 +655,19 @@ static void init_transport(grpc_chttp2_transport* t,
     enable_bdp = false;
   }
 
+  if (t->timestamping) {
+    gpr_mu_init(&t->timestamps_mu);
+    t->traced_writes_head = t->traced_writes_tail = nullptr;
+    t->traced_writes_count = 0;
+    t->last_read_timestamp = gpr_inf_past(GPR_CLOCK_REALTIME);
+    t->tracer.base.vtable = &tracer_vtable;
+    t->tracer.t = t;
+    if (!grpc_endpoint_set_tracer(t->ep, &t->tracer.base)) {
+      gpr_mu_destroy(&t->timestamps_mu);
+      t->timestamping = false;
+    }
+  }
+
   /* No pings allowed before receiving a header or data frame. */
   t->ping_state.pings_before_data_required = 0;
   t->ping_state.is_delayed_ping_timer_set = false;
@@ -680,6 +819,7 @@ static int init_stream(grpc_transport* gt, grpc_stream* gs,
   grpc_slice_buffer_init(&s->decompressed_data_buffer);
   s->pending_byte_stream = false;
   s->decompressed_header_bytes = 0;
+  s->timeline = nullptr;
   GRPC_CLOSURE_INIT(&s->reset_byte_stream, reset_byte_stream, s,
                     grpc_combiner_scheduler(t->combiner));
 
@@ -743,6 +883,9 @@ static void destroy_stream_locked(void* sp, grpc_error* error) {
   GRPC_ERROR_UNREF(s->read_closed_error);
   GRPC_ERROR_UNREF(s->write_closed_error);
   GRPC_ERROR_UNREF(s->byte_stream_error);
+  if (s->timeline != nullptr) {
+    grpc_network_timeline_unref(s->timeline);
+  }
 
   s->flow_control.Destroy();
 
@@ -1336,6 +1479,8 @@ static void perform_stream_op_locked(void* stream_op,
 
   GRPC_STATS_INC_HTTP2_OP_BATCHES();
 
+  maybe_trace_stream(t, s, op);
+
   if (grpc_http_trace.enabled()) {
     char* str = grpc_transport_stream_op_batch_string(op);
     gpr_log(GPR_DEBUG, "perform_stream_op_locked: %s; on_complete = %p", str,
@@ -2404,6 +2549,11 @@ static void read_action_locked(void* tp, grpc_error* error) {
   GRPC_ERROR_UNREF(err);
   if (t->closed_with_error == GRPC_ERROR_NONE) {
     GPR_TIMER_SCOPE("reading_action.parse", 0);
+    if (t->timestamping) {
+      gpr_mu_lock(&t->timestamps_mu);
+      t->read_timestamp = t->last_read_timestamp;
+      gpr_mu_unlock(&t->timestamps_mu);
+    }
     size_t i = 0;
     grpc_error* errors[3] = {GRPC_ERROR_REF(error), GRPC_ERROR_NONE,
                              GRPC_ERROR_NONE};
@@ -227,377 +227,313 @@ static const uint8_t first_byte_lut[256] = {
     INDEXED_FIELD,   INDEXED_FIELD, INDEXED_FIELD, INDEXED_FIELD_X,
 };
 
-/* state table for huffman decoding: given a state, gives an index/16 into
-   next_sub_tbl. Taking that index and adding the value of the nibble being
-   considered returns the next state.
-
-   generated by gen_hpack_tables.c */
-static const uint8_t next_tbl[256] = {
-    0,  1,  2,  3,  4,  1,  2, 5,  6,  1, 7,  8,  1,  3,  3,  9,  10, 11, 1,  1,
-    1,  12, 1,  2,  13, 1,  1, 1,  1,  1, 1,  1,  1,  1,  1,  1,  1,  1,  1,  2,
-    14, 1,  15, 16, 1,  17, 1, 15, 2,  7, 3,  18, 19, 1,  1,  1,  1,  20, 1,  1,
-    1,  1,  1,  1,  1,  1,  1, 1,  15, 2, 2,  7,  21, 1,  22, 1,  1,  1,  1,  1,
-    1,  1,  1,  15, 2,  2,  2, 2,  2,  2, 23, 24, 25, 1,  1,  1,  1,  2,  2,  2,
-    26, 3,  3,  27, 10, 28, 1, 1,  1,  1, 1,  1,  2,  3,  29, 10, 30, 1,  1,  1,
-    1,  1,  1,  1,  1,  1,  1, 1,  1,  1, 1,  31, 1,  1,  1,  1,  1,  1,  1,  2,
-    2,  2,  2,  2,  2,  2,  2, 32, 1,  1, 15, 33, 1,  34, 35, 9,  36, 1,  1,  1,
-    1,  1,  1,  1,  37, 1,  1, 1,  1,  1, 1,  2,  2,  2,  2,  2,  2,  2,  26, 9,
-    38, 1,  1,  1,  1,  1,  1, 1,  15, 2, 2,  2,  2,  26, 3,  3,  39, 1,  1,  1,
-    1,  1,  1,  1,  1,  1,  1, 1,  2,  2, 2,  2,  2,  2,  7,  3,  3,  3,  40, 2,
-    41, 1,  1,  1,  42, 43, 1, 1,  44, 1, 1,  1,  1,  15, 2,  2,  2,  2,  2,  2,
-    3,  3,  3,  45, 46, 1,  1, 2,  2,  2, 35, 3,  3,  18, 47, 2,
+/* huffman decoding: looking the next HUFF_FAST_BITS bits of the stream up in
+   huff_fast_tbl decodes the symbols whose codes fit in them, up to two at a
+   time. Each entry holds the first symbol in bits 0-7, the second one in bits
+   8-15, the length of the first code in bits 16-19 (0 if it does not fit) and
+   the length of both codes in bits 20-23 (0 if the second one does not fit).
+
+   generated by gen_hpack_tables.cc */
+#define HUFF_FAST_BITS 11
+#define HUFF_MAX_CODE_LENGTH 30
+static const uint32_t huff_fast_tbl[1 << HUFF_FAST_BITS] = {
+    0xa53030, 0xa53030, 0xa53130, 0xa53130, 0xa53230, 0xa53230, 0xa56130,
+    0xa56130, 0xa56330, 0xa56330, 0xa56530, 0xa56530, 0xa56930, 0xa56930,
+    0xa56f30, 0xa56f30, 0xa57330, 0xa57330, 0xa57430, 0xa57430, 0xb52030,
+    0xb52530, 0xb52d30, 0xb52e30, 0xb52f30, 0xb53330, 0xb53430, 0xb53530,
+    0xb53630, 0xb53730, 0xb53830, 0xb53930, 0xb53d30, 0xb54130, 0xb55f30,
+    0xb56230, 0xb56430, 0xb56630, 0xb56730, 0xb56830, 0xb56c30, 0xb56d30,
+    0xb56e30, 0xb57030, 0xb57230, 0xb57530, 0x50030, 0x50030, 0x50030, 0x50030,
+    0x50030, 0x50030, 0x50030, 0x50030, 0x50030, 0x50030, 0x50030, 0x50030,
+    0x50030, 0x50030, 0x50030, 0x50030, 0x50030, 0x50030, 0xa53031, 0xa53031,
+    0xa53131, 0xa53131, 0xa53231, 0xa53231, 0xa56131, 0xa56131, 0xa56331,
+    0xa56331, 0xa56531, 0xa56531, 0xa56931, 0xa56931, 0xa56f31, 0xa56f31,
+    0xa57331, 0xa57331, 0xa57431, 0xa57431, 0xb52031, 0xb52531, 0xb52d31,
+    0xb52e31, 0xb52f31, 0xb53331, 0xb53431, 0xb53531, 0xb53631, 0xb53731,
+    0xb53831, 0xb53931, 0xb53d31, 0xb54131, 0xb55f31, 0xb56231, 0xb56431,
+    0xb56631, 0xb56731, 0xb56831, 0xb56c31, 0xb56d31, 0xb56e31, 0xb57031,
+    0xb57231, 0xb57531, 0x50031, 0x50031, 0x50031, 0x50031, 0x50031, 0x50031,
+    0x50031, 0x50031, 0x50031, 0x50031, 0x50031, 0x50031, 0x50031, 0x50031,
+    0x50031, 0x50031, 0x50031, 0x50031, 0xa53032, 0xa53032, 0xa53132, 0xa53132,
+    0xa53232, 0xa53232, 0xa56132, 0xa56132, 0xa56332, 0xa56332, 0xa56532,
+    0xa56532, 0xa56932, 0xa56932, 0xa56f32, 0xa56f32, 0xa57332, 0xa57332,
+    0xa57432, 0xa57432, 0xb52032, 0xb52532, 0xb52d32, 0xb52e32, 0xb52f32,
+    0xb53332, 0xb53432, 0xb53532, 0xb53632, 0xb53732, 0xb53832, 0xb53932,
+    0xb53d32, 0xb54132, 0xb55f32, 0xb56232, 0xb56432, 0xb56632, 0xb56732,
+    0xb56832, 0xb56c32, 0xb56d32, 0xb56e32, 0xb57032, 0xb57232, 0xb57532,
+    0x50032, 0x50032, 0x50032, 0x50032, 0x50032, 0x50032, 0x50032, 0x50032,
+    0x50032, 0x50032, 0x50032, 0x50032, 0x50032, 0x50032, 0x50032, 0x50032,
+    0x50032, 0x50032, 0xa53061, 0xa53061, 0xa53161, 0xa53161, 0xa53261,
+    0xa53261, 0xa56161, 0xa56161, 0xa56361, 0xa56361, 0xa56561, 0xa56561,
+    0xa56961, 0xa56961, 0xa56f61, 0xa56f61, 0xa57361, 0xa57361, 0xa57461,
+    0xa57461, 0xb52061, 0xb52561, 0xb52d61, 0xb52e61, 0xb52f61, 0xb53361,
+    0xb53461, 0xb53561, 0xb53661, 0xb53761, 0xb53861, 0xb53961, 0xb53d61,
+    0xb54161, 0xb55f61, 0xb56261, 0xb56461, 0xb56661, 0xb56761, 0xb56861,
+    0xb56c61, 0xb56d61, 0xb56e61, 0xb57061, 0xb57261, 0xb57561, 0x50061,
+    0x50061, 0x50061, 0x50061, 0x50061, 0x50061, 0x50061, 0x50061, 0x50061,
+    0x50061, 0x50061, 0x50061, 0x50061, 0x50061, 0x50061, 0x50061, 0x50061,
+    0x50061, 0xa53063, 0xa53063, 0xa53163, 0xa53163, 0xa53263, 0xa53263,
+    0xa56163, 0xa56163, 0xa56363, 0xa56363, 0xa56563, 0xa56563, 0xa56963,
+    0xa56963, 0xa56f63, 0xa56f63, 0xa57363, 0xa57363, 0xa57463, 0xa57463,
+    0xb52063, 0xb52563, 0xb52d63, 0xb52e63, 0xb52f63, 0xb53363, 0xb53463,
+    0xb53563, 0xb53663, 0xb53763, 0xb53863, 0xb53963, 0xb53d63, 0xb54163,
+    0xb55f63, 0xb56263, 0xb56463, 0xb56663, 0xb56763, 0xb56863, 0xb56c63,
+    0xb56d63, 0xb56e63, 0xb57063, 0xb57263, 0xb57563, 0x50063, 0x50063, 0x50063,
+    0x50063, 0x50063, 0x50063, 0x50063, 0x50063, 0x50063, 0x50063, 0x50063,
+    0x50063, 0x50063, 0x50063, 0x50063, 0x50063, 0x50063, 0x50063, 0xa53065,
+    0xa53065, 0xa53165, 0xa53165, 0xa53265, 0xa53265, 0xa56165, 0xa56165,
+    0xa56365, 0xa56365, 0xa56565, 0xa56565, 0xa56965, 0xa56965, 0xa56f65,
+    0xa56f65, 0xa57365, 0xa57365, 0xa57465, 0xa57465, 0xb52065, 0xb52565,
+    0xb52d65, 0xb52e65, 0xb52f65, 0xb53365, 0xb53465, 0xb53565, 0xb53665,
+    0xb53765, 0xb53865, 0xb53965, 0xb53d65, 0xb54165, 0xb55f65, 0xb56265,
+    0xb56465, 0xb56665, 0xb56765, 0xb56865, 0xb56c65, 0xb56d65, 0xb56e65,
+    0xb57065, 0xb57265, 0xb57565, 0x50065, 0x50065, 0x50065, 0x50065, 0x50065,
+    0x50065, 0x50065, 0x50065, 0x50065, 0x50065, 0x50065, 0x50065, 0x50065,
+    0x50065, 0x50065, 0x50065, 0x50065, 0x50065, 0xa53069, 0xa53069, 0xa53169,
+    0xa53169, 0xa53269, 0xa53269, 0xa56169, 0xa56169, 0xa56369, 0xa56369,
+    0xa56569, 0xa56569, 0xa56969, 0xa56969, 0xa56f69, 0xa56f69, 0xa57369,
+    0xa57369, 0xa57469, 0xa57469, 0xb52069, 0xb52569, 0xb52d69, 0xb52e69,
+    0xb52f69, 0xb53369, 0xb53469, 0xb53569, 0xb53669, 0xb53769, 0xb53869,
+    0xb53969, 0xb53d69, 0xb54169, 0xb55f69, 0xb56269, 0xb56469, 0xb56669,
+    0xb56769, 0xb56869, 0xb56c69, 0xb56d69, 0xb56e69, 0xb57069, 0xb57269,
+    0xb57569, 0x50069, 0x50069, 0x50069, 0x50069, 0x50069, 0x50069, 0x50069,
+    0x50069, 0x50069, 0x50069, 0x50069, 0x50069, 0x50069, 0x50069, 0x50069,
+    0x50069, 0x50069, 0x50069, 0xa5306f, 0xa5306f, 0xa5316f, 0xa5316f, 0xa5326f,
+    0xa5326f, 0xa5616f, 0xa5616f, 0xa5636f, 0xa5636f, 0xa5656f, 0xa5656f,
+    0xa5696f, 0xa5696f, 0xa56f6f, 0xa56f6f, 0xa5736f, 0xa5736f, 0xa5746f,
+    0xa5746f, 0xb5206f, 0xb5256f, 0xb52d6f, 0xb52e6f, 0xb52f6f, 0xb5336f,
+    0xb5346f, 0xb5356f, 0xb5366f, 0xb5376f, 0xb5386f, 0xb5396f, 0xb53d6f,
+    0xb5416f, 0xb55f6f, 0xb5626f, 0xb5646f, 0xb5666f, 0xb5676f, 0xb5686f,
+    0xb56c6f, 0xb56d6f, 0xb56e6f, 0xb5706f, 0xb5726f, 0xb5756f, 0x5006f,
+    0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f,
+    0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f, 0x5006f,
+    0x5006f, 0xa53073, 0xa53073, 0xa53173, 0xa53173, 0xa53273, 0xa53273,
+    0xa56173, 0xa56173, 0xa56373, 0xa56373, 0xa56573, 0xa56573, 0xa56973,
+    0xa56973, 0xa56f73, 0xa56f73, 0xa57373, 0xa57373, 0xa57473, 0xa57473,
+    0xb52073, 0xb52573, 0xb52d73, 0xb52e73, 0xb52f73, 0xb53373, 0xb53473,
+    0xb53573, 0xb53673, 0xb53773, 0xb53873, 0xb53973, 0xb53d73, 0xb54173,
+    0xb55f73, 0xb56273, 0xb56473, 0xb56673, 0xb56773, 0xb56873, 0xb56c73,
+    0xb56d73, 0xb56e73, 0xb57073, 0xb57273, 0xb57573, 0x50073, 0x50073, 0x50073,
+    0x50073, 0x50073, 0x50073, 0x50073, 0x50073, 0x50073, 0x50073, 0x50073,
+    0x50073, 0x50073, 0x50073, 0x50073, 0x50073, 0x50073, 0x50073, 0xa53074,
+    0xa53074, 0xa53174, 0xa53174, 0xa53274, 0xa53274, 0xa56174, 0xa56174,
+    0xa56374, 0xa56374, 0xa56574, 0xa56574, 0xa56974, 0xa56974, 0xa56f74,
+    0xa56f74, 0xa57374, 0xa57374, 0xa57474, 0xa57474, 0xb52074, 0xb52574,
+    0xb52d74, 0xb52e74, 0xb52f74, 0xb53374, 0xb53474, 0xb53574, 0xb53674,
+    0xb53774, 0xb53874, 0xb53974, 0xb53d74, 0xb54174, 0xb55f74, 0xb56274,
+    0xb56474, 0xb56674, 0xb56774, 0xb56874, 0xb56c74, 0xb56d74, 0xb56e74,
+    0xb57074, 0xb57274, 0xb57574, 0x50074, 0x50074, 0x50074, 0x50074, 0x50074,
+    0x50074, 0x50074, 0x50074, 0x50074, 0x50074, 0x50074, 0x50074, 0x50074,
+    0x50074, 0x50074, 0x50074, 0x50074, 0x50074, 0xb63020, 0xb63120, 0xb63220,
+    0xb66120, 0xb66320, 0xb66520, 0xb66920, 0xb66f20, 0xb67320, 0xb67420,
+    0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0x60020,
+    0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0x60020,
+    0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0x60020, 0xb63025, 0xb63125,
+    0xb63225, 0xb66125, 0xb66325, 0xb66525, 0xb66925, 0xb66f25, 0xb67325,
+    0xb67425, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025,
+    0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025,
+    0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0x60025, 0xb6302d,
+    0xb6312d, 0xb6322d, 0xb6612d, 0xb6632d, 0xb6652d, 0xb6692d, 0xb66f2d,
+    0xb6732d, 0xb6742d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d,
+    0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d,
+    0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d, 0x6002d,
+    0xb6302e, 0xb6312e, 0xb6322e, 0xb6612e, 0xb6632e, 0xb6652e, 0xb6692e,
+    0xb66f2e, 0xb6732e, 0xb6742e, 0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e,
+    0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e,
+    0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e, 0x6002e,
+    0x6002e, 0xb6302f, 0xb6312f, 0xb6322f, 0xb6612f, 0xb6632f, 0xb6652f,
+    0xb6692f, 0xb66f2f, 0xb6732f, 0xb6742f, 0x6002f, 0x6002f, 0x6002f, 0x6002f,
+    0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f,
+    0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f, 0x6002f,
+    0x6002f, 0x6002f, 0xb63033, 0xb63133, 0xb63233, 0xb66133, 0xb66333,
+    0xb66533, 0xb66933, 0xb66f33, 0xb67333, 0xb67433, 0x60033, 0x60033, 0x60033,
+    0x60033, 0x60033, 0x60033, 0x60033, 0x60033, 0x60033, 0x60033, 0x60033,
+    0x60033, 0x60033, 0x60033, 0x60033, 0x60033, 0x60033, 0x60033, 0x60033,
+    0x60033, 0x60033, 0x60033, 0xb63034, 0xb63134, 0xb63234, 0xb66134, 0xb66334,
+    0xb66534, 0xb66934, 0xb66f34, 0xb67334, 0xb67434, 0x60034, 0x60034, 0x60034,
+    0x60034, 0x60034, 0x60034, 0x60034, 0x60034, 0x60034, 0x60034, 0x60034,
+    0x60034, 0x60034, 0x60034, 0x60034, 0x60034, 0x60034, 0x60034, 0x60034,
+    0x60034, 0x60034, 0x60034, 0xb63035, 0xb63135, 0xb63235, 0xb66135, 0xb66335,
+    0xb66535, 0xb66935, 0xb66f35, 0xb67335, 0xb67435, 0x60035, 0x60035, 0x60035,
+    0x60035, 0x60035, 0x60035, 0x60035, 0x60035, 0x60035, 0x60035, 0x60035,
+    0x60035, 0x60035, 0x60035, 0x60035, 0x60035, 0x60035, 0x60035, 0x60035,
+    0x60035, 0x60035, 0x60035, 0xb63036, 0xb63136, 0xb63236, 0xb66136, 0xb66336,
+    0xb66536, 0xb66936, 0xb66f36, 0xb67336, 0xb67436, 0x60036, 0x60036, 0x60036,
+    0x60036, 0x60036, 0x60036, 0x60036, 0x60036, 0x60036, 0x60036, 0x60036,
+    0x60036, 0x60036, 0x60036, 0x60036, 0x60036, 0x60036, 0x60036, 0x60036,
+    0x60036, 0x60036, 0x60036, 0xb63037, 0xb63137, 0xb63237, 0xb66137, 0xb66337,
+    0xb66537, 0xb66937, 0xb66f37, 0xb67337, 0xb67437, 0x60037, 0x60037, 0x60037,
+    0x60037, 0x60037, 0x60037, 0x60037, 0x60037, 0x60037, 0x60037, 0x60037,
+    0x60037, 0x60037, 0x60037, 0x60037, 0x60037, 0x60037, 0x60037, 0x60037,
+    0x60037, 0x60037, 0x60037, 0xb63038, 0xb63138, 0xb63238, 0xb66138, 0xb66338,
+    0xb66538, 0xb66938, 0xb66f38, 0xb67338, 0xb67438, 0x60038, 0x60038, 0x60038,
+    0x60038, 0x60038, 0x60038, 0x60038, 0x60038, 0x60038, 0x60038, 0x60038,
+    0x60038, 0x60038, 0x60038, 0x60038, 0x60038, 0x60038, 0x60038, 0x60038,
+    0x60038, 0x60038, 0x60038, 0xb63039, 0xb63139, 0xb63239, 0xb66139, 0xb66339,
+    0xb66539, 0xb66939, 0xb66f39, 0xb67339, 0xb67439, 0x60039, 0x60039, 0x60039,
+    0x60039, 0x60039, 0x60039, 0x60039, 0x60039, 0x60039, 0x60039, 0x60039,
+    0x60039, 0x60039, 0x60039, 0x60039, 0x60039, 0x60039, 0x60039, 0x60039,
+    0x60039, 0x60039, 0x60039, 0xb6303d, 0xb6313d, 0xb6323d, 0xb6613d, 0xb6633d,
+    0xb6653d, 0xb6693d, 0xb66f3d, 0xb6733d, 0xb6743d, 0x6003d, 0x6003d, 0x6003d,
+    0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d,
+    0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d, 0x6003d,
+    0x6003d, 0x6003d, 0x6003d, 0xb63041, 0xb63141, 0xb63241, 0xb66141, 0xb66341,
+    0xb66541, 0xb66941, 0xb66f41, 0xb67341, 0xb67441, 0x60041, 0x60041, 0x60041,
+    0x60041, 0x60041, 0x60041, 0x60041, 0x60041, 0x60041, 0x60041, 0x60041,
+    0x60041, 0x60041, 0x60041, 0x60041, 0x60041, 0x60041, 0x60041, 0x60041,
+    0x60041, 0x60041, 0x60041, 0xb6305f, 0xb6315f, 0xb6325f, 0xb6615f, 0xb6635f,
+    0xb6655f, 0xb6695f, 0xb66f5f, 0xb6735f, 0xb6745f, 0x6005f, 0x6005f, 0x6005f,
+    0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f,
+    0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f, 0x6005f,
+    0x6005f, 0x6005f, 0x6005f, 0xb63062, 0xb63162, 0xb63262, 0xb66162, 0xb66362,
+    0xb66562, 0xb66962, 0xb66f62, 0xb67362, 0xb67462, 0x60062, 0x60062, 0x60062,
+    0x60062, 0x60062, 0x60062, 0x60062, 0x60062, 0x60062, 0x60062, 0x60062,
+    0x60062, 0x60062, 0x60062, 0x60062, 0x60062, 0x60062, 0x60062, 0x60062,
+    0x60062, 0x60062, 0x60062, 0xb63064, 0xb63164, 0xb63264, 0xb66164, 0xb66364,
+    0xb66564, 0xb66964, 0xb66f64, 0xb67364, 0xb67464, 0x60064, 0x60064, 0x60064,
+    0x60064, 0x60064, 0x60064, 0x60064, 0x60064, 0x60064, 0x60064, 0x60064,
+    0x60064, 0x60064, 0x60064, 0x60064, 0x60064, 0x60064, 0x60064, 0x60064,
+    0x60064, 0x60064, 0x60064, 0xb63066, 0xb63166, 0xb63266, 0xb66166, 0xb66366,
+    0xb66566, 0xb66966, 0xb66f66, 0xb67366, 0xb67466, 0x60066, 0x60066, 0x60066,
+    0x60066, 0x60066, 0x60066, 0x60066, 0x60066, 0x60066, 0x60066, 0x60066,
+    0x60066, 0x60066, 0x60066, 0x60066, 0x60066, 0x60066, 0x60066, 0x60066,
+    0x60066, 0x60066, 0x60066, 0xb63067, 0xb63167, 0xb63267, 0xb66167, 0xb66367,
+    0xb66567, 0xb66967, 0xb66f67, 0xb67367, 0xb67467, 0x60067, 0x60067, 0x60067,
+    0x60067, 0x60067, 0x60067, 0x60067, 0x60067, 0x60067, 0x60067, 0x60067,
+    0x60067, 0x60067, 0x60067, 0x60067, 0x60067, 0x60067, 0x60067, 0x60067,
+    0x60067, 0x60067, 0x60067, 0xb63068, 0xb63168, 0xb63268, 0xb66168, 0xb66368,
+    0xb66568, 0xb66968, 0xb66f68, 0xb67368, 0xb67468, 0x60068, 0x60068, 0x60068,
+    0x60068, 0x60068, 0x60068, 0x60068, 0x60068, 0x60068, 0x60068, 0x60068,
+    0x60068, 0x60068, 0x60068, 0x60068, 0x60068, 0x60068, 0x60068, 0x60068,
+    0x60068, 0x60068, 0x60068, 0xb6306c, 0xb6316c, 0xb6326c, 0xb6616c, 0xb6636c,
+    0xb6656c, 0xb6696c, 0xb66f6c, 0xb6736c, 0xb6746c, 0x6006c, 0x6006c, 0x6006c,
+    0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c,
+    0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c, 0x6006c,
+    0x6006c, 0x6006c, 0x6006c, 0xb6306d, 0xb6316d, 0xb6326d, 0xb6616d, 0xb6636d,
+    0xb6656d, 0xb6696d, 0xb66f6d, 0xb6736d, 0xb6746d, 0x6006d, 0x6006d, 0x6006d,
+    0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d,
+    0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d, 0x6006d,
+    0x6006d, 0x6006d, 0x6006d, 0xb6306e, 0xb6316e, 0xb6326e, 0xb6616e, 0xb6636e,
+    0xb6656e, 0xb6696e, 0xb66f6e, 0xb6736e, 0xb6746e, 0x6006e, 0x6006e, 0x6006e,
+    0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e,
+    0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e, 0x6006e,
+    0x6006e, 0x6006e, 0x6006e, 0xb63070, 0xb63170, 0xb63270, 0xb66170, 0xb66370,
+    0xb66570, 0xb66970, 0xb66f70, 0xb67370, 0xb67470, 0x60070, 0x60070, 0x60070,
+    0x60070, 0x60070, 0x60070, 0x60070, 0x60070, 0x60070, 0x60070, 0x60070,
+    0x60070, 0x60070, 0x60070, 0x60070, 0x60070, 0x60070, 0x60070, 0x60070,
+    0x60070, 0x60070, 0x60070, 0xb63072, 0xb63172, 0xb63272, 0xb66172, 0xb66372,
+    0xb66572, 0xb66972, 0xb66f72, 0xb67372, 0xb67472, 0x60072, 0x60072, 0x60072,
+    0x60072, 0x60072, 0x60072, 0x60072, 0x60072, 0x60072, 0x60072, 0x60072,
+    0x60072, 0x60072, 0x60072, 0x60072, 0x60072, 0x60072, 0x60072, 0x60072,
+    0x60072, 0x60072, 0x60072, 0xb63075, 0xb63175, 0xb63275, 0xb66175, 0xb66375,
+    0xb66575, 0xb66975, 0xb66f75, 0xb67375, 0xb67475, 0x60075, 0x60075, 0x60075,
+    0x60075, 0x60075, 0x60075, 0x60075, 0x60075, 0x60075, 0x60075, 0x60075,
+    0x60075, 0x60075, 0x60075, 0x60075, 0x60075, 0x60075, 0x60075, 0x60075,
+    0x60075, 0x60075, 0x60075, 0x7003a, 0x7003a, 0x7003a, 0x7003a, 0x7003a,
+    0x7003a, 0x7003a, 0x7003a, 0x7003a, 0x7003a, 0x7003a, 0x7003a, 0x7003a,
+    0x7003a, 0x7003a, 0x7003a, 0x70042, 0x70042, 0x70042, 0x70042, 0x70042,
+    0x70042, 0x70042, 0x70042, 0x70042, 0x70042, 0x70042, 0x70042, 0x70042,
+    0x70042, 0x70042, 0x70042, 0x70043, 0x70043, 0x70043, 0x70043, 0x70043,
+    0x70043, 0x70043, 0x70043, 0x70043, 0x70043, 0x70043, 0x70043, 0x70043,
+    0x70043, 0x70043, 0x70043, 0x70044, 0x70044, 0x70044, 0x70044, 0x70044,
+    0x70044, 0x70044, 0x70044, 0x70044, 0x70044, 0x70044, 0x70044, 0x70044,
+    0x70044, 0x70044, 0x70044, 0x70045, 0x70045, 0x70045, 0x70045, 0x70045,
+    0x70045, 0x70045, 0x70045, 0x70045, 0x70045, 0x70045, 0x70045, 0x70045,
+    0x70045, 0x70045, 0x70045, 0x70046, 0x70046, 0x70046, 0x70046, 0x70046,
+    0x70046, 0x70046, 0x70046, 0x70046, 0x70046, 0x70046, 0x70046, 0x70046,
+    0x70046, 0x70046, 0x70046, 0x70047, 0x70047, 0x70047, 0x70047, 0x70047,
+    0x70047, 0x70047, 0x70047, 0x70047, 0x70047, 0x70047, 0x70047, 0x70047,
+    0x70047, 0x70047, 0x70047, 0x70048, 0x70048, 0x70048, 0x70048, 0x70048,
+    0x70048, 0x70048, 0x70048, 0x70048, 0x70048, 0x70048, 0x70048, 0x70048,
+    0x70048, 0x70048, 0x70048, 0x70049, 0x70049, 0x70049, 0x70049, 0x70049,
+    0x70049, 0x70049, 0x70049, 0x70049, 0x70049, 0x70049, 0x70049, 0x70049,
+    0x70049, 0x70049, 0x70049, 0x7004a, 0x7004a, 0x7004a, 0x7004a, 0x7004a,
+    0x7004a, 0x7004a, 0x7004a, 0x7004a, 0x7004a, 0x7004a, 0x7004a, 0x7004a,
+    0x7004a, 0x7004a, 0x7004a, 0x7004b, 0x7004b, 0x7004b, 0x7004b, 0x7004b,
+    0x7004b, 0x7004b, 0x7004b, 0x7004b, 0x7004b, 0x7004b, 0x7004b, 0x7004b,
+    0x7004b, 0x7004b, 0x7004b, 0x7004c, 0x7004c, 0x7004c, 0x7004c, 0x7004c,
+    0x7004c, 0x7004c, 0x7004c, 0x7004c, 0x7004c, 0x7004c, 0x7004c, 0x7004c,
+    0x7004c, 0x7004c, 0x7004c, 0x7004d, 0x7004d, 0x7004d, 0x7004d, 0x7004d,
+    0x7004d, 0x7004d, 0x7004d, 0x7004d, 0x7004d, 0x7004d, 0x7004d, 0x7004d,
+    0x7004d, 0x7004d, 0x7004d, 0x7004e, 0x7004e, 0x7004e, 0x7004e, 0x7004e,
+    0x7004e, 0x7004e, 0x7004e, 0x7004e, 0x7004e, 0x7004e, 0x7004e, 0x7004e,
+    0x7004e, 0x7004e, 0x7004e, 0x7004f, 0x7004f, 0x7004f, 0x7004f, 0x7004f,
+    0x7004f, 0x7004f, 0x7004f, 0x7004f, 0x7004f, 0x7004f, 0x7004f, 0x7004f,
+    0x7004f, 0x7004f, 0x7004f, 0x70050, 0x70050, 0x70050, 0x70050, 0x70050,
+    0x70050, 0x70050, 0x70050, 0x70050, 0x70050, 0x70050, 0x70050, 0x70050,
+    0x70050, 0x70050, 0x70050, 0x70051, 0x70051, 0x70051, 0x70051, 0x70051,
+    0x70051, 0x70051, 0x70051, 0x70051, 0x70051, 0x70051, 0x70051, 0x70051,
+    0x70051, 0x70051, 0x70051, 0x70052, 0x70052, 0x70052, 0x70052, 0x70052,
+    0x70052, 0x70052, 0x70052, 0x70052, 0x70052, 0x70052, 0x70052, 0x70052,
+    0x70052, 0x70052, 0x70052, 0x70053, 0x70053, 0x70053, 0x70053, 0x70053,
+    0x70053, 0x70053, 0x70053, 0x70053, 0x70053, 0x70053, 0x70053, 0x70053,
+    0x70053, 0x70053, 0x70053, 0x70054, 0x70054, 0x70054, 0x70054, 0x70054,
+    0x70054, 0x70054, 0x70054, 0x70054, 0x70054, 0x70054, 0x70054, 0x70054,
+    0x70054, 0x70054, 0x70054, 0x70055, 0x70055, 0x70055, 0x70055, 0x70055,
+    0x70055, 0x70055, 0x70055, 0x70055, 0x70055, 0x70055, 0x70055, 0x70055,
+    0x70055, 0x70055, 0x70055, 0x70056, 0x70056, 0x70056, 0x70056, 0x70056,
+    0x70056, 0x70056, 0x70056, 0x70056, 0x70056, 0x70056, 0x70056, 0x70056,
+    0x70056, 0x70056, 0x70056, 0x70057, 0x70057, 0x70057, 0x70057, 0x70057,
+    0x70057, 0x70057, 0x70057, 0x70057, 0x70057, 0x70057, 0x70057, 0x70057,
+    0x70057, 0x70057, 0x70057, 0x70059, 0x70059, 0x70059, 0x70059, 0x70059,
+    0x70059, 0x70059, 0x70059, 0x70059, 0x70059, 0x70059, 0x70059, 0x70059,
+    0x70059, 0x70059, 0x70059, 0x7006a, 0x7006a, 0x7006a, 0x7006a, 0x7006a,
+    0x7006a, 0x7006a, 0x7006a, 0x7006a, 0x7006a, 0x7006a, 0x7006a, 0x7006a,
+    0x7006a, 0x7006a, 0x7006a, 0x7006b, 0x7006b, 0x7006b, 0x7006b, 0x7006b,
+    0x7006b, 0x7006b, 0x7006b, 0x7006b, 0x7006b, 0x7006b, 0x7006b, 0x7006b,
+    0x7006b, 0x7006b, 0x7006b, 0x70071, 0x70071, 0x70071, 0x70071, 0x70071,
+    0x70071, 0x70071, 0x70071, 0x70071, 0x70071, 0x70071, 0x70071, 0x70071,
+    0x70071, 0x70071, 0x70071, 0x70076, 0x70076, 0x70076, 0x70076, 0x70076,
+    0x70076, 0x70076, 0x70076, 0x70076, 0x70076, 0x70076, 0x70076, 0x70076,
+    0x70076, 0x70076, 0x70076, 0x70077, 0x70077, 0x70077, 0x70077, 0x70077,
+    0x70077, 0x70077, 0x70077, 0x70077, 0x70077, 0x70077, 0x70077, 0x70077,
+    0x70077, 0x70077, 0x70077, 0x70078, 0x70078, 0x70078, 0x70078, 0x70078,
+    0x70078, 0x70078, 0x70078, 0x70078, 0x70078, 0x70078, 0x70078, 0x70078,
+    0x70078, 0x70078, 0x70078, 0x70079, 0x70079, 0x70079, 0x70079, 0x70079,
+    0x70079, 0x70079, 0x70079, 0x70079, 0x70079, 0x70079, 0x70079, 0x70079,
+    0x70079, 0x70079, 0x70079, 0x7007a, 0x7007a, 0x7007a, 0x7007a, 0x7007a,
+    0x7007a, 0x7007a, 0x7007a, 0x7007a, 0x7007a, 0x7007a, 0x7007a, 0x7007a,
+    0x7007a, 0x7007a, 0x7007a, 0x80026, 0x80026, 0x80026, 0x80026, 0x80026,
+    0x80026, 0x80026, 0x80026, 0x8002a, 0x8002a, 0x8002a, 0x8002a, 0x8002a,
+    0x8002a, 0x8002a, 0x8002a, 0x8002c, 0x8002c, 0x8002c, 0x8002c, 0x8002c,
+    0x8002c, 0x8002c, 0x8002c, 0x8003b, 0x8003b, 0x8003b, 0x8003b, 0x8003b,
+    0x8003b, 0x8003b, 0x8003b, 0x80058, 0x80058, 0x80058, 0x80058, 0x80058,
+    0x80058, 0x80058, 0x80058, 0x8005a, 0x8005a, 0x8005a, 0x8005a, 0x8005a,
+    0x8005a, 0x8005a, 0x8005a, 0xa0021, 0xa0021, 0xa0022, 0xa0022, 0xa0028,
+    0xa0028, 0xa0029, 0xa0029, 0xa003f, 0xa003f, 0xb0027, 0xb002b, 0xb007c, 0x0,
+    0x0, 0x0,
 };
 
-/* next state, based upon current state and the current nibble: see above.
-   generated by gen_hpack_tables.c */
-static const int16_t next_sub_tbl[48 * 16] = {
-    1,   204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
-    218, 2,   6,   10,  13,  14,  15,  16,  17,  2,   6,   10,  13,  14,  15,
-    16,  17,  3,   7,   11,  24,  3,   7,   11,  24,  3,   7,   11,  24,  3,
-    7,   11,  24,  4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,
-    4,   8,   4,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,
-    199, 200, 201, 202, 203, 4,   8,   4,   8,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   9,   133, 134, 135, 136, 137, 138, 139, 140,
-    141, 142, 143, 144, 145, 146, 147, 3,   7,   11,  24,  3,   7,   11,  24,
-    4,   8,   4,   8,   4,   8,   4,   8,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   0,   12,  132, 4,   8,   4,   8,   4,   8,
-    4,   8,   4,   8,   4,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   0,   0,   18,  19,  20,  21,  4,   8,   4,
-    8,   4,   8,   4,   8,   4,   8,   0,   0,   0,   22,  23,  91,  25,  26,
-    27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  3,
-    7,   11,  24,  3,   7,   11,  24,  0,   0,   0,   0,   0,   41,  42,  43,
-    2,   6,   10,  13,  14,  15,  16,  17,  3,   7,   11,  24,  3,   7,   11,
-    24,  4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   0,   0,
-    44,  45,  2,   6,   10,  13,  14,  15,  16,  17,  46,  47,  48,  49,  50,
-    51,  52,  57,  4,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   53,  54,  55,  56,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
-    68,  69,  70,  71,  72,  74,  0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   73,  75,  76,  77,  78,  79,  80,  81,  82,
-    83,  84,  85,  86,  87,  88,  89,  90,  3,   7,   11,  24,  3,   7,   11,
-    24,  3,   7,   11,  24,  0,   0,   0,   0,   3,   7,   11,  24,  3,   7,
-    11,  24,  4,   8,   4,   8,   0,   0,   0,   92,  0,   0,   0,   93,  94,
-    95,  96,  97,  98,  99,  100, 101, 102, 103, 104, 105, 3,   7,   11,  24,
-    4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,
-    8,   4,   8,   4,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 4,
-    8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   0,   0,
-    0,   117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-    131, 2,   6,   10,  13,  14,  15,  16,  17,  4,   8,   4,   8,   4,   8,
-    4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   148,
-    149, 150, 151, 3,   7,   11,  24,  4,   8,   4,   8,   0,   0,   0,   0,
-    0,   0,   152, 153, 3,   7,   11,  24,  3,   7,   11,  24,  3,   7,   11,
-    24,  154, 155, 156, 164, 3,   7,   11,  24,  3,   7,   11,  24,  3,   7,
-    11,  24,  4,   8,   4,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    157, 158, 159, 160, 161, 162, 163, 165, 166, 167, 168, 169, 170, 171, 172,
-    173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
-    188, 189, 190, 191, 192, 193, 194, 195, 196, 4,   8,   4,   8,   4,   8,
-    4,   8,   4,   8,   4,   8,   4,   8,   197, 198, 4,   8,   4,   8,   4,
-    8,   4,   8,   0,   0,   0,   0,   0,   0,   219, 220, 3,   7,   11,  24,
-    4,   8,   4,   8,   4,   8,   0,   0,   221, 222, 223, 224, 3,   7,   11,
-    24,  3,   7,   11,  24,  4,   8,   4,   8,   4,   8,   225, 228, 4,   8,
-    4,   8,   4,   8,   0,   0,   0,   0,   0,   0,   0,   0,   226, 227, 229,
-    230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
-    4,   8,   4,   8,   4,   8,   4,   8,   4,   8,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   0,   245, 246, 247, 248, 249, 250, 251, 252,
-    253, 254, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   255,
+/* longer codes are decoded through their canonical code ranges: given a code
+   length, the largest left aligned 32 bit stream prefix that starts with a
+   code of at most that length, and what to add to a code of that length to
+   get its index in huff_long_syms
+
+   generated by gen_hpack_tables.cc */
+static const uint32_t huff_long_max[HUFF_MAX_CODE_LENGTH - HUFF_FAST_BITS] = {
+    0xffbfffff, 0xffefffff, 0xfff7ffff, 0xfffdffff, 0xfffdffff, 0xfffdffff,
+    0xfffdffff, 0xfffe5fff, 0xfffedfff, 0xffff47ff, 0xffffafff, 0xffffe9ff,
+    0xfffff5ff, 0xfffff7ff, 0xfffffbbf, 0xfffffe1f, 0xffffffef, 0xffffffef,
+    0xffffffff,
 };
-
-/* emission table: indexed like next_tbl, ultimately gives the byte to be
-   emitted, or -1 for no byte, or 256 for end of stream
-
-   generated by gen_hpack_tables.c */
-static const uint16_t emit_tbl[256] = {
-    0,   1,   2,   3,   4,   5,   6,   7,   0,   8,   9,   10,  11,  12,  13,
-    14,  15,  16,  17,  18,  19,  20,  21,  22,  0,   23,  24,  25,  26,  27,
-    28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,
-    43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  0,   55,  56,
-    57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  0,
-    71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,
-    86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99,  100,
-    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
-    116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
-    131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
-    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 0,
-    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
-    0,   175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
-    189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203,
-    204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
-    219, 220, 221, 0,   222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232,
-    233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
-    248,
+static const int32_t huff_long_base[HUFF_MAX_CODE_LENGTH - HUFF_FAST_BITS] = {
+    -4090, -8182, -16372, -32754, -65521, -131055, -262123, -524259, -1048534,
+    -2097092, -4194221, -8388505, -16777102, -33554308, -67108724, -134217571,
+    -268435284, -536870739, -1073741649,
 };
-
-/* generated by gen_hpack_tables.c */
-static const int16_t emit_sub_tbl[249 * 16] = {
-    -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-    -1,  48,  48,  48,  48,  48,  48,  48,  48,  49,  49,  49,  49,  49,  49,
-    49,  49,  48,  48,  48,  48,  49,  49,  49,  49,  50,  50,  50,  50,  97,
-    97,  97,  97,  48,  48,  49,  49,  50,  50,  97,  97,  99,  99,  101, 101,
-    105, 105, 111, 111, 48,  49,  50,  97,  99,  101, 105, 111, 115, 116, -1,
-    -1,  -1,  -1,  -1,  -1,  32,  32,  32,  32,  32,  32,  32,  32,  37,  37,
-    37,  37,  37,  37,  37,  37,  99,  99,  99,  99,  101, 101, 101, 101, 105,
-    105, 105, 105, 111, 111, 111, 111, 115, 115, 116, 116, 32,  37,  45,  46,
-    47,  51,  52,  53,  54,  55,  56,  57,  61,  61,  61,  61,  61,  61,  61,
-    61,  65,  65,  65,  65,  65,  65,  65,  65,  115, 115, 115, 115, 116, 116,
-    116, 116, 32,  32,  37,  37,  45,  45,  46,  46,  61,  65,  95,  98,  100,
-    102, 103, 104, 108, 109, 110, 112, 114, 117, -1,  -1,  58,  58,  58,  58,
-    58,  58,  58,  58,  66,  66,  66,  66,  66,  66,  66,  66,  47,  47,  51,
-    51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  57,  61,  61,
-    65,  65,  95,  95,  98,  98,  100, 100, 102, 102, 103, 103, 104, 104, 108,
-    108, 109, 109, 110, 110, 112, 112, 114, 114, 117, 117, 58,  66,  67,  68,
-    69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,
-    84,  85,  86,  87,  89,  106, 107, 113, 118, 119, 120, 121, 122, -1,  -1,
-    -1,  -1,  38,  38,  38,  38,  38,  38,  38,  38,  42,  42,  42,  42,  42,
-    42,  42,  42,  44,  44,  44,  44,  44,  44,  44,  44,  59,  59,  59,  59,
-    59,  59,  59,  59,  88,  88,  88,  88,  88,  88,  88,  88,  90,  90,  90,
-    90,  90,  90,  90,  90,  33,  33,  34,  34,  40,  40,  41,  41,  63,  63,
-    39,  43,  124, -1,  -1,  -1,  35,  35,  35,  35,  35,  35,  35,  35,  62,
-    62,  62,  62,  62,  62,  62,  62,  0,   0,   0,   0,   36,  36,  36,  36,
-    64,  64,  64,  64,  91,  91,  91,  91,  69,  69,  69,  69,  69,  69,  69,
-    69,  70,  70,  70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,
-    71,  71,  72,  72,  72,  72,  72,  72,  72,  72,  73,  73,  73,  73,  73,
-    73,  73,  73,  74,  74,  74,  74,  74,  74,  74,  74,  75,  75,  75,  75,
-    75,  75,  75,  75,  76,  76,  76,  76,  76,  76,  76,  76,  77,  77,  77,
-    77,  77,  77,  77,  77,  78,  78,  78,  78,  78,  78,  78,  78,  79,  79,
-    79,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  80,  80,  80,  81,
-    81,  81,  81,  81,  81,  81,  81,  82,  82,  82,  82,  82,  82,  82,  82,
-    83,  83,  83,  83,  83,  83,  83,  83,  84,  84,  84,  84,  84,  84,  84,
-    84,  85,  85,  85,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  86,
-    86,  86,  87,  87,  87,  87,  87,  87,  87,  87,  89,  89,  89,  89,  89,
-    89,  89,  89,  106, 106, 106, 106, 106, 106, 106, 106, 107, 107, 107, 107,
-    107, 107, 107, 107, 113, 113, 113, 113, 113, 113, 113, 113, 118, 118, 118,
-    118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
-    120, 120, 120, 120, 120, 120, 121, 121, 121, 121, 121, 121, 121, 121, 122,
-    122, 122, 122, 122, 122, 122, 122, 38,  38,  38,  38,  42,  42,  42,  42,
-    44,  44,  44,  44,  59,  59,  59,  59,  88,  88,  88,  88,  90,  90,  90,
-    90,  33,  34,  40,  41,  63,  -1,  -1,  -1,  39,  39,  39,  39,  39,  39,
-    39,  39,  43,  43,  43,  43,  43,  43,  43,  43,  124, 124, 124, 124, 124,
-    124, 124, 124, 35,  35,  35,  35,  62,  62,  62,  62,  0,   0,   36,  36,
-    64,  64,  91,  91,  93,  93,  126, 126, 94,  125, -1,  -1,  60,  60,  60,
-    60,  60,  60,  60,  60,  96,  96,  96,  96,  96,  96,  96,  96,  123, 123,
-    123, 123, 123, 123, 123, 123, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  92,
-    92,  92,  92,  92,  92,  92,  92,  195, 195, 195, 195, 195, 195, 195, 195,
-    208, 208, 208, 208, 208, 208, 208, 208, 128, 128, 128, 128, 130, 130, 130,
-    130, 131, 131, 131, 131, 162, 162, 162, 162, 184, 184, 184, 184, 194, 194,
-    194, 194, 224, 224, 224, 224, 226, 226, 226, 226, 153, 153, 161, 161, 167,
-    167, 172, 172, 176, 176, 177, 177, 179, 179, 209, 209, 216, 216, 217, 217,
-    227, 227, 229, 229, 230, 230, 129, 132, 133, 134, 136, 146, 154, 156, 160,
-    163, 164, 169, 170, 173, 178, 181, 185, 186, 187, 189, 190, 196, 198, 228,
-    232, 233, -1,  -1,  -1,  -1,  1,   1,   1,   1,   1,   1,   1,   1,   135,
-    135, 135, 135, 135, 135, 135, 135, 137, 137, 137, 137, 137, 137, 137, 137,
-    138, 138, 138, 138, 138, 138, 138, 138, 139, 139, 139, 139, 139, 139, 139,
-    139, 140, 140, 140, 140, 140, 140, 140, 140, 141, 141, 141, 141, 141, 141,
-    141, 141, 143, 143, 143, 143, 143, 143, 143, 143, 147, 147, 147, 147, 147,
-    147, 147, 147, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150, 150, 150,
-    150, 150, 150, 150, 151, 151, 151, 151, 151, 151, 151, 151, 152, 152, 152,
-    152, 152, 152, 152, 152, 155, 155, 155, 155, 155, 155, 155, 155, 157, 157,
-    157, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 158, 158, 158, 165,
-    165, 165, 165, 165, 165, 165, 165, 166, 166, 166, 166, 166, 166, 166, 166,
-    168, 168, 168, 168, 168, 168, 168, 168, 174, 174, 174, 174, 174, 174, 174,
-    174, 175, 175, 175, 175, 175, 175, 175, 175, 180, 180, 180, 180, 180, 180,
-    180, 180, 182, 182, 182, 182, 182, 182, 182, 182, 183, 183, 183, 183, 183,
-    183, 183, 183, 188, 188, 188, 188, 188, 188, 188, 188, 191, 191, 191, 191,
-    191, 191, 191, 191, 197, 197, 197, 197, 197, 197, 197, 197, 231, 231, 231,
-    231, 231, 231, 231, 231, 239, 239, 239, 239, 239, 239, 239, 239, 9,   9,
-    9,   9,   142, 142, 142, 142, 144, 144, 144, 144, 145, 145, 145, 145, 148,
-    148, 148, 148, 159, 159, 159, 159, 171, 171, 171, 171, 206, 206, 206, 206,
-    215, 215, 215, 215, 225, 225, 225, 225, 236, 236, 236, 236, 237, 237, 237,
-    237, 199, 199, 207, 207, 234, 234, 235, 235, 192, 193, 200, 201, 202, 205,
-    210, 213, 218, 219, 238, 240, 242, 243, 255, -1,  203, 203, 203, 203, 203,
-    203, 203, 203, 204, 204, 204, 204, 204, 204, 204, 204, 211, 211, 211, 211,
-    211, 211, 211, 211, 212, 212, 212, 212, 212, 212, 212, 212, 214, 214, 214,
-    214, 214, 214, 214, 214, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
-    222, 222, 222, 222, 222, 222, 223, 223, 223, 223, 223, 223, 223, 223, 241,
-    241, 241, 241, 241, 241, 241, 241, 244, 244, 244, 244, 244, 244, 244, 244,
-    245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246,
-    246, 247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248,
-    248, 248, 250, 250, 250, 250, 250, 250, 250, 250, 251, 251, 251, 251, 251,
-    251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 252, 253, 253, 253, 253,
-    253, 253, 253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 2,   2,   2,
-    2,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,
-    6,   6,   7,   7,   7,   7,   8,   8,   8,   8,   11,  11,  11,  11,  12,
-    12,  12,  12,  14,  14,  14,  14,  15,  15,  15,  15,  16,  16,  16,  16,
-    17,  17,  17,  17,  18,  18,  18,  18,  19,  19,  19,  19,  20,  20,  20,
-    20,  21,  21,  21,  21,  23,  23,  23,  23,  24,  24,  24,  24,  25,  25,
-    25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,
-    29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  127, 127, 127, 127,
-    220, 220, 220, 220, 249, 249, 249, 249, 10,  13,  22,  256, 93,  93,  93,
-    93,  126, 126, 126, 126, 94,  94,  125, 125, 60,  96,  123, -1,  92,  195,
-    208, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  128,
-    128, 128, 128, 128, 128, 128, 128, 130, 130, 130, 130, 130, 130, 130, 130,
-    131, 131, 131, 131, 131, 131, 131, 131, 162, 162, 162, 162, 162, 162, 162,
-    162, 184, 184, 184, 184, 184, 184, 184, 184, 194, 194, 194, 194, 194, 194,
-    194, 194, 224, 224, 224, 224, 224, 224, 224, 224, 226, 226, 226, 226, 226,
-    226, 226, 226, 153, 153, 153, 153, 161, 161, 161, 161, 167, 167, 167, 167,
-    172, 172, 172, 172, 176, 176, 176, 176, 177, 177, 177, 177, 179, 179, 179,
-    179, 209, 209, 209, 209, 216, 216, 216, 216, 217, 217, 217, 217, 227, 227,
-    227, 227, 229, 229, 229, 229, 230, 230, 230, 230, 129, 129, 132, 132, 133,
-    133, 134, 134, 136, 136, 146, 146, 154, 154, 156, 156, 160, 160, 163, 163,
-    164, 164, 169, 169, 170, 170, 173, 173, 178, 178, 181, 181, 185, 185, 186,
-    186, 187, 187, 189, 189, 190, 190, 196, 196, 198, 198, 228, 228, 232, 232,
-    233, 233, 1,   135, 137, 138, 139, 140, 141, 143, 147, 149, 150, 151, 152,
-    155, 157, 158, 165, 166, 168, 174, 175, 180, 182, 183, 188, 191, 197, 231,
-    239, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  9,   9,   9,
-    9,   9,   9,   9,   9,   142, 142, 142, 142, 142, 142, 142, 142, 144, 144,
-    144, 144, 144, 144, 144, 144, 145, 145, 145, 145, 145, 145, 145, 145, 148,
-    148, 148, 148, 148, 148, 148, 148, 159, 159, 159, 159, 159, 159, 159, 159,
-    171, 171, 171, 171, 171, 171, 171, 171, 206, 206, 206, 206, 206, 206, 206,
-    206, 215, 215, 215, 215, 215, 215, 215, 215, 225, 225, 225, 225, 225, 225,
-    225, 225, 236, 236, 236, 236, 236, 236, 236, 236, 237, 237, 237, 237, 237,
-    237, 237, 237, 199, 199, 199, 199, 207, 207, 207, 207, 234, 234, 234, 234,
-    235, 235, 235, 235, 192, 192, 193, 193, 200, 200, 201, 201, 202, 202, 205,
-    205, 210, 210, 213, 213, 218, 218, 219, 219, 238, 238, 240, 240, 242, 242,
-    243, 243, 255, 255, 203, 204, 211, 212, 214, 221, 222, 223, 241, 244, 245,
-    246, 247, 248, 250, 251, 252, 253, 254, -1,  -1,  -1,  -1,  -1,  -1,  -1,
-    -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  2,   2,   2,   2,   2,   2,   2,
-    2,   3,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,   4,
-    4,   4,   5,   5,   5,   5,   5,   5,   5,   5,   6,   6,   6,   6,   6,
-    6,   6,   6,   7,   7,   7,   7,   7,   7,   7,   7,   8,   8,   8,   8,
-    8,   8,   8,   8,   11,  11,  11,  11,  11,  11,  11,  11,  12,  12,  12,
-    12,  12,  12,  12,  12,  14,  14,  14,  14,  14,  14,  14,  14,  15,  15,
-    15,  15,  15,  15,  15,  15,  16,  16,  16,  16,  16,  16,  16,  16,  17,
-    17,  17,  17,  17,  17,  17,  17,  18,  18,  18,  18,  18,  18,  18,  18,
-    19,  19,  19,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  20,  20,
-    20,  21,  21,  21,  21,  21,  21,  21,  21,  23,  23,  23,  23,  23,  23,
-    23,  23,  24,  24,  24,  24,  24,  24,  24,  24,  25,  25,  25,  25,  25,
-    25,  25,  25,  26,  26,  26,  26,  26,  26,  26,  26,  27,  27,  27,  27,
-    27,  27,  27,  27,  28,  28,  28,  28,  28,  28,  28,  28,  29,  29,  29,
-    29,  29,  29,  29,  29,  30,  30,  30,  30,  30,  30,  30,  30,  31,  31,
-    31,  31,  31,  31,  31,  31,  127, 127, 127, 127, 127, 127, 127, 127, 220,
-    220, 220, 220, 220, 220, 220, 220, 249, 249, 249, 249, 249, 249, 249, 249,
-    10,  10,  13,  13,  22,  22,  256, 256, 67,  67,  67,  67,  67,  67,  67,
-    67,  68,  68,  68,  68,  68,  68,  68,  68,  95,  95,  95,  95,  95,  95,
-    95,  95,  98,  98,  98,  98,  98,  98,  98,  98,  100, 100, 100, 100, 100,
-    100, 100, 100, 102, 102, 102, 102, 102, 102, 102, 102, 103, 103, 103, 103,
-    103, 103, 103, 103, 104, 104, 104, 104, 104, 104, 104, 104, 108, 108, 108,
-    108, 108, 108, 108, 108, 109, 109, 109, 109, 109, 109, 109, 109, 110, 110,
-    110, 110, 110, 110, 110, 110, 112, 112, 112, 112, 112, 112, 112, 112, 114,
-    114, 114, 114, 114, 114, 114, 114, 117, 117, 117, 117, 117, 117, 117, 117,
-    58,  58,  58,  58,  66,  66,  66,  66,  67,  67,  67,  67,  68,  68,  68,
-    68,  69,  69,  69,  69,  70,  70,  70,  70,  71,  71,  71,  71,  72,  72,
-    72,  72,  73,  73,  73,  73,  74,  74,  74,  74,  75,  75,  75,  75,  76,
-    76,  76,  76,  77,  77,  77,  77,  78,  78,  78,  78,  79,  79,  79,  79,
-    80,  80,  80,  80,  81,  81,  81,  81,  82,  82,  82,  82,  83,  83,  83,
-    83,  84,  84,  84,  84,  85,  85,  85,  85,  86,  86,  86,  86,  87,  87,
-    87,  87,  89,  89,  89,  89,  106, 106, 106, 106, 107, 107, 107, 107, 113,
-    113, 113, 113, 118, 118, 118, 118, 119, 119, 119, 119, 120, 120, 120, 120,
-    121, 121, 121, 121, 122, 122, 122, 122, 38,  38,  42,  42,  44,  44,  59,
-    59,  88,  88,  90,  90,  -1,  -1,  -1,  -1,  33,  33,  33,  33,  33,  33,
-    33,  33,  34,  34,  34,  34,  34,  34,  34,  34,  40,  40,  40,  40,  40,
-    40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  63,  63,  63,  63,
-    63,  63,  63,  63,  39,  39,  39,  39,  43,  43,  43,  43,  124, 124, 124,
-    124, 35,  35,  62,  62,  0,   36,  64,  91,  93,  126, -1,  -1,  94,  94,
-    94,  94,  94,  94,  94,  94,  125, 125, 125, 125, 125, 125, 125, 125, 60,
-    60,  60,  60,  96,  96,  96,  96,  123, 123, 123, 123, -1,  -1,  -1,  -1,
-    92,  92,  92,  92,  195, 195, 195, 195, 208, 208, 208, 208, 128, 128, 130,
-    130, 131, 131, 162, 162, 184, 184, 194, 194, 224, 224, 226, 226, 153, 161,
-    167, 172, 176, 177, 179, 209, 216, 217, 227, 229, 230, -1,  -1,  -1,  -1,
-    -1,  -1,  -1,  129, 129, 129, 129, 129, 129, 129, 129, 132, 132, 132, 132,
-    132, 132, 132, 132, 133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134,
-    134, 134, 134, 134, 134, 136, 136, 136, 136, 136, 136, 136, 136, 146, 146,
-    146, 146, 146, 146, 146, 146, 154, 154, 154, 154, 154, 154, 154, 154, 156,
-    156, 156, 156, 156, 156, 156, 156, 160, 160, 160, 160, 160, 160, 160, 160,
-    163, 163, 163, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 164, 164,
-    164, 169, 169, 169, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 170,
-    170, 170, 173, 173, 173, 173, 173, 173, 173, 173, 178, 178, 178, 178, 178,
-    178, 178, 178, 181, 181, 181, 181, 181, 181, 181, 181, 185, 185, 185, 185,
-    185, 185, 185, 185, 186, 186, 186, 186, 186, 186, 186, 186, 187, 187, 187,
-    187, 187, 187, 187, 187, 189, 189, 189, 189, 189, 189, 189, 189, 190, 190,
-    190, 190, 190, 190, 190, 190, 196, 196, 196, 196, 196, 196, 196, 196, 198,
-    198, 198, 198, 198, 198, 198, 198, 228, 228, 228, 228, 228, 228, 228, 228,
-    232, 232, 232, 232, 232, 232, 232, 232, 233, 233, 233, 233, 233, 233, 233,
-    233, 1,   1,   1,   1,   135, 135, 135, 135, 137, 137, 137, 137, 138, 138,
-    138, 138, 139, 139, 139, 139, 140, 140, 140, 140, 141, 141, 141, 141, 143,
-    143, 143, 143, 147, 147, 147, 147, 149, 149, 149, 149, 150, 150, 150, 150,
-    151, 151, 151, 151, 152, 152, 152, 152, 155, 155, 155, 155, 157, 157, 157,
-    157, 158, 158, 158, 158, 165, 165, 165, 165, 166, 166, 166, 166, 168, 168,
-    168, 168, 174, 174, 174, 174, 175, 175, 175, 175, 180, 180, 180, 180, 182,
-    182, 182, 182, 183, 183, 183, 183, 188, 188, 188, 188, 191, 191, 191, 191,
-    197, 197, 197, 197, 231, 231, 231, 231, 239, 239, 239, 239, 9,   9,   142,
-    142, 144, 144, 145, 145, 148, 148, 159, 159, 171, 171, 206, 206, 215, 215,
-    225, 225, 236, 236, 237, 237, 199, 207, 234, 235, 192, 192, 192, 192, 192,
-    192, 192, 192, 193, 193, 193, 193, 193, 193, 193, 193, 200, 200, 200, 200,
-    200, 200, 200, 200, 201, 201, 201, 201, 201, 201, 201, 201, 202, 202, 202,
-    202, 202, 202, 202, 202, 205, 205, 205, 205, 205, 205, 205, 205, 210, 210,
-    210, 210, 210, 210, 210, 210, 213, 213, 213, 213, 213, 213, 213, 213, 218,
-    218, 218, 218, 218, 218, 218, 218, 219, 219, 219, 219, 219, 219, 219, 219,
-    238, 238, 238, 238, 238, 238, 238, 238, 240, 240, 240, 240, 240, 240, 240,
-    240, 242, 242, 242, 242, 242, 242, 242, 242, 243, 243, 243, 243, 243, 243,
-    243, 243, 255, 255, 255, 255, 255, 255, 255, 255, 203, 203, 203, 203, 204,
-    204, 204, 204, 211, 211, 211, 211, 212, 212, 212, 212, 214, 214, 214, 214,
-    221, 221, 221, 221, 222, 222, 222, 222, 223, 223, 223, 223, 241, 241, 241,
-    241, 244, 244, 244, 244, 245, 245, 245, 245, 246, 246, 246, 246, 247, 247,
-    247, 247, 248, 248, 248, 248, 250, 250, 250, 250, 251, 251, 251, 251, 252,
-    252, 252, 252, 253, 253, 253, 253, 254, 254, 254, 254, 2,   2,   3,   3,
-    4,   4,   5,   5,   6,   6,   7,   7,   8,   8,   11,  11,  12,  12,  14,
-    14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  21,
-    23,  23,  24,  24,  25,  25,  26,  26,  27,  27,  28,  28,  29,  29,  30,
-    30,  31,  31,  127, 127, 220, 220, 249, 249, -1,  -1,  10,  10,  10,  10,
-    10,  10,  10,  10,  13,  13,  13,  13,  13,  13,  13,  13,  22,  22,  22,
-    22,  22,  22,  22,  22,  256, 256, 256, 256, 256, 256, 256, 256, 45,  45,
-    45,  45,  45,  45,  45,  45,  46,  46,  46,  46,  46,  46,  46,  46,  47,
-    47,  47,  47,  47,  47,  47,  47,  51,  51,  51,  51,  51,  51,  51,  51,
-    52,  52,  52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,
-    53,  54,  54,  54,  54,  54,  54,  54,  54,  55,  55,  55,  55,  55,  55,
-    55,  55,  56,  56,  56,  56,  56,  56,  56,  56,  57,  57,  57,  57,  57,
-    57,  57,  57,  50,  50,  50,  50,  50,  50,  50,  50,  97,  97,  97,  97,
-    97,  97,  97,  97,  99,  99,  99,  99,  99,  99,  99,  99,  101, 101, 101,
-    101, 101, 101, 101, 101, 105, 105, 105, 105, 105, 105, 105, 105, 111, 111,
-    111, 111, 111, 111, 111, 111, 115, 115, 115, 115, 115, 115, 115, 115, 116,
-    116, 116, 116, 116, 116, 116, 116, 32,  32,  32,  32,  37,  37,  37,  37,
-    45,  45,  45,  45,  46,  46,  46,  46,  47,  47,  47,  47,  51,  51,  51,
-    51,  52,  52,  52,  52,  53,  53,  53,  53,  54,  54,  54,  54,  55,  55,
-    55,  55,  56,  56,  56,  56,  57,  57,  57,  57,  61,  61,  61,  61,  65,
-    65,  65,  65,  95,  95,  95,  95,  98,  98,  98,  98,  100, 100, 100, 100,
-    102, 102, 102, 102, 103, 103, 103, 103, 104, 104, 104, 104, 108, 108, 108,
-    108, 109, 109, 109, 109, 110, 110, 110, 110, 112, 112, 112, 112, 114, 114,
-    114, 114, 117, 117, 117, 117, 58,  58,  66,  66,  67,  67,  68,  68,  69,
-    69,  70,  70,  71,  71,  72,  72,  73,  73,  74,  74,  75,  75,  76,  76,
-    77,  77,  78,  78,  79,  79,  80,  80,  81,  81,  82,  82,  83,  83,  84,
-    84,  85,  85,  86,  86,  87,  87,  89,  89,  106, 106, 107, 107, 113, 113,
-    118, 118, 119, 119, 120, 120, 121, 121, 122, 122, 38,  42,  44,  59,  88,
-    90,  -1,  -1,  33,  33,  33,  33,  34,  34,  34,  34,  40,  40,  40,  40,
-    41,  41,  41,  41,  63,  63,  63,  63,  39,  39,  43,  43,  124, 124, 35,
-    62,  -1,  -1,  -1,  -1,  0,   0,   0,   0,   0,   0,   0,   0,   36,  36,
-    36,  36,  36,  36,  36,  36,  64,  64,  64,  64,  64,  64,  64,  64,  91,
-    91,  91,  91,  91,  91,  91,  91,  93,  93,  93,  93,  93,  93,  93,  93,
-    126, 126, 126, 126, 126, 126, 126, 126, 94,  94,  94,  94,  125, 125, 125,
-    125, 60,  60,  96,  96,  123, 123, -1,  -1,  92,  92,  195, 195, 208, 208,
-    128, 130, 131, 162, 184, 194, 224, 226, -1,  -1,  153, 153, 153, 153, 153,
-    153, 153, 153, 161, 161, 161, 161, 161, 161, 161, 161, 167, 167, 167, 167,
-    167, 167, 167, 167, 172, 172, 172, 172, 172, 172, 172, 172, 176, 176, 176,
-    176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 179, 179,
-    179, 179, 179, 179, 179, 179, 209, 209, 209, 209, 209, 209, 209, 209, 216,
-    216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217, 217, 217, 217,
-    227, 227, 227, 227, 227, 227, 227, 227, 229, 229, 229, 229, 229, 229, 229,
-    229, 230, 230, 230, 230, 230, 230, 230, 230, 129, 129, 129, 129, 132, 132,
-    132, 132, 133, 133, 133, 133, 134, 134, 134, 134, 136, 136, 136, 136, 146,
-    146, 146, 146, 154, 154, 154, 154, 156, 156, 156, 156, 160, 160, 160, 160,
-    163, 163, 163, 163, 164, 164, 164, 164, 169, 169, 169, 169, 170, 170, 170,
-    170, 173, 173, 173, 173, 178, 178, 178, 178, 181, 181, 181, 181, 185, 185,
-    185, 185, 186, 186, 186, 186, 187, 187, 187, 187, 189, 189, 189, 189, 190,
-    190, 190, 190, 196, 196, 196, 196, 198, 198, 198, 198, 228, 228, 228, 228,
-    232, 232, 232, 232, 233, 233, 233, 233, 1,   1,   135, 135, 137, 137, 138,
-    138, 139, 139, 140, 140, 141, 141, 143, 143, 147, 147, 149, 149, 150, 150,
-    151, 151, 152, 152, 155, 155, 157, 157, 158, 158, 165, 165, 166, 166, 168,
-    168, 174, 174, 175, 175, 180, 180, 182, 182, 183, 183, 188, 188, 191, 191,
-    197, 197, 231, 231, 239, 239, 9,   142, 144, 145, 148, 159, 171, 206, 215,
-    225, 236, 237, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  199, 199,
-    199, 199, 199, 199, 199, 199, 207, 207, 207, 207, 207, 207, 207, 207, 234,
-    234, 234, 234, 234, 234, 234, 234, 235, 235, 235, 235, 235, 235, 235, 235,
-    192, 192, 192, 192, 193, 193, 193, 193, 200, 200, 200, 200, 201, 201, 201,
-    201, 202, 202, 202, 202, 205, 205, 205, 205, 210, 210, 210, 210, 213, 213,
-    213, 213, 218, 218, 218, 218, 219, 219, 219, 219, 238, 238, 238, 238, 240,
-    240, 240, 240, 242, 242, 242, 242, 243, 243, 243, 243, 255, 255, 255, 255,
-    203, 203, 204, 204, 211, 211, 212, 212, 214, 214, 221, 221, 222, 222, 223,
-    223, 241, 241, 244, 244, 245, 245, 246, 246, 247, 247, 248, 248, 250, 250,
-    251, 251, 252, 252, 253, 253, 254, 254, 2,   3,   4,   5,   6,   7,   8,
-    11,  12,  14,  15,  16,  17,  18,  19,  20,  21,  23,  24,  25,  26,  27,
-    28,  29,  30,  31,  127, 220, 249, -1,  10,  10,  10,  10,  13,  13,  13,
-    13,  22,  22,  22,  22,  256, 256, 256, 256,
+static const uint16_t huff_long_syms[175] = {
+    35, 62, 0, 36, 64, 91, 93, 126, 94, 125, 60, 96, 123, 92, 195, 208, 128,
+    130, 131, 162, 184, 194, 224, 226, 153, 161, 167, 172, 176, 177, 179, 209,
+    216, 217, 227, 229, 230, 129, 132, 133, 134, 136, 146, 154, 156, 160, 163,
+    164, 169, 170, 173, 178, 181, 185, 186, 187, 189, 190, 196, 198, 228, 232,
+    233, 1, 135, 137, 138, 139, 140, 141, 143, 147, 149, 150, 151, 152, 155,
+    157, 158, 165, 166, 168, 174, 175, 180, 182, 183, 188, 191, 197, 231, 239,
+    9, 142, 144, 145, 148, 159, 171, 206, 215, 225, 236, 237, 199, 207, 234,
+    235, 192, 193, 200, 201, 202, 205, 210, 213, 218, 219, 238, 240, 242, 243,
+    255, 203, 204, 211, 212, 214, 221, 222, 223, 241, 244, 245, 246, 247, 248,
+    250, 251, 252, 253, 254, 2, 3, 4, 5, 6, 7, 8, 11, 12, 14, 15, 16, 17, 18,
+    19, 20, 21, 23, 24, 25, 26, 27, 28, 29, 30, 31, 127, 220, 249, 10, 13, 22,
+    256,
 };
 
 static const uint8_t inverse_base64[256] = {
@@ -1383,32 +1319,61 @@ static grpc_error* finish_str(grpc_chttp2_hpack_parser* p, const uint8_t* cur,
   return GRPC_ERROR_NONE;
 }
 
-/* decode a nibble from a huffman encoded stream */
-static grpc_error* huff_nibble(grpc_chttp2_hpack_parser* p, uint8_t nibble) {
-  int16_t emit = emit_sub_tbl[16 * emit_tbl[p->huff_state] + nibble];
-  int16_t next = next_sub_tbl[16 * next_tbl[p->huff_state] + nibble];
-  if (emit != -1) {
-    if (emit >= 0 && emit < 256) {
-      uint8_t c = (uint8_t)emit;
-      grpc_error* err = append_string(p, &c, (&c) + 1);
-      if (err != GRPC_ERROR_NONE) return err;
-    } else {
-      assert(emit == 256);
-    }
-  }
-  p->huff_state = next;
-  return GRPC_ERROR_NONE;
+/* decode the symbol whose code, longer than HUFF_FAST_BITS, starts the left
+   aligned \a window, and set *length to the length of that code */
+static int huff_decode_long(uint32_t window, uint32_t* length) {
+  int i = 0;
+  while (window > huff_long_max[i]) i++;
+  *length = HUFF_FAST_BITS + 1 + (uint32_t)i;
+  return huff_long_syms[(int32_t)(window >> (32 - *length)) +
+                        huff_long_base[i]];
 }
 
-/* decode full bytes from a huffman encoded stream */
+/* decode full bytes from a huffman encoded stream: codes that do not end
+   before \a end are left in p->huff_bits for the next call */
 static grpc_error* add_huff_bytes(grpc_chttp2_hpack_parser* p,
                                   const uint8_t* cur, const uint8_t* end) {
-  for (; cur != end; ++cur) {
-    grpc_error* err = huff_nibble(p, *cur >> 4);
-    if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
-    err = huff_nibble(p, *cur & 0xf);
-    if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
+  uint8_t decoded[256];
+  size_t ndecoded = 0;
+  uint64_t bits = p->huff_bits;
+  uint32_t nbits = p->huff_nbits;
+  for (;;) {
+    while (nbits <= 56 && cur != end) {
+      bits = (bits << 8) | *cur++;
+      nbits += 8;
+    }
+    /* the next 32 bits, padded with zeros: a code that fits in the real ones
+       decodes the same */
+    const uint32_t window = nbits >= 32 ? (uint32_t)(bits >> (nbits - 32))
+                                        : (uint32_t)(bits << (32 - nbits));
+    const uint32_t entry = huff_fast_tbl[window >> (32 - HUFF_FAST_BITS)];
+    uint32_t length = (entry >> 16) & 0xf;
+    if (length != 0) {
+      if (length > nbits) break;
+      decoded[ndecoded++] = (uint8_t)entry;
+      const uint32_t length2 = entry >> 20;
+      if (length2 != 0 && length2 <= nbits) {
+        decoded[ndecoded++] = (uint8_t)(entry >> 8);
+        length = length2;
+      }
+    } else {
+      const int sym = huff_decode_long(window, &length);
+      if (length > nbits) break;
+      /* EOS has no business in a string, but used to be skipped over */
+      if (sym < 256) decoded[ndecoded++] = (uint8_t)sym;
+    }
+    nbits -= length;
+    if (ndecoded > sizeof(decoded) - 2) {
+      grpc_error* err = append_string(p, decoded, decoded + ndecoded);
+      if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
+      ndecoded = 0;
+    }
   }
+  /* cur == end: fewer than HUFF_MAX_CODE_LENGTH bits are left */
+  p->huff_bits = bits & ((1u << nbits) - 1);
+  p->huff_nbits = (uint8_t)nbits;
+  grpc_error* err = append_string(p, decoded, decoded + ndecoded);
+  if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
   return GRPC_ERROR_NONE;
 }
 
@@ -1463,7 +1428,8 @@ static grpc_error* begin_parse_string(grpc_chttp2_hpack_parser* p,
   str->copied = true;
   str->data.copied.length = 0;
   p->parsing.str = str;
-  p->huff_state = 0;
+  p->huff_bits = 0;
+  p->huff_nbits = 0;
   p->binary = binary;
   switch (p->binary) {
     case NOT_BINARY:
@@ -73,8 +73,10 @@ struct grpc_chttp2_hpack_parser {
   uint32_t strlen;
   /* number of source bytes read for the currently parsing string */
   uint32_t strgot;
-  /* huffman decoding state */
-  int16_t huff_state;
+  /* huffman decoding state: the huff_nbits bits of the current string that
+     were read but not decoded yet, in the low bits of huff_bits */
+  uint64_t huff_bits;
+  uint8_t huff_nbits;
   /* is the string being decoded binary? */
   uint8_t binary;
   /* is the current string huffman encoded? */
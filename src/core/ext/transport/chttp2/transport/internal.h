@@ -40,6 +40,7 @@
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/lib/transport/network_timeline.h"
 #include "src/core/lib/transport/transport_impl.h"
 
 /* streams are kept in various linked lists depending on what things need to
@@ -226,6 +227,20 @@ struct grpc_chttp2_incoming_byte_stream {
   grpc_closure finished_action;
 };
 
+/* An endpoint write made with kernel timestamping on, and the timelines of
+   the streams whose frames it carried */
+typedef struct grpc_chttp2_traced_write {
+  uint64_t seq;
+  grpc_network_timeline** timelines;
+  size_t count;
+  struct grpc_chttp2_traced_write* next;
+} grpc_chttp2_traced_write;
+
+typedef struct {
+  grpc_endpoint_tracer base;
+  grpc_chttp2_transport* t;
+} grpc_chttp2_endpoint_tracer;
+
 typedef enum {
   GRPC_CHTTP2_KEEPALIVE_STATE_WAITING,
   GRPC_CHTTP2_KEEPALIVE_STATE_PINGING,
@@ -304,6 +319,10 @@ struct grpc_chttp2_transport {
    */
   uint32_t write_buffer_size;
 
+  /** if nonzero, the endpoint paces writes to TCP_NOTSENT_LOWAT: build each
+      write to about this many bytes, leaving the rest queued here */
+  uint32_t write_pacing_size;
+
   /** Set to a grpc_error object if a goaway frame is received. By default, set
    * to GRPC_ERROR_NONE */
   grpc_error* goaway_error;
@@ -426,6 +445,25 @@ struct grpc_chttp2_transport {
   bool keepalive_permit_without_calls;
   /** keep-alive state machine state */
   grpc_chttp2_keepalive_state keepalive_state;
+
+  /** kernel timestamping (GRPC_ARG_TCP_TIMESTAMPING): set once the endpoint
+      has agreed to report timestamps to tracer */
+  bool timestamping;
+  grpc_chttp2_endpoint_tracer tracer;
+  /** number of endpoint writes made so far */
+  uint64_t write_seq;
+  /** when the kernel received the data being parsed */
+  gpr_timespec read_timestamp;
+  /** protects the fields below, which the endpoint's reports update from any
+      thread. The tracer callbacks take it under the endpoint's timestamp
+      lock, so nothing may call into the endpoint while holding it */
+  gpr_mu timestamps_mu;
+  /** writes awaiting timestamps, oldest first */
+  grpc_chttp2_traced_write* traced_writes_head;
+  grpc_chttp2_traced_write* traced_writes_tail;
+  size_t traced_writes_count;
+  /** when the kernel received the data of the latest read */
+  gpr_timespec last_read_timestamp;
 };
 
 typedef enum {
@@ -562,6 +600,10 @@ struct grpc_chttp2_stream {
   bool unprocessed_incoming_frames_decompressed;
   /** gRPC header bytes that are already decompressed */
   size_t decompressed_header_bytes;
+
+  /** kernel timestamps attributed to the call, if the transport is
+      timestamping */
+  grpc_network_timeline* timeline;
 };
 
 /** Transport writing call flow:
@@ -592,6 +634,13 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     grpc_chttp2_transport* t);
 void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error* error);
 
+/** Number the endpoint write about to be made, remembering the timelines of
+    the streams it carries (taking ownership of the array and its refs) until
+    the endpoint reports its timestamps */
+void grpc_chttp2_note_traced_write(grpc_chttp2_transport* t,
+                                   grpc_network_timeline** timelines,
+                                   size_t count);
+
 /** Process one slice of incoming data; return 1 if the connection is still
     viable after reading, or 0 if the connection should be torn down */
 grpc_error* grpc_chttp2_perform_read(grpc_chttp2_transport* t,
@@ -248,6 +248,18 @@ grpc_error* grpc_chttp2_perform_read(grpc_chttp2_transport* t,
   GPR_UNREACHABLE_CODE(return nullptr);
 }
 
+/* Attribute the kernel receive time of the data being parsed to s. A server
+   stream is traced from its first frame, before the call has a timeline for
+   it to join. */
+static void note_stream_read(grpc_chttp2_transport* t, grpc_chttp2_stream* s) {
+  if (!t->timestamping ||
+      gpr_time_cmp(t->read_timestamp, gpr_inf_past(GPR_CLOCK_REALTIME)) == 0) {
+    return;
+  }
+  if (s->timeline == nullptr) s->timeline = grpc_network_timeline_create();
+  grpc_network_timeline_note_read(s->timeline, t->read_timestamp);
+}
+
 static grpc_error* init_frame_parser(grpc_chttp2_transport* t) {
   if (t->is_first_frame &&
       t->incoming_frame_type != GRPC_CHTTP2_FRAME_SETTINGS) {
@@ -367,6 +379,7 @@ static grpc_error* init_data_frame_parser(grpc_chttp2_transport* t) {
 error_handler:
   if (err == GRPC_ERROR_NONE) {
     t->incoming_stream = s;
+    note_stream_read(t, s);
     /* t->parser = grpc_chttp2_data_parser_parse;*/
     t->parser = grpc_chttp2_data_parser_parse;
     t->parser_data = &s->data_parser;
@@ -601,6 +614,7 @@ static grpc_error* init_header_frame_parser(grpc_chttp2_transport* t,
   }
   GPR_ASSERT(s != nullptr);
   s->stats.incoming.framing_bytes += 9;
+  note_stream_read(t, s);
   if (s->read_closed) {
     GRPC_CHTTP2_IF_TRACING(gpr_log(
         GPR_ERROR, "skipping already closed grpc_chttp2_stream header"));
@@ -165,6 +165,10 @@ static bool stream_ref_if_not_destroyed(gpr_refcount* r) {
 
 /* How many bytes would we like to put on the wire during a single syscall */
 static uint32_t target_write_size(grpc_chttp2_transport* t) {
+  /* When the endpoint paces writes, it completes each one only once the
+     kernel is ready for more: keep writes near the pacing size so that the
+     frames making up the next one are chosen as late as possible. */
+  if (t->write_pacing_size > 0) return t->write_pacing_size;
   return 1024 * 1024;
 }
 
@@ -481,6 +485,13 @@ class StreamWriteContext {
            data_send_context.max_outgoing() > 0) {
       if (s_->compressed_data_buffer.length > 0) {
         data_send_context.FlushCompressedBytes();
+        // When writes are paced, leave the rest for a later write once this
+        // one is full. At least one frame always goes out, so a stream is
+        // only ever requeued below after it made progress.
+        if (t_->write_pacing_size > 0 &&
+            t_->outbuf.length > target_write_size(t_)) {
+          break;
+        }
       } else {
         data_send_context.CompressMoreBytes();
       }
@@ -589,15 +600,30 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     ctx.UpdateStreamsNoLongerStalled();
   }
 
+  /* timelines of the streams this write carries, if timestamping */
+  grpc_network_timeline** timelines = nullptr;
+  size_t timelines_count = 0;
+  size_t timelines_capacity = 0;
+
   /* for each grpc_chttp2_stream that's become writable, frame it's data
      (according to available window sizes) and add to the output buffer */
   while (grpc_chttp2_stream* s = ctx.NextStream()) {
+    size_t outbuf_length = t->outbuf.length;
     StreamWriteContext stream_ctx(&ctx, s);
     stream_ctx.FlushInitialMetadata();
     stream_ctx.FlushWindowUpdates();
     stream_ctx.FlushData();
     stream_ctx.FlushTrailingMetadata();
 
+    if (s->timeline != nullptr && t->outbuf.length != outbuf_length) {
+      if (timelines_count == timelines_capacity) {
+        timelines_capacity = GPR_MAX(4, 2 * timelines_capacity);
+        timelines = (grpc_network_timeline**)gpr_realloc(
+            timelines, timelines_capacity * sizeof(*timelines));
+      }
+      timelines[timelines_count++] = grpc_network_timeline_ref(s->timeline);
+    }
+
     if (stream_ctx.stream_became_writable()) {
       if (!grpc_chttp2_list_add_writing_stream(t, s)) {
         /* already in writing list: drop ref */
@@ -614,7 +640,16 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   maybe_initiate_ping(t);
 
-  return ctx.Result();
+  grpc_chttp2_begin_write_result result = ctx.Result();
+  if (t->timestamping && result.writing) {
+    grpc_chttp2_note_traced_write(t, timelines, timelines_count);
+  } else {
+    for (size_t i = 0; i < timelines_count; i++) {
+      grpc_network_timeline_unref(timelines[i]);
+    }
+    gpr_free(timelines);
+  }
+  return result;
 }
 
 void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error* error) {
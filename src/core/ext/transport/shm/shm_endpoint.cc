@@ -0,0 +1,590 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+
+#if defined(GRPC_LINUX_MEMFD) && defined(GRPC_LINUX_EVENTFD)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/memfd.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <grpc/slice.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/atm.h>
+#include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/useful.h>
+
+#include "src/core/lib/iomgr/resource_quota.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+#define SHM_MAGIC 0x67525043u
+#define SHM_RING_SIZE (1u << 20)
+#define SHM_MAX_RING_SIZE (64u << 20)
+/* The region's size is fixed for good once it is set up: neither side can
+   then fault the other by truncating it under its mapping. */
+#define SHM_SEALS (F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL)
+
+/* Control block for one direction of the connection. head and tail are
+   free-running byte counts, advanced only by the consumer and producer
+   respectively: the ring is empty when they are equal and full when they
+   are ring_size apart. */
+typedef struct {
+  gpr_atm head;
+  char head_pad[GPR_CACHELINE_SIZE - sizeof(gpr_atm)];
+  gpr_atm tail;
+  char tail_pad[GPR_CACHELINE_SIZE - sizeof(gpr_atm)];
+  /* Set by a side before it waits on its eventfd, and cleared by the side
+     that signals it. */
+  gpr_atm reader_sleeping;
+  gpr_atm writer_sleeping;
+  char sleeping_pad[GPR_CACHELINE_SIZE - 2 * sizeof(gpr_atm)];
+} shm_ring;
+
+/* Start of the shared region; the client-to-server and then the
+   server-to-client ring data follow it. */
+typedef struct {
+  uint32_t magic;
+  uint32_t ring_size;
+  char pad[GPR_CACHELINE_SIZE - 2 * sizeof(uint32_t)];
+  shm_ring rings[2];
+} shm_header;
+
+typedef struct {
+  grpc_endpoint base;
+  gpr_refcount refcount;
+
+  void* region;
+  size_t region_size;
+  size_t ring_size;
+  shm_ring* rx;
+  shm_ring* tx;
+  uint8_t* rx_data;
+  uint8_t* tx_data;
+
+  /* Signalled by the peer when rx has data, and when tx has space. */
+  grpc_fd* rx_fd;
+  grpc_fd* tx_fd;
+  /* Signalled by us when tx has data, and when rx has space. */
+  int peer_rx_fd;
+  int peer_tx_fd;
+  /* Bootstrap socket; becomes readable once the peer has gone away. */
+  grpc_fd* control_fd;
+  gpr_atm shutdown;
+
+  grpc_closure* read_cb;
+  grpc_slice_buffer* incoming_buffer;
+  grpc_closure read_ready;
+  grpc_resource_user_slice_allocator slice_allocator;
+
+  grpc_closure* write_cb;
+  grpc_slice_buffer* outgoing_buffer;
+  size_t outgoing_slice_idx;
+  size_t outgoing_byte_idx;
+  grpc_closure write_ready;
+
+  grpc_closure control_ready;
+
+  grpc_resource_user* resource_user;
+  char* peer_string;
+} shm_endpoint;
+
+grpc_error* grpc_shm_region_create(int* fds) {
+  for (size_t i = 0; i < GRPC_SHM_NUM_FDS; i++) {
+    fds[i] = -1;
+  }
+  size_t region_size = sizeof(shm_header) + 2 * SHM_RING_SIZE;
+  fds[0] = (int)syscall(SYS_memfd_create, "grpc_shm",
+                        MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fds[0] < 0) {
+    return GRPC_OS_ERROR(errno, "memfd_create");
+  }
+  if (ftruncate(fds[0], (off_t)region_size) != 0) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "ftruncate");
+    grpc_shm_close_fds(fds);
+    return error;
+  }
+  if (fcntl(fds[0], F_ADD_SEALS, SHM_SEALS) != 0) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "fcntl(F_ADD_SEALS)");
+    grpc_shm_close_fds(fds);
+    return error;
+  }
+  void* region = mmap(nullptr, sizeof(shm_header), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fds[0], 0);
+  if (region == MAP_FAILED) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "mmap");
+    grpc_shm_close_fds(fds);
+    return error;
+  }
+  /* A new memfd reads as zeros, so the rings start out empty and awake. */
+  shm_header* header = (shm_header*)region;
+  header->ring_size = SHM_RING_SIZE;
+  header->magic = SHM_MAGIC;
+  munmap(region, sizeof(shm_header));
+  for (size_t i = 1; i < GRPC_SHM_NUM_FDS; i++) {
+    fds[i] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fds[i] < 0) {
+      grpc_error* error = GRPC_OS_ERROR(errno, "eventfd");
+      grpc_shm_close_fds(fds);
+      return error;
+    }
+  }
+  return GRPC_ERROR_NONE;
+}
+
+void grpc_shm_close_fds(int* fds) {
+  for (size_t i = 0; i < GRPC_SHM_NUM_FDS; i++) {
+    if (fds[i] >= 0) {
+      close(fds[i]);
+      fds[i] = -1;
+    }
+  }
+}
+
+static void signal_fd(int fd) {
+  uint64_t one = 1;
+  ssize_t r;
+  do {
+    r = write(fd, &one, sizeof(one));
+  } while (r < 0 && errno == EINTR);
+}
+
+static void drain_fd(grpc_fd* fd) {
+  uint64_t count;
+  ssize_t r;
+  do {
+    r = read(grpc_fd_wrapped_fd(fd), &count, sizeof(count));
+  } while (r < 0 && errno == EINTR);
+}
+
+/* Clear the peer's sleeping flag, signalling it if it was set. Callers must
+   have published their progress with a full barrier first, pairing with the
+   barrier in mark_sleeping. */
+static void maybe_wake(gpr_atm* sleeping, int fd) {
+  if (gpr_atm_no_barrier_load(sleeping) != 0 &&
+      gpr_atm_no_barrier_cas(sleeping, 1, 0)) {
+    signal_fd(fd);
+  }
+}
+
+/* Returns true if the flag was already set, i.e. the ring has been checked
+   since the peer was last told to signal us. */
+static bool mark_sleeping(gpr_atm* sleeping) {
+  if (gpr_atm_no_barrier_load(sleeping) != 0) return true;
+  gpr_atm_no_barrier_store(sleeping, 1);
+  gpr_atm_full_barrier();
+  return false;
+}
+
+static void shm_free(shm_endpoint* s) {
+  grpc_fd_orphan(s->rx_fd, nullptr, nullptr, false /* already_closed */,
+                 "shm_endpoint");
+  grpc_fd_orphan(s->tx_fd, nullptr, nullptr, false /* already_closed */,
+                 "shm_endpoint");
+  grpc_fd_orphan(s->control_fd, nullptr, nullptr, false /* already_closed */,
+                 "shm_endpoint");
+  close(s->peer_rx_fd);
+  close(s->peer_tx_fd);
+  munmap(s->region, s->region_size);
+  grpc_resource_user_unref(s->resource_user);
+  gpr_free(s->peer_string);
+  gpr_free(s);
+}
+
+static void shm_unref(shm_endpoint* s) {
+  if (gpr_unref(&s->refcount)) {
+    shm_free(s);
+  }
+}
+
+static void shm_ref(shm_endpoint* s) { gpr_ref(&s->refcount); }
+
+/*******************************************************************************
+ * READING
+ */
+
+static void call_read_cb(shm_endpoint* s, grpc_error* error) {
+  grpc_closure* cb = s->read_cb;
+  if (error != GRPC_ERROR_NONE) {
+    grpc_slice_buffer_reset_and_unref_internal(s->incoming_buffer);
+  }
+  s->read_cb = nullptr;
+  s->incoming_buffer = nullptr;
+  GRPC_CLOSURE_SCHED(cb, error);
+  shm_unref(s);
+}
+
+/* Start taking everything the peer has produced: a slice for it is allocated
+   from the resource user, and filled by on_read_allocated. Returns false if
+   the ring is empty. */
+static bool read_ring(shm_endpoint* s) {
+  shm_ring* ring = s->rx;
+  size_t avail = (size_t)gpr_atm_acq_load(&ring->tail) -
+                 (size_t)gpr_atm_no_barrier_load(&ring->head);
+  if (avail == 0) return false;
+  gpr_atm_no_barrier_store(&ring->reader_sleeping, 0);
+  if (avail > s->ring_size) {
+    call_read_cb(s, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                        "Corrupt shared memory ring"));
+    return true;
+  }
+  grpc_resource_user_alloc_slices(&s->slice_allocator, avail, 1,
+                                  s->incoming_buffer);
+  return true;
+}
+
+static void on_read_allocated(void* arg, grpc_error* error) {
+  shm_endpoint* s = (shm_endpoint*)arg;
+  if (error != GRPC_ERROR_NONE) {
+    call_read_cb(s, GRPC_ERROR_REF(error));
+    return;
+  }
+  /* The peer may have produced more since, which is left for the next read:
+     only the bytes the slice was charged for are taken. */
+  shm_ring* ring = s->rx;
+  grpc_slice slice = s->incoming_buffer->slices[0];
+  size_t len = GRPC_SLICE_LENGTH(slice);
+  size_t head = (size_t)gpr_atm_no_barrier_load(&ring->head);
+  size_t offset = head & (s->ring_size - 1);
+  size_t first = GPR_MIN(len, s->ring_size - offset);
+  memcpy(GRPC_SLICE_START_PTR(slice), s->rx_data + offset, first);
+  memcpy(GRPC_SLICE_START_PTR(slice) + first, s->rx_data, len - first);
+  gpr_atm_rel_store(&ring->head, (gpr_atm)(head + len));
+  gpr_atm_full_barrier();
+  maybe_wake(&ring->writer_sleeping, s->peer_tx_fd);
+  call_read_cb(s, GRPC_ERROR_NONE);
+}
+
+static void read_or_wait(shm_endpoint* s) {
+  while (!read_ring(s)) {
+    if (mark_sleeping(&s->rx->reader_sleeping)) {
+      grpc_fd_notify_on_read(s->rx_fd, &s->read_ready);
+      return;
+    }
+  }
+}
+
+static void on_read_ready(void* arg, grpc_error* error) {
+  shm_endpoint* s = (shm_endpoint*)arg;
+  drain_fd(s->rx_fd);
+  if (error != GRPC_ERROR_NONE) {
+    /* Hand over whatever the peer wrote before it went away. */
+    if (!read_ring(s)) {
+      call_read_cb(s, GRPC_ERROR_REF(error));
+    }
+    return;
+  }
+  read_or_wait(s);
+}
+
+static void shm_read(grpc_endpoint* ep, grpc_slice_buffer* incoming_buffer,
+                     grpc_closure* cb) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  GPR_ASSERT(s->read_cb == nullptr);
+  s->read_cb = cb;
+  s->incoming_buffer = incoming_buffer;
+  grpc_slice_buffer_reset_and_unref_internal(incoming_buffer);
+  shm_ref(s);
+  read_or_wait(s);
+}
+
+/*******************************************************************************
+ * WRITING
+ */
+
+/* Copy as much of the outgoing buffer as fits. Returns true once all of it
+   has been written. */
+static bool write_ring(shm_endpoint* s, grpc_error** error) {
+  shm_ring* ring = s->tx;
+  size_t tail = (size_t)gpr_atm_no_barrier_load(&ring->tail);
+  size_t used = tail - (size_t)gpr_atm_acq_load(&ring->head);
+  if (used > s->ring_size) {
+    *error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Corrupt shared memory ring");
+    return true;
+  }
+  size_t space = s->ring_size - used;
+  size_t written = 0;
+  grpc_slice_buffer* buf = s->outgoing_buffer;
+  while (space > 0 && s->outgoing_slice_idx < buf->count) {
+    grpc_slice slice = buf->slices[s->outgoing_slice_idx];
+    const uint8_t* src = GRPC_SLICE_START_PTR(slice) + s->outgoing_byte_idx;
+    size_t n = GPR_MIN(space, GRPC_SLICE_LENGTH(slice) - s->outgoing_byte_idx);
+    size_t offset = (tail + written) & (s->ring_size - 1);
+    size_t first = GPR_MIN(n, s->ring_size - offset);
+    memcpy(s->tx_data + offset, src, first);
+    memcpy(s->tx_data, src + first, n - first);
+    written += n;
+    space -= n;
+    s->outgoing_byte_idx += n;
+    if (s->outgoing_byte_idx == GRPC_SLICE_LENGTH(slice)) {
+      s->outgoing_slice_idx++;
+      s->outgoing_byte_idx = 0;
+    }
+  }
+  if (written > 0) {
+    gpr_atm_rel_store(&ring->tail, (gpr_atm)(tail + written));
+    gpr_atm_full_barrier();
+    maybe_wake(&ring->reader_sleeping, s->peer_rx_fd);
+  }
+  *error = GRPC_ERROR_NONE;
+  return s->outgoing_slice_idx == buf->count;
+}
+
+static void call_write_cb(shm_endpoint* s, grpc_error* error) {
+  grpc_closure* cb = s->write_cb;
+  s->write_cb = nullptr;
+  s->outgoing_buffer = nullptr;
+  GRPC_CLOSURE_SCHED(cb, error);
+  shm_unref(s);
+}
+
+static void write_or_wait(shm_endpoint* s) {
+  grpc_error* error;
+  while (!write_ring(s, &error)) {
+    if (mark_sleeping(&s->tx->writer_sleeping)) {
+      grpc_fd_notify_on_read(s->tx_fd, &s->write_ready);
+      return;
+    }
+  }
+  gpr_atm_no_barrier_store(&s->tx->writer_sleeping, 0);
+  call_write_cb(s, error);
+}
+
+static void on_write_ready(void* arg, grpc_error* error) {
+  shm_endpoint* s = (shm_endpoint*)arg;
+  drain_fd(s->tx_fd);
+  if (error != GRPC_ERROR_NONE) {
+    call_write_cb(s, GRPC_ERROR_REF(error));
+    return;
+  }
+  write_or_wait(s);
+}
+
+static void shm_write(grpc_endpoint* ep, grpc_slice_buffer* buf,
+                      grpc_closure* cb) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  GPR_ASSERT(s->write_cb == nullptr);
+  if (gpr_atm_acq_load(&s->shutdown)) {
+    GRPC_CLOSURE_SCHED(
+        cb, GRPC_ERROR_CREATE_FROM_STATIC_STRING("Endpoint shutdown"));
+    return;
+  }
+  if (buf->length == 0) {
+    GRPC_CLOSURE_SCHED(cb, GRPC_ERROR_NONE);
+    return;
+  }
+  s->write_cb = cb;
+  s->outgoing_buffer = buf;
+  s->outgoing_slice_idx = 0;
+  s->outgoing_byte_idx = 0;
+  shm_ref(s);
+  write_or_wait(s);
+}
+
+/*******************************************************************************
+ * LIFECYCLE
+ */
+
+/* The peer never writes to the control socket, so it only becomes readable
+   at EOF. Wake any waiting reader or writer; reads still drain the ring
+   before failing. */
+static void on_control_ready(void* arg, grpc_error* error) {
+  shm_endpoint* s = (shm_endpoint*)arg;
+  if (error == GRPC_ERROR_NONE) {
+    char c;
+    ssize_t r;
+    do {
+      r = recv(grpc_fd_wrapped_fd(s->control_fd), &c, 1, MSG_DONTWAIT);
+    } while (r < 0 && errno == EINTR);
+    if (r < 0 && errno == EAGAIN) {
+      grpc_fd_notify_on_read(s->control_fd, &s->control_ready);
+      return;
+    }
+    error = r > 0 ? GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                        "Unexpected data on shm control socket")
+                  : GRPC_ERROR_CREATE_FROM_STATIC_STRING("Socket closed");
+  } else {
+    GRPC_ERROR_REF(error);
+  }
+  grpc_fd_shutdown(s->rx_fd, GRPC_ERROR_REF(error));
+  grpc_fd_shutdown(s->tx_fd, error);
+  shm_unref(s);
+}
+
+static void shm_shutdown(grpc_endpoint* ep, grpc_error* why) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  gpr_atm_rel_store(&s->shutdown, 1);
+  grpc_fd_shutdown(s->rx_fd, GRPC_ERROR_REF(why));
+  grpc_fd_shutdown(s->tx_fd, GRPC_ERROR_REF(why));
+  /* Also tells the peer that we have gone away. */
+  grpc_fd_shutdown(s->control_fd, GRPC_ERROR_REF(why));
+  grpc_resource_user_shutdown(s->resource_user);
+  GRPC_ERROR_UNREF(why);
+}
+
+static void shm_destroy(grpc_endpoint* ep) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  /* Release the ref held by the control socket watch. */
+  grpc_fd_shutdown(s->control_fd, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                      "shm endpoint destroyed"));
+  shm_unref(s);
+}
+
+static void shm_add_to_pollset(grpc_endpoint* ep, grpc_pollset* pollset) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  grpc_pollset_add_fd(pollset, s->rx_fd);
+  grpc_pollset_add_fd(pollset, s->tx_fd);
+  grpc_pollset_add_fd(pollset, s->control_fd);
+}
+
+static void shm_add_to_pollset_set(grpc_endpoint* ep,
+                                   grpc_pollset_set* pollset_set) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  grpc_pollset_set_add_fd(pollset_set, s->rx_fd);
+  grpc_pollset_set_add_fd(pollset_set, s->tx_fd);
+  grpc_pollset_set_add_fd(pollset_set, s->control_fd);
+}
+
+static void shm_delete_from_pollset_set(grpc_endpoint* ep,
+                                        grpc_pollset_set* pollset_set) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  grpc_pollset_set_del_fd(pollset_set, s->rx_fd);
+  grpc_pollset_set_del_fd(pollset_set, s->tx_fd);
+  grpc_pollset_set_del_fd(pollset_set, s->control_fd);
+}
+
+static grpc_resource_user* shm_get_resource_user(grpc_endpoint* ep) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  return s->resource_user;
+}
+
+static char* shm_get_peer(grpc_endpoint* ep) {
+  shm_endpoint* s = (shm_endpoint*)ep;
+  return gpr_strdup(s->peer_string);
+}
+
+static int shm_get_fd(grpc_endpoint* ep) { return -1; }
+
+static bool shm_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer) {
+  return false;
+}
+
+static const grpc_endpoint_vtable vtable = {shm_read,
+                                            shm_write,
+                                            shm_add_to_pollset,
+                                            shm_add_to_pollset_set,
+                                            shm_delete_from_pollset_set,
+                                            shm_shutdown,
+                                            shm_destroy,
+                                            shm_get_resource_user,
+                                            shm_get_peer,
+                                            shm_get_fd,
+                                            shm_set_tracer};
+
+grpc_error* grpc_shm_endpoint_create(grpc_fd* control, int* fds,
+                                     bool is_client,
+                                     const grpc_channel_args* args,
+                                     const char* peer_string,
+                                     grpc_endpoint** endpoint) {
+  /* The peer may have created the region, so check it before trusting any of
+     its layout. */
+  struct stat st;
+  if (fstat(fds[0], &st) != 0) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "fstat");
+    grpc_shm_close_fds(fds);
+    return error;
+  }
+  int seals = fcntl(fds[0], F_GET_SEALS);
+  if (seals < 0 || (seals & SHM_SEALS) != SHM_SEALS) {
+    grpc_shm_close_fds(fds);
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "Shared region is not sealed against resizing");
+  }
+  size_t region_size = (size_t)st.st_size;
+  if (region_size < sizeof(shm_header)) {
+    grpc_shm_close_fds(fds);
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING("Shared region too small");
+  }
+  void* region = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fds[0], 0);
+  if (region == MAP_FAILED) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "mmap");
+    grpc_shm_close_fds(fds);
+    return error;
+  }
+  shm_header* header = (shm_header*)region;
+  size_t ring_size = header->ring_size;
+  if (header->magic != SHM_MAGIC || ring_size == 0 ||
+      (ring_size & (ring_size - 1)) != 0 || ring_size > SHM_MAX_RING_SIZE ||
+      region_size < sizeof(shm_header) + 2 * ring_size) {
+    munmap(region, region_size);
+    grpc_shm_close_fds(fds);
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING("Invalid shared region");
+  }
+  close(fds[0]);
+  /* Ring 0 carries client-to-server bytes, ring 1 server-to-client. */
+  int rx = is_client ? 1 : 0;
+  int tx = 1 - rx;
+  shm_endpoint* s = (shm_endpoint*)gpr_zalloc(sizeof(*s));
+  s->base.vtable = &vtable;
+  s->region = region;
+  s->region_size = region_size;
+  s->ring_size = ring_size;
+  s->rx = &header->rings[rx];
+  s->tx = &header->rings[tx];
+  s->rx_data = (uint8_t*)region + sizeof(shm_header) + rx * ring_size;
+  s->tx_data = (uint8_t*)region + sizeof(shm_header) + tx * ring_size;
+  s->rx_fd = grpc_fd_create(fds[1 + 2 * rx], "shm_endpoint_rx");
+  s->tx_fd = grpc_fd_create(fds[2 + 2 * tx], "shm_endpoint_tx");
+  s->peer_rx_fd = fds[1 + 2 * tx];
+  s->peer_tx_fd = fds[2 + 2 * rx];
+  s->control_fd = control;
+  s->peer_string = gpr_strdup(peer_string);
+  GRPC_CLOSURE_INIT(&s->read_ready, on_read_ready, s,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&s->write_ready, on_write_ready, s,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&s->control_ready, on_control_ready, s,
+                    grpc_schedule_on_exec_ctx);
+  grpc_resource_quota* resource_quota =
+      args != nullptr ? grpc_resource_quota_from_channel_args(args)
+                      : grpc_resource_quota_create(nullptr);
+  s->resource_user = grpc_resource_user_create(resource_quota, peer_string);
+  grpc_resource_quota_unref_internal(resource_quota);
+  grpc_resource_user_slice_allocator_init(&s->slice_allocator,
+                                          s->resource_user, on_read_allocated,
+                                          s);
+  /* One ref for the caller and one for the control socket watch. */
+  gpr_ref_init(&s->refcount, 2);
+  grpc_fd_notify_on_read(s->control_fd, &s->control_ready);
+  *endpoint = &s->base;
+  return GRPC_ERROR_NONE;
+}
+
+#endif /* GRPC_LINUX_MEMFD && GRPC_LINUX_EVENTFD */
@@ -0,0 +1,63 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+#define GRPC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+/*
+   Endpoint that moves bytes between two processes on the same host through a
+   pair of single-producer/single-consumer rings in a shared memfd region.
+   Each side only makes a syscall when its peer has gone idle: a reader (or a
+   writer waiting for space) advertises that it is about to sleep on an
+   eventfd, and the other side signals that eventfd only if it sees the flag.
+
+   The region and its four eventfds are created by the connecting side and
+   passed to the listening side over a unix domain socket, which then stays
+   open as a control channel: it carries no data, and its closure tells each
+   side that the other has gone away.
+*/
+
+#include "src/core/lib/iomgr/port.h"
+
+#include "src/core/lib/iomgr/endpoint.h"
+
+#if defined(GRPC_LINUX_MEMFD) && defined(GRPC_LINUX_EVENTFD)
+
+#include "src/core/lib/iomgr/ev_posix.h"
+
+/* The region's memfd, followed by the data and space eventfds of the
+   client-to-server ring and then those of the server-to-client ring. */
+#define GRPC_SHM_NUM_FDS 5
+
+/* Create a shared region and its eventfds, storing them in fds. */
+grpc_error* grpc_shm_region_create(int* fds);
+
+/* Close every valid entry of fds and reset it to -1. */
+void grpc_shm_close_fds(int* fds);
+
+/* Map the region described by fds and create an endpoint over it, with the
+   client or server view of its rings. Always takes ownership of fds; takes
+   ownership of control (the bootstrap socket) only on success. */
+grpc_error* grpc_shm_endpoint_create(grpc_fd* control, int* fds,
+                                     bool is_client,
+                                     const grpc_channel_args* args,
+                                     const char* peer_string,
+                                     grpc_endpoint** endpoint);
+
+#endif /* GRPC_LINUX_MEMFD && GRPC_LINUX_EVENTFD */
+
+#endif /* GRPC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H */
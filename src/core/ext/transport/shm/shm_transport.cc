@@ -0,0 +1,563 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+#include "src/core/ext/transport/shm/shm_transport.h"
+
+#include <string.h>
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/surface/api_trace.h"
+#include "src/core/lib/surface/channel.h"
+
+bool grpc_shm_is_address(const char* target) {
+  return target != nullptr &&
+         strncmp(target, GRPC_SHM_SCHEME_PREFIX,
+                 strlen(GRPC_SHM_SCHEME_PREFIX)) == 0;
+}
+
+#if defined(GRPC_LINUX_MEMFD) && defined(GRPC_LINUX_EVENTFD)
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <grpc/support/sync.h>
+
+#include "src/core/ext/filters/client_channel/client_channel.h"
+#include "src/core/ext/filters/client_channel/connector.h"
+#include "src/core/ext/filters/client_channel/resolver_registry.h"
+#include "src/core/ext/filters/client_channel/subchannel.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/sockaddr_utils.h"
+#include "src/core/lib/iomgr/socket_utils_posix.h"
+#include "src/core/lib/iomgr/unix_sockets_posix.h"
+#include "src/core/lib/surface/server.h"
+
+/*******************************************************************************
+ * BOOTSTRAP
+ */
+
+/* The client sends the region's fds along with a single byte; nothing else
+   is ever written to the bootstrap socket. */
+typedef union {
+  char buf[CMSG_SPACE(sizeof(int) * GRPC_SHM_NUM_FDS)];
+  struct cmsghdr align;
+} fd_control_buffer;
+
+static grpc_error* send_fds(int sock, const int* fds) {
+  char byte = 0;
+  struct iovec iov = {&byte, 1};
+  fd_control_buffer control;
+  memset(&control, 0, sizeof(control));
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int) * GRPC_SHM_NUM_FDS);
+  memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * GRPC_SHM_NUM_FDS);
+  ssize_t r;
+  do {
+    r = sendmsg(sock, &msg, MSG_NOSIGNAL);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    return GRPC_OS_ERROR(errno, "sendmsg");
+  }
+  return GRPC_ERROR_NONE;
+}
+
+/* Sets *again if the client has not sent its fds yet. */
+static grpc_error* recv_fds(int sock, int* fds, bool* again) {
+  for (size_t i = 0; i < GRPC_SHM_NUM_FDS; i++) {
+    fds[i] = -1;
+  }
+  *again = false;
+  char byte;
+  struct iovec iov = {&byte, 1};
+  fd_control_buffer control;
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+  ssize_t r;
+  do {
+    r = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    if (errno == EAGAIN) {
+      *again = true;
+      return GRPC_ERROR_NONE;
+    }
+    return GRPC_OS_ERROR(errno, "recvmsg");
+  }
+  if (r == 0) {
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING("Socket closed");
+  }
+  size_t count = 0;
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+      continue;
+    }
+    size_t n = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    int* received = (int*)CMSG_DATA(cmsg);
+    for (size_t i = 0; i < n; i++, count++) {
+      if (count < GRPC_SHM_NUM_FDS) {
+        fds[count] = received[i];
+      } else {
+        close(received[i]);
+      }
+    }
+  }
+  if (count != GRPC_SHM_NUM_FDS || (msg.msg_flags & MSG_CTRUNC) != 0) {
+    grpc_shm_close_fds(fds);
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "Malformed shm bootstrap message");
+  }
+  return GRPC_ERROR_NONE;
+}
+
+/*******************************************************************************
+ * CLIENT
+ */
+
+static grpc_error* shm_connect(const grpc_resolved_address* addr,
+                               const grpc_channel_args* args,
+                               grpc_endpoint** endpoint) {
+  if (!grpc_is_unix_socket(addr)) {
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "shm addresses must name a unix domain socket");
+  }
+  int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (sock < 0) {
+    return GRPC_OS_ERROR(errno, "socket");
+  }
+  /* Unix domain connects complete (or fail) immediately, and the fds are
+     queued on the new connection even before the server accepts it, so
+     connecting never has to wait for the server. */
+  int r;
+  do {
+    r = connect(sock, (const struct sockaddr*)addr->addr,
+                (socklen_t)addr->len);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "connect");
+    close(sock);
+    return error;
+  }
+  int fds[GRPC_SHM_NUM_FDS];
+  grpc_error* error = grpc_shm_region_create(fds);
+  if (error != GRPC_ERROR_NONE) {
+    close(sock);
+    return error;
+  }
+  error = send_fds(sock, fds);
+  if (error != GRPC_ERROR_NONE) {
+    grpc_shm_close_fds(fds);
+    close(sock);
+    return error;
+  }
+  char* peer_string = grpc_sockaddr_to_uri(addr);
+  grpc_fd* control = grpc_fd_create(sock, "shm_client");
+  error = grpc_shm_endpoint_create(control, fds, true /* is_client */, args,
+                                   peer_string, endpoint);
+  if (error != GRPC_ERROR_NONE) {
+    grpc_fd_orphan(control, nullptr, nullptr, false /* already_closed */,
+                   "shm_client");
+  }
+  gpr_free(peer_string);
+  return error;
+}
+
+static void shm_connector_ref(grpc_connector* con) {}
+
+static void shm_connector_unref(grpc_connector* con) {}
+
+static void shm_connector_shutdown(grpc_connector* con, grpc_error* why) {
+  /* Connection attempts complete synchronously. */
+  GRPC_ERROR_UNREF(why);
+}
+
+static void shm_connector_connect(grpc_connector* con,
+                                  const grpc_connect_in_args* args,
+                                  grpc_connect_out_args* result,
+                                  grpc_closure* notify) {
+  grpc_resolved_address addr;
+  grpc_get_subchannel_address_arg(args->channel_args, &addr);
+  grpc_endpoint* endpoint;
+  grpc_error* error = shm_connect(&addr, args->channel_args, &endpoint);
+  if (error == GRPC_ERROR_NONE) {
+    result->transport =
+        grpc_create_chttp2_transport(args->channel_args, endpoint, true);
+    GPR_ASSERT(result->transport);
+    grpc_chttp2_transport_start_reading(result->transport, nullptr, nullptr);
+    result->channel_args = grpc_channel_args_copy(args->channel_args);
+  } else {
+    memset(result, 0, sizeof(*result));
+  }
+  GRPC_CLOSURE_SCHED(notify, error);
+}
+
+static const grpc_connector_vtable shm_connector_vtable = {
+    shm_connector_ref, shm_connector_unref, shm_connector_shutdown,
+    shm_connector_connect};
+
+static grpc_connector shm_connector = {&shm_connector_vtable};
+
+static void client_channel_factory_ref(
+    grpc_client_channel_factory* cc_factory) {}
+
+static void client_channel_factory_unref(
+    grpc_client_channel_factory* cc_factory) {}
+
+static grpc_subchannel* client_channel_factory_create_subchannel(
+    grpc_client_channel_factory* cc_factory, const grpc_subchannel_args* args) {
+  return grpc_subchannel_create(&shm_connector, args);
+}
+
+static grpc_channel* client_channel_factory_create_channel(
+    grpc_client_channel_factory* cc_factory, const char* target,
+    grpc_client_channel_type type, const grpc_channel_args* args) {
+  grpc_arg arg = grpc_channel_arg_string_create((char*)GRPC_ARG_SERVER_URI,
+                                                (char*)target);
+  const char* to_remove[] = {GRPC_ARG_SERVER_URI};
+  grpc_channel_args* new_args =
+      grpc_channel_args_copy_and_add_and_remove(args, to_remove, 1, &arg, 1);
+  grpc_channel* channel =
+      grpc_channel_create(target, new_args, GRPC_CLIENT_CHANNEL, nullptr);
+  grpc_channel_args_destroy(new_args);
+  return channel;
+}
+
+static const grpc_client_channel_factory_vtable client_channel_factory_vtable =
+    {client_channel_factory_ref, client_channel_factory_unref,
+     client_channel_factory_create_subchannel,
+     client_channel_factory_create_channel};
+
+static grpc_client_channel_factory client_channel_factory = {
+    &client_channel_factory_vtable};
+
+grpc_channel* grpc_shm_channel_create(const char* target,
+                                      const grpc_channel_args* args) {
+  GPR_ASSERT(grpc_shm_is_address(target));
+  grpc_arg arg =
+      grpc_client_channel_factory_create_channel_arg(&client_channel_factory);
+  grpc_channel_args* new_args = grpc_channel_args_copy_and_add(args, &arg, 1);
+  grpc_channel* channel = client_channel_factory_create_channel(
+      &client_channel_factory, target, GRPC_CLIENT_CHANNEL_TYPE_REGULAR,
+      new_args);
+  grpc_channel_args_destroy(new_args);
+  return channel != nullptr ? channel
+                            : grpc_lame_client_channel_create(
+                                  target, GRPC_STATUS_INTERNAL,
+                                  "Failed to create client channel");
+}
+
+/* "shm:" targets resolve exactly like "unix:" ones; the scheme only selects
+   the connector above. */
+static void shm_resolver_factory_ref(grpc_resolver_factory* factory) {}
+
+static void shm_resolver_factory_unref(grpc_resolver_factory* factory) {}
+
+static grpc_resolver* shm_resolver_factory_create_resolver(
+    grpc_resolver_factory* factory, grpc_resolver_args* args) {
+  grpc_resolver_factory* unix_factory = grpc_resolver_factory_lookup("unix");
+  if (unix_factory == nullptr) return nullptr;
+  /* The unix resolver insists on its own scheme. */
+  grpc_uri uri = *args->uri;
+  uri.scheme = const_cast<char*>("unix");
+  grpc_resolver_args unix_args = *args;
+  unix_args.uri = &uri;
+  grpc_resolver* resolver =
+      grpc_resolver_factory_create_resolver(unix_factory, &unix_args);
+  grpc_resolver_factory_unref(unix_factory);
+  return resolver;
+}
+
+static char* shm_resolver_factory_get_default_authority(
+    grpc_resolver_factory* factory, grpc_uri* uri) {
+  return gpr_strdup("localhost");
+}
+
+static const grpc_resolver_factory_vtable shm_resolver_factory_vtable = {
+    shm_resolver_factory_ref, shm_resolver_factory_unref,
+    shm_resolver_factory_create_resolver,
+    shm_resolver_factory_get_default_authority, "shm"};
+
+static grpc_resolver_factory shm_resolver_factory = {
+    &shm_resolver_factory_vtable};
+
+/*******************************************************************************
+ * SERVER
+ */
+
+typedef struct shm_pending_connection shm_pending_connection;
+
+typedef struct {
+  grpc_server* server;
+  grpc_channel_args* args;
+  grpc_fd* listen_fd;
+  grpc_closure on_accept;
+  grpc_pollset** pollsets;
+  size_t pollset_count;
+  size_t next_pollset;
+
+  gpr_mu mu;
+  /* One ref for the accept loop (or, before start, the server) plus one per
+     pending connection. */
+  gpr_refcount refs;
+  bool started;
+  bool shutdown;
+  shm_pending_connection* pending;
+  grpc_closure* destroy_done;
+} shm_listener;
+
+/* An accepted connection whose client has not sent its fds yet. */
+struct shm_pending_connection {
+  shm_listener* listener;
+  grpc_fd* fd;
+  grpc_pollset* pollset;
+  char* peer_string;
+  grpc_closure on_readable;
+  shm_pending_connection* prev;
+  shm_pending_connection* next;
+};
+
+static void shm_listener_unref(shm_listener* l) {
+  if (gpr_unref(&l->refs)) {
+    grpc_fd_orphan(l->listen_fd, nullptr, nullptr, false /* already_closed */,
+                   "shm_listener");
+    GRPC_CLOSURE_SCHED(l->destroy_done, GRPC_ERROR_NONE);
+    grpc_channel_args_destroy(l->args);
+    gpr_mu_destroy(&l->mu);
+    gpr_free(l);
+  }
+}
+
+static void on_connection_readable(void* arg, grpc_error* error) {
+  shm_pending_connection* conn = (shm_pending_connection*)arg;
+  shm_listener* l = conn->listener;
+  int fds[GRPC_SHM_NUM_FDS];
+  if (error == GRPC_ERROR_NONE) {
+    bool again;
+    error = recv_fds(grpc_fd_wrapped_fd(conn->fd), fds, &again);
+    if (error == GRPC_ERROR_NONE && again) {
+      grpc_fd_notify_on_read(conn->fd, &conn->on_readable);
+      return;
+    }
+  } else {
+    GRPC_ERROR_REF(error);
+  }
+  grpc_endpoint* endpoint = nullptr;
+  if (error == GRPC_ERROR_NONE) {
+    error = grpc_shm_endpoint_create(conn->fd, fds, false /* is_client */,
+                                     l->args, conn->peer_string, &endpoint);
+  }
+  gpr_mu_lock(&l->mu);
+  if (conn->prev != nullptr) {
+    conn->prev->next = conn->next;
+  } else {
+    l->pending = conn->next;
+  }
+  if (conn->next != nullptr) {
+    conn->next->prev = conn->prev;
+  }
+  if (error != GRPC_ERROR_NONE) {
+    gpr_log(GPR_DEBUG, "shm connection setup failed: %s",
+            grpc_error_string(error));
+    GRPC_ERROR_UNREF(error);
+    grpc_fd_orphan(conn->fd, nullptr, nullptr, false /* already_closed */,
+                   "shm_server_connection");
+  } else if (l->shutdown) {
+    grpc_endpoint_shutdown(endpoint, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                         "Server shutting down"));
+    grpc_endpoint_destroy(endpoint);
+  } else {
+    grpc_endpoint_add_to_pollset(endpoint, conn->pollset);
+    grpc_transport* transport =
+        grpc_create_chttp2_transport(l->args, endpoint, false);
+    grpc_server_setup_transport(l->server, transport, conn->pollset, l->args);
+    grpc_chttp2_transport_start_reading(transport, nullptr, nullptr);
+  }
+  gpr_mu_unlock(&l->mu);
+  gpr_free(conn->peer_string);
+  gpr_free(conn);
+  shm_listener_unref(l);
+}
+
+static void on_accept(void* arg, grpc_error* error) {
+  shm_listener* l = (shm_listener*)arg;
+  if (error != GRPC_ERROR_NONE) {
+    shm_listener_unref(l);
+    return;
+  }
+  for (;;) {
+    grpc_resolved_address addr;
+    addr.len = sizeof(struct sockaddr_storage);
+    int fd = grpc_accept4(grpc_fd_wrapped_fd(l->listen_fd), &addr, 1, 1);
+    if (fd < 0) {
+      if (errno == EINTR) continue;
+      if (errno != EAGAIN) {
+        gpr_log(GPR_ERROR, "Failed accept4: %s", strerror(errno));
+      }
+      break;
+    }
+    gpr_mu_lock(&l->mu);
+    if (l->shutdown) {
+      gpr_mu_unlock(&l->mu);
+      close(fd);
+      continue;
+    }
+    shm_pending_connection* conn =
+        (shm_pending_connection*)gpr_zalloc(sizeof(*conn));
+    conn->listener = l;
+    conn->fd = grpc_fd_create(fd, "shm_server_connection");
+    conn->pollset = l->pollsets[l->next_pollset++ % l->pollset_count];
+    conn->peer_string = grpc_sockaddr_to_uri(&addr);
+    GRPC_CLOSURE_INIT(&conn->on_readable, on_connection_readable, conn,
+                      grpc_schedule_on_exec_ctx);
+    conn->next = l->pending;
+    if (l->pending != nullptr) {
+      l->pending->prev = conn;
+    }
+    l->pending = conn;
+    gpr_ref(&l->refs);
+    grpc_pollset_add_fd(conn->pollset, conn->fd);
+    grpc_fd_notify_on_read(conn->fd, &conn->on_readable);
+    gpr_mu_unlock(&l->mu);
+  }
+  grpc_fd_notify_on_read(l->listen_fd, &l->on_accept);
+}
+
+static void shm_listener_start(grpc_server* server, void* arg,
+                               grpc_pollset** pollsets, size_t pollset_count) {
+  shm_listener* l = (shm_listener*)arg;
+  gpr_mu_lock(&l->mu);
+  l->pollsets = pollsets;
+  l->pollset_count = pollset_count;
+  l->started = true;
+  gpr_mu_unlock(&l->mu);
+  for (size_t i = 0; i < pollset_count; i++) {
+    grpc_pollset_add_fd(pollsets[i], l->listen_fd);
+  }
+  grpc_fd_notify_on_read(l->listen_fd, &l->on_accept);
+}
+
+static void shm_listener_destroy(grpc_server* server, void* arg,
+                                 grpc_closure* destroy_done) {
+  shm_listener* l = (shm_listener*)arg;
+  gpr_mu_lock(&l->mu);
+  l->shutdown = true;
+  l->destroy_done = destroy_done;
+  for (shm_pending_connection* conn = l->pending; conn != nullptr;
+       conn = conn->next) {
+    grpc_fd_shutdown(conn->fd, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                   "Server shutting down"));
+  }
+  bool started = l->started;
+  gpr_mu_unlock(&l->mu);
+  if (started) {
+    /* The accept loop drops its ref once it sees the shutdown. */
+    grpc_fd_shutdown(l->listen_fd, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                       "Server shutting down"));
+  } else {
+    shm_listener_unref(l);
+  }
+}
+
+grpc_error* grpc_shm_server_add_port(grpc_server* server, const char* addr,
+                                     grpc_channel_args* args, int* port_num) {
+  *port_num = 0;
+  grpc_resolved_addresses* resolved = nullptr;
+  grpc_error* error = grpc_resolve_unix_domain_address(
+      addr + strlen(GRPC_SHM_SCHEME_PREFIX), &resolved);
+  if (error != GRPC_ERROR_NONE) {
+    grpc_channel_args_destroy(args);
+    return error;
+  }
+  grpc_resolved_address* listen_addr = &resolved->addrs[0];
+  grpc_unlink_if_unix_domain_socket(listen_addr);
+  int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (sock < 0) {
+    error = GRPC_OS_ERROR(errno, "socket");
+  } else if (bind(sock, (const struct sockaddr*)listen_addr->addr,
+                  (socklen_t)listen_addr->len) < 0) {
+    error = GRPC_OS_ERROR(errno, "bind");
+  } else if (listen(sock, SOMAXCONN) < 0) {
+    error = GRPC_OS_ERROR(errno, "listen");
+  }
+  grpc_resolved_addresses_destroy(resolved);
+  if (error != GRPC_ERROR_NONE) {
+    if (sock >= 0) close(sock);
+    grpc_channel_args_destroy(args);
+    return error;
+  }
+  shm_listener* l = (shm_listener*)gpr_zalloc(sizeof(*l));
+  l->server = server;
+  l->args = args;
+  l->listen_fd = grpc_fd_create(sock, "shm_listener");
+  GRPC_CLOSURE_INIT(&l->on_accept, on_accept, l, grpc_schedule_on_exec_ctx);
+  gpr_mu_init(&l->mu);
+  gpr_ref_init(&l->refs, 1);
+  grpc_server_add_listener(server, l, shm_listener_start, shm_listener_destroy);
+  /* Like unix domain sockets, shm addresses have no port. */
+  *port_num = 1;
+  return GRPC_ERROR_NONE;
+}
+
+void grpc_shm_transport_init(void) {
+  grpc_register_resolver_type(&shm_resolver_factory);
+}
+
+void grpc_shm_transport_shutdown(void) {}
+
+#else /* GRPC_LINUX_MEMFD && GRPC_LINUX_EVENTFD */
+
+grpc_channel* grpc_shm_channel_create(const char* target,
+                                      const grpc_channel_args* args) {
+  return grpc_lame_client_channel_create(
+      target, GRPC_STATUS_UNIMPLEMENTED,
+      "shm transport is not supported on this platform");
+}
+
+grpc_error* grpc_shm_server_add_port(grpc_server* server, const char* addr,
+                                     grpc_channel_args* args, int* port_num) {
+  *port_num = 0;
+  grpc_channel_args_destroy(args);
+  return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "shm transport is not supported on this platform");
+}
+
+void grpc_shm_transport_init(void) {}
+
+void grpc_shm_transport_shutdown(void) {}
+
+#endif /* GRPC_LINUX_MEMFD && GRPC_LINUX_EVENTFD */
@@ -0,0 +1,46 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+#define GRPC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/iomgr/error.h"
+
+/* URI scheme of shared memory addresses, e.g. "shm:/tmp/sidecar.sock". The
+   path names the unix domain socket used to set up each connection. */
+#define GRPC_SHM_SCHEME_PREFIX "shm:"
+
+/* Returns true if target is a shared memory address. */
+bool grpc_shm_is_address(const char* target);
+
+/* Create a client channel that carries HTTP/2 over shared memory to a server
+   on the same host listening on target. */
+grpc_channel* grpc_shm_channel_create(const char* target,
+                                      const grpc_channel_args* args);
+
+/* Listen for shared memory connections to server at addr.
+   Takes ownership of args. */
+grpc_error* grpc_shm_server_add_port(grpc_server* server, const char* addr,
+                                     grpc_channel_args* args, int* port_num);
+
+void grpc_shm_transport_init(void);
+void grpc_shm_transport_shutdown(void);
+
+#endif /* GRPC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H */
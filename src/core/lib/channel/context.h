@@ -38,6 +38,9 @@ typedef enum {
   /// Value is a \a grpc_grpclb_client_stats.
   GRPC_GRPCLB_CLIENT_STATS,
 
+  /// Value is a \a grpc_network_timeline.
+  GRPC_CONTEXT_NETWORK_TIMELINE,
+
   GRPC_CONTEXT_COUNT
 } grpc_context_index;
 
@@ -31,17 +31,27 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "server_channels_created",
     "syscall_poll",
     "syscall_wait",
+    "pollset_spin_hits",
+    "pollset_spin_misses",
+    "pollset_epoll_set_drains",
     "pollset_kick",
     "pollset_kicked_without_poller",
     "pollset_kicked_again",
     "pollset_kick_wakeup_fd",
     "pollset_kick_wakeup_cv",
     "pollset_kick_own_thread",
+    "pollset_kick_suppressed",
     "histogram_slow_lookups",
     "syscall_write",
     "syscall_read",
     "tcp_backup_pollers_created",
     "tcp_backup_poller_polls",
+    "tcp_write_zerocopy",
+    "tcp_write_zerocopy_copied",
+    "tcp_read_provided_buffer",
+    "tcp_read_provided_buffer_exhausted",
+    "tcp_write_paced",
+    "io_uring_deferred_submit",
     "http2_op_batches",
     "http2_op_cancel",
     "http2_op_send_initial_metadata",
@@ -104,6 +114,8 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "combiner_locks_scheduled_items",
     "combiner_locks_scheduled_final_items",
     "combiner_locks_offloaded",
+    "combiner_locks_scheduled_background_items",
+    "exec_ctx_background_closures",
     "call_combiner_locks_initiated",
     "call_combiner_locks_scheduled_items",
     "call_combiner_set_notify_on_cancel",
@@ -114,6 +126,8 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "executor_wakeup_initiated",
     "executor_queue_drained",
     "executor_push_retries",
+    "executor_closures_stolen",
+    "executor_failed_steals",
     "server_requested_calls",
     "server_slowpath_requests_queued",
     "cq_ev_queue_trylock_failures",
@@ -129,6 +143,12 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of server channels created",
     "Number of polling syscalls (epoll_wait, poll, etc) made by this process",
     "Number of sleeping syscalls made by this process",
+    "Number of times a designated poller found events while spinning on a "
+    "non-blocking epoll_wait, avoiding a sleep (epoll1 only)",
+    "Number of times a designated poller exhausted its spin budget without "
+    "finding events and went on to block (epoll1 only)",
+    "Number of times the poller of the first epoll set drained another set "
+    "that had no designated poller of its own (epoll1_sharded only)",
     "How many polling wakeups were performed by the process (only valid for "
     "epoll1 right now)",
     "How many times was a polling wakeup requested without an active poller "
@@ -141,6 +161,9 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "polling wakeup (only valid for epoll1 right now)",
     "How many times could a polling wakeup be satisfied by keeping the waking "
     "thread awake? (only valid for epoll1 right now)",
+    "How many times was a designated poller woken without writing its eventfd, "
+    "because it was spinning, had not yet started to poll or had already "
+    "finished polling (only valid for epoll1 right now)",
     "Number of times histogram increments went through the slow (binary "
     "search) path",
     "Number of write syscalls (or equivalent - eg sendmsg) made by this "
@@ -148,6 +171,18 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of times a backup poller has been created (this can be expensive)",
     "Number of polls performed on the backup poller",
+    "Number of write syscalls (or equivalent - eg sendmsg) made with "
+    "MSG_ZEROCOPY by this process",
+    "Number of MSG_ZEROCOPY writes whose completion reported that the kernel "
+    "copied the payload anyway",
+    "Number of reads by io_uring endpoints that landed in a buffer provided to "
+    "the kernel by the polling engine",
+    "Number of reads by io_uring endpoints retried into an ordinary slice "
+    "because every provided buffer was in use",
+    "Number of times a write that had been handed to the kernel was held "
+    "pending because the socket had TCP_NOTSENT_LOWAT or more bytes unsent",
+    "Number of io_uring operations queued by a polling thread for submission "
+    "with the rest of its batch, rather than submitted immediately",
     "Number of batches received by HTTP2 transport",
     "Number of cancelations received by HTTP2 transport",
     "Number of batches containing send initial metadata",
@@ -220,6 +255,8 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of items scheduled against combiner locks",
     "Number of final items scheduled against combiner locks",
     "Number of combiner locks offloaded to different threads",
+    "Number of background items scheduled against combiner locks",
+    "Number of closures scheduled on the background lane of an exec_ctx",
     "Number of call combiner lock entries by process (first items queued to a "
     "call combiner)",
     "Number of items scheduled against call combiner locks",
@@ -234,6 +271,9 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of times an executor queue was drained",
     "Number of times we raced and were forced to retry pushing a closure to "
     "the executor",
+    "Number of closures an executor thread took from another thread's queue",
+    "Number of times an idle executor thread looked for work to steal and "
+    "found none",
     "How many calls were requested (not necessarily received) by the server",
     "How many times was the server slow path taken (indicates too few "
     "outstanding requests)",
@@ -247,31 +287,56 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
 const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "call_initial_size",
     "poll_events_returned",
+    "pollset_spin_time_us",
     "tcp_write_size",
     "tcp_write_iov_size",
     "tcp_read_size",
     "tcp_read_offer",
     "tcp_read_offer_iov_size",
+    "tcp_write_zerocopy_size",
+    "tcp_write_scheduled_us",
+    "tcp_write_sent_us",
+    "tcp_write_acked_us",
+    "tcp_read_queued_us",
     "http2_send_message_size",
     "http2_send_initial_metadata_per_write",
     "http2_send_message_per_write",
     "http2_send_trailing_metadata_per_write",
     "http2_send_flowctl_per_write",
+    "exec_ctx_critical_queue_delay_us",
+    "exec_ctx_background_queue_delay_us",
+    "executor_queue_depth",
     "server_cqs_checked",
 };
 const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Initial size of the grpc_call arena created at call start",
     "How many events are called for each syscall_poll",
+    "Microseconds spent spinning per spin attempt (epoll1 only)",
     "Number of bytes offered to each syscall_write",
     "Number of byte segments offered to each syscall_write",
     "Number of bytes received by each syscall_read",
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
+    "Number of bytes offered to each MSG_ZEROCOPY syscall_write",
+    "Microseconds from completing a timestamped write to its last byte "
+    "entering the packet scheduler (with GRPC_ARG_TCP_TIMESTAMPING)",
+    "Microseconds from completing a timestamped write to its last byte being "
+    "handed to the network device",
+    "Microseconds from completing a timestamped write to its last byte being "
+    "acknowledged by the peer",
+    "Microseconds data waited in the kernel between being received and being "
+    "returned by a read (with GRPC_ARG_TCP_TIMESTAMPING)",
     "Size of messages received by HTTP2 transport",
     "Number of streams initiated written per TCP write",
     "Number of streams whose payload was written per TCP write",
     "Number of streams terminated per TCP write",
     "Number of flow control updates written per TCP write",
+    "Microseconds latency-critical closures waited to run on an exec_ctx that "
+    "also had background work queued",
+    "Microseconds each closure at the head of an exec_ctx's background lane "
+    "waited before running",
+    "Number of closures queued to an executor thread when a closure is pushed "
+    "to it",
     "How many completion queues were checked looking for a CQ that had "
     "requested the incoming call",
 };
@@ -311,7 +376,15 @@ const uint8_t grpc_stats_table_3[166] = {
     65, 65, 66, 67, 67, 68, 69, 69, 70, 71, 71, 72, 72, 73, 73, 74, 75, 75, 76,
     76, 77, 78, 79, 79, 80, 81, 82, 83, 84, 85, 85, 86, 87, 88, 88, 89, 90, 90,
     91, 92, 92, 93, 94, 94, 95, 95, 96, 97, 97, 98, 98, 99};
-const int grpc_stats_table_4[65] = {
+const int grpc_stats_table_4[33] = {
+    0,      1,      2,      4,      7,      11,     17,    26,    40,
+    61,     94,     144,    220,    336,    512,    780,   1189,  1812,
+    2761,   4206,   6407,   9760,   14868,  22648,  34499, 52551, 80049,
+    121936, 185741, 282932, 430978, 656490, 1000000};
+const uint8_t grpc_stats_table_5[36] = {
+    0,  0,  1,  2,  3,  3,  4,  5,  6,  7,  8,  8,  9,  10, 11, 11, 12, 13,
+    14, 15, 16, 16, 17, 18, 19, 20, 21, 21, 22, 23, 24, 25, 26, 26, 27, 28};
+const int grpc_stats_table_6[65] = {
     0,       1,       2,       3,       4,       6,       8,        11,
     15,      20,      26,      34,      44,      57,      73,       94,
     121,     155,     199,     255,     327,     419,     537,      688,
@@ -321,27 +394,70 @@ const int grpc_stats_table_4[65] = {
     326126,  417200,  533707,  682750,  873414,  1117323, 1429345,  1828502,
     2339127, 2992348, 3827987, 4896985, 6264509, 8013925, 10251880, 13114801,
     16777216};
-const uint8_t grpc_stats_table_5[87] = {
+const uint8_t grpc_stats_table_7[87] = {
     0,  0,  1,  1,  2,  3,  3,  4,  4,  5,  6,  6,  7,  8,  8,  9,  10, 11,
     11, 12, 13, 13, 14, 15, 15, 16, 17, 17, 18, 19, 20, 20, 21, 22, 22, 23,
     24, 25, 25, 26, 27, 27, 28, 29, 29, 30, 31, 31, 32, 33, 34, 34, 35, 36,
     36, 37, 38, 39, 39, 40, 41, 41, 42, 43, 44, 44, 45, 45, 46, 47, 48, 48,
     49, 50, 51, 51, 52, 53, 53, 54, 55, 56, 56, 57, 58, 58, 59};
-const int grpc_stats_table_6[65] = {
+const int grpc_stats_table_8[65] = {
     0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,
     14,  16,  18,  20,  22,  24,  27,  30,  33,  36,  39,  43,  47,
     51,  56,  61,  66,  72,  78,  85,  92,  100, 109, 118, 128, 139,
     151, 164, 178, 193, 209, 226, 244, 264, 285, 308, 333, 359, 387,
     418, 451, 486, 524, 565, 609, 656, 707, 762, 821, 884, 952, 1024};
-const uint8_t grpc_stats_table_7[102] = {
+const uint8_t grpc_stats_table_9[102] = {
     0,  0,  0,  1,  1,  1,  1,  2,  2,  3,  3,  4,  4,  5,  5,  6,  6,
     6,  7,  7,  7,  8,  8,  9,  9,  10, 11, 11, 12, 12, 13, 13, 14, 14,
     14, 15, 15, 16, 16, 17, 17, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23,
     23, 24, 24, 24, 25, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32,
     32, 33, 33, 34, 35, 35, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41,
     42, 42, 43, 44, 44, 45, 46, 46, 47, 48, 48, 49, 49, 50, 50, 51, 51};
-const int grpc_stats_table_8[9] = {0, 1, 2, 4, 7, 13, 23, 39, 64};
-const uint8_t grpc_stats_table_9[9] = {0, 0, 1, 2, 2, 3, 4, 4, 5};
+const int grpc_stats_table_10[65] = {
+    0,      1,      2,      3,      4,      5,      7,      9,      12,
+    15,     19,     24,     30,     37,     46,     57,     70,     86,
+    105,    129,    158,    193,    236,    288,    352,    430,    525,
+    641,    782,    954,    1164,   1420,   1733,   2114,   2579,   3146,
+    3838,   4682,   5711,   6967,   8499,   10367,  12646,  15426,  18816,
+    22951,  27995,  34148,  41653,  50807,  61972,  75591,  92203,  112465,
+    137180, 167326, 204096, 248947, 303653, 370381, 451772, 551049, 672141,
+    819843, 1000000};
+const uint8_t grpc_stats_table_11[139] = {
+    0,  0,  0,  1,  1,  1,  2,  2,  2,  3,  3,  3,  4,  4,  5,  5,  5,  6,
+    6,  6,  7,  7,  8,  8,  9,  9,  9,  10, 10, 11, 11, 12, 12, 12, 13, 13,
+    13, 14, 15, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19, 19, 20, 20, 20, 21,
+    21, 22, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28, 29,
+    29, 30, 30, 31, 31, 31, 32, 32, 33, 33, 34, 34, 34, 35, 35, 36, 36, 37,
+    37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 41, 42, 42, 43, 43, 44, 44, 44,
+    45, 45, 46, 46, 47, 47, 48, 48, 48, 49, 49, 50, 50, 51, 51, 51, 52, 52,
+    53, 53, 54, 54, 55, 55, 55, 56, 56, 57, 57, 58, 58};
+const int grpc_stats_table_12[65] = {
+    0,       1,       2,       3,       4,       6,       8,       11,
+    14,      18,      23,      30,      39,      50,      64,      82,
+    105,     134,     171,     218,     277,     352,     447,     568,
+    721,     916,     1163,    1477,    1875,    2380,    3021,    3835,
+    4868,    6179,    7843,    9955,    12635,   16036,   20353,   25832,
+    32785,   41610,   52810,   67024,   85064,   107959,  137017,  173895,
+    220699,  280100,  355489,  451169,  572601,  726716,  922311,  1170550,
+    1485602, 1885449, 2392914, 3036962, 3854353, 4891743, 6208344, 7879305,
+    10000000};
+const uint8_t grpc_stats_table_13[83] = {
+    0,  0,  1,  1,  2,  3,  3,  4,  5,  6,  6,  7,  8,  8,  9,  9,  10,
+    11, 12, 12, 13, 14, 15, 15, 16, 17, 18, 18, 19, 20, 20, 21, 22, 23,
+    23, 24, 25, 26, 26, 27, 28, 28, 29, 30, 31, 31, 32, 33, 34, 34, 35,
+    35, 36, 37, 38, 38, 39, 40, 41, 41, 42, 43, 44, 44, 45, 46, 47, 47,
+    48, 49, 49, 50, 51, 52, 52, 53, 54, 55, 55, 56, 57, 58, 58};
+const int grpc_stats_table_14[33] = {
+    0,   1,   2,   3,   4,   5,   7,   9,   11,  14,  17,
+    21,  26,  32,  39,  47,  57,  69,  83,  100, 120, 144,
+    173, 207, 248, 297, 355, 424, 506, 604, 721, 860, 1024};
+const uint8_t grpc_stats_table_15[60] = {
+    0,  0,  0,  1,  1,  1,  2,  2,  3,  3,  3,  4,  4,  5,  5,
+    6,  6,  6,  7,  7,  7,  8,  9,  9,  10, 10, 10, 11, 11, 12,
+    12, 13, 13, 14, 14, 14, 15, 15, 16, 17, 17, 18, 18, 18, 19,
+    19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26};
+const int grpc_stats_table_16[9] = {0, 1, 2, 4, 7, 13, 23, 39, 64};
+const uint8_t grpc_stats_table_17[9] = {0, 0, 1, 2, 2, 3, 4, 4, 5};
 void grpc_stats_inc_call_initial_size(int value) {
   value = GPR_CLAMP(value, 0, 262144);
   if (value < 6) {
@@ -388,6 +504,29 @@ void grpc_stats_inc_poll_events_returned(int value) {
       GRPC_STATS_HISTOGRAM_POLL_EVENTS_RETURNED,
       grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_2, 128));
 }
+void grpc_stats_inc_pollset_spin_time_us(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 3) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_POLLSET_SPIN_TIME_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4676988213024260096ull) {
+    int bucket =
+        grpc_stats_table_5[((_val.uint - 4613937818241073152ull) >> 51)] + 3;
+    _bkt.dbl = grpc_stats_table_4[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_POLLSET_SPIN_TIME_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_POLLSET_SPIN_TIME_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_4, 32));
+}
 void grpc_stats_inc_tcp_write_size(int value) {
   value = GPR_CLAMP(value, 0, 16777216);
   if (value < 5) {
@@ -401,15 +540,15 @@ void grpc_stats_inc_tcp_write_size(int value) {
   _val.dbl = value;
   if (_val.uint < 4683743612465315840ull) {
     int bucket =
-        grpc_stats_table_5[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
-    _bkt.dbl = grpc_stats_table_4[bucket];
+        grpc_stats_table_7[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_6[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE, bucket);
     return;
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_4, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
 }
 void grpc_stats_inc_tcp_write_iov_size(int value) {
   value = GPR_CLAMP(value, 0, 1024);
@@ -424,15 +563,15 @@ void grpc_stats_inc_tcp_write_iov_size(int value) {
   _val.dbl = value;
   if (_val.uint < 4637863191261478912ull) {
     int bucket =
-        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
-    _bkt.dbl = grpc_stats_table_6[bucket];
+        grpc_stats_table_9[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_8[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE, bucket);
     return;
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
 }
 void grpc_stats_inc_tcp_read_size(int value) {
   value = GPR_CLAMP(value, 0, 16777216);
@@ -447,15 +586,15 @@ void grpc_stats_inc_tcp_read_size(int value) {
   _val.dbl = value;
   if (_val.uint < 4683743612465315840ull) {
     int bucket =
-        grpc_stats_table_5[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
-    _bkt.dbl = grpc_stats_table_4[bucket];
+        grpc_stats_table_7[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_6[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_READ_SIZE, bucket);
     return;
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_TCP_READ_SIZE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_4, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
 }
 void grpc_stats_inc_tcp_read_offer(int value) {
   value = GPR_CLAMP(value, 0, 16777216);
@@ -470,15 +609,15 @@ void grpc_stats_inc_tcp_read_offer(int value) {
   _val.dbl = value;
   if (_val.uint < 4683743612465315840ull) {
     int bucket =
-        grpc_stats_table_5[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
-    _bkt.dbl = grpc_stats_table_4[bucket];
+        grpc_stats_table_7[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_6[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_READ_OFFER, bucket);
     return;
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_TCP_READ_OFFER,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_4, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
 }
 void grpc_stats_inc_tcp_read_offer_iov_size(int value) {
   value = GPR_CLAMP(value, 0, 1024);
@@ -494,8 +633,8 @@ void grpc_stats_inc_tcp_read_offer_iov_size(int value) {
   _val.dbl = value;
   if (_val.uint < 4637863191261478912ull) {
     int bucket =
-        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
-    _bkt.dbl = grpc_stats_table_6[bucket];
+        grpc_stats_table_9[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_8[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE,
                              bucket);
@@ -503,8 +642,127 @@ void grpc_stats_inc_tcp_read_offer_iov_size(int value) {
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
+}
+void grpc_stats_inc_tcp_write_zerocopy_size(int value) {
+  value = GPR_CLAMP(value, 0, 16777216);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_ZEROCOPY_SIZE,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4683743612465315840ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_ZEROCOPY_SIZE,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_TCP_WRITE_ZEROCOPY_SIZE,
       grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
 }
+void grpc_stats_inc_tcp_write_scheduled_us(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_SCHEDULED_US,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_SCHEDULED_US,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_TCP_WRITE_SCHEDULED_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_tcp_write_sent_us(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_SENT_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_SENT_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_TCP_WRITE_SENT_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_tcp_write_acked_us(int value) {
+  value = GPR_CLAMP(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_ACKED_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_13[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_12[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_WRITE_ACKED_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_TCP_WRITE_ACKED_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_12, 64));
+}
+void grpc_stats_inc_tcp_read_queued_us(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_READ_QUEUED_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_TCP_READ_QUEUED_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_TCP_READ_QUEUED_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
 void grpc_stats_inc_http2_send_message_size(int value) {
   value = GPR_CLAMP(value, 0, 16777216);
   if (value < 5) {
@@ -519,8 +777,8 @@ void grpc_stats_inc_http2_send_message_size(int value) {
   _val.dbl = value;
   if (_val.uint < 4683743612465315840ull) {
     int bucket =
-        grpc_stats_table_5[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
-    _bkt.dbl = grpc_stats_table_4[bucket];
+        grpc_stats_table_7[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_6[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE,
                              bucket);
@@ -528,7 +786,7 @@ void grpc_stats_inc_http2_send_message_size(int value) {
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_4, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
 }
 void grpc_stats_inc_http2_send_initial_metadata_per_write(int value) {
   value = GPR_CLAMP(value, 0, 1024);
@@ -544,8 +802,8 @@ void grpc_stats_inc_http2_send_initial_metadata_per_write(int value) {
   _val.dbl = value;
   if (_val.uint < 4637863191261478912ull) {
     int bucket =
-        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
-    _bkt.dbl = grpc_stats_table_6[bucket];
+        grpc_stats_table_9[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_8[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(
         GRPC_STATS_HISTOGRAM_HTTP2_SEND_INITIAL_METADATA_PER_WRITE, bucket);
@@ -553,7 +811,7 @@ void grpc_stats_inc_http2_send_initial_metadata_per_write(int value) {
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_HTTP2_SEND_INITIAL_METADATA_PER_WRITE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
 }
 void grpc_stats_inc_http2_send_message_per_write(int value) {
   value = GPR_CLAMP(value, 0, 1024);
@@ -569,8 +827,8 @@ void grpc_stats_inc_http2_send_message_per_write(int value) {
   _val.dbl = value;
   if (_val.uint < 4637863191261478912ull) {
     int bucket =
-        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
-    _bkt.dbl = grpc_stats_table_6[bucket];
+        grpc_stats_table_9[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_8[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_PER_WRITE,
                              bucket);
@@ -578,7 +836,7 @@ void grpc_stats_inc_http2_send_message_per_write(int value) {
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_PER_WRITE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
 }
 void grpc_stats_inc_http2_send_trailing_metadata_per_write(int value) {
   value = GPR_CLAMP(value, 0, 1024);
@@ -594,8 +852,8 @@ void grpc_stats_inc_http2_send_trailing_metadata_per_write(int value) {
   _val.dbl = value;
   if (_val.uint < 4637863191261478912ull) {
     int bucket =
-        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
-    _bkt.dbl = grpc_stats_table_6[bucket];
+        grpc_stats_table_9[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_8[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(
         GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE, bucket);
@@ -603,7 +861,7 @@ void grpc_stats_inc_http2_send_trailing_metadata_per_write(int value) {
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
 }
 void grpc_stats_inc_http2_send_flowctl_per_write(int value) {
   value = GPR_CLAMP(value, 0, 1024);
@@ -619,8 +877,8 @@ void grpc_stats_inc_http2_send_flowctl_per_write(int value) {
   _val.dbl = value;
   if (_val.uint < 4637863191261478912ull) {
     int bucket =
-        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
-    _bkt.dbl = grpc_stats_table_6[bucket];
+        grpc_stats_table_9[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_8[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
                              bucket);
@@ -628,7 +886,80 @@ void grpc_stats_inc_http2_send_flowctl_per_write(int value) {
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
+}
+void grpc_stats_inc_exec_ctx_critical_queue_delay_us(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 3) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_EXEC_CTX_CRITICAL_QUEUE_DELAY_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4676988213024260096ull) {
+    int bucket =
+        grpc_stats_table_5[((_val.uint - 4613937818241073152ull) >> 51)] + 3;
+    _bkt.dbl = grpc_stats_table_4[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_EXEC_CTX_CRITICAL_QUEUE_DELAY_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_EXEC_CTX_CRITICAL_QUEUE_DELAY_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_4, 32));
+}
+void grpc_stats_inc_exec_ctx_background_queue_delay_us(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 3) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4676988213024260096ull) {
+    int bucket =
+        grpc_stats_table_5[((_val.uint - 4613937818241073152ull) >> 51)] + 3;
+    _bkt.dbl = grpc_stats_table_4[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_4, 32));
+}
+void grpc_stats_inc_executor_queue_depth(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_EXECUTOR_QUEUE_DEPTH, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4633078116657397760ull) {
+    int bucket =
+        grpc_stats_table_15[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_14[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_EXECUTOR_QUEUE_DEPTH, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_EXECUTOR_QUEUE_DEPTH,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_14, 32));
 }
 void grpc_stats_inc_server_cqs_checked(int value) {
   value = GPR_CLAMP(value, 0, 64);
@@ -643,37 +974,51 @@ void grpc_stats_inc_server_cqs_checked(int value) {
   _val.dbl = value;
   if (_val.uint < 4625196817309499392ull) {
     int bucket =
-        grpc_stats_table_9[((_val.uint - 4613937818241073152ull) >> 51)] + 3;
-    _bkt.dbl = grpc_stats_table_8[bucket];
+        grpc_stats_table_17[((_val.uint - 4613937818241073152ull) >> 51)] + 3;
+    _bkt.dbl = grpc_stats_table_16[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED, bucket);
     return;
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 8));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_16, 8));
 }
-const int grpc_stats_histo_buckets[13] = {64, 128, 64, 64, 64, 64, 64,
-                                          64, 64,  64, 64, 64, 8};
-const int grpc_stats_histo_start[13] = {0,   64,  192, 256, 320, 384, 448,
-                                        512, 576, 640, 704, 768, 832};
-const int* const grpc_stats_histo_bucket_boundaries[13] = {
-    grpc_stats_table_0, grpc_stats_table_2, grpc_stats_table_4,
-    grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_4,
-    grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_6,
-    grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_6,
-    grpc_stats_table_8};
-void (*const grpc_stats_inc_histogram[13])(int x) = {
+const int grpc_stats_histo_buckets[22] = {64, 128, 32, 64, 64, 64, 64, 64,
+                                          64, 64,  64, 64, 64, 64, 64, 64,
+                                          64, 64,  32, 32, 32, 8};
+const int grpc_stats_histo_start[22] = {
+    0,   64,  192, 224, 288, 352,  416,  480,  544,  608,  672,
+    736, 800, 864, 928, 992, 1056, 1120, 1184, 1216, 1248, 1280};
+const int* const grpc_stats_histo_bucket_boundaries[22] = {
+    grpc_stats_table_0,  grpc_stats_table_2,  grpc_stats_table_4,
+    grpc_stats_table_6,  grpc_stats_table_8,  grpc_stats_table_6,
+    grpc_stats_table_6,  grpc_stats_table_8,  grpc_stats_table_6,
+    grpc_stats_table_10, grpc_stats_table_10, grpc_stats_table_12,
+    grpc_stats_table_10, grpc_stats_table_6,  grpc_stats_table_8,
+    grpc_stats_table_8,  grpc_stats_table_8,  grpc_stats_table_8,
+    grpc_stats_table_4,  grpc_stats_table_4,  grpc_stats_table_14,
+    grpc_stats_table_16};
+void (*const grpc_stats_inc_histogram[22])(int x) = {
     grpc_stats_inc_call_initial_size,
     grpc_stats_inc_poll_events_returned,
+    grpc_stats_inc_pollset_spin_time_us,
     grpc_stats_inc_tcp_write_size,
     grpc_stats_inc_tcp_write_iov_size,
     grpc_stats_inc_tcp_read_size,
     grpc_stats_inc_tcp_read_offer,
     grpc_stats_inc_tcp_read_offer_iov_size,
+    grpc_stats_inc_tcp_write_zerocopy_size,
+    grpc_stats_inc_tcp_write_scheduled_us,
+    grpc_stats_inc_tcp_write_sent_us,
+    grpc_stats_inc_tcp_write_acked_us,
+    grpc_stats_inc_tcp_read_queued_us,
     grpc_stats_inc_http2_send_message_size,
     grpc_stats_inc_http2_send_initial_metadata_per_write,
     grpc_stats_inc_http2_send_message_per_write,
     grpc_stats_inc_http2_send_trailing_metadata_per_write,
     grpc_stats_inc_http2_send_flowctl_per_write,
+    grpc_stats_inc_exec_ctx_critical_queue_delay_us,
+    grpc_stats_inc_exec_ctx_background_queue_delay_us,
+    grpc_stats_inc_executor_queue_depth,
     grpc_stats_inc_server_cqs_checked};
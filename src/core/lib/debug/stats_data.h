@@ -33,17 +33,27 @@ typedef enum {
   GRPC_STATS_COUNTER_SERVER_CHANNELS_CREATED,
   GRPC_STATS_COUNTER_SYSCALL_POLL,
   GRPC_STATS_COUNTER_SYSCALL_WAIT,
+  GRPC_STATS_COUNTER_POLLSET_SPIN_HITS,
+  GRPC_STATS_COUNTER_POLLSET_SPIN_MISSES,
+  GRPC_STATS_COUNTER_POLLSET_EPOLL_SET_DRAINS,
   GRPC_STATS_COUNTER_POLLSET_KICK,
   GRPC_STATS_COUNTER_POLLSET_KICKED_WITHOUT_POLLER,
   GRPC_STATS_COUNTER_POLLSET_KICKED_AGAIN,
   GRPC_STATS_COUNTER_POLLSET_KICK_WAKEUP_FD,
   GRPC_STATS_COUNTER_POLLSET_KICK_WAKEUP_CV,
   GRPC_STATS_COUNTER_POLLSET_KICK_OWN_THREAD,
+  GRPC_STATS_COUNTER_POLLSET_KICK_SUPPRESSED,
   GRPC_STATS_COUNTER_HISTOGRAM_SLOW_LOOKUPS,
   GRPC_STATS_COUNTER_SYSCALL_WRITE,
   GRPC_STATS_COUNTER_SYSCALL_READ,
   GRPC_STATS_COUNTER_TCP_BACKUP_POLLERS_CREATED,
   GRPC_STATS_COUNTER_TCP_BACKUP_POLLER_POLLS,
+  GRPC_STATS_COUNTER_TCP_WRITE_ZEROCOPY,
+  GRPC_STATS_COUNTER_TCP_WRITE_ZEROCOPY_COPIED,
+  GRPC_STATS_COUNTER_TCP_READ_PROVIDED_BUFFER,
+  GRPC_STATS_COUNTER_TCP_READ_PROVIDED_BUFFER_EXHAUSTED,
+  GRPC_STATS_COUNTER_TCP_WRITE_PACED,
+  GRPC_STATS_COUNTER_IO_URING_DEFERRED_SUBMIT,
   GRPC_STATS_COUNTER_HTTP2_OP_BATCHES,
   GRPC_STATS_COUNTER_HTTP2_OP_CANCEL,
   GRPC_STATS_COUNTER_HTTP2_OP_SEND_INITIAL_METADATA,
@@ -106,6 +116,8 @@ typedef enum {
   GRPC_STATS_COUNTER_COMBINER_LOCKS_SCHEDULED_ITEMS,
   GRPC_STATS_COUNTER_COMBINER_LOCKS_SCHEDULED_FINAL_ITEMS,
   GRPC_STATS_COUNTER_COMBINER_LOCKS_OFFLOADED,
+  GRPC_STATS_COUNTER_COMBINER_LOCKS_SCHEDULED_BACKGROUND_ITEMS,
+  GRPC_STATS_COUNTER_EXEC_CTX_BACKGROUND_CLOSURES,
   GRPC_STATS_COUNTER_CALL_COMBINER_LOCKS_INITIATED,
   GRPC_STATS_COUNTER_CALL_COMBINER_LOCKS_SCHEDULED_ITEMS,
   GRPC_STATS_COUNTER_CALL_COMBINER_SET_NOTIFY_ON_CANCEL,
@@ -116,6 +128,8 @@ typedef enum {
   GRPC_STATS_COUNTER_EXECUTOR_WAKEUP_INITIATED,
   GRPC_STATS_COUNTER_EXECUTOR_QUEUE_DRAINED,
   GRPC_STATS_COUNTER_EXECUTOR_PUSH_RETRIES,
+  GRPC_STATS_COUNTER_EXECUTOR_CLOSURES_STOLEN,
+  GRPC_STATS_COUNTER_EXECUTOR_FAILED_STEALS,
   GRPC_STATS_COUNTER_SERVER_REQUESTED_CALLS,
   GRPC_STATS_COUNTER_SERVER_SLOWPATH_REQUESTS_QUEUED,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_FAILURES,
@@ -128,16 +142,25 @@ extern const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT];
 typedef enum {
   GRPC_STATS_HISTOGRAM_CALL_INITIAL_SIZE,
   GRPC_STATS_HISTOGRAM_POLL_EVENTS_RETURNED,
+  GRPC_STATS_HISTOGRAM_POLLSET_SPIN_TIME_US,
   GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE,
   GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE,
   GRPC_STATS_HISTOGRAM_TCP_READ_SIZE,
   GRPC_STATS_HISTOGRAM_TCP_READ_OFFER,
   GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_ZEROCOPY_SIZE,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_SCHEDULED_US,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_SENT_US,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_ACKED_US,
+  GRPC_STATS_HISTOGRAM_TCP_READ_QUEUED_US,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_INITIAL_METADATA_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_CRITICAL_QUEUE_DELAY_US,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US,
+  GRPC_STATS_HISTOGRAM_EXECUTOR_QUEUE_DEPTH,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
   GRPC_STATS_HISTOGRAM_COUNT
 } grpc_stats_histograms;
@@ -148,29 +171,47 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_CALL_INITIAL_SIZE_BUCKETS = 64,
   GRPC_STATS_HISTOGRAM_POLL_EVENTS_RETURNED_FIRST_SLOT = 64,
   GRPC_STATS_HISTOGRAM_POLL_EVENTS_RETURNED_BUCKETS = 128,
-  GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE_FIRST_SLOT = 192,
+  GRPC_STATS_HISTOGRAM_POLLSET_SPIN_TIME_US_FIRST_SLOT = 192,
+  GRPC_STATS_HISTOGRAM_POLLSET_SPIN_TIME_US_BUCKETS = 32,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE_FIRST_SLOT = 224,
   GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE_FIRST_SLOT = 256,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE_FIRST_SLOT = 288,
   GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_TCP_READ_SIZE_FIRST_SLOT = 320,
+  GRPC_STATS_HISTOGRAM_TCP_READ_SIZE_FIRST_SLOT = 352,
   GRPC_STATS_HISTOGRAM_TCP_READ_SIZE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_FIRST_SLOT = 384,
+  GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_FIRST_SLOT = 416,
   GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE_FIRST_SLOT = 448,
+  GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE_FIRST_SLOT = 480,
   GRPC_STATS_HISTOGRAM_TCP_READ_OFFER_IOV_SIZE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE_FIRST_SLOT = 512,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_ZEROCOPY_SIZE_FIRST_SLOT = 544,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_ZEROCOPY_SIZE_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_SCHEDULED_US_FIRST_SLOT = 608,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_SCHEDULED_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_SENT_US_FIRST_SLOT = 672,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_SENT_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_ACKED_US_FIRST_SLOT = 736,
+  GRPC_STATS_HISTOGRAM_TCP_WRITE_ACKED_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_TCP_READ_QUEUED_US_FIRST_SLOT = 800,
+  GRPC_STATS_HISTOGRAM_TCP_READ_QUEUED_US_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE_FIRST_SLOT = 864,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_SIZE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_HTTP2_SEND_INITIAL_METADATA_PER_WRITE_FIRST_SLOT = 576,
+  GRPC_STATS_HISTOGRAM_HTTP2_SEND_INITIAL_METADATA_PER_WRITE_FIRST_SLOT = 928,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_INITIAL_METADATA_PER_WRITE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_PER_WRITE_FIRST_SLOT = 640,
+  GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_PER_WRITE_FIRST_SLOT = 992,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_PER_WRITE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE_FIRST_SLOT = 704,
+  GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE_FIRST_SLOT = 1056,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_FIRST_SLOT = 768,
+  GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_FIRST_SLOT = 1120,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_FIRST_SLOT = 832,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_CRITICAL_QUEUE_DELAY_US_FIRST_SLOT = 1184,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_CRITICAL_QUEUE_DELAY_US_BUCKETS = 32,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US_FIRST_SLOT = 1216,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US_BUCKETS = 32,
+  GRPC_STATS_HISTOGRAM_EXECUTOR_QUEUE_DEPTH_FIRST_SLOT = 1248,
+  GRPC_STATS_HISTOGRAM_EXECUTOR_QUEUE_DEPTH_BUCKETS = 32,
+  GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_FIRST_SLOT = 1280,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_BUCKETS = 8,
-  GRPC_STATS_HISTOGRAM_BUCKETS = 840
+  GRPC_STATS_HISTOGRAM_BUCKETS = 1288
 } grpc_stats_histogram_constants;
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CLIENT_CALLS_CREATED)
@@ -188,6 +229,12 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SYSCALL_POLL)
 #define GRPC_STATS_INC_SYSCALL_WAIT() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SYSCALL_WAIT)
+#define GRPC_STATS_INC_POLLSET_SPIN_HITS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_SPIN_HITS)
+#define GRPC_STATS_INC_POLLSET_SPIN_MISSES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_SPIN_MISSES)
+#define GRPC_STATS_INC_POLLSET_EPOLL_SET_DRAINS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_EPOLL_SET_DRAINS)
 #define GRPC_STATS_INC_POLLSET_KICK() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_KICK)
 #define GRPC_STATS_INC_POLLSET_KICKED_WITHOUT_POLLER() \
@@ -200,6 +247,8 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_KICK_WAKEUP_CV)
 #define GRPC_STATS_INC_POLLSET_KICK_OWN_THREAD() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_KICK_OWN_THREAD)
+#define GRPC_STATS_INC_POLLSET_KICK_SUPPRESSED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_POLLSET_KICK_SUPPRESSED)
 #define GRPC_STATS_INC_HISTOGRAM_SLOW_LOOKUPS() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HISTOGRAM_SLOW_LOOKUPS)
 #define GRPC_STATS_INC_SYSCALL_WRITE() \
@@ -210,6 +259,18 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_BACKUP_POLLERS_CREATED)
 #define GRPC_STATS_INC_TCP_BACKUP_POLLER_POLLS() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_BACKUP_POLLER_POLLS)
+#define GRPC_STATS_INC_TCP_WRITE_ZEROCOPY() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_WRITE_ZEROCOPY)
+#define GRPC_STATS_INC_TCP_WRITE_ZEROCOPY_COPIED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_WRITE_ZEROCOPY_COPIED)
+#define GRPC_STATS_INC_TCP_READ_PROVIDED_BUFFER() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_READ_PROVIDED_BUFFER)
+#define GRPC_STATS_INC_TCP_READ_PROVIDED_BUFFER_EXHAUSTED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_READ_PROVIDED_BUFFER_EXHAUSTED)
+#define GRPC_STATS_INC_TCP_WRITE_PACED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_TCP_WRITE_PACED)
+#define GRPC_STATS_INC_IO_URING_DEFERRED_SUBMIT() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_IO_URING_DEFERRED_SUBMIT)
 #define GRPC_STATS_INC_HTTP2_OP_BATCHES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HTTP2_OP_BATCHES)
 #define GRPC_STATS_INC_HTTP2_OP_CANCEL() \
@@ -356,6 +417,11 @@ typedef enum {
       GRPC_STATS_COUNTER_COMBINER_LOCKS_SCHEDULED_FINAL_ITEMS)
 #define GRPC_STATS_INC_COMBINER_LOCKS_OFFLOADED() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_COMBINER_LOCKS_OFFLOADED)
+#define GRPC_STATS_INC_COMBINER_LOCKS_SCHEDULED_BACKGROUND_ITEMS() \
+  GRPC_STATS_INC_COUNTER(                                          \
+      GRPC_STATS_COUNTER_COMBINER_LOCKS_SCHEDULED_BACKGROUND_ITEMS)
+#define GRPC_STATS_INC_EXEC_CTX_BACKGROUND_CLOSURES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXEC_CTX_BACKGROUND_CLOSURES)
 #define GRPC_STATS_INC_CALL_COMBINER_LOCKS_INITIATED() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CALL_COMBINER_LOCKS_INITIATED)
 #define GRPC_STATS_INC_CALL_COMBINER_LOCKS_SCHEDULED_ITEMS() \
@@ -376,6 +442,10 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXECUTOR_QUEUE_DRAINED)
 #define GRPC_STATS_INC_EXECUTOR_PUSH_RETRIES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXECUTOR_PUSH_RETRIES)
+#define GRPC_STATS_INC_EXECUTOR_CLOSURES_STOLEN() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXECUTOR_CLOSURES_STOLEN)
+#define GRPC_STATS_INC_EXECUTOR_FAILED_STEALS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_EXECUTOR_FAILED_STEALS)
 #define GRPC_STATS_INC_SERVER_REQUESTED_CALLS() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SERVER_REQUESTED_CALLS)
 #define GRPC_STATS_INC_SERVER_SLOWPATH_REQUESTS_QUEUED() \
@@ -392,6 +462,9 @@ void grpc_stats_inc_call_initial_size(int x);
 #define GRPC_STATS_INC_POLL_EVENTS_RETURNED(value) \
   grpc_stats_inc_poll_events_returned((int)(value))
 void grpc_stats_inc_poll_events_returned(int x);
+#define GRPC_STATS_INC_POLLSET_SPIN_TIME_US(value) \
+  grpc_stats_inc_pollset_spin_time_us((int)(value))
+void grpc_stats_inc_pollset_spin_time_us(int x);
 #define GRPC_STATS_INC_TCP_WRITE_SIZE(value) \
   grpc_stats_inc_tcp_write_size((int)(value))
 void grpc_stats_inc_tcp_write_size(int x);
@@ -407,6 +480,21 @@ void grpc_stats_inc_tcp_read_offer(int x);
 #define GRPC_STATS_INC_TCP_READ_OFFER_IOV_SIZE(value) \
   grpc_stats_inc_tcp_read_offer_iov_size((int)(value))
 void grpc_stats_inc_tcp_read_offer_iov_size(int x);
+#define GRPC_STATS_INC_TCP_WRITE_ZEROCOPY_SIZE(value) \
+  grpc_stats_inc_tcp_write_zerocopy_size((int)(value))
+void grpc_stats_inc_tcp_write_zerocopy_size(int x);
+#define GRPC_STATS_INC_TCP_WRITE_SCHEDULED_US(value) \
+  grpc_stats_inc_tcp_write_scheduled_us((int)(value))
+void grpc_stats_inc_tcp_write_scheduled_us(int x);
+#define GRPC_STATS_INC_TCP_WRITE_SENT_US(value) \
+  grpc_stats_inc_tcp_write_sent_us((int)(value))
+void grpc_stats_inc_tcp_write_sent_us(int x);
+#define GRPC_STATS_INC_TCP_WRITE_ACKED_US(value) \
+  grpc_stats_inc_tcp_write_acked_us((int)(value))
+void grpc_stats_inc_tcp_write_acked_us(int x);
+#define GRPC_STATS_INC_TCP_READ_QUEUED_US(value) \
+  grpc_stats_inc_tcp_read_queued_us((int)(value))
+void grpc_stats_inc_tcp_read_queued_us(int x);
 #define GRPC_STATS_INC_HTTP2_SEND_MESSAGE_SIZE(value) \
   grpc_stats_inc_http2_send_message_size((int)(value))
 void grpc_stats_inc_http2_send_message_size(int x);
@@ -422,12 +510,21 @@ void grpc_stats_inc_http2_send_trailing_metadata_per_write(int x);
 #define GRPC_STATS_INC_HTTP2_SEND_FLOWCTL_PER_WRITE(value) \
   grpc_stats_inc_http2_send_flowctl_per_write((int)(value))
 void grpc_stats_inc_http2_send_flowctl_per_write(int x);
+#define GRPC_STATS_INC_EXEC_CTX_CRITICAL_QUEUE_DELAY_US(value) \
+  grpc_stats_inc_exec_ctx_critical_queue_delay_us((int)(value))
+void grpc_stats_inc_exec_ctx_critical_queue_delay_us(int x);
+#define GRPC_STATS_INC_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US(value) \
+  grpc_stats_inc_exec_ctx_background_queue_delay_us((int)(value))
+void grpc_stats_inc_exec_ctx_background_queue_delay_us(int x);
+#define GRPC_STATS_INC_EXECUTOR_QUEUE_DEPTH(value) \
+  grpc_stats_inc_executor_queue_depth((int)(value))
+void grpc_stats_inc_executor_queue_depth(int x);
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value) \
   grpc_stats_inc_server_cqs_checked((int)(value))
 void grpc_stats_inc_server_cqs_checked(int x);
-extern const int grpc_stats_histo_buckets[13];
-extern const int grpc_stats_histo_start[13];
-extern const int* const grpc_stats_histo_bucket_boundaries[13];
-extern void (*const grpc_stats_inc_histogram[13])(int x);
+extern const int grpc_stats_histo_buckets[22];
+extern const int grpc_stats_histo_start[22];
+extern const int* const grpc_stats_histo_bucket_boundaries[22];
+extern void (*const grpc_stats_inc_histogram[22])(int x);
 
 #endif /* GRPC_CORE_LIB_DEBUG_STATS_DATA_H */
@@ -6,17 +6,27 @@ client_subchannels_created_per_iteration:FLOAT,
 server_channels_created_per_iteration:FLOAT,
 syscall_poll_per_iteration:FLOAT,
 syscall_wait_per_iteration:FLOAT,
+pollset_spin_hits_per_iteration:FLOAT,
+pollset_spin_misses_per_iteration:FLOAT,
+pollset_epoll_set_drains_per_iteration:FLOAT,
 pollset_kick_per_iteration:FLOAT,
 pollset_kicked_without_poller_per_iteration:FLOAT,
 pollset_kicked_again_per_iteration:FLOAT,
 pollset_kick_wakeup_fd_per_iteration:FLOAT,
 pollset_kick_wakeup_cv_per_iteration:FLOAT,
 pollset_kick_own_thread_per_iteration:FLOAT,
+pollset_kick_suppressed_per_iteration:FLOAT,
 histogram_slow_lookups_per_iteration:FLOAT,
 syscall_write_per_iteration:FLOAT,
 syscall_read_per_iteration:FLOAT,
 tcp_backup_pollers_created_per_iteration:FLOAT,
 tcp_backup_poller_polls_per_iteration:FLOAT,
+tcp_write_zerocopy_per_iteration:FLOAT,
+tcp_write_zerocopy_copied_per_iteration:FLOAT,
+tcp_read_provided_buffer_per_iteration:FLOAT,
+tcp_read_provided_buffer_exhausted_per_iteration:FLOAT,
+tcp_write_paced_per_iteration:FLOAT,
+io_uring_deferred_submit_per_iteration:FLOAT,
 http2_op_batches_per_iteration:FLOAT,
 http2_op_cancel_per_iteration:FLOAT,
 http2_op_send_initial_metadata_per_iteration:FLOAT,
@@ -79,6 +89,8 @@ combiner_locks_initiated_per_iteration:FLOAT,
 combiner_locks_scheduled_items_per_iteration:FLOAT,
 combiner_locks_scheduled_final_items_per_iteration:FLOAT,
 combiner_locks_offloaded_per_iteration:FLOAT,
+combiner_locks_scheduled_background_items_per_iteration:FLOAT,
+exec_ctx_background_closures_per_iteration:FLOAT,
 call_combiner_locks_initiated_per_iteration:FLOAT,
 call_combiner_locks_scheduled_items_per_iteration:FLOAT,
 call_combiner_set_notify_on_cancel_per_iteration:FLOAT,
@@ -89,6 +101,8 @@ executor_scheduled_to_self_per_iteration:FLOAT,
 executor_wakeup_initiated_per_iteration:FLOAT,
 executor_queue_drained_per_iteration:FLOAT,
 executor_push_retries_per_iteration:FLOAT,
+executor_closures_stolen_per_iteration:FLOAT,
+executor_failed_steals_per_iteration:FLOAT,
 server_requested_calls_per_iteration:FLOAT,
 server_slowpath_requests_queued_per_iteration:FLOAT,
 cq_ev_queue_trylock_failures_per_iteration:FLOAT,
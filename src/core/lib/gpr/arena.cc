@@ -22,16 +22,22 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/useful.h>
 
-// TODO(roth): We currently assume that all callers need alignment of 16
-// bytes, which may be wrong in some cases.  As part of converting the
-// arena API to C++, we should consider replacing gpr_arena_alloc() with a
-// template that takes the type of the value being allocated, which
-// would allow us to use the alignment actually needed by the caller.
+#include "src/core/lib/gpr/spinlock.h"
+
+#define ROUND_UP_TO_ALIGNMENT(x, alignment) \
+  (((x) + (alignment)-1u) & ~((alignment)-1u))
 #define ROUND_UP_TO_ALIGNMENT_SIZE(x) \
-  (((x) + GPR_MAX_ALIGNMENT - 1u) & ~(GPR_MAX_ALIGNMENT - 1u))
+  ROUND_UP_TO_ALIGNMENT(x, GPR_MAX_ALIGNMENT)
+
+// Destroyed arenas are cached in a few free lists, picked by cpu
+#define ARENA_CACHE_SHARDS 64
+#define ARENA_CACHE_ARENAS_PER_SHARD 8
+// Arenas with a bigger initial zone are not worth keeping around
+#define ARENA_CACHE_MAX_INITIAL_SIZE (64 * 1024)
 
 typedef struct zone {
   size_t size_begin;
@@ -42,8 +48,83 @@ typedef struct zone {
 struct gpr_arena {
   gpr_atm size_so_far;
   zone initial_zone;
+  // next arena in a free list, while cached
+  gpr_arena* next_cached;
 };
 
+typedef struct arena_cache {
+  gpr_spinlock lock;
+  gpr_arena* head;
+  size_t count;
+} GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE) arena_cache;
+
+// Static storage, so that cached arenas are never reported as leaks
+static arena_cache g_arena_caches[ARENA_CACHE_SHARDS];
+
+static arena_cache* current_cache() {
+  return &g_arena_caches[gpr_cpu_current_cpu() % ARENA_CACHE_SHARDS];
+}
+
+// Returns a cached arena whose initial zone fits initial_size without wasting
+// more than half of it, or NULL
+static gpr_arena* arena_cache_pop(size_t initial_size) {
+  arena_cache* c = current_cache();
+  gpr_spinlock_lock(&c->lock);
+  gpr_arena* a = c->head;
+  if (a != nullptr) {
+    c->head = a->next_cached;
+    c->count--;
+  }
+  gpr_spinlock_unlock(&c->lock);
+  if (a != nullptr && (a->initial_zone.size_end < initial_size ||
+                       a->initial_zone.size_end / 2 > initial_size)) {
+    // the estimate has moved on: let the cache follow it
+    gpr_free_aligned(a);
+    a = nullptr;
+  }
+  return a;
+}
+
+// Zeroes what was handed out of the initial zone of \a a and caches it, or
+// returns false if it is not worth caching
+static bool arena_cache_push(gpr_arena* a) {
+  if (a->initial_zone.size_end > ARENA_CACHE_MAX_INITIAL_SIZE) return false;
+  // Zero just the part of the initial zone that was handed out (creating a new
+  // arena has to zero all of it)
+  size_t used = GPR_MIN((size_t)gpr_atm_no_barrier_load(&a->size_so_far),
+                        a->initial_zone.size_end);
+  memset((char*)a + ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(gpr_arena)), 0, used);
+  gpr_atm_no_barrier_store(&a->size_so_far, 0);
+  gpr_atm_no_barrier_store(&a->initial_zone.next_atm, (gpr_atm)NULL);
+  arena_cache* c = current_cache();
+  bool pushed = false;
+  gpr_spinlock_lock(&c->lock);
+  if (c->count < ARENA_CACHE_ARENAS_PER_SHARD) {
+    a->next_cached = c->head;
+    c->head = a;
+    c->count++;
+    pushed = true;
+  }
+  gpr_spinlock_unlock(&c->lock);
+  return pushed;
+}
+
+void gpr_arena_cache_drain(void) {
+  for (size_t i = 0; i < ARENA_CACHE_SHARDS; i++) {
+    arena_cache* c = &g_arena_caches[i];
+    gpr_spinlock_lock(&c->lock);
+    gpr_arena* a = c->head;
+    c->head = nullptr;
+    c->count = 0;
+    gpr_spinlock_unlock(&c->lock);
+    while (a != nullptr) {
+      gpr_arena* next = a->next_cached;
+      gpr_free_aligned(a);
+      a = next;
+    }
+  }
+}
+
 static void* zalloc_aligned(size_t size) {
   void* ptr = gpr_malloc_aligned(size, GPR_MAX_ALIGNMENT);
   memset(ptr, 0, size);
@@ -52,16 +133,21 @@ static void* zalloc_aligned(size_t size) {
 
 gpr_arena* gpr_arena_create(size_t initial_size) {
   initial_size = ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
-  gpr_arena* a = (gpr_arena*)zalloc_aligned(
-      ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(gpr_arena)) + initial_size);
-  a->initial_zone.size_end = initial_size;
+  gpr_arena* a = arena_cache_pop(initial_size);
+  if (a == nullptr) {
+    a = (gpr_arena*)zalloc_aligned(
+        ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(gpr_arena)) + initial_size);
+    a->initial_zone.size_end = initial_size;
+  }
   return a;
 }
 
 size_t gpr_arena_destroy(gpr_arena* arena) {
   gpr_atm size = gpr_atm_no_barrier_load(&arena->size_so_far);
   zone* z = (zone*)gpr_atm_no_barrier_load(&arena->initial_zone.next_atm);
-  gpr_free_aligned(arena);
+  if (!arena_cache_push(arena)) {
+    gpr_free_aligned(arena);
+  }
   while (z) {
     zone* next_z = (zone*)gpr_atm_no_barrier_load(&z->next_atm);
     gpr_free_aligned(z);
@@ -70,15 +156,25 @@ size_t gpr_arena_destroy(gpr_arena* arena) {
   return (size_t)size;
 }
 
-void* gpr_arena_alloc(gpr_arena* arena, size_t size) {
-  size = ROUND_UP_TO_ALIGNMENT_SIZE(size);
-  size_t start =
-      (size_t)gpr_atm_no_barrier_fetch_add(&arena->size_so_far, size);
+void* gpr_arena_alloc_aligned(gpr_arena* arena, size_t size,
+                              size_t alignment) {
+  size_t start;
+  for (;;) {
+    gpr_atm so_far = gpr_atm_no_barrier_load(&arena->size_so_far);
+    start = ROUND_UP_TO_ALIGNMENT((size_t)so_far, alignment);
+    if (gpr_atm_no_barrier_cas(&arena->size_so_far, so_far,
+                               (gpr_atm)(start + size))) {
+      break;
+    }
+  }
   zone* z = &arena->initial_zone;
   while (start > z->size_end) {
     zone* next_z = (zone*)gpr_atm_acq_load(&z->next_atm);
     if (next_z == nullptr) {
-      size_t next_z_size = (size_t)gpr_atm_no_barrier_load(&arena->size_so_far);
+      // Zones start at multiples of GPR_MAX_ALIGNMENT, so that aligning
+      // offsets within the arena aligns the addresses too
+      size_t next_z_size = ROUND_UP_TO_ALIGNMENT_SIZE(
+          (size_t)gpr_atm_no_barrier_load(&arena->size_so_far));
       next_z = (zone*)zalloc_aligned(ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(zone)) +
                                      next_z_size);
       next_z->size_begin = z->size_end;
@@ -91,7 +187,7 @@ void* gpr_arena_alloc(gpr_arena* arena, size_t size) {
     z = next_z;
   }
   if (start + size > z->size_end) {
-    return gpr_arena_alloc(arena, size);
+    return gpr_arena_alloc_aligned(arena, size, alignment);
   }
   GPR_ASSERT(start >= z->size_begin);
   GPR_ASSERT(start + size <= z->size_end);
@@ -100,3 +196,7 @@ void* gpr_arena_alloc(gpr_arena* arena, size_t size) {
                   : (char*)z + ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(zone));
   return ptr + start - z->size_begin;
 }
+
+void* gpr_arena_alloc(gpr_arena* arena, size_t size) {
+  return gpr_arena_alloc_aligned(arena, size, GPR_MAX_ALIGNMENT);
+}
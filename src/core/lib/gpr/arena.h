@@ -27,13 +27,39 @@
 
 #include <stddef.h>
 
+#include <new>
+#include <utility>
+
+#include <grpc/support/port_platform.h>
+
 typedef struct gpr_arena gpr_arena;
 
 // Create an arena, with \a initial_size bytes in the first allocated buffer
+// Destroyed arenas are kept around (per cpu) to be handed out again by this
+// function, so that its cost is usually just a few loads and stores
 gpr_arena* gpr_arena_create(size_t initial_size);
-// Allocate \a size bytes from the arena
+// Allocate \a size bytes of zeroed memory from the arena, aligned to
+// GPR_MAX_ALIGNMENT
 void* gpr_arena_alloc(gpr_arena* arena, size_t size);
+// Allocate \a size bytes of zeroed memory from the arena, aligned to
+// \a alignment (a power of two no greater than GPR_MAX_ALIGNMENT)
+void* gpr_arena_alloc_aligned(gpr_arena* arena, size_t size, size_t alignment);
 // Destroy an arena, returning the total number of bytes allocated
 size_t gpr_arena_destroy(gpr_arena* arena);
+// Free the arenas kept for reuse by gpr_arena_create()
+void gpr_arena_cache_drain(void);
+
+namespace grpc_core {
+
+// Construct a T in \a arena, taking only the space and alignment T needs
+// T's destructor is never run: the memory goes away with the arena
+template <typename T, typename... Args>
+inline T* ArenaNew(gpr_arena* arena, Args&&... args) {
+  static_assert(alignof(T) <= GPR_MAX_ALIGNMENT, "arena cannot align T");
+  void* p = gpr_arena_alloc_aligned(arena, sizeof(T), alignof(T));
+  return new (p) T(std::forward<Args>(args)...);
+}
+
+}  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_GPR_ARENA_H */
@@ -0,0 +1,165 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/gpr/epoch_reclaim.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/useful.h>
+
+// Reader counts for the two halves of the epoch, one set per cpu (modulo
+// MAX_READER_SLOTS) so that read sections on different cpus don't share a
+// cache line. Retired memory is kept per cpu the same way
+#define MAX_READER_SLOTS 64
+// A retire shard tries to free its memory every this many retires; only then
+// is the global lock taken, to advance the epoch
+#define RECLAIM_BATCH 32
+
+typedef struct reader_slot {
+  gpr_atm readers[2];
+} GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE) reader_slot;
+
+typedef struct retired {
+  void* ptr;
+  gpr_atm epoch;  // g_epoch when ptr was retired
+} retired;
+
+typedef struct retire_shard {
+  gpr_mu mu;
+  // guarded by mu
+  retired* entries;
+  size_t count;
+  size_t capacity;
+  size_t reclaim_at;  // reclaim once count reaches this
+} GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE) retire_shard;
+
+static reader_slot g_reader_slots[MAX_READER_SLOTS];
+static retire_shard g_retire_shards[MAX_READER_SLOTS];
+static size_t g_num_reader_slots;
+// Only ever incremented. New read sections count themselves in half
+// (g_epoch & 1)
+static gpr_atm g_epoch;
+// Serializes advancing g_epoch
+static gpr_mu g_epoch_mu;
+
+static size_t current_slot(void) {
+  return g_num_reader_slots == 1
+             ? 0
+             : gpr_cpu_current_cpu() % g_num_reader_slots;
+}
+
+gpr_atm* gpr_epoch_read_begin(void) {
+  reader_slot* slot = &g_reader_slots[current_slot()];
+  for (;;) {
+    gpr_atm epoch = gpr_atm_acq_load(&g_epoch) & 1;
+    gpr_atm* readers = &slot->readers[epoch];
+    gpr_atm_full_fetch_add(readers, 1);
+    // The epoch flipped before we were counted: the flipper may already have
+    // found our half empty, so count ourselves in the new half instead
+    if ((gpr_atm_acq_load(&g_epoch) & 1) == epoch) return readers;
+    gpr_atm_full_fetch_add(readers, -1);
+  }
+}
+
+void gpr_epoch_read_end(gpr_atm* reader) {
+  gpr_atm_full_fetch_add(reader, -1);
+}
+
+static bool readers_gone(gpr_atm epoch) {
+  for (size_t i = 0; i < g_num_reader_slots; i++) {
+    if (gpr_atm_acq_load(&g_reader_slots[i].readers[epoch & 1]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Advance g_epoch as far as it can go, and return it. Moving on to epoch e
+// reuses the half of the reader counts that epoch e - 2 used, so it needs the
+// read sections counted there to be gone
+static gpr_atm advance_epoch(void) {
+  gpr_mu_lock(&g_epoch_mu);
+  gpr_atm epoch = gpr_atm_no_barrier_load(&g_epoch);
+  for (int i = 0; i < 2 && readers_gone(epoch + 1); i++) {
+    epoch = gpr_atm_full_fetch_add(&g_epoch, 1) + 1;
+  }
+  gpr_mu_unlock(&g_epoch_mu);
+  return epoch;
+}
+
+// Free what no read section can be reading anymore. Read sections that might
+// reach memory retired in epoch e were counted in epoch e or earlier, and are
+// gone once the epoch has reached e + 2. Called with shard->mu held
+static void reclaim_locked(retire_shard* shard, gpr_atm epoch) {
+  size_t kept = 0;
+  for (size_t i = 0; i < shard->count; i++) {
+    if (epoch - shard->entries[i].epoch >= 2) {
+      gpr_free(shard->entries[i].ptr);
+    } else {
+      shard->entries[kept++] = shard->entries[i];
+    }
+  }
+  shard->count = kept;
+}
+
+void gpr_epoch_retire(void* p) {
+  // Order the caller unlinking p before reading the epoch, so that no read
+  // section that might still reach p was counted in a later one
+  gpr_atm_full_barrier();
+  gpr_atm epoch = gpr_atm_no_barrier_load(&g_epoch);
+  retire_shard* shard = &g_retire_shards[current_slot()];
+  gpr_mu_lock(&shard->mu);
+  if (shard->count == shard->capacity) {
+    shard->capacity = GPR_MAX(RECLAIM_BATCH, 2 * shard->capacity);
+    shard->entries = (retired*)gpr_realloc(
+        shard->entries, sizeof(*shard->entries) * shard->capacity);
+  }
+  shard->entries[shard->count].ptr = p;
+  shard->entries[shard->count].epoch = epoch;
+  shard->count++;
+  if (shard->count >= shard->reclaim_at) {
+    reclaim_locked(shard, advance_epoch());
+    shard->reclaim_at = shard->count + RECLAIM_BATCH;
+  }
+  gpr_mu_unlock(&shard->mu);
+}
+
+void gpr_epoch_init(void) {
+  gpr_mu_init(&g_epoch_mu);
+  g_num_reader_slots = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_READER_SLOTS);
+  for (size_t i = 0; i < g_num_reader_slots; i++) {
+    retire_shard* shard = &g_retire_shards[i];
+    gpr_mu_init(&shard->mu);
+    shard->reclaim_at = RECLAIM_BATCH;
+  }
+}
+
+void gpr_epoch_shutdown(void) {
+  for (size_t i = 0; i < g_num_reader_slots; i++) {
+    retire_shard* shard = &g_retire_shards[i];
+    for (size_t j = 0; j < shard->count; j++) {
+      gpr_free(shard->entries[j].ptr);
+    }
+    gpr_free(shard->entries);
+    shard->entries = nullptr;
+    shard->count = shard->capacity = 0;
+    gpr_mu_destroy(&shard->mu);
+  }
+  gpr_mu_destroy(&g_epoch_mu);
+}
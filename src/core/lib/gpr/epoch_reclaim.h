@@ -0,0 +1,45 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// \file Epoch based memory reclamation
+// Lets lock-free readers walk structures that writers modify under a lock:
+// memory that writers unlink is retired rather than freed, and only freed once
+// every read section that might still see it has ended
+// Shared by the interned slice table (slice_intern.cc) and the interned mdelem
+// table (metadata.cc): a change here affects both reclamation paths
+
+#ifndef GRPC_CORE_LIB_GPR_EPOCH_RECLAIM_H
+#define GRPC_CORE_LIB_GPR_EPOCH_RECLAIM_H
+
+#include <grpc/support/atm.h>
+
+// Start a read section: memory retired after this returns is not freed before
+// the matching gpr_epoch_read_end(), which takes the returned pointer.
+// Read sections are cheap (two atomic increments on a per-cpu cache line) and
+// must be short: they hold back all reclamation while they run
+gpr_atm* gpr_epoch_read_begin(void);
+void gpr_epoch_read_end(gpr_atm* reader);
+// gpr_free() \a p once no read section can be reading it anymore
+// \a p must already be unreachable for read sections starting from now on
+void gpr_epoch_retire(void* p);
+
+void gpr_epoch_init(void);
+// Frees everything still retired: no read sections may be running
+void gpr_epoch_shutdown(void);
+
+#endif /* GRPC_CORE_LIB_GPR_EPOCH_RECLAIM_H */
@@ -45,6 +45,7 @@ struct grpc_combiner {
   grpc_combiner* next_combiner_on_this_exec_ctx;
   grpc_closure_scheduler scheduler;
   grpc_closure_scheduler finally_scheduler;
+  grpc_closure_scheduler background_scheduler;
   gpr_mpscq queue;
   // either:
   // a pointer to the initiating exec ctx if that is the only exec_ctx that has
@@ -63,11 +64,16 @@ struct grpc_combiner {
 
 static void combiner_exec(grpc_closure* closure, grpc_error* error);
 static void combiner_finally_exec(grpc_closure* closure, grpc_error* error);
+static void combiner_background_exec(grpc_closure* closure, grpc_error* error);
+static void combiner_background_sched(grpc_closure* closure,
+                                      grpc_error* error);
 
 static const grpc_closure_scheduler_vtable scheduler = {
     combiner_exec, combiner_exec, "combiner:immediately"};
 static const grpc_closure_scheduler_vtable finally_scheduler = {
     combiner_finally_exec, combiner_finally_exec, "combiner:finally"};
+static const grpc_closure_scheduler_vtable background_scheduler = {
+    combiner_background_exec, combiner_background_sched, "combiner:background"};
 
 static void offload(void* arg, grpc_error* error);
 
@@ -76,6 +82,7 @@ grpc_combiner* grpc_combiner_create(void) {
   gpr_ref_init(&lock->refs, 1);
   lock->scheduler.vtable = &scheduler;
   lock->finally_scheduler.vtable = &finally_scheduler;
+  lock->background_scheduler.vtable = &background_scheduler;
   gpr_atm_no_barrier_store(&lock->state, STATE_UNORPHANED);
   gpr_mpscq_init(&lock->queue);
   grpc_closure_list_init(&lock->final_list);
@@ -152,10 +159,10 @@ static void push_first_on_exec_ctx(grpc_combiner* lock) {
   ((grpc_combiner*)(((char*)((closure)->scheduler)) -            \
                     offsetof(grpc_combiner, scheduler_name)))
 
-static void combiner_exec(grpc_closure* cl, grpc_error* error) {
+static void combiner_exec_on(grpc_combiner* lock, grpc_closure* cl,
+                             grpc_error* error) {
   GPR_TIMER_SCOPE("combiner.execute", 0);
   GRPC_STATS_INC_COMBINER_LOCKS_SCHEDULED_ITEMS();
-  grpc_combiner* lock = COMBINER_FROM_CLOSURE_SCHEDULER(cl, scheduler);
   gpr_atm last = gpr_atm_full_fetch_add(&lock->state, STATE_ELEM_COUNT_LOW_BIT);
   GRPC_COMBINER_TRACE(gpr_log(GPR_DEBUG,
                               "C:%p grpc_combiner_execute c=%p last=%" PRIdPTR,
@@ -183,6 +190,22 @@ static void combiner_exec(grpc_closure* cl, grpc_error* error) {
   gpr_mpscq_push(&lock->queue, &cl->next_data.atm_next);
 }
 
+static void combiner_exec(grpc_closure* cl, grpc_error* error) {
+  combiner_exec_on(COMBINER_FROM_CLOSURE_SCHEDULER(cl, scheduler), cl, error);
+}
+
+// Background items wait on the exec_ctx's background lane until it has no
+// latency-critical work left, and only then join the combiner's queue.
+static void combiner_background_sched(grpc_closure* cl, grpc_error* error) {
+  GRPC_STATS_INC_COMBINER_LOCKS_SCHEDULED_BACKGROUND_ITEMS();
+  grpc_core::ExecCtx::Get()->ScheduleBackground(cl, error);
+}
+
+static void combiner_background_exec(grpc_closure* cl, grpc_error* error) {
+  combiner_exec_on(COMBINER_FROM_CLOSURE_SCHEDULER(cl, background_scheduler),
+                   cl, error);
+}
+
 static void move_next() {
   grpc_core::ExecCtx::Get()->combiner_data()->active_combiner =
       grpc_core::ExecCtx::Get()
@@ -353,3 +376,8 @@ grpc_closure_scheduler* grpc_combiner_finally_scheduler(
     grpc_combiner* combiner) {
   return &combiner->finally_scheduler;
 }
+
+grpc_closure_scheduler* grpc_combiner_background_scheduler(
+    grpc_combiner* combiner) {
+  return &combiner->background_scheduler;
+}
@@ -56,6 +56,11 @@ void grpc_combiner_unref(grpc_combiner* lock GRPC_COMBINER_DEBUG_ARGS);
 grpc_closure_scheduler* grpc_combiner_scheduler(grpc_combiner* lock);
 // Scheduler to execute \a action within the lock just prior to unlocking.
 grpc_closure_scheduler* grpc_combiner_finally_scheduler(grpc_combiner* lock);
+// Scheduler for background work (timers that only do bookkeeping, memory
+// reclamation, ...) on the lock: such actions are held back until the
+// scheduling exec_ctx has no other work left.
+grpc_closure_scheduler* grpc_combiner_background_scheduler(
+    grpc_combiner* lock);
 
 bool grpc_combiner_continue_exec_ctx();
 
@@ -57,3 +57,7 @@ int grpc_endpoint_get_fd(grpc_endpoint* ep) { return ep->vtable->get_fd(ep); }
 grpc_resource_user* grpc_endpoint_get_resource_user(grpc_endpoint* ep) {
   return ep->vtable->get_resource_user(ep);
 }
+
+bool grpc_endpoint_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer) {
+  return ep->vtable->set_tracer(ep, tracer);
+}
@@ -31,6 +31,36 @@
 
 typedef struct grpc_endpoint grpc_endpoint;
 typedef struct grpc_endpoint_vtable grpc_endpoint_vtable;
+typedef struct grpc_endpoint_tracer grpc_endpoint_tracer;
+
+/* Points at which the kernel timestamps the last byte of a write */
+typedef enum {
+  /* it entered the packet scheduler */
+  GRPC_ENDPOINT_WRITE_SCHEDULED,
+  /* it was handed to the network device */
+  GRPC_ENDPOINT_WRITE_SENT,
+  /* it was acknowledged by the peer: the last report for a write */
+  GRPC_ENDPOINT_WRITE_ACKED,
+} grpc_endpoint_write_stage;
+
+/* Receives the kernel timestamps an endpoint reports for its traffic (see
+   grpc_endpoint_set_tracer). Times are GPR_CLOCK_REALTIME. The callbacks run
+   under a lock of the endpoint's, which is what keeps them from racing with
+   its destruction: they may take locks of their own, but must not call back
+   into the endpoint, nor may any of those locks be held while calling into
+   it. */
+typedef struct grpc_endpoint_tracer_vtable {
+  /* The data returned by the read about to complete was received at ts */
+  void (*on_read)(grpc_endpoint_tracer* tracer, gpr_timespec ts);
+  /* The last byte of the seq'th write made since the tracer was set (counting
+     from 1) reached stage at ts */
+  void (*on_write)(grpc_endpoint_tracer* tracer, uint64_t seq,
+                   grpc_endpoint_write_stage stage, gpr_timespec ts);
+} grpc_endpoint_tracer_vtable;
+
+struct grpc_endpoint_tracer {
+  const grpc_endpoint_tracer_vtable* vtable;
+};
 
 struct grpc_endpoint_vtable {
   void (*read)(grpc_endpoint* ep, grpc_slice_buffer* slices, grpc_closure* cb);
@@ -43,6 +73,7 @@ struct grpc_endpoint_vtable {
   grpc_resource_user* (*get_resource_user)(grpc_endpoint* ep);
   char* (*get_peer)(grpc_endpoint* ep);
   int (*get_fd)(grpc_endpoint* ep);
+  bool (*set_tracer)(grpc_endpoint* ep, grpc_endpoint_tracer* tracer);
 };
 
 /* When data is available on the connection, calls the callback with slices.
@@ -89,6 +120,12 @@ void grpc_endpoint_delete_from_pollset_set(grpc_endpoint* ep,
 
 grpc_resource_user* grpc_endpoint_get_resource_user(grpc_endpoint* endpoint);
 
+/* Ask \a ep to report kernel timestamps for its traffic to \a tracer, which
+   may be called from any thread until \a ep is destroyed. Returns false if
+   the endpoint cannot: it is not a TCP socket, or was not created with
+   GRPC_ARG_TCP_TIMESTAMPING. */
+bool grpc_endpoint_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer);
+
 struct grpc_endpoint {
   const grpc_endpoint_vtable* vtable;
 };
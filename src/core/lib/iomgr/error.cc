@@ -26,6 +26,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
+#include <grpc/support/sync.h>
 #include <grpc/support/useful.h>
 
 #ifdef GPR_WINDOWS
@@ -126,9 +127,29 @@ bool grpc_error_is_special(grpc_error* err) {
          err == GRPC_ERROR_CANCELLED;
 }
 
+#define SLOTS_PER_INT (sizeof(intptr_t) / sizeof(intptr_t))
+#define SLOTS_PER_STR (sizeof(grpc_slice) / sizeof(intptr_t))
+#define SLOTS_PER_TIME (sizeof(gpr_timespec) / sizeof(intptr_t))
+#define SLOTS_PER_LINKED_ERROR (sizeof(grpc_linked_error) / sizeof(intptr_t))
+
+// The errors returned by grpc_error_for_status, indexed by status: each holds
+// a description and a grpc status. They are never freed, and ref counting
+// skips them.
+#define STATIC_ERROR_CAPACITY (SLOTS_PER_STR + SLOTS_PER_INT)
+#define NUM_STATIC_ERRORS (GRPC_STATUS_UNAUTHENTICATED + 1)
+static intptr_t g_static_errors[NUM_STATIC_ERRORS]
+                               [sizeof(grpc_error) / sizeof(intptr_t) +
+                                STATIC_ERROR_CAPACITY];
+static gpr_once g_static_errors_once = GPR_ONCE_INIT;
+
+static bool is_static_error(grpc_error* err) {
+  return (uintptr_t)err >= (uintptr_t)g_static_errors &&
+         (uintptr_t)err < (uintptr_t)(g_static_errors + NUM_STATIC_ERRORS);
+}
+
 #ifndef NDEBUG
 grpc_error* grpc_error_ref(grpc_error* err, const char* file, int line) {
-  if (grpc_error_is_special(err)) return err;
+  if (grpc_error_is_special(err) || is_static_error(err)) return err;
   if (grpc_trace_error_refcount.enabled()) {
     gpr_log(GPR_DEBUG, "%p: %" PRIdPTR " -> %" PRIdPTR " [%s:%d]", err,
             gpr_atm_no_barrier_load(&err->atomics.refs.count),
@@ -139,7 +160,7 @@ grpc_error* grpc_error_ref(grpc_error* err, const char* file, int line) {
 }
 #else
 grpc_error* grpc_error_ref(grpc_error* err) {
-  if (grpc_error_is_special(err)) return err;
+  if (grpc_error_is_special(err) || is_static_error(err)) return err;
   gpr_ref(&err->atomics.refs);
   return err;
 }
@@ -171,13 +192,14 @@ static void error_destroy(grpc_error* err) {
   GPR_ASSERT(!grpc_error_is_special(err));
   unref_errs(err);
   unref_strs(err);
+  GRPC_ERROR_UNREF(err->parent);
   gpr_free((void*)gpr_atm_acq_load(&err->atomics.error_string));
   gpr_free(err);
 }
 
 #ifndef NDEBUG
 void grpc_error_unref(grpc_error* err, const char* file, int line) {
-  if (grpc_error_is_special(err)) return;
+  if (grpc_error_is_special(err) || is_static_error(err)) return;
   if (grpc_trace_error_refcount.enabled()) {
     gpr_log(GPR_DEBUG, "%p: %" PRIdPTR " -> %" PRIdPTR " [%s:%d]", err,
             gpr_atm_no_barrier_load(&err->atomics.refs.count),
@@ -189,7 +211,7 @@ void grpc_error_unref(grpc_error* err, const char* file, int line) {
 }
 #else
 void grpc_error_unref(grpc_error* err) {
-  if (grpc_error_is_special(err)) return;
+  if (grpc_error_is_special(err) || is_static_error(err)) return;
   if (gpr_unref(&err->atomics.refs)) {
     error_destroy(err);
   }
@@ -298,11 +320,6 @@ static void internal_add_error(grpc_error** err, grpc_error* new_err) {
   memcpy((*err)->arena + slot, &new_last, sizeof(grpc_linked_error));
 }
 
-#define SLOTS_PER_INT (sizeof(intptr_t) / sizeof(intptr_t))
-#define SLOTS_PER_STR (sizeof(grpc_slice) / sizeof(intptr_t))
-#define SLOTS_PER_TIME (sizeof(gpr_timespec) / sizeof(intptr_t))
-#define SLOTS_PER_LINKED_ERROR (sizeof(grpc_linked_error) / sizeof(intptr_t))
-
 // size of storing one int and two slices and a timespec. For line, desc, file,
 // and time created
 #define DEFAULT_ERROR_CAPACITY \
@@ -311,6 +328,30 @@ static void internal_add_error(grpc_error** err, grpc_error* new_err) {
 // It is very common to include and extra int and string in an error
 #define SURPLUS_CAPACITY (2 * SLOTS_PER_INT + SLOTS_PER_TIME)
 
+// Room for the string or int usually added to an error derived from a shared
+// one (see copy_error_and_unref)
+#define DERIVED_ERROR_CAPACITY (SLOTS_PER_STR + SLOTS_PER_INT)
+
+// Errors derived from shared errors chain at most this deep: past it they are
+// copied instead
+#define MAX_PARENT_DEPTH 4
+
+static void init_error(grpc_error* err, uint8_t arena_capacity) {
+  err->parent = nullptr;
+  err->parent_depth = 0;
+  err->arena_size = 0;
+  err->arena_capacity = arena_capacity;
+  err->first_err = UINT8_MAX;
+  err->last_err = UINT8_MAX;
+
+  memset(err->ints, UINT8_MAX, GRPC_ERROR_INT_MAX);
+  memset(err->strs, UINT8_MAX, GRPC_ERROR_STR_MAX);
+  memset(err->times, UINT8_MAX, GRPC_ERROR_TIME_MAX);
+
+  gpr_atm_no_barrier_store(&err->atomics.error_string, 0);
+  gpr_ref_init(&err->atomics.refs, 1);
+}
+
 grpc_error* grpc_error_create(const char* file, int line, grpc_slice desc,
                               grpc_error** referencing,
                               size_t num_referencing) {
@@ -329,14 +370,7 @@ grpc_error* grpc_error_create(const char* file, int line, grpc_slice desc,
   }
 #endif
 
-  err->arena_size = 0;
-  err->arena_capacity = initial_arena_capacity;
-  err->first_err = UINT8_MAX;
-  err->last_err = UINT8_MAX;
-
-  memset(err->ints, UINT8_MAX, GRPC_ERROR_INT_MAX);
-  memset(err->strs, UINT8_MAX, GRPC_ERROR_STR_MAX);
-  memset(err->times, UINT8_MAX, GRPC_ERROR_TIME_MAX);
+  init_error(err, initial_arena_capacity);
 
   internal_set_int(&err, GRPC_ERROR_INT_FILE_LINE, line);
   internal_set_str(&err, GRPC_ERROR_STR_FILE,
@@ -353,11 +387,52 @@ grpc_error* grpc_error_create(const char* file, int line, grpc_slice desc,
 
   internal_set_time(&err, GRPC_ERROR_TIME_CREATED, gpr_now(GPR_CLOCK_REALTIME));
 
-  gpr_atm_no_barrier_store(&err->atomics.error_string, 0);
-  gpr_ref_init(&err->atomics.refs, 1);
   return err;
 }
 
+static const char* const status_descriptions[NUM_STATIC_ERRORS] = {
+    "OK",
+    "Cancelled",
+    "Unknown",
+    "Invalid argument",
+    "Deadline Exceeded",
+    "Not found",
+    "Already exists",
+    "Permission denied",
+    "Resource exhausted",
+    "Failed precondition",
+    "Aborted",
+    "Out of range",
+    "Unimplemented",
+    "Internal",
+    "Unavailable",
+    "Data loss",
+    "Unauthenticated",
+};
+
+static void init_static_errors(void) {
+  for (size_t i = 0; i < NUM_STATIC_ERRORS; i++) {
+    grpc_error* err = (grpc_error*)g_static_errors[i];
+    init_error(err, STATIC_ERROR_CAPACITY);
+    internal_set_str(&err, GRPC_ERROR_STR_DESCRIPTION,
+                     grpc_slice_from_static_string(status_descriptions[i]));
+    internal_set_int(&err, GRPC_ERROR_INT_GRPC_STATUS, (intptr_t)i);
+    GPR_ASSERT(err == (grpc_error*)g_static_errors[i]);
+  }
+}
+
+grpc_error* grpc_error_for_status(grpc_status_code status) {
+  if (status == GRPC_STATUS_OK) return GRPC_ERROR_NONE;
+  if (status == GRPC_STATUS_CANCELLED) return GRPC_ERROR_CANCELLED;
+  if (status < 0 || status >= NUM_STATIC_ERRORS) {
+    return grpc_error_set_int(
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Unknown status"),
+        GRPC_ERROR_INT_GRPC_STATUS, status);
+  }
+  gpr_once_init(&g_static_errors_once, init_static_errors);
+  return (grpc_error*)g_static_errors[status];
+}
+
 static void ref_strs(grpc_error* err) {
   for (size_t i = 0; i < GRPC_ERROR_STR_MAX; ++i) {
     uint8_t slot = err->strs[i];
@@ -393,8 +468,22 @@ static grpc_error* copy_error_and_unref(grpc_error* in) {
                        grpc_slice_from_static_string("cancelled"));
       internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED);
     }
-  } else if (gpr_ref_is_unique(&in->atomics.refs)) {
+  } else if (!is_static_error(in) && gpr_ref_is_unique(&in->atomics.refs)) {
     out = in;
+  } else if (in->parent_depth < MAX_PARENT_DEPTH) {
+    // Others can see in, so it cannot change. Rather than copy it, make an
+    // error holding just what the caller adds, which defers to in (taking
+    // over the caller's ref to it) for everything else.
+    out = (grpc_error*)gpr_malloc(sizeof(*out) +
+                                  DERIVED_ERROR_CAPACITY * sizeof(intptr_t));
+#ifndef NDEBUG
+    if (grpc_trace_error_refcount.enabled()) {
+      gpr_log(GPR_DEBUG, "%p create deriving from %p", out, in);
+    }
+#endif
+    init_error(out, DERIVED_ERROR_CAPACITY);
+    out->parent = in;
+    out->parent_depth = (uint8_t)(in->parent_depth + 1);
   } else {
     uint8_t new_arena_capacity = in->arena_capacity;
     // the returned err will be added to, so we ensure this is room to avoid
@@ -419,6 +508,7 @@ static grpc_error* copy_error_and_unref(grpc_error* in) {
     out->arena_capacity = new_arena_capacity;
     ref_strs(out);
     ref_errs(out);
+    GRPC_ERROR_REF(out->parent);
     GRPC_ERROR_UNREF(in);
   }
   return out;
@@ -432,6 +522,24 @@ grpc_error* grpc_error_set_int(grpc_error* src, grpc_error_ints which,
   return new_err;
 }
 
+// Return the error in err's parent chain (err itself first) holding the given
+// int, string or time; or NULL if there is none
+
+static grpc_error* find_int(grpc_error* err, grpc_error_ints which) {
+  while (err != nullptr && err->ints[which] == UINT8_MAX) err = err->parent;
+  return err;
+}
+
+static grpc_error* find_str(grpc_error* err, grpc_error_strs which) {
+  while (err != nullptr && err->strs[which] == UINT8_MAX) err = err->parent;
+  return err;
+}
+
+static grpc_error* find_time(grpc_error* err, grpc_error_times which) {
+  while (err != nullptr && err->times[which] == UINT8_MAX) err = err->parent;
+  return err;
+}
+
 typedef struct {
   grpc_error* error;
   grpc_status_code code;
@@ -456,9 +564,9 @@ bool grpc_error_get_int(grpc_error* err, grpc_error_ints which, intptr_t* p) {
     }
     return false;
   }
-  uint8_t slot = err->ints[which];
-  if (slot != UINT8_MAX) {
-    if (p != nullptr) *p = err->arena[slot];
+  err = find_int(err, which);
+  if (err != nullptr) {
+    if (p != nullptr) *p = err->arena[err->ints[which]];
     return true;
   }
   return false;
@@ -485,9 +593,9 @@ bool grpc_error_get_str(grpc_error* err, grpc_error_strs which,
     }
     return false;
   }
-  uint8_t slot = err->strs[which];
-  if (slot != UINT8_MAX) {
-    *str = *(grpc_slice*)(err->arena + slot);
+  err = find_str(err, which);
+  if (err != nullptr) {
+    *str = *(grpc_slice*)(err->arena + err->strs[which]);
     return true;
   } else {
     return false;
@@ -591,10 +699,10 @@ static char* fmt_int(intptr_t p) {
 
 static void collect_ints_kvs(grpc_error* err, kv_pairs* kvs) {
   for (size_t which = 0; which < GRPC_ERROR_INT_MAX; ++which) {
-    uint8_t slot = err->ints[which];
-    if (slot != UINT8_MAX) {
+    grpc_error* owner = find_int(err, (grpc_error_ints)which);
+    if (owner != nullptr) {
       append_kv(kvs, key_int((grpc_error_ints)which),
-                fmt_int(err->arena[slot]));
+                fmt_int(owner->arena[owner->ints[which]]));
     }
   }
 }
@@ -615,10 +723,10 @@ static char* fmt_str(grpc_slice slice) {
 
 static void collect_strs_kvs(grpc_error* err, kv_pairs* kvs) {
   for (size_t which = 0; which < GRPC_ERROR_STR_MAX; ++which) {
-    uint8_t slot = err->strs[which];
-    if (slot != UINT8_MAX) {
+    grpc_error* owner = find_str(err, (grpc_error_strs)which);
+    if (owner != nullptr) {
       append_kv(kvs, key_str((grpc_error_strs)which),
-                fmt_str(*(grpc_slice*)(err->arena + slot)));
+                fmt_str(*(grpc_slice*)(owner->arena + owner->strs[which])));
     }
   }
 }
@@ -650,21 +758,23 @@ static char* fmt_time(gpr_timespec tm) {
 
 static void collect_times_kvs(grpc_error* err, kv_pairs* kvs) {
   for (size_t which = 0; which < GRPC_ERROR_TIME_MAX; ++which) {
-    uint8_t slot = err->times[which];
-    if (slot != UINT8_MAX) {
+    grpc_error* owner = find_time(err, (grpc_error_times)which);
+    if (owner != nullptr) {
       append_kv(kvs, key_time((grpc_error_times)which),
-                fmt_time(*(gpr_timespec*)(err->arena + slot)));
+                fmt_time(*(gpr_timespec*)(owner->arena + owner->times[which])));
     }
   }
 }
 
-static void add_errs(grpc_error* err, char** s, size_t* sz, size_t* cap) {
+// Children of err's parents come first: they were added first
+static void add_errs(grpc_error* err, char** s, size_t* sz, size_t* cap,
+                     bool* first) {
+  if (err->parent != nullptr) add_errs(err->parent, s, sz, cap, first);
   uint8_t slot = err->first_err;
-  bool first = true;
   while (slot != UINT8_MAX) {
     grpc_linked_error* lerr = (grpc_linked_error*)(err->arena + slot);
-    if (!first) append_chr(',', s, sz, cap);
-    first = false;
+    if (!*first) append_chr(',', s, sz, cap);
+    *first = false;
     const char* e = grpc_error_string(lerr->err);
     append_str(e, s, sz, cap);
     GPR_ASSERT(err->last_err == slot ? lerr->next == UINT8_MAX
@@ -673,12 +783,20 @@ static void add_errs(grpc_error* err, char** s, size_t* sz, size_t* cap) {
   }
 }
 
+static bool has_errs(grpc_error* err) {
+  for (; err != nullptr; err = err->parent) {
+    if (err->first_err != UINT8_MAX) return true;
+  }
+  return false;
+}
+
 static char* errs_string(grpc_error* err) {
   char* s = nullptr;
   size_t sz = 0;
   size_t cap = 0;
+  bool first = true;
   append_chr('[', &s, &sz, &cap);
-  add_errs(err, &s, &sz, &cap);
+  add_errs(err, &s, &sz, &cap, &first);
   append_chr(']', &s, &sz, &cap);
   append_chr(0, &s, &sz, &cap);
   return s;
@@ -729,7 +847,7 @@ const char* grpc_error_string(grpc_error* err) {
   collect_ints_kvs(err, &kvs);
   collect_strs_kvs(err, &kvs);
   collect_times_kvs(err, &kvs);
-  if (err->first_err != UINT8_MAX) {
+  if (has_errs(err)) {
     append_kv(&kvs, gpr_strdup("referenced_errors"), errs_string(err));
   }
 
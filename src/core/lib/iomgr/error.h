@@ -121,6 +121,13 @@ typedef enum {
 #define GRPC_ERROR_OOM ((grpc_error*)2)
 #define GRPC_ERROR_CANCELLED ((grpc_error*)4)
 
+/// Returns a preallocated, immutable error carrying \a status (and a canonical
+/// description of it): like the special errors above it is never allocated,
+/// and refs to it are free. GRPC_STATUS_OK maps to GRPC_ERROR_NONE and
+/// GRPC_STATUS_CANCELLED to GRPC_ERROR_CANCELLED. Setting attributes on the
+/// result only allocates room for what is added.
+grpc_error* grpc_error_for_status(grpc_status_code status);
+
 const char* grpc_error_string(grpc_error* error);
 
 /// Create an error - but use GRPC_ERROR_CREATE instead
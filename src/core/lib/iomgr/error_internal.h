@@ -41,6 +41,10 @@ struct grpc_error {
     gpr_refcount refs;
     gpr_atm error_string;
   } atomics;
+  // An error made by setting attributes on (or adding children to) an error
+  // that was shared only records what was added, and holds a ref to the
+  // original here: lookups fall through to it. NULL for ordinary errors.
+  grpc_error* parent;
   // These arrays index into dynamic arena at the bottom of the struct.
   // UINT8_MAX is used as a sentinel value.
   uint8_t ints[GRPC_ERROR_INT_MAX];
@@ -53,6 +57,8 @@ struct grpc_error {
   // The arena is dynamically reallocated with a grow factor of 1.5.
   uint8_t arena_size;
   uint8_t arena_capacity;
+  // Length of the parent chain
+  uint8_t parent_depth;
   intptr_t arena[0];
 };
 
@@ -52,18 +52,17 @@
 #include "src/core/lib/iomgr/wakeup_fd_posix.h"
 #include "src/core/lib/profiling/timers.h"
 
-static grpc_wakeup_fd global_wakeup_fd;
-
 /*******************************************************************************
- * Singleton epoll set related fields
+ * Epoll set related fields
  */
 
 #define MAX_EPOLL_EVENTS 100
 #define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
+#define MAX_EPOLL_SETS 64
 
 /* NOTE ON SYNCHRONIZATION:
- * - Fields in this struct are only modified by the designated poller. Hence
- *   there is no need for any locks to protect the struct.
+ * - Fields in this struct are only modified by the designated poller of the
+ *   set. Hence there is no need for any locks to protect the struct.
  * - num_events and cursor fields have to be of atomic type to provide memory
  *   visibility guarantees only. i.e In case of multiple pollers, the designated
  *   polling thread keeps changing; the thread that wrote these values may be
@@ -72,6 +71,18 @@ static grpc_wakeup_fd global_wakeup_fd;
 typedef struct epoll_set {
   int epfd;
 
+  /* Kicks the designated poller of this set out of epoll_wait() */
+  grpc_wakeup_fd wakeup_fd;
+
+  /* The designated poller: the only worker calling epoll_wait() on this set.
+   * The actual type stored in this is (grpc_pollset_worker *) */
+  gpr_atm active_poller;
+
+  /* Sharded engine only: set by the poller of g_epoll_sets[0] when it found
+   * this set ready but owned by another poller, so that the owner wakes it up
+   * to drain the set should it leave without a successor */
+  gpr_atm drain_pending;
+
   /* The epoll_events after the last call to epoll_wait() */
   struct epoll_event events[MAX_EPOLL_EVENTS];
 
@@ -83,8 +94,17 @@ typedef struct epoll_set {
   gpr_atm cursor;
 } epoll_set;
 
-/* The global singleton epoll set */
-static epoll_set g_epoll_set;
+/* The epoll sets. The plain epoll1 engine has a single one; the sharded
+ * variant has one per core, each with its own designated poller, so that
+ * several threads can wait for events in parallel. Every fd is registered with
+ * exactly one set. Sets other than the first are themselves registered
+ * (edge-triggered) with g_epoll_sets[0]: its poller drains any set that is
+ * left without a poller of its own, so no set ever goes unpolled */
+static epoll_set* g_epoll_sets;
+static size_t g_num_epoll_sets;
+
+/* Round-robin counter used to spread fds over the epoll sets */
+static gpr_atm g_next_epoll_set;
 
 static int epoll_create_and_cloexec() {
 #ifdef GRPC_LINUX_EPOLL_CREATE1
@@ -104,25 +124,66 @@ static int epoll_create_and_cloexec() {
   return fd;
 }
 
+/* epoll_set_init() MUST be called before calling this. */
+static void epoll_set_shutdown() {
+  if (g_epoll_sets == nullptr) return;
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    if (g_epoll_sets[i].epfd >= 0) {
+      close(g_epoll_sets[i].epfd);
+    }
+  }
+  gpr_free(g_epoll_sets);
+  g_epoll_sets = nullptr;
+}
+
 /* Must be called *only* once */
-static bool epoll_set_init() {
-  g_epoll_set.epfd = epoll_create_and_cloexec();
-  if (g_epoll_set.epfd < 0) {
-    return false;
+static bool epoll_set_init(size_t num_sets) {
+  g_num_epoll_sets = num_sets;
+  g_epoll_sets = (epoll_set*)gpr_zalloc(sizeof(*g_epoll_sets) * num_sets);
+  for (size_t i = 0; i < num_sets; i++) {
+    g_epoll_sets[i].epfd = -1;
+    g_epoll_sets[i].wakeup_fd.read_fd = -1;
   }
+  gpr_atm_no_barrier_store(&g_next_epoll_set, 0);
+
+  for (size_t i = 0; i < num_sets; i++) {
+    epoll_set* set = &g_epoll_sets[i];
+    set->epfd = epoll_create_and_cloexec();
+    if (set->epfd < 0) {
+      epoll_set_shutdown();
+      return false;
+    }
 
-  gpr_log(GPR_INFO, "grpc epoll fd: %d", g_epoll_set.epfd);
-  gpr_atm_no_barrier_store(&g_epoll_set.num_events, 0);
-  gpr_atm_no_barrier_store(&g_epoll_set.cursor, 0);
+    gpr_log(GPR_INFO, "grpc epoll fd: %d", set->epfd);
+    gpr_atm_no_barrier_store(&set->active_poller, 0);
+    gpr_atm_no_barrier_store(&set->drain_pending, 0);
+    gpr_atm_no_barrier_store(&set->num_events, 0);
+    gpr_atm_no_barrier_store(&set->cursor, 0);
+
+    if (i > 0) {
+      struct epoll_event ev;
+      ev.events = (uint32_t)(EPOLLIN | EPOLLET);
+      ev.data.ptr = set;
+      if (epoll_ctl(g_epoll_sets[0].epfd, EPOLL_CTL_ADD, set->epfd, &ev) != 0) {
+        gpr_log(GPR_ERROR, "epoll_ctl failed: %s", strerror(errno));
+        epoll_set_shutdown();
+        return false;
+      }
+    }
+  }
   return true;
 }
 
-/* epoll_set_init() MUST be called before calling this. */
-static void epoll_set_shutdown() {
-  if (g_epoll_set.epfd >= 0) {
-    close(g_epoll_set.epfd);
-    g_epoll_set.epfd = -1;
-  }
+static bool is_epoll_set(void* p) {
+  return p >= (void*)g_epoll_sets &&
+         p < (void*)(g_epoll_sets + g_num_epoll_sets);
+}
+
+/* Picks the set a new fd is registered with */
+static epoll_set* choose_epoll_set(void) {
+  if (g_num_epoll_sets == 1) return &g_epoll_sets[0];
+  size_t idx = (size_t)gpr_atm_no_barrier_fetch_add(&g_next_epoll_set, 1);
+  return &g_epoll_sets[idx % g_num_epoll_sets];
 }
 
 /*******************************************************************************
@@ -165,10 +226,27 @@ static const char* kick_state_string(kick_state st) {
   GPR_UNREACHABLE_CODE(return "UNKNOWN");
 }
 
+/* How far a designated poller is through its (single) poll in pollset_work().
+   Lets a kick skip the wakeup fd write unless the poller is actually blocked in
+   epoll_wait(): a poller that has not started polling yet or is spinning
+   notices the kick through this state instead, and one that is done polling is
+   about to return anyway */
+typedef enum {
+  POLL_NOT_STARTED,
+  POLL_SPINNING,
+  POLL_BLOCKED,
+  POLL_DONE,
+  POLL_KICKED /* kicked before it blocked: will not block */
+} poll_state;
+
 struct grpc_pollset_worker {
   kick_state state;
   int kick_state_mutator;  // which line of code last changed kick state
   bool initialized_cv;
+  /* The set this worker polls while it is a designated poller */
+  epoll_set* set;
+  /* A poll_state: only meaningful while this is a designated poller */
+  gpr_atm poll_state;
   grpc_pollset_worker* next;
   grpc_pollset_worker* prev;
   gpr_cv cv;
@@ -206,6 +284,10 @@ struct grpc_pollset {
    * worker list */
   int begin_refs;
 
+  /* Microseconds the designated poller spins on a non-blocking epoll_wait
+     before blocking (0 disables spinning). Set by pollset_configure_spin() */
+  gpr_atm spin_budget_us;
+
   grpc_pollset* next;
   grpc_pollset* prev;
 };
@@ -306,7 +388,7 @@ static grpc_fd* fd_create(int fd, const char* name) {
   struct epoll_event ev;
   ev.events = (uint32_t)(EPOLLIN | EPOLLOUT | EPOLLET);
   ev.data.ptr = new_fd;
-  if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+  if (epoll_ctl(choose_epoll_set()->epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
     gpr_log(GPR_ERROR, "epoll_ctl failed: %s", strerror(errno));
   }
 
@@ -396,9 +478,6 @@ static void fd_become_writable(grpc_fd* fd) { fd->write_closure->SetReady(); }
 GPR_TLS_DECL(g_current_thread_pollset);
 GPR_TLS_DECL(g_current_thread_worker);
 
-/* The designated poller */
-static gpr_atm g_active_poller;
-
 static pollset_neighborhood* g_neighborhoods;
 static size_t g_num_neighborhoods;
 
@@ -443,19 +522,65 @@ static size_t choose_neighborhood(void) {
   return (size_t)gpr_cpu_current_cpu() % g_num_neighborhoods;
 }
 
+static bool is_active_poller(grpc_pollset_worker* worker) {
+  return worker->set != nullptr &&
+         gpr_atm_no_barrier_load(&worker->set->active_poller) ==
+             (gpr_atm)worker;
+}
+
+/* Wake up the designated poller 'worker' (and mark it KICKED); only writes the
+   wakeup fd if the poller is blocked in epoll_wait() */
+static grpc_error* kick_active_poller(grpc_pollset_worker* worker) {
+  SET_KICK_STATE(worker, KICKED);
+  for (;;) {
+    gpr_atm state = gpr_atm_acq_load(&worker->poll_state);
+    if (state == POLL_BLOCKED) {
+      GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+      return grpc_wakeup_fd_wakeup(&worker->set->wakeup_fd);
+    }
+    if (state == POLL_DONE || state == POLL_KICKED ||
+        gpr_atm_full_cas(&worker->poll_state, state, POLL_KICKED)) {
+      GRPC_STATS_INC_POLLSET_KICK_SUPPRESSED();
+      return GRPC_ERROR_NONE;
+    }
+  }
+}
+
+/* Make 'worker' the designated poller of a set that has none; returns false if
+   every set already has one. g_epoll_sets[0] goes first, as its poller also
+   covers the sets left without a poller. After it, the set local to
+   'neighborhood' is preferred */
+static bool claim_epoll_set(grpc_pollset_worker* worker,
+                            pollset_neighborhood* neighborhood) {
+  size_t local = (size_t)(neighborhood - g_neighborhoods) * g_num_epoll_sets /
+                 g_num_neighborhoods;
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    size_t idx =
+        i == 0 ? 0
+               : 1 + (GPR_MAX(local, 1) - 1 + i - 1) % (g_num_epoll_sets - 1);
+    epoll_set* set = &g_epoll_sets[idx];
+    if (gpr_atm_no_barrier_cas(&set->active_poller, 0, (gpr_atm)worker)) {
+      worker->set = set;
+      SET_KICK_STATE(worker, DESIGNATED_POLLER);
+      return true;
+    }
+  }
+  return false;
+}
+
 static grpc_error* pollset_global_init(void) {
   gpr_tls_init(&g_current_thread_pollset);
   gpr_tls_init(&g_current_thread_worker);
-  gpr_atm_no_barrier_store(&g_active_poller, 0);
-  global_wakeup_fd.read_fd = -1;
-  grpc_error* err = grpc_wakeup_fd_init(&global_wakeup_fd);
-  if (err != GRPC_ERROR_NONE) return err;
-  struct epoll_event ev;
-  ev.events = (uint32_t)(EPOLLIN | EPOLLET);
-  ev.data.ptr = &global_wakeup_fd;
-  if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, global_wakeup_fd.read_fd,
-                &ev) != 0) {
-    return GRPC_OS_ERROR(errno, "epoll_ctl");
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    epoll_set* set = &g_epoll_sets[i];
+    grpc_error* err = grpc_wakeup_fd_init(&set->wakeup_fd);
+    if (err != GRPC_ERROR_NONE) return err;
+    struct epoll_event ev;
+    ev.events = (uint32_t)(EPOLLIN | EPOLLET);
+    ev.data.ptr = &set->wakeup_fd;
+    if (epoll_ctl(set->epfd, EPOLL_CTL_ADD, set->wakeup_fd.read_fd, &ev) != 0) {
+      return GRPC_OS_ERROR(errno, "epoll_ctl");
+    }
   }
   g_num_neighborhoods = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_NEIGHBORHOODS);
   g_neighborhoods = (pollset_neighborhood*)gpr_zalloc(sizeof(*g_neighborhoods) *
@@ -469,7 +594,11 @@ static grpc_error* pollset_global_init(void) {
 static void pollset_global_shutdown(void) {
   gpr_tls_destroy(&g_current_thread_pollset);
   gpr_tls_destroy(&g_current_thread_worker);
-  if (global_wakeup_fd.read_fd != -1) grpc_wakeup_fd_destroy(&global_wakeup_fd);
+  for (size_t i = 0; i < g_num_epoll_sets; i++) {
+    if (g_epoll_sets[i].wakeup_fd.read_fd != -1) {
+      grpc_wakeup_fd_destroy(&g_epoll_sets[i].wakeup_fd);
+    }
+  }
   for (size_t i = 0; i < g_num_neighborhoods; i++) {
     gpr_mu_destroy(&g_neighborhoods[i].mu);
   }
@@ -487,9 +616,15 @@ static void pollset_init(grpc_pollset* pollset, gpr_mu** mu) {
   pollset->shutting_down = false;
   pollset->shutdown_closure = nullptr;
   pollset->begin_refs = 0;
+  gpr_atm_no_barrier_store(&pollset->spin_budget_us, 0);
   pollset->next = pollset->prev = nullptr;
 }
 
+static void pollset_configure_spin(grpc_pollset* pollset, int spin_budget_us) {
+  gpr_atm_no_barrier_store(&pollset->spin_budget_us,
+                           GPR_MAX(spin_budget_us, 0));
+}
+
 static void pollset_destroy(grpc_pollset* pollset) {
   gpr_mu_lock(&pollset->mu);
   if (!pollset->seen_inactive) {
@@ -537,10 +672,7 @@ static grpc_error* pollset_kick_all(grpc_pollset* pollset) {
           }
           break;
         case DESIGNATED_POLLER:
-          GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
-          SET_KICK_STATE(worker, KICKED);
-          append_error(&error, grpc_wakeup_fd_wakeup(&global_wakeup_fd),
-                       "pollset_kick_all");
+          append_error(&error, kick_active_poller(worker), "pollset_kick_all");
           break;
       }
 
@@ -583,30 +715,43 @@ static int poll_deadline_to_millis_timeout(grpc_millis millis) {
   }
 }
 
+static grpc_error* drain_epoll_set(epoll_set* set, grpc_pollset* pollset,
+                                   grpc_pollset_worker* worker);
+static grpc_error* drain_pending_epoll_sets(grpc_pollset* pollset,
+                                            grpc_pollset_worker* worker);
+
 /* Process the epoll events found by do_epoll_wait() function.
-   - g_epoll_set.cursor points to the index of the first event to be processed
-   - This function then processes up-to MAX_EPOLL_EVENTS_PER_ITERATION and
-     updates the g_epoll_set.cursor
+   - set->cursor points to the index of the first event to be processed
+   - This function then processes up-to 'max_events' and updates the
+     set->cursor
 
    NOTE ON SYNCRHONIZATION: Similar to do_epoll_wait(), this function is only
-   called by g_active_poller thread. So there is no need for synchronization
-   when accessing fields in g_epoll_set */
-static grpc_error* process_epoll_events(grpc_pollset* pollset) {
+   called by the set's active_poller thread. So there is no need for
+   synchronization when accessing fields in the set */
+static grpc_error* process_epoll_events(grpc_pollset* pollset,
+                                        grpc_pollset_worker* worker,
+                                        epoll_set* set, long max_events) {
   GPR_TIMER_SCOPE("process_epoll_events", 0);
 
   static const char* err_desc = "process_events";
   grpc_error* error = GRPC_ERROR_NONE;
-  long num_events = gpr_atm_acq_load(&g_epoll_set.num_events);
-  long cursor = gpr_atm_acq_load(&g_epoll_set.cursor);
-  for (int idx = 0;
-       (idx < MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION) && cursor != num_events;
-       idx++) {
+  long num_events = gpr_atm_acq_load(&set->num_events);
+  long cursor = gpr_atm_acq_load(&set->cursor);
+  for (long idx = 0; (idx < max_events) && cursor != num_events; idx++) {
     long c = cursor++;
-    struct epoll_event* ev = &g_epoll_set.events[c];
+    struct epoll_event* ev = &set->events[c];
     void* data_ptr = ev->data.ptr;
 
-    if (data_ptr == &global_wakeup_fd) {
-      append_error(&error, grpc_wakeup_fd_consume_wakeup(&global_wakeup_fd),
+    if (data_ptr == &set->wakeup_fd) {
+      append_error(&error, grpc_wakeup_fd_consume_wakeup(&set->wakeup_fd),
+                   err_desc);
+      if (set == &g_epoll_sets[0] && g_num_epoll_sets > 1) {
+        append_error(&error, drain_pending_epoll_sets(pollset, worker),
+                     err_desc);
+      }
+    } else if (is_epoll_set(data_ptr)) {
+      append_error(&error,
+                   drain_epoll_set((epoll_set*)data_ptr, pollset, worker),
                    err_desc);
     } else {
       grpc_fd* fd = (grpc_fd*)(data_ptr);
@@ -623,20 +768,29 @@ static grpc_error* process_epoll_events(grpc_pollset* pollset) {
       }
     }
   }
-  gpr_atm_rel_store(&g_epoll_set.cursor, cursor);
+  gpr_atm_rel_store(&set->cursor, cursor);
   return error;
 }
 
-/* Do epoll_wait and store the events in g_epoll_set.events field. This does not
+/* Do epoll_wait and store the events in set->events field. This does not
    "process" any of the events yet; that is done in process_epoll_events().
    *See process_epoll_events() function for more details.
 
-   NOTE ON SYNCHRONIZATION: At any point of time, only the g_active_poller
+   NOTE ON SYNCHRONIZATION: At any point of time, only the set's active_poller
    (i.e the designated poller thread) will be calling this function. So there is
-   no need for any synchronization when accesing fields in g_epoll_set */
-static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
+   no need for any synchronization when accesing fields in the set */
+static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_pollset_worker* worker,
+                                 epoll_set* set, grpc_millis deadline) {
   GPR_TIMER_SCOPE("do_epoll_wait", 0);
 
+  /* From here on a kick has to go through the wakeup fd, unless one has
+     already been delivered */
+  gpr_atm state = gpr_atm_acq_load(&worker->poll_state);
+  if (state == POLL_KICKED ||
+      !gpr_atm_full_cas(&worker->poll_state, state, POLL_BLOCKED)) {
+    return GRPC_ERROR_NONE;
+  }
+
   int r;
   int timeout = poll_deadline_to_millis_timeout(deadline);
   if (timeout != 0) {
@@ -644,8 +798,7 @@ static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
   }
   do {
     GRPC_STATS_INC_SYSCALL_POLL();
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
+    r = epoll_wait(set->epfd, set->events, MAX_EPOLL_EVENTS, timeout);
   } while (r < 0 && errno == EINTR);
   if (timeout != 0) {
     GRPC_SCHEDULING_END_BLOCKING_REGION;
@@ -659,18 +812,141 @@ static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
     gpr_log(GPR_DEBUG, "ps: %p poll got %d events", ps, r);
   }
 
-  gpr_atm_rel_store(&g_epoll_set.num_events, r);
-  gpr_atm_rel_store(&g_epoll_set.cursor, 0);
+  gpr_atm_rel_store(&set->num_events, r);
+  gpr_atm_rel_store(&set->cursor, 0);
 
   return GRPC_ERROR_NONE;
 }
 
+/* Busy-poll variant of do_epoll_wait(): repeatedly calls epoll_wait() with a
+   zero timeout for up to the pollset's spin budget (never past the deadline).
+   Returns true if events were found (and stored in the set just like
+   do_epoll_wait() does) or the worker was kicked, false if the budget ran out
+   and the caller should block instead. Trades CPU for wakeup latency: a thread
+   that finds work while spinning avoids the cost of sleeping in the kernel and
+   being woken again (kicks reach it without a wakeup fd write, too).
+
+   Same synchronization rules as do_epoll_wait() apply */
+static bool do_epoll_spin(grpc_pollset* ps, grpc_pollset_worker* worker,
+                          epoll_set* set, grpc_millis deadline) {
+  int64_t budget_us = gpr_atm_no_barrier_load(&ps->spin_budget_us);
+  if (budget_us <= 0) return false;
+  int timeout = poll_deadline_to_millis_timeout(deadline);
+  if (timeout == 0) return false;
+  if (timeout > 0) budget_us = GPR_MIN(budget_us, (int64_t)timeout * 1000);
+  if (!gpr_atm_full_cas(&worker->poll_state, POLL_NOT_STARTED,
+                        POLL_SPINNING)) {
+    return true; /* already kicked */
+  }
+
+  GPR_TIMER_SCOPE("do_epoll_spin", 0);
+  gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  gpr_timespec end =
+      gpr_time_add(start, gpr_time_from_micros(budget_us, GPR_TIMESPAN));
+  gpr_timespec now;
+  int r;
+  bool kicked = false;
+  /* the spin counts as one poll however many times it goes round: its length
+     shows in pollset_spin_time_us */
+  GRPC_STATS_INC_SYSCALL_POLL();
+  for (;;) {
+    r = epoll_wait(set->epfd, set->events, MAX_EPOLL_EVENTS, 0);
+    now = gpr_now(GPR_CLOCK_MONOTONIC);
+    if (r > 0 || (r < 0 && errno != EINTR)) break;
+    if (gpr_atm_acq_load(&worker->poll_state) == POLL_KICKED) {
+      kicked = true;
+      break;
+    }
+    if (gpr_time_cmp(now, end) >= 0) break;
+  }
+  gpr_timespec spent = gpr_time_sub(now, start);
+  GRPC_STATS_INC_POLLSET_SPIN_TIME_US(
+      (int)(spent.tv_sec * GPR_US_PER_SEC + spent.tv_nsec / GPR_NS_PER_US));
+
+  if (r <= 0) {
+    if (kicked) return true;
+    GRPC_STATS_INC_POLLSET_SPIN_MISSES();
+    return false;
+  }
+  GRPC_STATS_INC_POLLSET_SPIN_HITS();
+  GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+
+  if (grpc_polling_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "ps: %p spin got %d events", ps, r);
+  }
+
+  gpr_atm_rel_store(&set->num_events, r);
+  gpr_atm_rel_store(&set->cursor, 0);
+  return true;
+}
+
+/* Called by the poller of g_epoll_sets[0] when 'set' has become ready. If the
+   set has a designated poller of its own this is left to it, and the set is
+   flagged so that its poller wakes us should it leave without a successor.
+   Otherwise claim the set for as long as it takes to process everything it has
+   ready (the fds are edge-triggered, so this is cheap: just scheduling their
+   closures) */
+static grpc_error* drain_epoll_set(epoll_set* set, grpc_pollset* pollset,
+                                   grpc_pollset_worker* worker) {
+  if (!gpr_atm_full_cas(&set->active_poller, 0, (gpr_atm)worker)) {
+    gpr_atm_full_xchg(&set->drain_pending, 1);
+    /* the poller may have left before it could see the flag */
+    if (!gpr_atm_full_cas(&set->active_poller, 0, (gpr_atm)worker)) {
+      return GRPC_ERROR_NONE;
+    }
+  }
+  GPR_TIMER_SCOPE("drain_epoll_set", 0);
+  GRPC_STATS_INC_POLLSET_EPOLL_SET_DRAINS();
+  gpr_atm_no_barrier_store(&set->drain_pending, 0);
+  grpc_error* error = GRPC_ERROR_NONE;
+  /* events left behind by the last poller go first */
+  append_error(&error,
+               process_epoll_events(pollset, worker, set, MAX_EPOLL_EVENTS),
+               "drain_epoll_set");
+  int r;
+  do {
+    do {
+      GRPC_STATS_INC_SYSCALL_POLL();
+      r = epoll_wait(set->epfd, set->events, MAX_EPOLL_EVENTS, 0);
+    } while (r < 0 && errno == EINTR);
+    if (r < 0) {
+      append_error(&error, GRPC_OS_ERROR(errno, "epoll_wait"),
+                   "drain_epoll_set");
+      break;
+    }
+    GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+    gpr_atm_rel_store(&set->num_events, r);
+    gpr_atm_rel_store(&set->cursor, 0);
+    append_error(&error,
+                 process_epoll_events(pollset, worker, set, MAX_EPOLL_EVENTS),
+                 "drain_epoll_set");
+  } while (r == MAX_EPOLL_EVENTS);
+  gpr_atm_full_xchg(&set->active_poller, 0);
+  return error;
+}
+
+/* The poller of g_epoll_sets[0] was woken up: drain the sets that were handed
+   back to it (see end_worker()) */
+static grpc_error* drain_pending_epoll_sets(grpc_pollset* pollset,
+                                            grpc_pollset_worker* worker) {
+  grpc_error* error = GRPC_ERROR_NONE;
+  for (size_t i = 1; i < g_num_epoll_sets; i++) {
+    if (gpr_atm_no_barrier_load(&g_epoll_sets[i].drain_pending)) {
+      append_error(&error, drain_epoll_set(&g_epoll_sets[i], pollset, worker),
+                   "drain_pending_epoll_sets");
+    }
+  }
+  return error;
+}
+
 static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
                          grpc_pollset_worker** worker_hdl,
                          grpc_millis deadline) {
   GPR_TIMER_SCOPE("begin_worker", 0);
   if (worker_hdl != nullptr) *worker_hdl = worker;
   worker->initialized_cv = false;
+  worker->set = nullptr;
+  gpr_atm_no_barrier_store(&worker->poll_state, POLL_NOT_STARTED);
   SET_KICK_STATE(worker, UNKICKED);
   worker->schedule_on_end_work = (grpc_closure_list)GRPC_CLOSURE_LIST_INIT;
   pollset->begin_refs++;
@@ -721,9 +997,8 @@ static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
         if (neighborhood->active_root == nullptr) {
           neighborhood->active_root = pollset->next = pollset->prev = pollset;
           /* Make this the designated poller if there isn't one already */
-          if (worker->state == UNKICKED &&
-              gpr_atm_no_barrier_cas(&g_active_poller, 0, (gpr_atm)worker)) {
-            SET_KICK_STATE(worker, DESIGNATED_POLLER);
+          if (worker->state == UNKICKED) {
+            claim_epoll_set(worker, neighborhood);
           }
         } else {
           pollset->next = neighborhood->active_root;
@@ -741,8 +1016,14 @@ static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
 
   worker_insert(pollset, worker);
   pollset->begin_refs--;
+  /* With several epoll sets, rather than queue up behind the current poller
+     take over a set that has none */
+  if (g_num_epoll_sets > 1 && worker->state == UNKICKED &&
+      !pollset->kicked_without_poller && !pollset->shutting_down) {
+    claim_epoll_set(worker, pollset->neighborhood);
+  }
   if (worker->state == UNKICKED && !pollset->kicked_without_poller) {
-    GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+    GPR_ASSERT(!is_active_poller(worker));
     worker->initialized_cv = true;
     gpr_cv_init(&worker->cv);
     while (worker->state == UNKICKED && !pollset->shutting_down) {
@@ -789,7 +1070,7 @@ static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
 }
 
 static bool check_neighborhood_for_available_poller(
-    pollset_neighborhood* neighborhood) {
+    pollset_neighborhood* neighborhood, epoll_set* set) {
   GPR_TIMER_SCOPE("check_neighborhood_for_available_poller", 0);
   bool found_worker = false;
   do {
@@ -804,12 +1085,13 @@ static bool check_neighborhood_for_available_poller(
       do {
         switch (inspect_worker->state) {
           case UNKICKED:
-            if (gpr_atm_no_barrier_cas(&g_active_poller, 0,
+            if (gpr_atm_no_barrier_cas(&set->active_poller, 0,
                                        (gpr_atm)inspect_worker)) {
               if (grpc_polling_trace.enabled()) {
                 gpr_log(GPR_DEBUG, " .. choose next poller to be %p",
                         inspect_worker);
               }
+              inspect_worker->set = set;
               SET_KICK_STATE(inspect_worker, DESIGNATED_POLLER);
               if (inspect_worker->initialized_cv) {
                 GPR_TIMER_MARK("signal worker", 0);
@@ -863,13 +1145,15 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
   SET_KICK_STATE(worker, KICKED);
   grpc_closure_list_move(&worker->schedule_on_end_work,
                          grpc_core::ExecCtx::Get()->closure_list());
-  if (gpr_atm_no_barrier_load(&g_active_poller) == (gpr_atm)worker) {
+  if (is_active_poller(worker)) {
+    epoll_set* set = worker->set;
     if (worker->next != worker && worker->next->state == UNKICKED) {
       if (grpc_polling_trace.enabled()) {
         gpr_log(GPR_DEBUG, " .. choose next poller to be peer %p", worker);
       }
       GPR_ASSERT(worker->next->initialized_cv);
-      gpr_atm_no_barrier_store(&g_active_poller, (gpr_atm)worker->next);
+      worker->next->set = set;
+      gpr_atm_no_barrier_store(&set->active_poller, (gpr_atm)worker->next);
       SET_KICK_STATE(worker->next, DESIGNATED_POLLER);
       GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
       gpr_cv_signal(&worker->next->cv);
@@ -879,7 +1163,8 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
         gpr_mu_lock(&pollset->mu);
       }
     } else {
-      gpr_atm_no_barrier_store(&g_active_poller, 0);
+      /* full barrier: pairs with drain_epoll_set() */
+      gpr_atm_full_xchg(&set->active_poller, 0);
       size_t poller_neighborhood_idx =
           (size_t)(pollset->neighborhood - g_neighborhoods);
       gpr_mu_unlock(&pollset->mu);
@@ -890,7 +1175,8 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
             &g_neighborhoods[(poller_neighborhood_idx + i) %
                              g_num_neighborhoods];
         if (gpr_mu_trylock(&neighborhood->mu)) {
-          found_worker = check_neighborhood_for_available_poller(neighborhood);
+          found_worker =
+              check_neighborhood_for_available_poller(neighborhood, set);
           gpr_mu_unlock(&neighborhood->mu);
           scan_state[i] = true;
         } else {
@@ -903,9 +1189,23 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
             &g_neighborhoods[(poller_neighborhood_idx + i) %
                              g_num_neighborhoods];
         gpr_mu_lock(&neighborhood->mu);
-        found_worker = check_neighborhood_for_available_poller(neighborhood);
+        found_worker =
+            check_neighborhood_for_available_poller(neighborhood, set);
         gpr_mu_unlock(&neighborhood->mu);
       }
+      /* Nobody left to poll the set: if the poller of g_epoll_sets[0] asked
+         for it, or events fetched from it are still to be processed, hand it
+         back. The flag has to be raised in the latter case too: the set is
+         empty as far as the kernel is concerned, so g_epoll_sets[0] will not
+         report it again and only drain_pending_epoll_sets() gets to it */
+      if (!found_worker && set != &g_epoll_sets[0] &&
+          (gpr_atm_no_barrier_load(&set->drain_pending) ||
+           gpr_atm_acq_load(&set->cursor) !=
+               gpr_atm_acq_load(&set->num_events))) {
+        gpr_atm_full_xchg(&set->drain_pending, 1);
+        GRPC_LOG_IF_ERROR("end_worker",
+                          grpc_wakeup_fd_wakeup(&g_epoll_sets[0].wakeup_fd));
+      }
       grpc_core::ExecCtx::Get()->Flush();
       gpr_mu_lock(&pollset->mu);
     }
@@ -923,7 +1223,7 @@ static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
   if (EMPTIED == worker_remove(pollset, worker)) {
     pollset_maybe_finish_shutdown(pollset);
   }
-  GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+  GPR_ASSERT(!is_active_poller(worker));
 }
 
 /* pollset->po.mu lock must be held by the caller before calling this.
@@ -963,11 +1263,17 @@ static grpc_error* pollset_work(grpc_pollset* ps,
        accurately grpc_core::ExecCtx::Get()->Flush() happens in end_worker()
        AFTER selecting a designated poller). So we are not waiting long periods
        without a designated poller */
-    if (gpr_atm_acq_load(&g_epoll_set.cursor) ==
-        gpr_atm_acq_load(&g_epoll_set.num_events)) {
-      append_error(&error, do_epoll_wait(ps, deadline), err_desc);
+    epoll_set* set = worker.set;
+    if (gpr_atm_acq_load(&set->cursor) == gpr_atm_acq_load(&set->num_events) &&
+        !do_epoll_spin(ps, &worker, set, deadline)) {
+      append_error(&error, do_epoll_wait(ps, &worker, set, deadline),
+                   err_desc);
     }
-    append_error(&error, process_epoll_events(ps), err_desc);
+    gpr_atm_rel_store(&worker.poll_state, POLL_DONE);
+    append_error(&error,
+                 process_epoll_events(ps, &worker, set,
+                                      MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION),
+                 err_desc);
 
     gpr_mu_lock(&ps->mu); /* lock */
 
@@ -1042,14 +1348,11 @@ static grpc_error* pollset_kick(grpc_pollset* pollset,
       } else if (root_worker ==
                      next_worker &&  // only try and wake up a poller if
                                      // there is no next worker
-                 root_worker == (grpc_pollset_worker*)gpr_atm_no_barrier_load(
-                                    &g_active_poller)) {
-        GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+                 is_active_poller(root_worker)) {
         if (grpc_polling_trace.enabled()) {
           gpr_log(GPR_DEBUG, " .. kicked %p", root_worker);
         }
-        SET_KICK_STATE(root_worker, KICKED);
-        ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+        ret_err = kick_active_poller(root_worker);
         goto done;
       } else if (next_worker->state == UNKICKED) {
         GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
@@ -1075,13 +1378,11 @@ static grpc_error* pollset_kick(grpc_pollset* pollset,
           }
           goto done;
         } else {
-          GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
           if (grpc_polling_trace.enabled()) {
             gpr_log(GPR_DEBUG, " .. non-root poller %p (root=%p)", next_worker,
                     root_worker);
           }
-          SET_KICK_STATE(next_worker, KICKED);
-          ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+          ret_err = kick_active_poller(next_worker);
           goto done;
         }
       } else {
@@ -1114,14 +1415,11 @@ static grpc_error* pollset_kick(grpc_pollset* pollset,
     }
     SET_KICK_STATE(specific_worker, KICKED);
     goto done;
-  } else if (specific_worker ==
-             (grpc_pollset_worker*)gpr_atm_no_barrier_load(&g_active_poller)) {
-    GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+  } else if (is_active_poller(specific_worker)) {
     if (grpc_polling_trace.enabled()) {
       gpr_log(GPR_DEBUG, " .. kick active poller");
     }
-    SET_KICK_STATE(specific_worker, KICKED);
-    ret_err = grpc_wakeup_fd_wakeup(&global_wakeup_fd);
+    ret_err = kick_active_poller(specific_worker);
     goto done;
   } else if (specific_worker->initialized_cv) {
     GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
@@ -1208,18 +1506,20 @@ static const grpc_event_engine_vtable vtable = {
     pollset_set_del_fd,
 
     shutdown_engine,
+
+    pollset_configure_spin,
 };
 
 /* It is possible that GLIBC has epoll but the underlying kernel doesn't.
  * Create epoll_fd (epoll_set_init() takes care of that) to make sure epoll
  * support is available */
-const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request) {
+static const grpc_event_engine_vtable* init_epoll1(size_t num_epoll_sets) {
   if (!grpc_has_wakeup_fd()) {
     gpr_log(GPR_ERROR, "Skipping epoll1 because of no wakeup fd.");
     return nullptr;
   }
 
-  if (!epoll_set_init()) {
+  if (!epoll_set_init(num_epoll_sets)) {
     return nullptr;
   }
 
@@ -1234,6 +1534,18 @@ const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request) {
   return &vtable;
 }
 
+const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request) {
+  return init_epoll1(1);
+}
+
+/* Only used when asked for by name. A single set would just be epoll1, so
+   there are at least two even on a single core */
+const grpc_event_engine_vtable* grpc_init_epoll1_sharded_linux(
+    bool explicit_request) {
+  if (!explicit_request) return nullptr;
+  return init_epoll1((size_t)GPR_CLAMP(gpr_cpu_num_cores(), 2, MAX_EPOLL_SETS));
+}
+
 #else /* defined(GRPC_LINUX_EPOLL) */
 #if defined(GRPC_POSIX_SOCKET)
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
@@ -1242,5 +1554,9 @@ const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request) {
 const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request) {
   return nullptr;
 }
+const grpc_event_engine_vtable* grpc_init_epoll1_sharded_linux(
+    bool explicit_request) {
+  return nullptr;
+}
 #endif /* defined(GRPC_POSIX_SOCKET) */
 #endif /* !defined(GRPC_LINUX_EPOLL) */
@@ -26,4 +26,9 @@
 
 const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request);
 
+// a variant with one epoll set per core, each polled by its own designated
+// poller; only used when requested explicitly
+const grpc_event_engine_vtable* grpc_init_epoll1_sharded_linux(
+    bool explicit_request);
+
 #endif /* GRPC_CORE_LIB_IOMGR_EV_EPOLL1_LINUX_H */
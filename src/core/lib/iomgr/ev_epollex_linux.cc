@@ -823,6 +823,8 @@ static grpc_error* pollable_epoll(pollable* p, grpc_millis deadline) {
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
 
+  GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+
   if (grpc_polling_trace.enabled()) {
     gpr_log(GPR_DEBUG, "POLLABLE:%p got %d events", p, r);
   }
@@ -1448,6 +1450,8 @@ static const grpc_event_engine_vtable vtable = {
     pollset_set_del_fd,
 
     shutdown_engine,
+
+    nullptr, /* pollset_configure_spin */
 };
 
 const grpc_event_engine_vtable* grpc_init_epollex_linux(
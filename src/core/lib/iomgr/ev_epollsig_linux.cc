@@ -1233,6 +1233,9 @@ static void pollset_work_and_unlock(grpc_pollset* pollset,
       ep_rv = epoll_wait(epoll_fd, ep_ev, GRPC_EPOLL_MAX_EVENTS, 0);
     }
   }
+  if (ep_rv >= 0) {
+    GRPC_STATS_INC_POLL_EVENTS_RETURNED(ep_rv);
+  }
 
 #ifdef GRPC_TSAN
   /* See the definition of g_poll_sync for more details */
@@ -1657,6 +1660,8 @@ static const grpc_event_engine_vtable vtable = {
     pollset_set_del_fd,
 
     shutdown_engine,
+
+    nullptr, /* pollset_configure_spin */
 };
 
 /* It is possible that GLIBC has epoll but the underlying kernel doesn't.
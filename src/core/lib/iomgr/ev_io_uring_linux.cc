@@ -0,0 +1,1739 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+#include <grpc/support/log.h>
+
+/* This polling engine is only relevant on linux kernels supporting io_uring
+   with multishot poll requests */
+#ifdef GRPC_LINUX_IO_URING
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/tls.h>
+#include <grpc/support/useful.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/iomgr/block_annotate.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/iomgr_internal.h"
+#include "src/core/lib/iomgr/lockfree_event.h"
+#include "src/core/lib/profiling/timers.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+/*******************************************************************************
+ * Singleton io_uring related fields
+ */
+
+#define IO_URING_SQ_ENTRIES 4096
+#define IO_URING_CQ_ENTRIES 16384
+#define MAX_IO_URING_EVENTS 100
+#define MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION 1
+
+/* user_data values that do not name a grpc_fd. grpc_fd pointers are at least
+   8-byte aligned, so these can never collide with one */
+#define IO_URING_KICK_TAG ((uint64_t)1)
+#define IO_URING_IGNORE_TAG ((uint64_t)2)
+/* Low bits marking the user_data of a grpc_io_uring_op (also 8-byte
+   aligned) */
+#define IO_URING_OP_TAG ((uint64_t)4)
+#define IO_URING_TAG_MASK ((uint64_t)7)
+
+/* Read buffers provided to the kernel: sized like the default tcp read
+   slice. Only reads that actually received data hold one. */
+#define IO_URING_PROVIDED_BUFFERS 1024
+#define IO_URING_PROVIDED_BUFFER_SIZE 8192
+#define IO_URING_PROVIDED_BUFFER_GROUP 0
+
+/* A completion copied out of the shared completion queue */
+typedef struct io_uring_event {
+  uint64_t user_data;
+  int32_t res;
+  uint32_t flags;
+} io_uring_event;
+
+/* Every fd is registered once, with a multishot poll request that keeps
+ * posting a completion each time the fd's readiness changes (the io_uring
+ * analogue of an EPOLLET registration). Kicks are NOP submissions: the
+ * designated poller sleeps in io_uring_enter() waiting for completions, so
+ * posting one wakes it, and unlike a wakeup fd there is nothing to read back.
+ *
+ * NOTE ON SYNCHRONIZATION:
+ * - The submission queue is shared by every thread that registers fds or
+ *   kicks the poller, and is protected by sq_mu.
+ * - The completion queue and the events/num_events/cursor fields are only
+ *   touched by the designated poller (see the matching note in
+ *   ev_epoll1_linux.cc); num_events and cursor are atomic for memory
+ *   visibility only.
+ */
+typedef struct io_uring_ring {
+  int ring_fd;
+
+  void* ring_ptr;
+  size_t ring_size;
+  struct io_uring_sqe* sqes;
+  size_t sqes_size;
+
+  gpr_mu sq_mu;
+  /* Set when entries were queued by a polling thread without being submitted;
+     see grpc_io_uring_submit() */
+  bool submit_deferred;
+  unsigned* sq_head;
+  unsigned* sq_tail;
+  unsigned* sq_ring_mask;
+  unsigned* sq_ring_entries;
+  unsigned* sq_flags;
+  unsigned* sq_array;
+
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  unsigned* cq_ring_mask;
+  struct io_uring_cqe* cqes;
+
+  /* The completions reaped by the last call to do_io_uring_wait() */
+  io_uring_event events[MAX_IO_URING_EVENTS];
+
+  /* The number of completions reaped by the last call to do_io_uring_wait() */
+  gpr_atm num_events;
+
+  /* Index of the first event in events that has to be processed. This field is
+   * only valid if num_events > 0 */
+  gpr_atm cursor;
+} io_uring_ring;
+
+/* The global singleton ring */
+static io_uring_ring g_ring;
+
+/* Whether this engine is the one in use */
+static bool g_io_uring_active;
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params* p) {
+  return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                              unsigned flags, void* arg, size_t argsz) {
+  return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                      arg, argsz);
+}
+
+static int sys_io_uring_register(int fd, unsigned opcode, void* arg,
+                                 unsigned nr_args) {
+  return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/* Must be called *only* once */
+static bool ring_init() {
+  struct io_uring_params p;
+  memset(&p, 0, sizeof(p));
+  p.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  p.cq_entries = IO_URING_CQ_ENTRIES;
+  g_ring.ring_fd = sys_io_uring_setup(IO_URING_SQ_ENTRIES, &p);
+  if (g_ring.ring_fd < 0) {
+    gpr_log(GPR_ERROR, "io_uring_setup unavailable: %s", strerror(errno));
+    return false;
+  }
+  /* IORING_FEAT_RSRC_TAGS was introduced in the same kernel release (5.13) as
+     multishot poll requests, which this engine relies on; earlier releases
+     also lack IORING_ENTER_EXT_ARG timeouts and a single ring mapping */
+  const unsigned required = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP |
+                            IORING_FEAT_EXT_ARG | IORING_FEAT_RSRC_TAGS;
+  if ((p.features & required) != required) {
+    gpr_log(GPR_ERROR, "io_uring lacks required features (have 0x%x)",
+            p.features);
+    close(g_ring.ring_fd);
+    g_ring.ring_fd = -1;
+    return false;
+  }
+
+  size_t sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  size_t cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  g_ring.ring_size = GPR_MAX(sq_size, cq_size);
+  g_ring.ring_ptr =
+      mmap(nullptr, g_ring.ring_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, g_ring.ring_fd, IORING_OFF_SQ_RING);
+  if (g_ring.ring_ptr == MAP_FAILED) {
+    gpr_log(GPR_ERROR, "io_uring ring mmap failed: %s", strerror(errno));
+    close(g_ring.ring_fd);
+    g_ring.ring_fd = -1;
+    return false;
+  }
+  g_ring.sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+  g_ring.sqes = (struct io_uring_sqe*)mmap(
+      nullptr, g_ring.sqes_size, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, g_ring.ring_fd, IORING_OFF_SQES);
+  if (g_ring.sqes == MAP_FAILED) {
+    gpr_log(GPR_ERROR, "io_uring sqe mmap failed: %s", strerror(errno));
+    munmap(g_ring.ring_ptr, g_ring.ring_size);
+    close(g_ring.ring_fd);
+    g_ring.ring_fd = -1;
+    return false;
+  }
+
+  char* base = (char*)g_ring.ring_ptr;
+  g_ring.sq_head = (unsigned*)(base + p.sq_off.head);
+  g_ring.sq_tail = (unsigned*)(base + p.sq_off.tail);
+  g_ring.sq_ring_mask = (unsigned*)(base + p.sq_off.ring_mask);
+  g_ring.sq_ring_entries = (unsigned*)(base + p.sq_off.ring_entries);
+  g_ring.sq_flags = (unsigned*)(base + p.sq_off.flags);
+  g_ring.sq_array = (unsigned*)(base + p.sq_off.array);
+  g_ring.cq_head = (unsigned*)(base + p.cq_off.head);
+  g_ring.cq_tail = (unsigned*)(base + p.cq_off.tail);
+  g_ring.cq_ring_mask = (unsigned*)(base + p.cq_off.ring_mask);
+  g_ring.cqes = (struct io_uring_cqe*)(base + p.cq_off.cqes);
+
+  gpr_mu_init(&g_ring.sq_mu);
+  g_ring.submit_deferred = false;
+  gpr_log(GPR_INFO, "grpc io_uring fd: %d", g_ring.ring_fd);
+  gpr_atm_no_barrier_store(&g_ring.num_events, 0);
+  gpr_atm_no_barrier_store(&g_ring.cursor, 0);
+  return true;
+}
+
+/* ring_init() MUST be called before calling this. */
+static void ring_shutdown() {
+  if (g_ring.ring_fd >= 0) {
+    munmap(g_ring.sqes, g_ring.sqes_size);
+    munmap(g_ring.ring_ptr, g_ring.ring_size);
+    close(g_ring.ring_fd);
+    g_ring.ring_fd = -1;
+    gpr_mu_destroy(&g_ring.sq_mu);
+  }
+}
+
+/* Submit everything queued so far. Must be called with sq_mu held. */
+static grpc_error* ring_submit_locked() {
+  unsigned tail = *g_ring.sq_tail;
+  unsigned head = __atomic_load_n(g_ring.sq_head, __ATOMIC_ACQUIRE);
+  unsigned to_submit = tail - head;
+  g_ring.submit_deferred = false;
+  while (to_submit > 0) {
+    int r = sys_io_uring_enter(g_ring.ring_fd, to_submit, 0, 0, nullptr, 0);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      return GRPC_OS_ERROR(errno, "io_uring_enter");
+    }
+    to_submit -= (unsigned)r;
+  }
+  return GRPC_ERROR_NONE;
+}
+
+/* Reserve the next submission queue entry, flushing the queue first if it is
+   full. Must be called with sq_mu held; the entry is published by
+   ring_commit_sqe_locked(). */
+static struct io_uring_sqe* ring_get_sqe_locked() {
+  unsigned tail = *g_ring.sq_tail;
+  if (tail - __atomic_load_n(g_ring.sq_head, __ATOMIC_ACQUIRE) ==
+      *g_ring.sq_ring_entries) {
+    GRPC_LOG_IF_ERROR("io_uring_submit", ring_submit_locked());
+  }
+  struct io_uring_sqe* sqe = &g_ring.sqes[tail & *g_ring.sq_ring_mask];
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+static void ring_commit_sqe_locked() {
+  unsigned tail = *g_ring.sq_tail;
+  unsigned idx = tail & *g_ring.sq_ring_mask;
+  g_ring.sq_array[idx] = idx;
+  __atomic_store_n(g_ring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+/* Wake up whichever thread is waiting in io_uring_enter() */
+static grpc_error* ring_kick() {
+  gpr_mu_lock(&g_ring.sq_mu);
+  struct io_uring_sqe* sqe = ring_get_sqe_locked();
+  sqe->opcode = IORING_OP_NOP;
+  sqe->user_data = IO_URING_KICK_TAG;
+  ring_commit_sqe_locked();
+  grpc_error* error = ring_submit_locked();
+  gpr_mu_unlock(&g_ring.sq_mu);
+  return error;
+}
+
+/* Submit whatever grpc_io_uring_submit() held back on this polling thread */
+static void ring_flush_deferred() {
+  grpc_error* error = GRPC_ERROR_NONE;
+  gpr_mu_lock(&g_ring.sq_mu);
+  if (g_ring.submit_deferred) {
+    error = ring_submit_locked();
+  }
+  gpr_mu_unlock(&g_ring.sq_mu);
+  GRPC_LOG_IF_ERROR("io_uring_submit", error);
+}
+
+/*******************************************************************************
+ * Fd Declarations
+ */
+
+struct grpc_fd {
+  int fd;
+
+  /* Bumped every time this object is orphaned, so that completions of the
+   * poll request of a previous incarnation can be told apart. Only the low 16
+   * bits are used (see fd_user_data()) */
+  gpr_atm generation;
+  /* Held while bumping the generation, and while delivering or re-arming
+   * the poll request of a given generation, so that neither can happen to
+   * an fd that was orphaned (and whose descriptor may have been reused) in
+   * the meantime */
+  gpr_mu poll_mu;
+
+  grpc_core::ManualConstructor<grpc_core::LockfreeEvent> read_closure;
+  grpc_core::ManualConstructor<grpc_core::LockfreeEvent> write_closure;
+
+  struct grpc_fd* freelist_next;
+
+  /* The pollset that last noticed that the fd is readable. The actual type
+   * stored in this is (grpc_pollset *) */
+  gpr_atm read_notifier_pollset;
+
+  grpc_iomgr_object iomgr_object;
+};
+
+static void fd_global_init(void);
+static void fd_global_shutdown(void);
+
+/*******************************************************************************
+ * Pollset Declarations
+ */
+
+typedef enum { UNKICKED, KICKED, DESIGNATED_POLLER } kick_state;
+
+static const char* kick_state_string(kick_state st) {
+  switch (st) {
+    case UNKICKED:
+      return "UNKICKED";
+    case KICKED:
+      return "KICKED";
+    case DESIGNATED_POLLER:
+      return "DESIGNATED_POLLER";
+  }
+  GPR_UNREACHABLE_CODE(return "UNKNOWN");
+}
+
+struct grpc_pollset_worker {
+  kick_state state;
+  int kick_state_mutator;  // which line of code last changed kick state
+  bool initialized_cv;
+  grpc_pollset_worker* next;
+  grpc_pollset_worker* prev;
+  gpr_cv cv;
+  grpc_closure_list schedule_on_end_work;
+};
+
+#define SET_KICK_STATE(worker, kick_state)   \
+  do {                                       \
+    (worker)->state = (kick_state);          \
+    (worker)->kick_state_mutator = __LINE__; \
+  } while (false)
+
+#define MAX_NEIGHBORHOODS 1024
+
+typedef struct pollset_neighborhood {
+  gpr_mu mu;
+  grpc_pollset* active_root;
+  char pad[GPR_CACHELINE_SIZE];
+} pollset_neighborhood;
+
+struct grpc_pollset {
+  gpr_mu mu;
+  pollset_neighborhood* neighborhood;
+  bool reassigning_neighborhood;
+  grpc_pollset_worker* root_worker;
+  bool kicked_without_poller;
+
+  /* Set to true if the pollset is observed to have no workers available to
+     poll */
+  bool seen_inactive;
+  bool shutting_down;             /* Is the pollset shutting down ? */
+  grpc_closure* shutdown_closure; /* Called after after shutdown is complete */
+
+  /* Number of workers who are *about-to* attach themselves to the pollset
+   * worker list */
+  int begin_refs;
+
+  grpc_pollset* next;
+  grpc_pollset* prev;
+};
+
+/*******************************************************************************
+ * Pollset-set Declarations
+ */
+
+struct grpc_pollset_set {
+  char unused;
+};
+
+/*******************************************************************************
+ * Common helpers
+ */
+
+static bool append_error(grpc_error** composite, grpc_error* error,
+                         const char* desc) {
+  if (error == GRPC_ERROR_NONE) return true;
+  if (*composite == GRPC_ERROR_NONE) {
+    *composite = GRPC_ERROR_CREATE_FROM_COPIED_STRING(desc);
+  }
+  *composite = grpc_error_add_child(*composite, error);
+  return false;
+}
+
+/*******************************************************************************
+ * Fd Definitions
+ */
+
+/* As in ev_epoll1_linux.cc, grpc_fd objects are freelisted rather than freed:
+ * completions for an fd may still be queued (or about to be posted) when it is
+ * orphaned. The generation packed into each poll request's user_data lets the
+ * poller drop those completions instead of delivering them to a reused fd. */
+
+static grpc_fd* fd_freelist = nullptr;
+static gpr_mu fd_freelist_mu;
+
+static void fd_global_init(void) { gpr_mu_init(&fd_freelist_mu); }
+
+static void fd_global_shutdown(void) {
+  gpr_mu_lock(&fd_freelist_mu);
+  gpr_mu_unlock(&fd_freelist_mu);
+  while (fd_freelist != nullptr) {
+    grpc_fd* fd = fd_freelist;
+    fd_freelist = fd_freelist->freelist_next;
+    gpr_mu_destroy(&fd->poll_mu);
+    gpr_free(fd);
+  }
+  gpr_mu_destroy(&fd_freelist_mu);
+}
+
+static uint64_t fd_user_data(grpc_fd* fd) {
+  uint64_t generation =
+      (uint64_t)gpr_atm_no_barrier_load(&fd->generation) & 0xffff;
+  return (generation << 48) | (uint64_t)(uintptr_t)fd;
+}
+
+/* Unlike epoll, io_uring is not guaranteed to add POLLERR and POLLHUP to the
+   requested events, and a wakeup carrying only those (eg. MSG_ZEROCOPY
+   completions landing on the error queue) must not be dropped */
+#define FD_POLL_EVENTS \
+  ((uint32_t)(POLLIN | POLLPRI | POLLOUT | POLLERR | POLLHUP))
+
+static grpc_fd* fd_from_user_data(uint64_t user_data) {
+  return (grpc_fd*)(uintptr_t)(user_data & ((((uint64_t)1) << 48) - 1));
+}
+
+static void fd_arm_poll(grpc_fd* fd) {
+  gpr_mu_lock(&g_ring.sq_mu);
+  struct io_uring_sqe* sqe = ring_get_sqe_locked();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd->fd;
+  sqe->poll32_events = FD_POLL_EVENTS;
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->user_data = fd_user_data(fd);
+  ring_commit_sqe_locked();
+  grpc_error* error = ring_submit_locked();
+  gpr_mu_unlock(&g_ring.sq_mu);
+  if (error != GRPC_ERROR_NONE) {
+    gpr_log(GPR_ERROR, "io_uring poll add failed: %s",
+            grpc_error_string(error));
+    GRPC_ERROR_UNREF(error);
+  }
+}
+
+static void fd_cancel_poll(grpc_fd* fd) {
+  gpr_mu_lock(&g_ring.sq_mu);
+  struct io_uring_sqe* sqe = ring_get_sqe_locked();
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = fd_user_data(fd);
+  sqe->user_data = IO_URING_IGNORE_TAG;
+  ring_commit_sqe_locked();
+  grpc_error* error = ring_submit_locked();
+  gpr_mu_unlock(&g_ring.sq_mu);
+  if (error != GRPC_ERROR_NONE) {
+    gpr_log(GPR_ERROR, "io_uring poll remove failed: %s",
+            grpc_error_string(error));
+    GRPC_ERROR_UNREF(error);
+  }
+}
+
+static grpc_fd* fd_create(int fd, const char* name) {
+  grpc_fd* new_fd = nullptr;
+
+  gpr_mu_lock(&fd_freelist_mu);
+  if (fd_freelist != nullptr) {
+    new_fd = fd_freelist;
+    fd_freelist = fd_freelist->freelist_next;
+  }
+  gpr_mu_unlock(&fd_freelist_mu);
+
+  if (new_fd == nullptr) {
+    new_fd = (grpc_fd*)gpr_malloc(sizeof(grpc_fd));
+    GPR_ASSERT(((uintptr_t)new_fd >> 48) == 0);
+    new_fd->read_closure.Init();
+    new_fd->write_closure.Init();
+    gpr_atm_no_barrier_store(&new_fd->generation, 0);
+    gpr_mu_init(&new_fd->poll_mu);
+  }
+
+  new_fd->fd = fd;
+  new_fd->read_closure->InitEvent();
+  new_fd->write_closure->InitEvent();
+  gpr_atm_no_barrier_store(&new_fd->read_notifier_pollset, (gpr_atm)NULL);
+
+  new_fd->freelist_next = nullptr;
+
+  char* fd_name;
+  gpr_asprintf(&fd_name, "%s fd=%d", name, fd);
+  grpc_iomgr_register_object(&new_fd->iomgr_object, fd_name);
+#ifndef NDEBUG
+  if (grpc_trace_fd_refcount.enabled()) {
+    gpr_log(GPR_DEBUG, "FD %d %p create %s", fd, new_fd, fd_name);
+  }
+#endif
+  gpr_free(fd_name);
+
+  fd_arm_poll(new_fd);
+
+  return new_fd;
+}
+
+static int fd_wrapped_fd(grpc_fd* fd) { return fd->fd; }
+
+/* if 'releasing_fd' is true, it means that we are going to detach the internal
+ * fd from grpc_fd structure (i.e which means we should not be calling
+ * shutdown() syscall on that fd) */
+static void fd_shutdown_internal(grpc_fd* fd, grpc_error* why,
+                                 bool releasing_fd) {
+  if (fd->read_closure->SetShutdown(GRPC_ERROR_REF(why))) {
+    if (!releasing_fd) {
+      shutdown(fd->fd, SHUT_RDWR);
+    }
+    fd->write_closure->SetShutdown(GRPC_ERROR_REF(why));
+  }
+  GRPC_ERROR_UNREF(why);
+}
+
+/* Might be called multiple times */
+static void fd_shutdown(grpc_fd* fd, grpc_error* why) {
+  fd_shutdown_internal(fd, why, false);
+}
+
+static void fd_orphan(grpc_fd* fd, grpc_closure* on_done, int* release_fd,
+                      bool already_closed, const char* reason) {
+  grpc_error* error = GRPC_ERROR_NONE;
+  bool is_release_fd = (release_fd != nullptr);
+
+  if (!fd->read_closure->IsShutdown()) {
+    fd_shutdown_internal(fd, GRPC_ERROR_CREATE_FROM_COPIED_STRING(reason),
+                         is_release_fd);
+  }
+
+  /* Unlike an epoll registration, the poll request outlives close(): cancel it
+     explicitly, and make sure anything it already posted is ignored */
+  gpr_mu_lock(&fd->poll_mu);
+  fd_cancel_poll(fd);
+  gpr_atm_no_barrier_fetch_add(&fd->generation, 1);
+  gpr_mu_unlock(&fd->poll_mu);
+
+  /* If release_fd is not NULL, we should be relinquishing control of the file
+     descriptor fd->fd (but we still own the grpc_fd structure). */
+  if (is_release_fd) {
+    *release_fd = fd->fd;
+  } else if (!already_closed) {
+    close(fd->fd);
+  }
+
+  GRPC_CLOSURE_SCHED(on_done, GRPC_ERROR_REF(error));
+
+  grpc_iomgr_unregister_object(&fd->iomgr_object);
+  fd->read_closure->DestroyEvent();
+  fd->write_closure->DestroyEvent();
+
+  gpr_mu_lock(&fd_freelist_mu);
+  fd->freelist_next = fd_freelist;
+  fd_freelist = fd;
+  gpr_mu_unlock(&fd_freelist_mu);
+}
+
+static grpc_pollset* fd_get_read_notifier_pollset(grpc_fd* fd) {
+  gpr_atm notifier = gpr_atm_acq_load(&fd->read_notifier_pollset);
+  return (grpc_pollset*)notifier;
+}
+
+static bool fd_is_shutdown(grpc_fd* fd) {
+  return fd->read_closure->IsShutdown();
+}
+
+static void fd_notify_on_read(grpc_fd* fd, grpc_closure* closure) {
+  fd->read_closure->NotifyOn(closure);
+}
+
+static void fd_notify_on_write(grpc_fd* fd, grpc_closure* closure) {
+  fd->write_closure->NotifyOn(closure);
+}
+
+static void fd_become_readable(grpc_fd* fd, grpc_pollset* notifier) {
+  fd->read_closure->SetReady();
+  /* Use release store to match with acquire load in fd_get_read_notifier */
+  gpr_atm_rel_store(&fd->read_notifier_pollset, (gpr_atm)notifier);
+}
+
+static void fd_become_writable(grpc_fd* fd) { fd->write_closure->SetReady(); }
+
+/*******************************************************************************
+ * Pollset Definitions
+ */
+
+GPR_TLS_DECL(g_current_thread_pollset);
+GPR_TLS_DECL(g_current_thread_worker);
+
+/* The designated poller */
+static gpr_atm g_active_poller;
+
+static pollset_neighborhood* g_neighborhoods;
+static size_t g_num_neighborhoods;
+
+/* Return true if first in list */
+static bool worker_insert(grpc_pollset* pollset, grpc_pollset_worker* worker) {
+  if (pollset->root_worker == nullptr) {
+    pollset->root_worker = worker;
+    worker->next = worker->prev = worker;
+    return true;
+  } else {
+    worker->next = pollset->root_worker;
+    worker->prev = worker->next->prev;
+    worker->next->prev = worker;
+    worker->prev->next = worker;
+    return false;
+  }
+}
+
+/* Return true if last in list */
+typedef enum { EMPTIED, NEW_ROOT, REMOVED } worker_remove_result;
+
+static worker_remove_result worker_remove(grpc_pollset* pollset,
+                                          grpc_pollset_worker* worker) {
+  if (worker == pollset->root_worker) {
+    if (worker == worker->next) {
+      pollset->root_worker = nullptr;
+      return EMPTIED;
+    } else {
+      pollset->root_worker = worker->next;
+      worker->prev->next = worker->next;
+      worker->next->prev = worker->prev;
+      return NEW_ROOT;
+    }
+  } else {
+    worker->prev->next = worker->next;
+    worker->next->prev = worker->prev;
+    return REMOVED;
+  }
+}
+
+static size_t choose_neighborhood(void) {
+  return (size_t)gpr_cpu_current_cpu() % g_num_neighborhoods;
+}
+
+static grpc_error* pollset_global_init(void) {
+  gpr_tls_init(&g_current_thread_pollset);
+  gpr_tls_init(&g_current_thread_worker);
+  gpr_atm_no_barrier_store(&g_active_poller, 0);
+  g_num_neighborhoods = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_NEIGHBORHOODS);
+  g_neighborhoods = (pollset_neighborhood*)gpr_zalloc(sizeof(*g_neighborhoods) *
+                                                      g_num_neighborhoods);
+  for (size_t i = 0; i < g_num_neighborhoods; i++) {
+    gpr_mu_init(&g_neighborhoods[i].mu);
+  }
+  return GRPC_ERROR_NONE;
+}
+
+static void pollset_global_shutdown(void) {
+  gpr_tls_destroy(&g_current_thread_pollset);
+  gpr_tls_destroy(&g_current_thread_worker);
+  for (size_t i = 0; i < g_num_neighborhoods; i++) {
+    gpr_mu_destroy(&g_neighborhoods[i].mu);
+  }
+  gpr_free(g_neighborhoods);
+}
+
+static void pollset_init(grpc_pollset* pollset, gpr_mu** mu) {
+  gpr_mu_init(&pollset->mu);
+  *mu = &pollset->mu;
+  pollset->neighborhood = &g_neighborhoods[choose_neighborhood()];
+  pollset->reassigning_neighborhood = false;
+  pollset->root_worker = nullptr;
+  pollset->kicked_without_poller = false;
+  pollset->seen_inactive = true;
+  pollset->shutting_down = false;
+  pollset->shutdown_closure = nullptr;
+  pollset->begin_refs = 0;
+  pollset->next = pollset->prev = nullptr;
+}
+
+static void pollset_destroy(grpc_pollset* pollset) {
+  gpr_mu_lock(&pollset->mu);
+  if (!pollset->seen_inactive) {
+    pollset_neighborhood* neighborhood = pollset->neighborhood;
+    gpr_mu_unlock(&pollset->mu);
+  retry_lock_neighborhood:
+    gpr_mu_lock(&neighborhood->mu);
+    gpr_mu_lock(&pollset->mu);
+    if (!pollset->seen_inactive) {
+      if (pollset->neighborhood != neighborhood) {
+        gpr_mu_unlock(&neighborhood->mu);
+        neighborhood = pollset->neighborhood;
+        gpr_mu_unlock(&pollset->mu);
+        goto retry_lock_neighborhood;
+      }
+      pollset->prev->next = pollset->next;
+      pollset->next->prev = pollset->prev;
+      if (pollset == pollset->neighborhood->active_root) {
+        pollset->neighborhood->active_root =
+            pollset->next == pollset ? nullptr : pollset->next;
+      }
+    }
+    gpr_mu_unlock(&pollset->neighborhood->mu);
+  }
+  gpr_mu_unlock(&pollset->mu);
+  gpr_mu_destroy(&pollset->mu);
+}
+
+static grpc_error* pollset_kick_all(grpc_pollset* pollset) {
+  GPR_TIMER_SCOPE("pollset_kick_all", 0);
+  grpc_error* error = GRPC_ERROR_NONE;
+  if (pollset->root_worker != nullptr) {
+    grpc_pollset_worker* worker = pollset->root_worker;
+    do {
+      GRPC_STATS_INC_POLLSET_KICK();
+      switch (worker->state) {
+        case KICKED:
+          GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+          break;
+        case UNKICKED:
+          SET_KICK_STATE(worker, KICKED);
+          if (worker->initialized_cv) {
+            GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+            gpr_cv_signal(&worker->cv);
+          }
+          break;
+        case DESIGNATED_POLLER:
+          GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+          SET_KICK_STATE(worker, KICKED);
+          append_error(&error, ring_kick(),
+                       "pollset_kick_all");
+          break;
+      }
+
+      worker = worker->next;
+    } while (worker != pollset->root_worker);
+  }
+  /* With no workers there is nothing to kick: this is only called by
+     pollset_shutdown(), and a worker that begins afterwards sees shutting_down
+     and does not poll */
+  return error;
+}
+
+static void pollset_maybe_finish_shutdown(grpc_pollset* pollset) {
+  if (pollset->shutdown_closure != nullptr && pollset->root_worker == nullptr &&
+      pollset->begin_refs == 0) {
+    GPR_TIMER_MARK("pollset_finish_shutdown", 0);
+    GRPC_CLOSURE_SCHED(pollset->shutdown_closure, GRPC_ERROR_NONE);
+    pollset->shutdown_closure = nullptr;
+  }
+}
+
+static void pollset_shutdown(grpc_pollset* pollset, grpc_closure* closure) {
+  GPR_TIMER_SCOPE("pollset_shutdown", 0);
+  GPR_ASSERT(pollset->shutdown_closure == nullptr);
+  GPR_ASSERT(!pollset->shutting_down);
+  pollset->shutdown_closure = closure;
+  pollset->shutting_down = true;
+  GRPC_LOG_IF_ERROR("pollset_shutdown", pollset_kick_all(pollset));
+  pollset_maybe_finish_shutdown(pollset);
+}
+
+static int poll_deadline_to_millis_timeout(grpc_millis millis) {
+  if (millis == GRPC_MILLIS_INF_FUTURE) return -1;
+  grpc_millis delta = millis - grpc_core::ExecCtx::Get()->Now();
+  if (delta > INT_MAX) {
+    return INT_MAX;
+  } else if (delta < 0) {
+    return 0;
+  } else {
+    return (int)delta;
+  }
+}
+
+/* Process the completions reaped by do_io_uring_wait() function.
+   - g_ring.cursor points to the index of the first event to be processed
+   - This function then processes up-to
+     MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION and updates the g_ring.cursor
+
+   NOTE ON SYNCRHONIZATION: Similar to do_io_uring_wait(), this function is
+   only called by g_active_poller thread. So there is no need for
+   synchronization when accessing the completion fields of g_ring */
+static grpc_error* process_io_uring_events(grpc_pollset* pollset) {
+  GPR_TIMER_SCOPE("process_io_uring_events", 0);
+
+  long num_events = gpr_atm_acq_load(&g_ring.num_events);
+  long cursor = gpr_atm_acq_load(&g_ring.cursor);
+  for (int idx = 0; (idx < MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION) &&
+                    cursor != num_events;
+       idx++) {
+    long c = cursor++;
+    io_uring_event* ev = &g_ring.events[c];
+
+    if ((ev->user_data & IO_URING_TAG_MASK) == IO_URING_OP_TAG) {
+      grpc_io_uring_op* op =
+          (grpc_io_uring_op*)(uintptr_t)(ev->user_data & ~IO_URING_TAG_MASK);
+      op->res = ev->res;
+      op->flags = ev->flags;
+      GRPC_CLOSURE_SCHED(op->on_done, GRPC_ERROR_NONE);
+      continue;
+    }
+    if (ev->user_data == IO_URING_KICK_TAG ||
+        ev->user_data == IO_URING_IGNORE_TAG) {
+      /* kicks need no consuming: reaping the completion was enough */
+      continue;
+    }
+    if (ev->res == -ECANCELED) {
+      continue;
+    }
+    grpc_fd* fd = fd_from_user_data(ev->user_data);
+    gpr_mu_lock(&fd->poll_mu);
+    if (fd_user_data(fd) != ev->user_data) {
+      /* posted before fd was orphaned */
+      gpr_mu_unlock(&fd->poll_mu);
+      continue;
+    }
+    /* an error or hangup makes the fd both readable and writable: a pending
+       read or write finds out about it from its next syscall */
+    bool error_ev = ev->res < 0 || (ev->res & (POLLERR | POLLHUP)) != 0;
+    bool read_ev = ev->res > 0 && (ev->res & (POLLIN | POLLPRI)) != 0;
+    bool write_ev = ev->res > 0 && (ev->res & POLLOUT) != 0;
+
+    if (read_ev || error_ev) {
+      fd_become_readable(fd, pollset);
+    }
+
+    if (write_ev || error_ev) {
+      fd_become_writable(fd);
+    }
+
+    if ((ev->flags & IORING_CQE_F_MORE) == 0 && ev->res >= 0) {
+      /* the kernel terminated the multishot request (eg. the completion queue
+         overflowed): register a fresh one. Under poll_mu, this either
+         happens before fd_orphan() queues its cancellation (which then
+         removes the new request too), or not at all. */
+      fd_arm_poll(fd);
+    }
+    gpr_mu_unlock(&fd->poll_mu);
+  }
+  gpr_atm_rel_store(&g_ring.cursor, cursor);
+  return GRPC_ERROR_NONE;
+}
+
+/* Copy whatever completions are available into g_ring.events, returning how
+   many were copied */
+static int reap_completions() {
+  unsigned head = *g_ring.cq_head;
+  unsigned tail = __atomic_load_n(g_ring.cq_tail, __ATOMIC_ACQUIRE);
+  int n = 0;
+  while (head != tail && n < MAX_IO_URING_EVENTS) {
+    struct io_uring_cqe* cqe = &g_ring.cqes[head & *g_ring.cq_ring_mask];
+    g_ring.events[n].user_data = cqe->user_data;
+    g_ring.events[n].res = cqe->res;
+    g_ring.events[n].flags = cqe->flags;
+    n++;
+    head++;
+  }
+  __atomic_store_n(g_ring.cq_head, head, __ATOMIC_RELEASE);
+  return n;
+}
+
+/* Wait for completions and store them in g_ring.events field. This does not
+   "process" any of the events yet; that is done in process_io_uring_events().
+   *See process_io_uring_events() function for more details.
+
+   Completions that are already in the completion queue are reaped without
+   entering the kernel at all; otherwise a single io_uring_enter() both waits
+   for readiness and picks up any kick.
+
+   NOTE ON SYNCHRONIZATION: At any point of time, only the g_active_poller
+   (i.e the designated poller thread) will be calling this function. So there is
+   no need for any synchronization when accesing the completion fields of
+   g_ring */
+static grpc_error* do_io_uring_wait(grpc_pollset* ps, grpc_millis deadline) {
+  GPR_TIMER_SCOPE("do_io_uring_wait", 0);
+
+  int r = reap_completions();
+  if (r == 0) {
+    int timeout = poll_deadline_to_millis_timeout(deadline);
+    bool overflowed =
+        (__atomic_load_n(g_ring.sq_flags, __ATOMIC_ACQUIRE) &
+         IORING_SQ_CQ_OVERFLOW) != 0;
+    if (timeout != 0 || overflowed) {
+      struct __kernel_timespec ts;
+      struct io_uring_getevents_arg arg;
+      memset(&arg, 0, sizeof(arg));
+      if (timeout >= 0) {
+        ts.tv_sec = timeout / GPR_MS_PER_SEC;
+        ts.tv_nsec = (timeout % GPR_MS_PER_SEC) * GPR_NS_PER_MS;
+        arg.ts = (uint64_t)(uintptr_t)&ts;
+      }
+      if (timeout != 0) {
+        GRPC_SCHEDULING_START_BLOCKING_REGION;
+      }
+      int e;
+      do {
+        GRPC_STATS_INC_SYSCALL_POLL();
+        e = sys_io_uring_enter(g_ring.ring_fd, 0, timeout == 0 ? 0 : 1,
+                               IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                               &arg, sizeof(arg));
+      } while (e < 0 && errno == EINTR);
+      if (timeout != 0) {
+        GRPC_SCHEDULING_END_BLOCKING_REGION;
+      }
+      if (e < 0 && errno != ETIME && errno != EBUSY) {
+        return GRPC_OS_ERROR(errno, "io_uring_enter");
+      }
+      r = reap_completions();
+    }
+  }
+
+  GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+
+  if (grpc_polling_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "ps: %p poll got %d events", ps, r);
+  }
+
+  gpr_atm_rel_store(&g_ring.num_events, r);
+  gpr_atm_rel_store(&g_ring.cursor, 0);
+
+  return GRPC_ERROR_NONE;
+}
+
+static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
+                         grpc_pollset_worker** worker_hdl,
+                         grpc_millis deadline) {
+  GPR_TIMER_SCOPE("begin_worker", 0);
+  if (worker_hdl != nullptr) *worker_hdl = worker;
+  worker->initialized_cv = false;
+  SET_KICK_STATE(worker, UNKICKED);
+  worker->schedule_on_end_work = (grpc_closure_list)GRPC_CLOSURE_LIST_INIT;
+  pollset->begin_refs++;
+
+  if (grpc_polling_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "PS:%p BEGIN_STARTS:%p", pollset, worker);
+  }
+
+  if (pollset->seen_inactive) {
+    // pollset has been observed to be inactive, we need to move back to the
+    // active list
+    bool is_reassigning = false;
+    if (!pollset->reassigning_neighborhood) {
+      is_reassigning = true;
+      pollset->reassigning_neighborhood = true;
+      pollset->neighborhood = &g_neighborhoods[choose_neighborhood()];
+    }
+    pollset_neighborhood* neighborhood = pollset->neighborhood;
+    gpr_mu_unlock(&pollset->mu);
+  // pollset unlocked: state may change (even worker->kick_state)
+  retry_lock_neighborhood:
+    gpr_mu_lock(&neighborhood->mu);
+    gpr_mu_lock(&pollset->mu);
+    if (grpc_polling_trace.enabled()) {
+      gpr_log(GPR_DEBUG, "PS:%p BEGIN_REORG:%p kick_state=%s is_reassigning=%d",
+              pollset, worker, kick_state_string(worker->state),
+              is_reassigning);
+    }
+    if (pollset->seen_inactive) {
+      if (neighborhood != pollset->neighborhood) {
+        gpr_mu_unlock(&neighborhood->mu);
+        neighborhood = pollset->neighborhood;
+        gpr_mu_unlock(&pollset->mu);
+        goto retry_lock_neighborhood;
+      }
+
+      /* In the brief time we released the pollset locks above, the worker MAY
+         have been kicked. In this case, the worker should get out of this
+         pollset ASAP and hence this should neither add the pollset to
+         neighborhood nor mark the pollset as active.
+
+         On a side note, the only way a worker's kick state could have changed
+         at this point is if it were "kicked specifically". Since the worker has
+         not added itself to the pollset yet (by calling worker_insert()), it is
+         not visible in the "kick any" path yet */
+      if (worker->state == UNKICKED) {
+        pollset->seen_inactive = false;
+        if (neighborhood->active_root == nullptr) {
+          neighborhood->active_root = pollset->next = pollset->prev = pollset;
+          /* Make this the designated poller if there isn't one already */
+          if (worker->state == UNKICKED &&
+              gpr_atm_no_barrier_cas(&g_active_poller, 0, (gpr_atm)worker)) {
+            SET_KICK_STATE(worker, DESIGNATED_POLLER);
+          }
+        } else {
+          pollset->next = neighborhood->active_root;
+          pollset->prev = pollset->next->prev;
+          pollset->next->prev = pollset->prev->next = pollset;
+        }
+      }
+    }
+    if (is_reassigning) {
+      GPR_ASSERT(pollset->reassigning_neighborhood);
+      pollset->reassigning_neighborhood = false;
+    }
+    gpr_mu_unlock(&neighborhood->mu);
+  }
+
+  worker_insert(pollset, worker);
+  pollset->begin_refs--;
+  if (worker->state == UNKICKED && !pollset->kicked_without_poller) {
+    GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+    worker->initialized_cv = true;
+    gpr_cv_init(&worker->cv);
+    while (worker->state == UNKICKED && !pollset->shutting_down) {
+      if (grpc_polling_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "PS:%p BEGIN_WAIT:%p kick_state=%s shutdown=%d",
+                pollset, worker, kick_state_string(worker->state),
+                pollset->shutting_down);
+      }
+
+      if (gpr_cv_wait(&worker->cv, &pollset->mu,
+                      grpc_millis_to_timespec(deadline, GPR_CLOCK_MONOTONIC)) &&
+          worker->state == UNKICKED) {
+        /* If gpr_cv_wait returns true (i.e a timeout), pretend that the worker
+           received a kick */
+        SET_KICK_STATE(worker, KICKED);
+      }
+    }
+    grpc_core::ExecCtx::Get()->InvalidateNow();
+  }
+
+  if (grpc_polling_trace.enabled()) {
+    gpr_log(GPR_DEBUG,
+            "PS:%p BEGIN_DONE:%p kick_state=%s shutdown=%d "
+            "kicked_without_poller: %d",
+            pollset, worker, kick_state_string(worker->state),
+            pollset->shutting_down, pollset->kicked_without_poller);
+  }
+
+  /* We release pollset lock in this function at a couple of places:
+   *   1. Briefly when assigning pollset to a neighborhood
+   *   2. When doing gpr_cv_wait()
+   * It is possible that 'kicked_without_poller' was set to true during (1) and
+   * 'shutting_down' is set to true during (1) or (2). If either of them is
+   * true, this worker cannot do polling. That holds for the DESIGNATED_POLLER
+   * too: end_worker() hands the role on, so the ring keeps being polled */
+
+  if (pollset->kicked_without_poller) {
+    pollset->kicked_without_poller = false;
+    return false;
+  }
+
+  return worker->state == DESIGNATED_POLLER && !pollset->shutting_down;
+}
+
+static bool check_neighborhood_for_available_poller(
+    pollset_neighborhood* neighborhood) {
+  GPR_TIMER_SCOPE("check_neighborhood_for_available_poller", 0);
+  bool found_worker = false;
+  do {
+    grpc_pollset* inspect = neighborhood->active_root;
+    if (inspect == nullptr) {
+      break;
+    }
+    gpr_mu_lock(&inspect->mu);
+    GPR_ASSERT(!inspect->seen_inactive);
+    grpc_pollset_worker* inspect_worker = inspect->root_worker;
+    if (inspect_worker != nullptr) {
+      do {
+        switch (inspect_worker->state) {
+          case UNKICKED:
+            if (gpr_atm_no_barrier_cas(&g_active_poller, 0,
+                                       (gpr_atm)inspect_worker)) {
+              if (grpc_polling_trace.enabled()) {
+                gpr_log(GPR_DEBUG, " .. choose next poller to be %p",
+                        inspect_worker);
+              }
+              SET_KICK_STATE(inspect_worker, DESIGNATED_POLLER);
+              if (inspect_worker->initialized_cv) {
+                GPR_TIMER_MARK("signal worker", 0);
+                GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+                gpr_cv_signal(&inspect_worker->cv);
+              }
+            } else {
+              if (grpc_polling_trace.enabled()) {
+                gpr_log(GPR_DEBUG, " .. beaten to choose next poller");
+              }
+            }
+            // even if we didn't win the cas, there's a worker, we can stop
+            found_worker = true;
+            break;
+          case KICKED:
+            break;
+          case DESIGNATED_POLLER:
+            found_worker = true;  // ok, so someone else found the worker, but
+                                  // we'll accept that
+            break;
+        }
+        inspect_worker = inspect_worker->next;
+      } while (!found_worker && inspect_worker != inspect->root_worker);
+    }
+    if (!found_worker) {
+      if (grpc_polling_trace.enabled()) {
+        gpr_log(GPR_DEBUG, " .. mark pollset %p inactive", inspect);
+      }
+      inspect->seen_inactive = true;
+      if (inspect == neighborhood->active_root) {
+        neighborhood->active_root =
+            inspect->next == inspect ? nullptr : inspect->next;
+      }
+      inspect->next->prev = inspect->prev;
+      inspect->prev->next = inspect->next;
+      inspect->next = inspect->prev = nullptr;
+    }
+    gpr_mu_unlock(&inspect->mu);
+  } while (!found_worker);
+  return found_worker;
+}
+
+static void end_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
+                       grpc_pollset_worker** worker_hdl) {
+  GPR_TIMER_SCOPE("end_worker", 0);
+  if (grpc_polling_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "PS:%p END_WORKER:%p", pollset, worker);
+  }
+  if (worker_hdl != nullptr) *worker_hdl = nullptr;
+  /* Make sure we appear kicked */
+  SET_KICK_STATE(worker, KICKED);
+  grpc_closure_list_move(&worker->schedule_on_end_work,
+                         grpc_core::ExecCtx::Get()->closure_list());
+  if (gpr_atm_no_barrier_load(&g_active_poller) == (gpr_atm)worker) {
+    if (worker->next != worker && worker->next->state == UNKICKED) {
+      if (grpc_polling_trace.enabled()) {
+        gpr_log(GPR_DEBUG, " .. choose next poller to be peer %p", worker);
+      }
+      GPR_ASSERT(worker->next->initialized_cv);
+      gpr_atm_no_barrier_store(&g_active_poller, (gpr_atm)worker->next);
+      SET_KICK_STATE(worker->next, DESIGNATED_POLLER);
+      GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+      gpr_cv_signal(&worker->next->cv);
+      if (grpc_core::ExecCtx::Get()->HasWork()) {
+        gpr_mu_unlock(&pollset->mu);
+        grpc_core::ExecCtx::Get()->Flush();
+        gpr_mu_lock(&pollset->mu);
+      }
+    } else {
+      gpr_atm_no_barrier_store(&g_active_poller, 0);
+      size_t poller_neighborhood_idx =
+          (size_t)(pollset->neighborhood - g_neighborhoods);
+      gpr_mu_unlock(&pollset->mu);
+      bool found_worker = false;
+      bool scan_state[MAX_NEIGHBORHOODS];
+      for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
+        pollset_neighborhood* neighborhood =
+            &g_neighborhoods[(poller_neighborhood_idx + i) %
+                             g_num_neighborhoods];
+        if (gpr_mu_trylock(&neighborhood->mu)) {
+          found_worker = check_neighborhood_for_available_poller(neighborhood);
+          gpr_mu_unlock(&neighborhood->mu);
+          scan_state[i] = true;
+        } else {
+          scan_state[i] = false;
+        }
+      }
+      for (size_t i = 0; !found_worker && i < g_num_neighborhoods; i++) {
+        if (scan_state[i]) continue;
+        pollset_neighborhood* neighborhood =
+            &g_neighborhoods[(poller_neighborhood_idx + i) %
+                             g_num_neighborhoods];
+        gpr_mu_lock(&neighborhood->mu);
+        found_worker = check_neighborhood_for_available_poller(neighborhood);
+        gpr_mu_unlock(&neighborhood->mu);
+      }
+      grpc_core::ExecCtx::Get()->Flush();
+      gpr_mu_lock(&pollset->mu);
+    }
+  } else if (grpc_core::ExecCtx::Get()->HasWork()) {
+    gpr_mu_unlock(&pollset->mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(&pollset->mu);
+  }
+  if (worker->initialized_cv) {
+    gpr_cv_destroy(&worker->cv);
+  }
+  if (grpc_polling_trace.enabled()) {
+    gpr_log(GPR_DEBUG, " .. remove worker");
+  }
+  if (EMPTIED == worker_remove(pollset, worker)) {
+    pollset_maybe_finish_shutdown(pollset);
+  }
+  GPR_ASSERT(gpr_atm_no_barrier_load(&g_active_poller) != (gpr_atm)worker);
+}
+
+/* pollset->po.mu lock must be held by the caller before calling this.
+   The function pollset_work() may temporarily release the lock (pollset->po.mu)
+   during the course of its execution but it will always re-acquire the lock and
+   ensure that it is held by the time the function returns */
+static grpc_error* pollset_work(grpc_pollset* ps,
+                                grpc_pollset_worker** worker_hdl,
+                                grpc_millis deadline) {
+  GPR_TIMER_SCOPE("pollset_work", 0);
+  grpc_pollset_worker worker;
+  grpc_error* error = GRPC_ERROR_NONE;
+  static const char* err_desc = "pollset_work";
+  if (ps->kicked_without_poller) {
+    ps->kicked_without_poller = false;
+    return GRPC_ERROR_NONE;
+  }
+
+  if (begin_worker(ps, &worker, worker_hdl, deadline)) {
+    gpr_tls_set(&g_current_thread_pollset, (intptr_t)ps);
+    gpr_tls_set(&g_current_thread_worker, (intptr_t)&worker);
+    GPR_ASSERT(!ps->shutting_down);
+    GPR_ASSERT(!ps->seen_inactive);
+
+    gpr_mu_unlock(&ps->mu); /* unlock */
+    /* This is the designated polling thread at this point and should ideally do
+       polling. However, if there are unprocessed events left from a previous
+       call to do_io_uring_wait(), skip waiting in this iteration and process
+       the pending events (see the equivalent comment in ev_epoll1_linux.cc) */
+    if (gpr_atm_acq_load(&g_ring.cursor) ==
+        gpr_atm_acq_load(&g_ring.num_events)) {
+      append_error(&error, do_io_uring_wait(ps, deadline), err_desc);
+    }
+    append_error(&error, process_io_uring_events(ps), err_desc);
+
+    gpr_mu_lock(&ps->mu); /* lock */
+
+    gpr_tls_set(&g_current_thread_worker, 0);
+  } else {
+    gpr_tls_set(&g_current_thread_pollset, (intptr_t)ps);
+  }
+  end_worker(ps, &worker, worker_hdl);
+
+  /* everything the closures run by end_worker() submitted goes out at once */
+  ring_flush_deferred();
+  gpr_tls_set(&g_current_thread_pollset, 0);
+  return error;
+}
+
+static grpc_error* pollset_kick(grpc_pollset* pollset,
+                                grpc_pollset_worker* specific_worker) {
+  GPR_TIMER_SCOPE("pollset_kick", 0);
+  GRPC_STATS_INC_POLLSET_KICK();
+  grpc_error* ret_err = GRPC_ERROR_NONE;
+  if (grpc_polling_trace.enabled()) {
+    gpr_strvec log;
+    gpr_strvec_init(&log);
+    char* tmp;
+    gpr_asprintf(&tmp, "PS:%p KICK:%p curps=%p curworker=%p root=%p", pollset,
+                 specific_worker, (void*)gpr_tls_get(&g_current_thread_pollset),
+                 (void*)gpr_tls_get(&g_current_thread_worker),
+                 pollset->root_worker);
+    gpr_strvec_add(&log, tmp);
+    if (pollset->root_worker != nullptr) {
+      gpr_asprintf(&tmp, " {kick_state=%s next=%p {kick_state=%s}}",
+                   kick_state_string(pollset->root_worker->state),
+                   pollset->root_worker->next,
+                   kick_state_string(pollset->root_worker->next->state));
+      gpr_strvec_add(&log, tmp);
+    }
+    if (specific_worker != nullptr) {
+      gpr_asprintf(&tmp, " worker_kick_state=%s",
+                   kick_state_string(specific_worker->state));
+      gpr_strvec_add(&log, tmp);
+    }
+    tmp = gpr_strvec_flatten(&log, nullptr);
+    gpr_strvec_destroy(&log);
+    gpr_log(GPR_DEBUG, "%s", tmp);
+    gpr_free(tmp);
+  }
+
+  if (specific_worker == nullptr) {
+    if (gpr_tls_get(&g_current_thread_pollset) != (intptr_t)pollset) {
+      grpc_pollset_worker* root_worker = pollset->root_worker;
+      if (root_worker == nullptr) {
+        GRPC_STATS_INC_POLLSET_KICKED_WITHOUT_POLLER();
+        pollset->kicked_without_poller = true;
+        if (grpc_polling_trace.enabled()) {
+          gpr_log(GPR_DEBUG, " .. kicked_without_poller");
+        }
+        goto done;
+      }
+      grpc_pollset_worker* next_worker = root_worker->next;
+      if (root_worker->state == KICKED) {
+        GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+        if (grpc_polling_trace.enabled()) {
+          gpr_log(GPR_DEBUG, " .. already kicked %p", root_worker);
+        }
+        SET_KICK_STATE(root_worker, KICKED);
+        goto done;
+      } else if (next_worker->state == KICKED) {
+        GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+        if (grpc_polling_trace.enabled()) {
+          gpr_log(GPR_DEBUG, " .. already kicked %p", next_worker);
+        }
+        SET_KICK_STATE(next_worker, KICKED);
+        goto done;
+      } else if (root_worker ==
+                     next_worker &&  // only try and wake up a poller if
+                                     // there is no next worker
+                 root_worker == (grpc_pollset_worker*)gpr_atm_no_barrier_load(
+                                    &g_active_poller)) {
+        GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+        if (grpc_polling_trace.enabled()) {
+          gpr_log(GPR_DEBUG, " .. kicked %p", root_worker);
+        }
+        SET_KICK_STATE(root_worker, KICKED);
+        ret_err = ring_kick();
+        goto done;
+      } else if (next_worker->state == UNKICKED) {
+        GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+        if (grpc_polling_trace.enabled()) {
+          gpr_log(GPR_DEBUG, " .. kicked %p", next_worker);
+        }
+        GPR_ASSERT(next_worker->initialized_cv);
+        SET_KICK_STATE(next_worker, KICKED);
+        gpr_cv_signal(&next_worker->cv);
+        goto done;
+      } else if (next_worker->state == DESIGNATED_POLLER) {
+        if (root_worker->state != DESIGNATED_POLLER) {
+          if (grpc_polling_trace.enabled()) {
+            gpr_log(
+                GPR_DEBUG,
+                " .. kicked root non-poller %p (initialized_cv=%d) (poller=%p)",
+                root_worker, root_worker->initialized_cv, next_worker);
+          }
+          SET_KICK_STATE(root_worker, KICKED);
+          if (root_worker->initialized_cv) {
+            GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+            gpr_cv_signal(&root_worker->cv);
+          }
+          goto done;
+        } else {
+          GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+          if (grpc_polling_trace.enabled()) {
+            gpr_log(GPR_DEBUG, " .. non-root poller %p (root=%p)", next_worker,
+                    root_worker);
+          }
+          SET_KICK_STATE(next_worker, KICKED);
+          ret_err = ring_kick();
+          goto done;
+        }
+      } else {
+        GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+        GPR_ASSERT(next_worker->state == KICKED);
+        SET_KICK_STATE(next_worker, KICKED);
+        goto done;
+      }
+    } else {
+      GRPC_STATS_INC_POLLSET_KICK_OWN_THREAD();
+      if (grpc_polling_trace.enabled()) {
+        gpr_log(GPR_DEBUG, " .. kicked while waking up");
+      }
+      goto done;
+    }
+
+    GPR_UNREACHABLE_CODE(goto done);
+  }
+
+  if (specific_worker->state == KICKED) {
+    if (grpc_polling_trace.enabled()) {
+      gpr_log(GPR_DEBUG, " .. specific worker already kicked");
+    }
+    goto done;
+  } else if (gpr_tls_get(&g_current_thread_worker) ==
+             (intptr_t)specific_worker) {
+    GRPC_STATS_INC_POLLSET_KICK_OWN_THREAD();
+    if (grpc_polling_trace.enabled()) {
+      gpr_log(GPR_DEBUG, " .. mark %p kicked", specific_worker);
+    }
+    SET_KICK_STATE(specific_worker, KICKED);
+    goto done;
+  } else if (specific_worker ==
+             (grpc_pollset_worker*)gpr_atm_no_barrier_load(&g_active_poller)) {
+    GRPC_STATS_INC_POLLSET_KICK_WAKEUP_FD();
+    if (grpc_polling_trace.enabled()) {
+      gpr_log(GPR_DEBUG, " .. kick active poller");
+    }
+    SET_KICK_STATE(specific_worker, KICKED);
+    ret_err = ring_kick();
+    goto done;
+  } else if (specific_worker->initialized_cv) {
+    GRPC_STATS_INC_POLLSET_KICK_WAKEUP_CV();
+    if (grpc_polling_trace.enabled()) {
+      gpr_log(GPR_DEBUG, " .. kick waiting worker");
+    }
+    SET_KICK_STATE(specific_worker, KICKED);
+    gpr_cv_signal(&specific_worker->cv);
+    goto done;
+  } else {
+    GRPC_STATS_INC_POLLSET_KICKED_AGAIN();
+    if (grpc_polling_trace.enabled()) {
+      gpr_log(GPR_DEBUG, " .. kick non-waiting worker");
+    }
+    SET_KICK_STATE(specific_worker, KICKED);
+    goto done;
+  }
+done:
+  return ret_err;
+}
+
+static void pollset_add_fd(grpc_pollset* pollset, grpc_fd* fd) {}
+
+/*******************************************************************************
+ * Pollset-set Definitions
+ */
+
+static grpc_pollset_set* pollset_set_create(void) {
+  return (grpc_pollset_set*)((intptr_t)0xdeafbeef);
+}
+
+static void pollset_set_destroy(grpc_pollset_set* pss) {}
+
+static void pollset_set_add_fd(grpc_pollset_set* pss, grpc_fd* fd) {}
+
+static void pollset_set_del_fd(grpc_pollset_set* pss, grpc_fd* fd) {}
+
+static void pollset_set_add_pollset(grpc_pollset_set* pss, grpc_pollset* ps) {}
+
+static void pollset_set_del_pollset(grpc_pollset_set* pss, grpc_pollset* ps) {}
+
+static void pollset_set_add_pollset_set(grpc_pollset_set* bag,
+                                        grpc_pollset_set* item) {}
+
+static void pollset_set_del_pollset_set(grpc_pollset_set* bag,
+                                        grpc_pollset_set* item) {}
+
+/*******************************************************************************
+ * Operation submission
+ */
+
+/* Submit the entries queued so far, unless called from a polling thread, in
+   which case they go out at the end of its pollset_work() call */
+static grpc_error* ring_submit_or_defer_locked() {
+  if (gpr_tls_get(&g_current_thread_pollset) != 0) {
+    g_ring.submit_deferred = true;
+    GRPC_STATS_INC_IO_URING_DEFERRED_SUBMIT();
+    return GRPC_ERROR_NONE;
+  }
+  return ring_submit_locked();
+}
+
+bool grpc_io_uring_active(void) { return g_io_uring_active; }
+
+void grpc_io_uring_submit(const struct io_uring_sqe* sqe,
+                          grpc_io_uring_op* op) {
+  GPR_ASSERT(((uintptr_t)op & IO_URING_TAG_MASK) == 0);
+  gpr_mu_lock(&g_ring.sq_mu);
+  struct io_uring_sqe* dst = ring_get_sqe_locked();
+  memcpy(dst, sqe, sizeof(*dst));
+  dst->user_data = (uint64_t)(uintptr_t)op | IO_URING_OP_TAG;
+  ring_commit_sqe_locked();
+  grpc_error* error = ring_submit_or_defer_locked();
+  gpr_mu_unlock(&g_ring.sq_mu);
+  /* a failed submission stays queued and goes out with the next one */
+  GRPC_LOG_IF_ERROR("io_uring_submit", error);
+}
+
+/*******************************************************************************
+ * Provided buffer pool
+ */
+
+/* The pool's buffers are handed to the kernel with IORING_OP_PROVIDE_BUFFERS.
+ * A read submitted with IOSQE_BUFFER_SELECT takes one only once data arrives,
+ * so idle connections waiting to read hold none of them.
+ *
+ * Buffers lent out as slices can outlive the ring (the application may hold
+ * on to a byte buffer past grpc_shutdown()), so the pool is refcounted: the
+ * engine holds one reference and every borrowed buffer another. */
+typedef struct provided_buffer_pool provided_buffer_pool;
+
+typedef struct provided_buffer {
+  grpc_slice_refcount base;
+  gpr_refcount refs;
+  provided_buffer_pool* pool;
+  /* charged for the buffer while it is lent out, if anyone */
+  grpc_resource_user* resource_user;
+} provided_buffer;
+
+struct provided_buffer_pool {
+  gpr_refcount refs;
+  /* guards engine_alive: once cleared, returned buffers stay out of the
+     (destroyed) ring */
+  gpr_mu mu;
+  bool engine_alive;
+  uint8_t* memory;
+  provided_buffer buffers[IO_URING_PROVIDED_BUFFERS];
+};
+
+/* Only changes while no endpoint exists: at engine init and shutdown */
+static provided_buffer_pool* g_provided_buffers;
+
+static void provided_buffer_pool_unref(provided_buffer_pool* pool) {
+  if (gpr_unref(&pool->refs)) {
+    gpr_mu_destroy(&pool->mu);
+    gpr_free_aligned(pool->memory);
+    gpr_free(pool);
+  }
+}
+
+/* Hand buffers [first, first + count) (back) to the kernel */
+static void provided_buffers_provide_locked(provided_buffer_pool* pool,
+                                            int first, int count) {
+  struct io_uring_sqe* sqe = ring_get_sqe_locked();
+  sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+  sqe->fd = count;
+  uint8_t* base = pool->memory + (size_t)first * IO_URING_PROVIDED_BUFFER_SIZE;
+  sqe->addr = (uint64_t)(uintptr_t)base;
+  sqe->len = IO_URING_PROVIDED_BUFFER_SIZE;
+  sqe->off = (uint64_t)first;
+  sqe->buf_group = IO_URING_PROVIDED_BUFFER_GROUP;
+  sqe->user_data = IO_URING_IGNORE_TAG;
+  ring_commit_sqe_locked();
+}
+
+static void provided_buffer_release(provided_buffer* b) {
+  provided_buffer_pool* pool = b->pool;
+  if (b->resource_user != nullptr) {
+    grpc_resource_user_free(b->resource_user, IO_URING_PROVIDED_BUFFER_SIZE);
+    grpc_resource_user_unref(b->resource_user);
+    b->resource_user = nullptr;
+  }
+  gpr_mu_lock(&pool->mu);
+  if (pool->engine_alive) {
+    gpr_mu_lock(&g_ring.sq_mu);
+    provided_buffers_provide_locked(pool, (int)(b - pool->buffers), 1);
+    grpc_error* error = ring_submit_or_defer_locked();
+    gpr_mu_unlock(&g_ring.sq_mu);
+    GRPC_LOG_IF_ERROR("io_uring_provide_buffers", error);
+  }
+  gpr_mu_unlock(&pool->mu);
+  provided_buffer_pool_unref(pool);
+}
+
+static void provided_buffer_slice_ref(void* p) {
+  provided_buffer* b = (provided_buffer*)p;
+  gpr_ref(&b->refs);
+}
+
+static void provided_buffer_slice_unref(void* p) {
+  provided_buffer* b = (provided_buffer*)p;
+  if (gpr_unref(&b->refs)) {
+    provided_buffer_release(b);
+  }
+}
+
+static const grpc_slice_refcount_vtable provided_buffer_slice_vtable = {
+    provided_buffer_slice_ref, provided_buffer_slice_unref,
+    grpc_slice_default_eq_impl, grpc_slice_default_hash_impl};
+
+/* Providing buffers needs Linux 5.7: without it, reads are done into
+   ordinary slices */
+static bool provide_buffers_supported() {
+  size_t size = sizeof(struct io_uring_probe) +
+                256 * sizeof(struct io_uring_probe_op);
+  struct io_uring_probe* probe = (struct io_uring_probe*)gpr_zalloc(size);
+  bool supported =
+      sys_io_uring_register(g_ring.ring_fd, IORING_REGISTER_PROBE, probe,
+                            256) == 0 &&
+      probe->last_op >= IORING_OP_PROVIDE_BUFFERS &&
+      (probe->ops[IORING_OP_PROVIDE_BUFFERS].flags & IO_URING_OP_SUPPORTED) !=
+          0;
+  gpr_free(probe);
+  return supported;
+}
+
+static void provided_buffers_init() {
+  g_provided_buffers = nullptr;
+  if (!provide_buffers_supported()) {
+    gpr_log(GPR_INFO, "io_uring provided buffers unavailable");
+    return;
+  }
+  provided_buffer_pool* pool =
+      (provided_buffer_pool*)gpr_malloc(sizeof(provided_buffer_pool));
+  pool->memory = (uint8_t*)gpr_malloc_aligned(
+      IO_URING_PROVIDED_BUFFERS * IO_URING_PROVIDED_BUFFER_SIZE, 4096);
+  for (int i = 0; i < IO_URING_PROVIDED_BUFFERS; i++) {
+    pool->buffers[i].pool = pool;
+    pool->buffers[i].resource_user = nullptr;
+  }
+  gpr_ref_init(&pool->refs, 1);
+  gpr_mu_init(&pool->mu);
+  pool->engine_alive = true;
+  gpr_mu_lock(&g_ring.sq_mu);
+  provided_buffers_provide_locked(pool, 0, IO_URING_PROVIDED_BUFFERS);
+  grpc_error* error = ring_submit_locked();
+  gpr_mu_unlock(&g_ring.sq_mu);
+  if (error != GRPC_ERROR_NONE) {
+    gpr_log(GPR_INFO, "io_uring provided buffers unavailable: %s",
+            grpc_error_string(error));
+    GRPC_ERROR_UNREF(error);
+    provided_buffer_pool_unref(pool);
+    return;
+  }
+  g_provided_buffers = pool;
+}
+
+static void provided_buffers_shutdown() {
+  provided_buffer_pool* pool = g_provided_buffers;
+  if (pool != nullptr) {
+    gpr_mu_lock(&pool->mu);
+    pool->engine_alive = false;
+    gpr_mu_unlock(&pool->mu);
+    provided_buffer_pool_unref(pool);
+    g_provided_buffers = nullptr;
+  }
+}
+
+int grpc_io_uring_buffer_group(void) {
+  return g_provided_buffers == nullptr ? -1 : IO_URING_PROVIDED_BUFFER_GROUP;
+}
+
+size_t grpc_io_uring_provided_buffer_size(void) {
+  return IO_URING_PROVIDED_BUFFER_SIZE;
+}
+
+grpc_slice grpc_io_uring_provided_buffer_slice(
+    uint32_t cqe_flags, size_t length, grpc_resource_user* resource_user) {
+  GPR_ASSERT(cqe_flags & IORING_CQE_F_BUFFER);
+  GPR_ASSERT(length <= IO_URING_PROVIDED_BUFFER_SIZE);
+  provided_buffer_pool* pool = g_provided_buffers;
+  size_t index = cqe_flags >> IORING_CQE_BUFFER_SHIFT;
+  GPR_ASSERT(index < IO_URING_PROVIDED_BUFFERS);
+  provided_buffer* b = &pool->buffers[index];
+  gpr_ref(&pool->refs);
+  if (resource_user != nullptr) {
+    grpc_resource_user_ref(resource_user);
+  }
+  b->resource_user = resource_user;
+  b->base.vtable = &provided_buffer_slice_vtable;
+  b->base.sub_refcount = &b->base;
+  gpr_ref_init(&b->refs, 1);
+  grpc_slice slice;
+  slice.refcount = &b->base;
+  slice.data.refcounted.bytes =
+      pool->memory + index * IO_URING_PROVIDED_BUFFER_SIZE;
+  slice.data.refcounted.length = length;
+  return slice;
+}
+
+/*******************************************************************************
+ * Event engine binding
+ */
+
+static void shutdown_engine(void) {
+  g_io_uring_active = false;
+  provided_buffers_shutdown();
+  fd_global_shutdown();
+  pollset_global_shutdown();
+  ring_shutdown();
+}
+
+static const grpc_event_engine_vtable vtable = {
+    sizeof(grpc_pollset),
+
+    fd_create,
+    fd_wrapped_fd,
+    fd_orphan,
+    fd_shutdown,
+    fd_notify_on_read,
+    fd_notify_on_write,
+    fd_is_shutdown,
+    fd_get_read_notifier_pollset,
+
+    pollset_init,
+    pollset_shutdown,
+    pollset_destroy,
+    pollset_work,
+    pollset_kick,
+    pollset_add_fd,
+
+    pollset_set_create,
+    pollset_set_destroy,
+    pollset_set_add_pollset,
+    pollset_set_del_pollset,
+    pollset_set_add_pollset_set,
+    pollset_set_del_pollset_set,
+    pollset_set_add_fd,
+    pollset_set_del_fd,
+
+    shutdown_engine,
+
+    nullptr, /* pollset_configure_spin */
+};
+
+/* io_uring is opt-in: it is only used when asked for by name in
+ * GRPC_POLL_STRATEGY. The headers may be newer than the running kernel, so
+ * ring_init() checks that the kernel provides everything the engine uses */
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool explicit_request) {
+  if (!explicit_request) {
+    return nullptr;
+  }
+
+  if (!ring_init()) {
+    return nullptr;
+  }
+
+  fd_global_init();
+
+  if (!GRPC_LOG_IF_ERROR("pollset_global_init", pollset_global_init())) {
+    fd_global_shutdown();
+    ring_shutdown();
+    return nullptr;
+  }
+
+  provided_buffers_init();
+  g_io_uring_active = true;
+  return &vtable;
+}
+
+#else /* defined(GRPC_LINUX_IO_URING) */
+#if defined(GRPC_POSIX_SOCKET)
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
+/* If GRPC_LINUX_IO_URING is not defined, it means io_uring is not available.
+ * Return NULL */
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool explicit_request) {
+  return nullptr;
+}
+#endif /* defined(GRPC_POSIX_SOCKET) */
+#endif /* !defined(GRPC_LINUX_IO_URING) */
@@ -0,0 +1,77 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_EV_IO_URING_LINUX_H
+#define GRPC_CORE_LIB_IOMGR_EV_IO_URING_LINUX_H
+
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/port.h"
+
+// a polling engine that utilizes a singleton io_uring instance and turnstile
+// polling
+
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(bool explicit_request);
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/iomgr/resource_quota.h"
+
+/* An operation submitted to the polling engine's ring on behalf of some other
+   iomgr component (see tcp_io_uring_linux.cc). on_done is scheduled once the
+   operation completes, with res and flags set to those the kernel posted for
+   it. */
+typedef struct grpc_io_uring_op {
+  grpc_closure* on_done;
+  int32_t res;
+  uint32_t flags;
+} grpc_io_uring_op;
+
+/* Returns true if the io_uring engine is the active polling engine, in which
+   case the functions below may be used */
+bool grpc_io_uring_active(void);
+
+/* Queue a copy of sqe (whose user_data is ignored) on the engine's ring.
+   Submissions made from a polling thread are held back until it is done with
+   its current pollset_work() call, so that every operation issued while
+   processing one batch of completions reaches the kernel in a single
+   io_uring_enter(). Anything the kernel reads from user memory at submission
+   time (eg. a msghdr) must therefore stay valid until op->on_done runs. */
+void grpc_io_uring_submit(const struct io_uring_sqe* sqe, grpc_io_uring_op* op);
+
+/* The engine provides its ring with a group of equally sized read buffers
+   (IORING_OP_PROVIDE_BUFFERS). A read submitted with IOSQE_BUFFER_SELECT and
+   this buf_group takes one of them only once data arrives, or fails with
+   -ENOBUFS if none is left. Returns -1 if the kernel cannot do this. */
+int grpc_io_uring_buffer_group(void);
+
+/* Size of each provided buffer */
+size_t grpc_io_uring_provided_buffer_size(void);
+
+/* Turn the first length bytes of the buffer picked by a read (as reported by
+   the flags of its completion) into a slice. The buffer is handed back to the
+   kernel once the last reference to the slice is released. If resource_user
+   is not NULL, it must have been charged for the buffer (see
+   grpc_io_uring_provided_buffer_size()), and is refunded at that point. */
+grpc_slice grpc_io_uring_provided_buffer_slice(
+    uint32_t cqe_flags, size_t length, grpc_resource_user* resource_user);
+#endif /* defined(GRPC_LINUX_IO_URING) */
+
+#endif /* GRPC_CORE_LIB_IOMGR_EV_IO_URING_LINUX_H */
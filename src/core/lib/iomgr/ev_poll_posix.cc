@@ -984,6 +984,10 @@ static grpc_error* pollset_work(grpc_pollset* pollset,
         gpr_log(GPR_DEBUG, "%p poll=%d", pollset, r);
       }
 
+      if (r >= 0) {
+        GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+      }
+
       if (r < 0) {
         if (errno != EINTR) {
           work_combine_error(&error, GRPC_OS_ERROR(errno, "poll"));
@@ -1692,6 +1696,8 @@ static const grpc_event_engine_vtable vtable = {
     pollset_set_del_fd,
 
     shutdown_engine,
+
+    nullptr, /* pollset_configure_spin */
 };
 
 const grpc_event_engine_vtable* grpc_init_poll_posix(bool explicit_request) {
@@ -34,6 +34,7 @@
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
 #include "src/core/lib/iomgr/ev_epollex_linux.h"
 #include "src/core/lib/iomgr/ev_epollsig_linux.h"
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
 #include "src/core/lib/iomgr/ev_poll_posix.h"
 
 grpc_core::TraceFlag grpc_polling_trace(false,
@@ -100,6 +101,8 @@ static const event_engine_factory g_factories[] = {
     {"epollex", grpc_init_epollex_linux},   {"epoll1", grpc_init_epoll1_linux},
     {"epollsig", grpc_init_epollsig_linux}, {"poll", grpc_init_poll_posix},
     {"poll-cv", grpc_init_poll_cv_posix},   {"none", init_non_polling},
+    {"io_uring", grpc_init_io_uring_linux},
+    {"epoll1_sharded", grpc_init_epoll1_sharded_linux},
 };
 
 static void add(const char* beg, const char* end, char*** ss, size_t* ns) {
@@ -256,6 +259,14 @@ grpc_error* grpc_pollset_kick(grpc_pollset* pollset,
   return g_event_engine->pollset_kick(pollset, specific_worker);
 }
 
+void grpc_pollset_configure_spin(grpc_pollset* pollset, int spin_budget_us) {
+  GRPC_POLLING_API_TRACE("pollset_configure_spin(%p, %d)", pollset,
+                         spin_budget_us);
+  if (g_event_engine->pollset_configure_spin != nullptr) {
+    g_event_engine->pollset_configure_spin(pollset, spin_budget_us);
+  }
+}
+
 void grpc_pollset_add_fd(grpc_pollset* pollset, struct grpc_fd* fd) {
   GRPC_POLLING_API_TRACE("pollset_add_fd(%p, %d)", pollset,
                          grpc_fd_wrapped_fd(fd));
@@ -68,6 +68,9 @@ typedef struct grpc_event_engine_vtable {
   void (*pollset_set_del_fd)(grpc_pollset_set* pollset_set, grpc_fd* fd);
 
   void (*shutdown_engine)(void);
+
+  /* Optional: engines that do not spin leave this null */
+  void (*pollset_configure_spin)(grpc_pollset* pollset, int spin_budget_us);
 } grpc_event_engine_vtable;
 
 void grpc_event_engine_init(void);
@@ -22,6 +22,7 @@
 #include <grpc/support/sync.h>
 #include <grpc/support/thd.h>
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/profiling/timers.h"
 
@@ -45,8 +46,19 @@ static void exec_ctx_run(grpc_closure* closure, grpc_error* error) {
 }
 
 static void exec_ctx_sched(grpc_closure* closure, grpc_error* error) {
-  grpc_closure_list_append(grpc_core::ExecCtx::Get()->closure_list(), closure,
-                           error);
+  grpc_core::ExecCtx::Get()->Schedule(closure, error);
+}
+
+static void exec_ctx_sched_background(grpc_closure* closure,
+                                      grpc_error* error) {
+  GRPC_STATS_INC_EXEC_CTX_BACKGROUND_CLOSURES();
+  grpc_core::ExecCtx::Get()->ScheduleBackground(closure, error);
+}
+
+static int micros_since(gpr_timespec start) {
+  gpr_timespec elapsed = gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start);
+  return (int)(elapsed.tv_sec * GPR_US_PER_SEC +
+               elapsed.tv_nsec / GPR_NS_PER_US);
 }
 
 static gpr_timespec g_start_time;
@@ -103,6 +115,13 @@ static const grpc_closure_scheduler_vtable exec_ctx_scheduler_vtable = {
 static grpc_closure_scheduler exec_ctx_scheduler = {&exec_ctx_scheduler_vtable};
 grpc_closure_scheduler* grpc_schedule_on_exec_ctx = &exec_ctx_scheduler;
 
+static const grpc_closure_scheduler_vtable exec_ctx_background_vtable = {
+    exec_ctx_run, exec_ctx_sched_background, "exec_ctx:background"};
+static grpc_closure_scheduler exec_ctx_background_scheduler = {
+    &exec_ctx_background_vtable};
+grpc_closure_scheduler* grpc_schedule_on_exec_ctx_background =
+    &exec_ctx_background_scheduler;
+
 namespace grpc_core {
 GPR_TLS_CLASS_DEF(ExecCtx::exec_ctx_);
 
@@ -116,17 +135,42 @@ bool ExecCtx::Flush() {
   GPR_TIMER_SCOPE("grpc_exec_ctx_flush", 0);
   for (;;) {
     if (!grpc_closure_list_empty(closure_list_)) {
+      if (critical_queued_at_valid_) {
+        critical_queued_at_valid_ = false;
+        GRPC_STATS_INC_EXEC_CTX_CRITICAL_QUEUE_DELAY_US(
+            micros_since(critical_queued_at_));
+      }
       grpc_closure* c = closure_list_.head;
       closure_list_.head = closure_list_.tail = nullptr;
       while (c != nullptr) {
         grpc_closure* next = c->next_data.next;
         grpc_error* error = c->error_data.error;
         did_something = true;
+        closures_run_++;
         exec_ctx_run(c, error);
         c = next;
       }
-    } else if (!grpc_combiner_continue_exec_ctx()) {
-      break;
+    } else if (grpc_combiner_continue_exec_ctx()) {
+      closures_run_++;
+    } else {
+      if (grpc_closure_list_empty(background_closure_list_)) break;
+      // Run background closures one at a time, so that any critical work
+      // they schedule overtakes the rest of the background lane.
+      grpc_closure* c = background_closure_list_.head;
+      background_closure_list_.head = c->next_data.next;
+      GRPC_STATS_INC_EXEC_CTX_BACKGROUND_QUEUE_DELAY_US(
+          micros_since(background_queued_at_));
+      if (background_closure_list_.head == nullptr) {
+        background_closure_list_.tail = nullptr;
+      } else {
+        // the next closure only now reaches the head of the lane
+        background_queued_at_ = gpr_now(GPR_CLOCK_MONOTONIC);
+      }
+      did_something = true;
+      closures_run_++;
+      // Dispatch through the scheduler: combiner background closures are
+      // forwarded to their combiner from here.
+      c->scheduler->vtable->run(c, c->error_data.error);
     }
   }
   GPR_ASSERT(combiner_data_.active_combiner == nullptr);
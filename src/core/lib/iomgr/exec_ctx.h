@@ -44,6 +44,11 @@ typedef struct grpc_combiner grpc_combiner;
 #define GRPC_EXEC_CTX_FLAG_THREAD_RESOURCE_LOOP 2
 
 extern grpc_closure_scheduler* grpc_schedule_on_exec_ctx;
+/* Like grpc_schedule_on_exec_ctx, but for background work (periodic
+   bookkeeping, memory reclamation, ...): such closures only run once no other
+   work is pending on the exec_ctx, so they never delay latency-critical
+   closures scheduled after them. */
+extern grpc_closure_scheduler* grpc_schedule_on_exec_ctx_background;
 
 gpr_timespec grpc_millis_to_timespec(grpc_millis millis, gpr_clock_type clock);
 grpc_millis grpc_timespec_to_millis_round_down(gpr_timespec timespec);
@@ -106,13 +111,36 @@ class ExecCtx {
   /** Return pointer to grpc_closure_list */
   grpc_closure_list* closure_list() { return &closure_list_; }
 
+  /** Queue \a closure on the latency-critical lane. Only to be used by
+   * closure schedulers */
+  void Schedule(grpc_closure* closure, grpc_error* error) {
+    // Time critical work only while it may be held up by background work
+    if (background_closure_list_.head != nullptr &&
+        closure_list_.head == nullptr) {
+      critical_queued_at_ = gpr_now(GPR_CLOCK_MONOTONIC);
+      critical_queued_at_valid_ = true;
+    }
+    grpc_closure_list_append(&closure_list_, closure, error);
+  }
+
+  /** Queue \a closure on the background lane: it runs once neither
+   * closures nor combiners have latency-critical work left. Only to be used
+   * by closure schedulers */
+  void ScheduleBackground(grpc_closure* closure, grpc_error* error) {
+    if (background_closure_list_.head == nullptr) {
+      background_queued_at_ = gpr_now(GPR_CLOCK_MONOTONIC);
+    }
+    grpc_closure_list_append(&background_closure_list_, closure, error);
+  }
+
   /** Return flags */
   uintptr_t flags() { return flags_; }
 
   /** Checks if there is work to be done */
   bool HasWork() {
     return combiner_data_.active_combiner != nullptr ||
-           !grpc_closure_list_empty(closure_list_);
+           !grpc_closure_list_empty(closure_list_) ||
+           !grpc_closure_list_empty(background_closure_list_);
   }
 
   /** Flush any work that has been enqueued onto this grpc_exec_ctx.
@@ -120,6 +148,9 @@ class ExecCtx {
    *  Returns true if work was performed, false otherwise. */
   bool Flush();
 
+  /** Number of closures (or combiner steps) Flush() has run so far */
+  size_t closures_run() const { return closures_run_; }
+
   /** Returns true if we'd like to leave this execution context as soon as
 possible: useful for deciding whether to do something more or not depending
 on outside context */
@@ -183,8 +214,15 @@ on outside context */
   }
 
   grpc_closure_list closure_list_ = GRPC_CLOSURE_LIST_INIT;
+  grpc_closure_list background_closure_list_ = GRPC_CLOSURE_LIST_INIT;
+  /* when the oldest closure in each lane was queued (the critical lane is
+     only timed while background work is pending) */
+  gpr_timespec critical_queued_at_;
+  bool critical_queued_at_valid_ = false;
+  gpr_timespec background_queued_at_;
   CombinerData combiner_data_ = {nullptr, nullptr};
   uintptr_t flags_;
+  size_t closures_run_ = 0;
   unsigned starting_cpu_ = gpr_cpu_current_cpu();
 
   bool now_is_valid_ = false;
@@ -29,24 +29,54 @@
 #include <grpc/support/useful.h>
 
 #include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/mpscq.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 
 #define MAX_DEPTH 2
+/* Capacity of each thread's deque: must be a power of two */
+#define DEQUE_SIZE 256
+
+/* A bounded lock-free work-stealing deque (after Chase & Lev). Only the owning
+   thread pushes, at the bottom; the owner and thieves alike take from the top
+   with a CAS, so closures a thread schedules to itself still run in the order
+   they were scheduled. top and bottom only ever grow: slots are indexed modulo
+   DEQUE_SIZE. */
+typedef struct {
+  gpr_atm top;
+  /* make sure thieves bumping top don't share a cacheline with bottom */
+  char padding[GPR_CACHELINE_SIZE];
+  gpr_atm bottom;
+  gpr_atm slots[DEQUE_SIZE];
+} closure_deque;
 
 typedef struct {
   gpr_mu mu;
   gpr_cv cv;
-  grpc_closure_list elems;
-  size_t depth;
-  bool shutdown;
-  bool queued_long_job;
+  /* closures this thread scheduled to itself */
+  closure_deque deque;
+  /* closures scheduled from other threads: pushes are lock-free, pops (by the
+     owner or a thief) take the queue lock */
+  gpr_locked_mpscq inbox;
+  /* number of closures queued to this thread (deque + inbox); may briefly
+     disagree with the queues while a push or pop is in flight */
+  gpr_atm depth;
+  /* set while this thread runs a closure scheduled as GRPC_EXECUTOR_LONG:
+     pushes from other threads then prefer other threads */
+  gpr_atm running_long_job;
+  /* set while this thread waits on cv */
+  gpr_atm sleeping;
+  gpr_atm shutdown;
+  /* owner-only state */
+  uint32_t rand_state;
+  bool inbox_first;
   gpr_thd_id id;
 } thread_state;
 
 static thread_state* g_thread_state;
 static size_t g_max_threads;
 static gpr_atm g_cur_threads;
+static gpr_atm g_sleeping_threads;
 static gpr_spinlock g_adding_thread_lock = GPR_SPINLOCK_STATIC_INITIALIZER;
 
 GPR_TLS_DECL(g_this_thread_state);
@@ -54,33 +84,158 @@ GPR_TLS_DECL(g_this_thread_state);
 grpc_core::TraceFlag executor_trace(false, "executor");
 
 static void executor_thread(void* arg);
+static bool is_long_job(grpc_closure* closure);
 
-static size_t run_closures(grpc_closure_list list) {
-  size_t n = 0;
+static void deque_init(closure_deque* d) {
+  gpr_atm_no_barrier_store(&d->top, 0);
+  gpr_atm_no_barrier_store(&d->bottom, 0);
+}
 
-  grpc_closure* c = list.head;
-  while (c != nullptr) {
-    grpc_closure* next = c->next_data.next;
-    grpc_error* error = c->error_data.error;
-    if (executor_trace.enabled()) {
+/* Push a closure: only the owning thread may call this. Returns false if the
+   deque is full. */
+static bool deque_push(closure_deque* d, grpc_closure* closure) {
+  gpr_atm b = gpr_atm_no_barrier_load(&d->bottom);
+  gpr_atm t = gpr_atm_acq_load(&d->top);
+  if (b - t >= DEQUE_SIZE) return false;
+  gpr_atm_no_barrier_store(&d->slots[b & (DEQUE_SIZE - 1)], (gpr_atm)closure);
+  gpr_atm_rel_store(&d->bottom, b + 1);
+  return true;
+}
+
+/* Take the oldest closure: thread safe. Returns NULL if the deque is empty. */
+static grpc_closure* deque_take(closure_deque* d) {
+  for (;;) {
+    gpr_atm t = gpr_atm_acq_load(&d->top);
+    gpr_atm b = gpr_atm_acq_load(&d->bottom);
+    if (t >= b) return nullptr;
+    grpc_closure* closure = (grpc_closure*)gpr_atm_no_barrier_load(
+        &d->slots[t & (DEQUE_SIZE - 1)]);
+    /* the owner only reuses this slot once top has moved past t, in which case
+       the CAS fails and we retry */
+    if (gpr_atm_full_cas(&d->top, t, t + 1)) return closure;
+  }
+}
+
+static void run_closure(grpc_closure* c) {
+  grpc_error* error = c->error_data.error;
+  if (executor_trace.enabled()) {
 #ifndef NDEBUG
-      gpr_log(GPR_DEBUG, "EXECUTOR: run %p [created by %s:%d]", c,
-              c->file_created, c->line_created);
+    gpr_log(GPR_DEBUG, "EXECUTOR: run %p [created by %s:%d]", c,
+            c->file_created, c->line_created);
 #else
-      gpr_log(GPR_DEBUG, "EXECUTOR: run %p", c);
+    gpr_log(GPR_DEBUG, "EXECUTOR: run %p", c);
 #endif
-    }
+  }
 #ifndef NDEBUG
-    c->scheduled = false;
+  c->scheduled = false;
 #endif
-    c->cb(c->cb_arg, error);
-    GRPC_ERROR_UNREF(error);
-    c = next;
-    n++;
-    grpc_core::ExecCtx::Get()->Flush();
+  c->cb(c->cb_arg, error);
+  GRPC_ERROR_UNREF(error);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
+/* Pop a closure queued to ts, from either queue. Thieves must not block on the
+   inbox lock (its owner or another thief has it), so they only try it. */
+static grpc_closure* pop_closure(thread_state* ts, bool is_owner) {
+  grpc_closure* closure = nullptr;
+  /* the owner alternates between its queues so that neither a closure that
+     keeps rescheduling itself nor a stream of pushes from other threads can
+     starve the other */
+  bool inbox_first = false;
+  if (is_owner) {
+    inbox_first = ts->inbox_first;
+    ts->inbox_first = !inbox_first;
   }
+  for (int i = 0; i < 2 && closure == nullptr; i++) {
+    if ((i == 0) == inbox_first) {
+      gpr_mpscq_node* n = is_owner ? gpr_locked_mpscq_pop(&ts->inbox)
+                                   : gpr_locked_mpscq_try_pop(&ts->inbox);
+      closure = (grpc_closure*)n;
+    } else {
+      closure = deque_take(&ts->deque);
+    }
+  }
+  if (closure != nullptr) {
+    gpr_atm_no_barrier_fetch_add(&ts->depth, -1);
+  }
+  return closure;
+}
+
+static size_t current_thread_count() {
+  return (size_t)gpr_atm_acq_load(&g_cur_threads);
+}
+
+/* Look for a closure queued to another thread, starting at a random victim */
+static grpc_closure* steal_closure(thread_state* thief) {
+  size_t n = current_thread_count();
+  /* xorshift32 */
+  uint32_t r = thief->rand_state;
+  r ^= r << 13;
+  r ^= r >> 17;
+  r ^= r << 5;
+  thief->rand_state = r;
+  size_t start = r % n;
+  for (size_t i = 0; i < n; i++) {
+    thread_state* victim = &g_thread_state[(start + i) % n];
+    if (victim == thief || gpr_atm_no_barrier_load(&victim->depth) <= 0) {
+      continue;
+    }
+    grpc_closure* closure = pop_closure(victim, false);
+    if (closure != nullptr) {
+      if (executor_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "EXECUTOR[%d]: stole %p from thread %d",
+                (int)(thief - g_thread_state), closure,
+                (int)(victim - g_thread_state));
+      }
+      GRPC_STATS_INC_EXECUTOR_CLOSURES_STOLEN();
+      return closure;
+    }
+  }
+  GRPC_STATS_INC_EXECUTOR_FAILED_STEALS();
+  return nullptr;
+}
+
+static bool work_available() {
+  size_t n = current_thread_count();
+  for (size_t i = 0; i < n; i++) {
+    if (gpr_atm_no_barrier_load(&g_thread_state[i].depth) > 0) return true;
+  }
+  return false;
+}
+
+/* Sleep until there may be work for ts; returns false on shutdown */
+static bool wait_for_work(thread_state* ts) {
+  bool shutdown;
+  GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED();
+  gpr_mu_lock(&ts->mu);
+  /* pairs with the barrier in executor_push: either the pusher sees us
+     sleeping and signals cv (under mu, so the signal can't be lost), or we see
+     its closure here */
+  gpr_atm_no_barrier_store(&ts->sleeping, 1);
+  gpr_atm_full_fetch_add(&g_sleeping_threads, 1);
+  for (;;) {
+    shutdown = gpr_atm_no_barrier_load(&ts->shutdown) != 0;
+    if (shutdown || work_available()) break;
+    gpr_cv_wait(&ts->cv, &ts->mu, gpr_inf_future(GPR_CLOCK_MONOTONIC));
+  }
+  gpr_atm_no_barrier_store(&ts->sleeping, 0);
+  gpr_atm_no_barrier_fetch_add(&g_sleeping_threads, -1);
+  gpr_mu_unlock(&ts->mu);
+  return !shutdown;
+}
+
+static void wake_thread(thread_state* ts) {
+  GRPC_STATS_INC_EXECUTOR_WAKEUP_INITIATED();
+  gpr_mu_lock(&ts->mu);
+  gpr_cv_signal(&ts->cv);
+  gpr_mu_unlock(&ts->mu);
+}
 
-  return n;
+static void drain_queues(thread_state* ts) {
+  grpc_closure* closure;
+  while ((closure = pop_closure(ts, true)) != nullptr) {
+    run_closure(closure);
+  }
 }
 
 bool grpc_executor_is_threaded() {
@@ -92,15 +247,18 @@ void grpc_executor_set_threading(bool threading) {
   if (threading) {
     if (cur_threads > 0) return;
     g_max_threads = GPR_MAX(1, 2 * gpr_cpu_num_cores());
-    gpr_atm_no_barrier_store(&g_cur_threads, 1);
     gpr_tls_init(&g_this_thread_state);
     g_thread_state =
         (thread_state*)gpr_zalloc(sizeof(thread_state) * g_max_threads);
     for (size_t i = 0; i < g_max_threads; i++) {
       gpr_mu_init(&g_thread_state[i].mu);
       gpr_cv_init(&g_thread_state[i].cv);
-      g_thread_state[i].elems = GRPC_CLOSURE_LIST_INIT;
+      deque_init(&g_thread_state[i].deque);
+      gpr_locked_mpscq_init(&g_thread_state[i].inbox);
+      g_thread_state[i].rand_state = (uint32_t)(i + 1) * 2654435761u;
     }
+    gpr_atm_no_barrier_store(&g_sleeping_threads, 0);
+    gpr_atm_rel_store(&g_cur_threads, 1);
 
     gpr_thd_options opt = gpr_thd_options_default();
     gpr_thd_options_set_joinable(&opt);
@@ -109,8 +267,8 @@ void grpc_executor_set_threading(bool threading) {
   } else {
     if (cur_threads == 0) return;
     for (size_t i = 0; i < g_max_threads; i++) {
+      gpr_atm_no_barrier_store(&g_thread_state[i].shutdown, 1);
       gpr_mu_lock(&g_thread_state[i].mu);
-      g_thread_state[i].shutdown = true;
       gpr_cv_signal(&g_thread_state[i].cv);
       gpr_mu_unlock(&g_thread_state[i].mu);
     }
@@ -123,9 +281,10 @@ void grpc_executor_set_threading(bool threading) {
     }
     gpr_atm_no_barrier_store(&g_cur_threads, 0);
     for (size_t i = 0; i < g_max_threads; i++) {
+      drain_queues(&g_thread_state[i]);
       gpr_mu_destroy(&g_thread_state[i].mu);
       gpr_cv_destroy(&g_thread_state[i].cv);
-      run_closures(g_thread_state[i].elems);
+      gpr_locked_mpscq_destroy(&g_thread_state[i].inbox);
     }
     gpr_free(g_thread_state);
     gpr_tls_destroy(&g_this_thread_state);
@@ -145,131 +304,126 @@ static void executor_thread(void* arg) {
 
   grpc_core::ExecCtx exec_ctx(0);
 
-  size_t subtract_depth = 0;
   for (;;) {
-    if (executor_trace.enabled()) {
-      gpr_log(GPR_DEBUG, "EXECUTOR[%d]: step (sub_depth=%" PRIdPTR ")",
-              (int)(ts - g_thread_state), subtract_depth);
-    }
-    gpr_mu_lock(&ts->mu);
-    ts->depth -= subtract_depth;
-    while (grpc_closure_list_empty(ts->elems) && !ts->shutdown) {
-      ts->queued_long_job = false;
-      gpr_cv_wait(&ts->cv, &ts->mu, gpr_inf_future(GPR_CLOCK_MONOTONIC));
-    }
-    if (ts->shutdown) {
-      if (executor_trace.enabled()) {
-        gpr_log(GPR_DEBUG, "EXECUTOR[%d]: shutdown",
-                (int)(ts - g_thread_state));
-      }
-      gpr_mu_unlock(&ts->mu);
-      break;
+    if (gpr_atm_no_barrier_load(&ts->shutdown)) break;
+    grpc_closure* closure = pop_closure(ts, true);
+    if (closure == nullptr) {
+      closure = steal_closure(ts);
     }
-    GRPC_STATS_INC_EXECUTOR_QUEUE_DRAINED();
-    grpc_closure_list exec = ts->elems;
-    ts->elems = GRPC_CLOSURE_LIST_INIT;
-    gpr_mu_unlock(&ts->mu);
-    if (executor_trace.enabled()) {
-      gpr_log(GPR_DEBUG, "EXECUTOR[%d]: execute", (int)(ts - g_thread_state));
+    if (closure == nullptr) {
+      if (!wait_for_work(ts)) break;
+      continue;
     }
-
+    bool is_long = is_long_job(closure);
+    if (is_long) gpr_atm_no_barrier_store(&ts->running_long_job, 1);
     grpc_core::ExecCtx::Get()->InvalidateNow();
-    subtract_depth = run_closures(exec);
+    run_closure(closure);
+    if (is_long) gpr_atm_no_barrier_store(&ts->running_long_job, 0);
+  }
+  if (executor_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "EXECUTOR[%d]: shutdown", (int)(ts - g_thread_state));
+  }
+}
+
+static void maybe_add_thread() {
+  if (!gpr_spinlock_trylock(&g_adding_thread_lock)) return;
+  size_t cur_thread_count = current_thread_count();
+  if (cur_thread_count < g_max_threads &&
+      !gpr_atm_no_barrier_load(&g_thread_state[0].shutdown)) {
+    gpr_thd_options opt = gpr_thd_options_default();
+    gpr_thd_options_set_joinable(&opt);
+    gpr_thd_new(&g_thread_state[cur_thread_count].id, "gpr_executor",
+                executor_thread, &g_thread_state[cur_thread_count], &opt);
+    gpr_atm_rel_store(&g_cur_threads, cur_thread_count + 1);
   }
+  gpr_spinlock_unlock(&g_adding_thread_lock);
 }
 
 static void executor_push(grpc_closure* closure, grpc_error* error,
                           bool is_short) {
-  bool retry_push;
   if (is_short) {
     GRPC_STATS_INC_EXECUTOR_SCHEDULED_SHORT_ITEMS();
   } else {
     GRPC_STATS_INC_EXECUTOR_SCHEDULED_LONG_ITEMS();
   }
-  do {
-    retry_push = false;
-    size_t cur_thread_count = (size_t)gpr_atm_no_barrier_load(&g_cur_threads);
-    if (cur_thread_count == 0) {
-      if (executor_trace.enabled()) {
+  size_t cur_thread_count = current_thread_count();
+  if (cur_thread_count == 0) {
+    if (executor_trace.enabled()) {
 #ifndef NDEBUG
-        gpr_log(GPR_DEBUG, "EXECUTOR: schedule %p (created %s:%d) inline",
-                closure, closure->file_created, closure->line_created);
+      gpr_log(GPR_DEBUG, "EXECUTOR: schedule %p (created %s:%d) inline",
+              closure, closure->file_created, closure->line_created);
 #else
-        gpr_log(GPR_DEBUG, "EXECUTOR: schedule %p inline", closure);
+      gpr_log(GPR_DEBUG, "EXECUTOR: schedule %p inline", closure);
 #endif
-      }
-      grpc_closure_list_append(grpc_core::ExecCtx::Get()->closure_list(),
-                               closure, error);
-      return;
-    }
-    thread_state* ts = (thread_state*)gpr_tls_get(&g_this_thread_state);
-    if (ts == nullptr) {
-      ts = &g_thread_state[GPR_HASH_POINTER(grpc_core::ExecCtx::Get(),
-                                            cur_thread_count)];
-    } else {
-      GRPC_STATS_INC_EXECUTOR_SCHEDULED_TO_SELF();
     }
+    grpc_closure_list_append(grpc_core::ExecCtx::Get()->closure_list(),
+                             closure, error);
+    return;
+  }
+  closure->error_data.error = error;
+  bool try_new_thread = false;
+  thread_state* self = (thread_state*)gpr_tls_get(&g_this_thread_state);
+  thread_state* ts = self;
+  if (self != nullptr && !gpr_atm_no_barrier_load(&self->running_long_job)) {
+    GRPC_STATS_INC_EXECUTOR_SCHEDULED_TO_SELF();
+  } else {
+    /* a long job scheduling work must not queue it behind itself: it may be
+       about to wait for it */
+    ts = self != nullptr ? self
+                         : &g_thread_state[GPR_HASH_POINTER(
+                               grpc_core::ExecCtx::Get(), cur_thread_count)];
+    /* a thread stuck in a long job can still have its queue stolen from, but
+       prefer one that will get to the closure itself */
     thread_state* orig_ts = ts;
-
-    bool try_new_thread;
-    for (;;) {
-      if (executor_trace.enabled()) {
+    while (gpr_atm_no_barrier_load(&ts->running_long_job)) {
+      GRPC_STATS_INC_EXECUTOR_PUSH_RETRIES();
+      ts = &g_thread_state[(size_t)(ts - g_thread_state + 1) %
+                           cur_thread_count];
+      if (ts == orig_ts) {
+        try_new_thread = true;
+        break;
+      }
+    }
+  }
+  if (executor_trace.enabled()) {
 #ifndef NDEBUG
-        gpr_log(
-            GPR_DEBUG,
-            "EXECUTOR: try to schedule %p (%s) (created %s:%d) to thread %d",
-            closure, is_short ? "short" : "long", closure->file_created,
+    gpr_log(GPR_DEBUG,
+            "EXECUTOR: schedule %p (%s) (created %s:%d) to thread %d", closure,
+            is_short ? "short" : "long", closure->file_created,
             closure->line_created, (int)(ts - g_thread_state));
 #else
-        gpr_log(GPR_DEBUG, "EXECUTOR: try to schedule %p (%s) to thread %d",
-                closure, is_short ? "short" : "long",
-                (int)(ts - g_thread_state));
+    gpr_log(GPR_DEBUG, "EXECUTOR: schedule %p (%s) to thread %d", closure,
+            is_short ? "short" : "long", (int)(ts - g_thread_state));
 #endif
+  }
+  if (ts != self || !deque_push(&ts->deque, closure)) {
+    gpr_locked_mpscq_push(&ts->inbox, &closure->next_data.atm_next);
+  }
+  /* full barrier: pairs with wait_for_work */
+  gpr_atm depth = gpr_atm_full_fetch_add(&ts->depth, 1) + 1;
+  GRPC_STATS_INC_EXECUTOR_QUEUE_DEPTH((int)depth);
+  if (gpr_atm_no_barrier_load(&ts->sleeping)) {
+    wake_thread(ts);
+  } else if ((ts != self || depth > 1 ||
+              gpr_atm_no_barrier_load(&ts->running_long_job)) &&
+             gpr_atm_no_barrier_load(&g_sleeping_threads) > 0) {
+    /* ts is busy: hand the closure to an idle thread to steal. A thread
+       scheduling to itself will usually get to a lone closure soon enough, and
+       running it there keeps its data in cache. */
+    for (size_t i = 1; i < cur_thread_count; i++) {
+      thread_state* idle =
+          &g_thread_state[(size_t)(ts - g_thread_state + i) % cur_thread_count];
+      if (gpr_atm_no_barrier_load(&idle->sleeping)) {
+        wake_thread(idle);
+        break;
       }
-      gpr_mu_lock(&ts->mu);
-      if (ts->queued_long_job) {
-        // if there's a long job queued, we never queue anything else to this
-        // queue (since long jobs can take 'infinite' time and we need to
-        // guarantee no starvation)
-        // ... spin through queues and try again
-        gpr_mu_unlock(&ts->mu);
-        size_t idx = (size_t)(ts - g_thread_state);
-        ts = &g_thread_state[(idx + 1) % cur_thread_count];
-        if (ts == orig_ts) {
-          retry_push = true;
-          try_new_thread = true;
-          break;
-        }
-        continue;
-      }
-      if (grpc_closure_list_empty(ts->elems) && !ts->shutdown) {
-        GRPC_STATS_INC_EXECUTOR_WAKEUP_INITIATED();
-        gpr_cv_signal(&ts->cv);
-      }
-      grpc_closure_list_append(&ts->elems, closure, error);
-      ts->depth++;
-      try_new_thread = ts->depth > MAX_DEPTH &&
-                       cur_thread_count < g_max_threads && !ts->shutdown;
-      if (!is_short) ts->queued_long_job = true;
-      gpr_mu_unlock(&ts->mu);
-      break;
-    }
-    if (try_new_thread && gpr_spinlock_trylock(&g_adding_thread_lock)) {
-      cur_thread_count = (size_t)gpr_atm_no_barrier_load(&g_cur_threads);
-      if (cur_thread_count < g_max_threads) {
-        gpr_atm_no_barrier_store(&g_cur_threads, cur_thread_count + 1);
-
-        gpr_thd_options opt = gpr_thd_options_default();
-        gpr_thd_options_set_joinable(&opt);
-        gpr_thd_new(&g_thread_state[cur_thread_count].id, "gpr_executor",
-                    executor_thread, &g_thread_state[cur_thread_count], &opt);
-      }
-      gpr_spinlock_unlock(&g_adding_thread_lock);
-    }
-    if (retry_push) {
-      GRPC_STATS_INC_EXECUTOR_PUSH_RETRIES();
     }
-  } while (retry_push);
+  } else if (depth > MAX_DEPTH) {
+    try_new_thread = true;
+  }
+  if (try_new_thread && cur_thread_count < g_max_threads) {
+    maybe_add_thread();
+  }
 }
 
 static void executor_push_short(grpc_closure* closure, grpc_error* error) {
@@ -294,3 +448,7 @@ grpc_closure_scheduler* grpc_executor_scheduler(
   return length == GRPC_EXECUTOR_SHORT ? &executor_scheduler_short
                                        : &executor_scheduler_long;
 }
+
+static bool is_long_job(grpc_closure* closure) {
+  return closure->scheduler == &executor_scheduler_long;
+}
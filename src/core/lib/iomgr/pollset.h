@@ -77,4 +77,9 @@ grpc_error* grpc_pollset_kick(grpc_pollset* pollset,
                               grpc_pollset_worker* specific_worker)
     GRPC_MUST_USE_RESULT;
 
+/* Have threads polling on behalf of this pollset spin on a non-blocking poll
+   for up to spin_budget_us microseconds before blocking (0 turns spinning
+   off). A hint: polling engines are free to ignore it. Thread safe. */
+void grpc_pollset_configure_spin(grpc_pollset* pollset, int spin_budget_us);
+
 #endif /* GRPC_CORE_LIB_IOMGR_POLLSET_H */
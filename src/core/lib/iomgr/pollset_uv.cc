@@ -153,4 +153,6 @@ grpc_error* grpc_pollset_kick(grpc_pollset* pollset,
   return GRPC_ERROR_NONE;
 }
 
+void grpc_pollset_configure_spin(grpc_pollset* pollset, int spin_budget_us) {}
+
 #endif /* GRPC_UV */
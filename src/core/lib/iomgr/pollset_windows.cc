@@ -218,4 +218,6 @@ grpc_error* grpc_pollset_kick(grpc_pollset* p,
   return GRPC_ERROR_NONE;
 }
 
+void grpc_pollset_configure_spin(grpc_pollset* p, int spin_budget_us) {}
+
 #endif /* GRPC_WINSOCK_SOCKET */
@@ -25,6 +25,7 @@
 
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/useful.h>
@@ -35,6 +36,36 @@ grpc_core::TraceFlag grpc_resource_quota_trace(false, "resource_quota");
 
 #define MEMORY_USAGE_ESTIMATION_MAX 65536
 
+/* Most bytes of a quota's free pool held in any one CPU's reservation cache
+   (see rq_cpu_cache); limited quotas also cap each cache to 1/8 of the quota
+   divided across CPUs, so that together they never hold more than 1/8 of it */
+#define RQ_CPU_CACHE_MAX_BATCH (1024 * 1024)
+
+/* Slices allocated through a grpc_resource_user_slice_allocator (i.e. read
+   buffers) of up to 256 << (RU_SLICE_CACHE_CLASSES - 1) bytes come in
+   power-of-two size classes. When such a slice is released its block is parked
+   on the resource user's free list for the next allocation of the same class,
+   rather than going back to malloc. */
+#define RU_SLICE_CACHE_MIN_SHIFT 8
+#define RU_SLICE_CACHE_CLASSES 6
+/* Maximum number of blocks kept per size class and resource user */
+#define RU_SLICE_CACHE_MAX_PER_CLASS 8
+
+typedef struct ru_slice_refcount ru_slice_refcount;
+
+/* Memory reserved from a quota's free pool for resource users allocating on
+   one CPU. A resource user whose own free pool runs short takes the shortfall
+   from here with a lock-free decrement instead of queuing an allocation on the
+   quota combiner. The quota (under its combiner) refills caches in batches
+   while it is at most half used, and takes everything back as soon as it
+   cannot grant an allocation from its own free pool. Cached bytes are still
+   the quota's free bytes, just closer to the allocating thread, so the quota
+   stays bounded. */
+typedef struct {
+  gpr_atm credit;
+  char padding[GPR_CACHELINE_SIZE - sizeof(gpr_atm)];
+} rq_cpu_cache;
+
 /* Internal linked list pointers for a resource user */
 typedef struct {
   grpc_resource_user* next;
@@ -111,6 +142,16 @@ struct grpc_resource_user {
   /* Links in the various grpc_rulist lists */
   grpc_resource_user_link links[GRPC_RULIST_COUNT];
 
+  /* Released slice blocks available for reuse, by size class (see
+     RU_SLICE_CACHE_CLASSES). Guarded by mu. The cached bytes never exceed
+     free_pool: the blocks are memory this user holds from the quota. Blocks
+     are evicted whenever an allocation lowers free_pool below them (less any
+     a pending slice allocation is about to reuse), and all are freed whenever
+     the quota takes that free pool back. */
+  ru_slice_refcount* slice_cache[RU_SLICE_CACHE_CLASSES];
+  int slice_cache_count[RU_SLICE_CACHE_CLASSES];
+  int64_t slice_cache_bytes;
+
   /* The name of this resource user, for debugging/tracing */
   char* name;
 };
@@ -128,9 +169,14 @@ struct grpc_resource_quota {
   grpc_combiner* combiner;
   /* Size of the resource quota */
   int64_t size;
-  /* Amount of free memory in the resource quota */
+  /* Amount of free memory in the resource quota (excluding what is held in
+     cpu_caches) */
   int64_t free_pool;
 
+  /* Per-CPU reservation caches, indexed by gpr_cpu_current_cpu() */
+  rq_cpu_cache* cpu_caches;
+  size_t num_cpu_caches;
+
   gpr_atm last_size;
 
   /* Has rq_step been scheduled to occur? */
@@ -155,6 +201,9 @@ struct grpc_resource_quota {
 };
 
 static void ru_unref_by(grpc_resource_user* resource_user, gpr_atm amount);
+static ru_slice_refcount* ru_slice_cache_take_all_locked(
+    grpc_resource_user* resource_user);
+static void ru_slice_cache_free_blocks(ru_slice_refcount* blocks);
 
 /*******************************************************************************
  * list management
@@ -239,6 +288,8 @@ static void rulist_remove(grpc_resource_user* resource_user, grpc_rulist list) {
  */
 
 static bool rq_alloc(grpc_resource_quota* resource_quota);
+static void rq_refill_cpu_caches(grpc_resource_quota* resource_quota);
+static bool rq_reclaim_from_cpu_caches(grpc_resource_quota* resource_quota);
 static bool rq_reclaim_from_per_user_free_pool(
     grpc_resource_quota* resource_quota);
 static bool rq_reclaim(grpc_resource_quota* resource_quota, bool destructive);
@@ -247,8 +298,12 @@ static void rq_step(void* rq, grpc_error* error) {
   grpc_resource_quota* resource_quota = (grpc_resource_quota*)rq;
   resource_quota->step_scheduled = false;
   do {
-    if (rq_alloc(resource_quota)) goto done;
-  } while (rq_reclaim_from_per_user_free_pool(resource_quota));
+    if (rq_alloc(resource_quota)) {
+      rq_refill_cpu_caches(resource_quota);
+      goto done;
+    }
+  } while (rq_reclaim_from_cpu_caches(resource_quota) ||
+           rq_reclaim_from_per_user_free_pool(resource_quota));
 
   if (!rq_reclaim(resource_quota, false)) {
     rq_reclaim(resource_quota, true);
@@ -270,11 +325,16 @@ static void rq_step_sched(grpc_resource_quota* resource_quota) {
 static void rq_update_estimate(grpc_resource_quota* resource_quota) {
   gpr_atm memory_usage_estimation = MEMORY_USAGE_ESTIMATION_MAX;
   if (resource_quota->size != 0) {
-    memory_usage_estimation =
-        GPR_CLAMP((gpr_atm)((1.0 - ((double)resource_quota->free_pool) /
-                                       ((double)resource_quota->size)) *
-                            MEMORY_USAGE_ESTIMATION_MAX),
-                  0, MEMORY_USAGE_ESTIMATION_MAX);
+    /* memory in the per-cpu caches is still free */
+    double free_pool = (double)resource_quota->free_pool;
+    for (size_t i = 0; i < resource_quota->num_cpu_caches; i++) {
+      free_pool += (double)gpr_atm_no_barrier_load(
+          &resource_quota->cpu_caches[i].credit);
+    }
+    memory_usage_estimation = GPR_CLAMP(
+        (gpr_atm)((1.0 - free_pool / ((double)resource_quota->size)) *
+                  MEMORY_USAGE_ESTIMATION_MAX),
+        0, MEMORY_USAGE_ESTIMATION_MAX);
   }
   gpr_atm_no_barrier_store(&resource_quota->memory_usage_estimation,
                            memory_usage_estimation);
@@ -338,6 +398,73 @@ static bool rq_alloc(grpc_resource_quota* resource_quota) {
   return true;
 }
 
+static int64_t rq_cpu_cache_batch(grpc_resource_quota* resource_quota) {
+  return GPR_MIN(
+      RQ_CPU_CACHE_MAX_BATCH,
+      resource_quota->size / 8 / (int64_t)resource_quota->num_cpu_caches);
+}
+
+/* top up per-cpu caches that are at least half empty, as long as the quota
+   is at most half used */
+static void rq_refill_cpu_caches(grpc_resource_quota* resource_quota) {
+  int64_t batch = rq_cpu_cache_batch(resource_quota);
+  int64_t reserve = resource_quota->size / 2;
+  bool refilled = false;
+  for (size_t i = 0; i < resource_quota->num_cpu_caches; i++) {
+    rq_cpu_cache* cache = &resource_quota->cpu_caches[i];
+    int64_t amt = batch - (int64_t)gpr_atm_no_barrier_load(&cache->credit);
+    if (amt < batch / 2) continue;
+    amt = GPR_MIN(amt, resource_quota->free_pool - reserve);
+    if (amt <= 0) break;
+    gpr_atm_no_barrier_fetch_add(&cache->credit, (gpr_atm)amt);
+    resource_quota->free_pool -= amt;
+    refilled = true;
+  }
+  if (refilled) {
+    rq_update_estimate(resource_quota);
+    if (grpc_resource_quota_trace.enabled()) {
+      gpr_log(GPR_DEBUG,
+              "RQ %s: refill cpu caches; rq_free_pool -> %" PRId64,
+              resource_quota->name, resource_quota->free_pool);
+    }
+  }
+}
+
+/* returns true if any memory could be reclaimed from the per-cpu caches */
+static bool rq_reclaim_from_cpu_caches(grpc_resource_quota* resource_quota) {
+  int64_t amt = 0;
+  for (size_t i = 0; i < resource_quota->num_cpu_caches; i++) {
+    amt += (int64_t)gpr_atm_full_xchg(&resource_quota->cpu_caches[i].credit, 0);
+  }
+  if (amt == 0) return false;
+  resource_quota->free_pool += amt;
+  rq_update_estimate(resource_quota);
+  if (grpc_resource_quota_trace.enabled()) {
+    gpr_log(GPR_DEBUG,
+            "RQ %s: reclaim_from_cpu_caches %" PRId64
+            " bytes; rq_free_pool -> %" PRId64,
+            resource_quota->name, amt, resource_quota->free_pool);
+  }
+  return true;
+}
+
+/* take amount bytes from the current cpu's cache: safe from any thread */
+static bool rq_take_from_cpu_cache(grpc_resource_quota* resource_quota,
+                                   int64_t amount) {
+  rq_cpu_cache* cache =
+      &resource_quota->cpu_caches[gpr_cpu_current_cpu() %
+                                  resource_quota->num_cpu_caches];
+  gpr_atm credit = gpr_atm_no_barrier_load(&cache->credit);
+  while (credit >= amount) {
+    if (gpr_atm_no_barrier_cas(&cache->credit, credit,
+                               credit - (gpr_atm)amount)) {
+      return true;
+    }
+    credit = gpr_atm_no_barrier_load(&cache->credit);
+  }
+  return false;
+}
+
 /* returns true if any memory could be reclaimed from buffers */
 static bool rq_reclaim_from_per_user_free_pool(
     grpc_resource_quota* resource_quota) {
@@ -357,7 +484,10 @@ static bool rq_reclaim_from_per_user_free_pool(
                 resource_quota->name, resource_user->name, amt,
                 resource_quota->free_pool);
       }
+      /* the cached slice blocks were backed by that free pool */
+      ru_slice_refcount* blocks = ru_slice_cache_take_all_locked(resource_user);
       gpr_mu_unlock(&resource_user->mu);
+      ru_slice_cache_free_blocks(blocks);
       return true;
     } else {
       gpr_mu_unlock(&resource_user->mu);
@@ -393,12 +523,121 @@ static bool rq_reclaim(grpc_resource_quota* resource_quota, bool destructive) {
  * ru_slice: a slice implementation that is backed by a grpc_resource_user
  */
 
-typedef struct {
+struct ru_slice_refcount {
   grpc_slice_refcount base;
   gpr_refcount refs;
   grpc_resource_user* resource_user;
+  /* bytes allocated after this header (and charged to resource_user) */
   size_t size;
-} ru_slice_refcount;
+  /* size class (or -1 if too large to be cached) */
+  int size_class;
+  /* next block in the resource user's slice cache */
+  ru_slice_refcount* next_free;
+};
+
+/* size class for a slice of length bytes, or -1 if it is not cacheable */
+static int ru_slice_size_class(size_t length) {
+  for (int i = 0; i < RU_SLICE_CACHE_CLASSES; i++) {
+    if (length <= ((size_t)1 << (RU_SLICE_CACHE_MIN_SHIFT + i))) return i;
+  }
+  return -1;
+}
+
+/* bytes charged to the resource user for a slice of length bytes */
+static size_t ru_slice_charge(size_t length) {
+  int size_class = ru_slice_size_class(length);
+  return size_class < 0
+             ? length
+             : (size_t)1 << (RU_SLICE_CACHE_MIN_SHIFT + size_class);
+}
+
+static bool ru_slice_cache_put_locked(grpc_resource_user* resource_user,
+                                      ru_slice_refcount* rc) {
+  if (rc->size_class < 0 ||
+      resource_user->slice_cache_count[rc->size_class] >=
+          RU_SLICE_CACHE_MAX_PER_CLASS ||
+      resource_user->slice_cache_bytes + (int64_t)rc->size >
+          resource_user->free_pool) {
+    return false;
+  }
+  rc->next_free = resource_user->slice_cache[rc->size_class];
+  resource_user->slice_cache[rc->size_class] = rc;
+  resource_user->slice_cache_count[rc->size_class]++;
+  resource_user->slice_cache_bytes += (int64_t)rc->size;
+  return true;
+}
+
+static ru_slice_refcount* ru_slice_cache_get_locked(
+    grpc_resource_user* resource_user, int size_class) {
+  ru_slice_refcount* rc = resource_user->slice_cache[size_class];
+  if (rc != nullptr) {
+    resource_user->slice_cache[size_class] = rc->next_free;
+    resource_user->slice_cache_count[size_class]--;
+    resource_user->slice_cache_bytes -= (int64_t)rc->size;
+  }
+  return rc;
+}
+
+/* empties the slice cache, returning its blocks as one list to be passed to
+   ru_slice_cache_free_blocks() once the lock is dropped */
+static ru_slice_refcount* ru_slice_cache_take_all_locked(
+    grpc_resource_user* resource_user) {
+  ru_slice_refcount* blocks = nullptr;
+  for (int i = 0; i < RU_SLICE_CACHE_CLASSES; i++) {
+    ru_slice_refcount* rc;
+    while ((rc = ru_slice_cache_get_locked(resource_user, i)) != nullptr) {
+      rc->next_free = blocks;
+      blocks = rc;
+    }
+  }
+  return blocks;
+}
+
+/* moves blocks of size_class from the slice cache onto *blocks until it holds
+   no more than limit bytes */
+static void ru_slice_cache_evict_class_locked(grpc_resource_user* resource_user,
+                                              int size_class, int64_t limit,
+                                              ru_slice_refcount** blocks) {
+  ru_slice_refcount* rc;
+  while (resource_user->slice_cache_bytes > limit &&
+         (rc = ru_slice_cache_get_locked(resource_user, size_class)) !=
+             nullptr) {
+    rc->next_free = *blocks;
+    *blocks = rc;
+  }
+}
+
+/* evicts cached blocks, largest first, until the cache is covered by the free
+   pool again. A pending slice allocation about to reuse keep_bytes of blocks of
+   keep_class (-1 for none) needs no free pool for those: they are not counted,
+   and that class is evicted last. Returns the evicted blocks as for
+   ru_slice_cache_take_all_locked() */
+static ru_slice_refcount* ru_slice_cache_trim_locked(
+    grpc_resource_user* resource_user, int keep_class, int64_t keep_bytes) {
+  int64_t limit = GPR_MAX(resource_user->free_pool, 0) + keep_bytes;
+  ru_slice_refcount* blocks = nullptr;
+  for (int i = RU_SLICE_CACHE_CLASSES - 1; i >= 0; i--) {
+    if (i != keep_class) {
+      ru_slice_cache_evict_class_locked(resource_user, i, limit, &blocks);
+    }
+  }
+  if (keep_class >= 0) {
+    ru_slice_cache_evict_class_locked(resource_user, keep_class, limit,
+                                      &blocks);
+  }
+  return blocks;
+}
+
+static void ru_slice_cache_free_blocks(ru_slice_refcount* blocks) {
+  while (blocks != nullptr) {
+    ru_slice_refcount* next = blocks->next_free;
+    gpr_free(blocks);
+    blocks = next;
+  }
+}
+
+static void ru_free(grpc_resource_user* resource_user, size_t size,
+                    ru_slice_refcount* block);
 
 static void ru_slice_ref(void* p) {
   ru_slice_refcount* rc = (ru_slice_refcount*)p;
@@ -408,8 +647,7 @@ static void ru_slice_ref(void* p) {
 static void ru_slice_unref(void* p) {
   ru_slice_refcount* rc = (ru_slice_refcount*)p;
   if (gpr_unref(&rc->refs)) {
-    grpc_resource_user_free(rc->resource_user, rc->size);
-    gpr_free(rc);
+    ru_free(rc->resource_user, rc->size, rc);
   }
 }
 
@@ -417,19 +655,31 @@ static const grpc_slice_refcount_vtable ru_slice_vtable = {
     ru_slice_ref, ru_slice_unref, grpc_slice_default_eq_impl,
     grpc_slice_default_hash_impl};
 
-static grpc_slice ru_slice_create(grpc_resource_user* resource_user,
-                                  size_t size) {
-  ru_slice_refcount* rc =
-      (ru_slice_refcount*)gpr_malloc(sizeof(ru_slice_refcount) + size);
-  rc->base.vtable = &ru_slice_vtable;
-  rc->base.sub_refcount = &rc->base;
+/* Create a slice of length bytes, reusing a cached block if there is one.
+   Must be called with resource_user->mu held; the caller has already charged
+   ru_slice_charge(length) bytes to resource_user. */
+static grpc_slice ru_slice_create_locked(grpc_resource_user* resource_user,
+                                         size_t length) {
+  int size_class = ru_slice_size_class(length);
+  ru_slice_refcount* rc = nullptr;
+  if (size_class >= 0) {
+    rc = ru_slice_cache_get_locked(resource_user, size_class);
+  }
+  if (rc == nullptr) {
+    size_t size = ru_slice_charge(length);
+    rc = (ru_slice_refcount*)gpr_malloc(sizeof(ru_slice_refcount) + size);
+    rc->base.vtable = &ru_slice_vtable;
+    rc->base.sub_refcount = &rc->base;
+    rc->resource_user = resource_user;
+    rc->size = size;
+    rc->size_class = size_class;
+  }
   gpr_ref_init(&rc->refs, 1);
-  rc->resource_user = resource_user;
-  rc->size = size;
+  rc->next_free = nullptr;
   grpc_slice slice;
   slice.refcount = &rc->base;
   slice.data.refcounted.bytes = (uint8_t*)(rc + 1);
-  slice.data.refcounted.length = size;
+  slice.data.refcounted.length = length;
   return slice;
 }
 
@@ -532,6 +782,10 @@ static void ru_destroy(void* ru, grpc_error* error) {
     resource_user->resource_quota->free_pool += resource_user->free_pool;
     rq_step_sched(resource_user->resource_quota);
   }
+  gpr_mu_lock(&resource_user->mu);
+  ru_slice_refcount* blocks = ru_slice_cache_take_all_locked(resource_user);
+  gpr_mu_unlock(&resource_user->mu);
+  ru_slice_cache_free_blocks(blocks);
   grpc_resource_quota_unref_internal(resource_user->resource_quota);
   gpr_mu_destroy(&resource_user->mu);
   gpr_free(resource_user->name);
@@ -542,11 +796,16 @@ static void ru_allocated_slices(void* arg, grpc_error* error) {
   grpc_resource_user_slice_allocator* slice_allocator =
       (grpc_resource_user_slice_allocator*)arg;
   if (error == GRPC_ERROR_NONE) {
+    grpc_resource_user* resource_user = slice_allocator->resource_user;
+    gpr_mu_lock(&resource_user->mu);
     for (size_t i = 0; i < slice_allocator->count; i++) {
       grpc_slice_buffer_add_indexed(
-          slice_allocator->dest, ru_slice_create(slice_allocator->resource_user,
-                                                 slice_allocator->length));
+          slice_allocator->dest,
+          ru_slice_create_locked(resource_user, slice_allocator->length));
     }
+    ru_slice_refcount* blocks = ru_slice_cache_trim_locked(resource_user, -1, 0);
+    gpr_mu_unlock(&resource_user->mu);
+    ru_slice_cache_free_blocks(blocks);
   }
   GRPC_CLOSURE_RUN(&slice_allocator->on_done, GRPC_ERROR_REF(error));
 }
@@ -567,6 +826,8 @@ static void rq_resize(void* args, grpc_error* error) {
   int64_t delta = a->size - a->resource_quota->size;
   a->resource_quota->size += delta;
   a->resource_quota->free_pool += delta;
+  /* the caches are sized for the old quota: they refill on the next step */
+  rq_reclaim_from_cpu_caches(a->resource_quota);
   rq_update_estimate(a->resource_quota);
   rq_step_sched(a->resource_quota);
   grpc_resource_quota_unref_internal(a->resource_quota);
@@ -592,6 +853,9 @@ grpc_resource_quota* grpc_resource_quota_create(const char* name) {
   resource_quota->combiner = grpc_combiner_create();
   resource_quota->free_pool = INT64_MAX;
   resource_quota->size = INT64_MAX;
+  resource_quota->num_cpu_caches = GPR_MAX(1, gpr_cpu_num_cores());
+  resource_quota->cpu_caches = (rq_cpu_cache*)gpr_zalloc(
+      sizeof(*resource_quota->cpu_caches) * resource_quota->num_cpu_caches);
   gpr_atm_no_barrier_store(&resource_quota->last_size, GPR_ATM_MAX);
   resource_quota->step_scheduled = false;
   resource_quota->reclaiming = false;
@@ -616,6 +880,7 @@ grpc_resource_quota* grpc_resource_quota_create(const char* name) {
 void grpc_resource_quota_unref_internal(grpc_resource_quota* resource_quota) {
   if (gpr_unref(&resource_quota->refs)) {
     GRPC_COMBINER_UNREF(resource_quota->combiner, "resource_quota");
+    gpr_free(resource_quota->cpu_caches);
     gpr_free(resource_quota->name);
     gpr_free(resource_quota);
   }
@@ -736,6 +1001,11 @@ grpc_resource_user* grpc_resource_user_create(
   for (int i = 0; i < GRPC_RULIST_COUNT; i++) {
     resource_user->links[i].next = resource_user->links[i].prev = nullptr;
   }
+  for (int i = 0; i < RU_SLICE_CACHE_CLASSES; i++) {
+    resource_user->slice_cache[i] = nullptr;
+    resource_user->slice_cache_count[i] = 0;
+  }
+  resource_user->slice_cache_bytes = 0;
   if (name != nullptr) {
     resource_user->name = gpr_strdup(name);
   } else {
@@ -782,9 +1052,10 @@ void grpc_resource_user_shutdown(grpc_resource_user* resource_user) {
   }
 }
 
-void grpc_resource_user_alloc(grpc_resource_user* resource_user, size_t size,
-                              grpc_closure* optional_on_done) {
-  gpr_mu_lock(&resource_user->mu);
+/* Charge size bytes to resource_user: must be called with resource_user->mu
+   held */
+static void ru_alloc_locked(grpc_resource_user* resource_user, size_t size,
+                            grpc_closure* optional_on_done) {
   ru_ref_by(resource_user, (gpr_atm)size);
   resource_user->free_pool -= (int64_t)size;
   resource_user->outstanding_allocations += (int64_t)size;
@@ -793,6 +1064,17 @@ void grpc_resource_user_alloc(grpc_resource_user* resource_user, size_t size,
             resource_user->resource_quota->name, resource_user->name, size,
             resource_user->free_pool);
   }
+  /* allocations already waiting on the quota must be granted first */
+  if (resource_user->free_pool < 0 && !resource_user->allocating &&
+      rq_take_from_cpu_cache(resource_user->resource_quota,
+                             -resource_user->free_pool)) {
+    if (grpc_resource_quota_trace.enabled()) {
+      gpr_log(GPR_DEBUG, "RQ %s %s: took %" PRId64 " bytes from cpu cache",
+              resource_user->resource_quota->name, resource_user->name,
+              -resource_user->free_pool);
+    }
+    resource_user->free_pool = 0;
+  }
   if (resource_user->free_pool < 0) {
     grpc_closure_list_append(&resource_user->on_allocated, optional_on_done,
                              GRPC_ERROR_NONE);
@@ -804,10 +1086,25 @@ void grpc_resource_user_alloc(grpc_resource_user* resource_user, size_t size,
     resource_user->outstanding_allocations -= (int64_t)size;
     GRPC_CLOSURE_SCHED(optional_on_done, GRPC_ERROR_NONE);
   }
+}
+
+void grpc_resource_user_alloc(grpc_resource_user* resource_user, size_t size,
+                              grpc_closure* optional_on_done) {
+  gpr_mu_lock(&resource_user->mu);
+  ru_alloc_locked(resource_user, size, optional_on_done);
+  ru_slice_refcount* blocks = ru_slice_cache_trim_locked(resource_user, -1, 0);
   gpr_mu_unlock(&resource_user->mu);
+  ru_slice_cache_free_blocks(blocks);
 }
 
 void grpc_resource_user_free(grpc_resource_user* resource_user, size_t size) {
+  ru_free(resource_user, size, nullptr);
+}
+
+/* Return size bytes to resource_user; if block is set, it is the slice block
+   that held them, and is either cached for reuse or freed */
+static void ru_free(grpc_resource_user* resource_user, size_t size,
+                    ru_slice_refcount* block) {
   gpr_mu_lock(&resource_user->mu);
   bool was_zero_or_negative = resource_user->free_pool <= 0;
   resource_user->free_pool += (int64_t)size;
@@ -823,7 +1120,11 @@ void grpc_resource_user_free(grpc_resource_user* resource_user, size_t size) {
     GRPC_CLOSURE_SCHED(&resource_user->add_to_free_pool_closure,
                        GRPC_ERROR_NONE);
   }
+  if (block != nullptr && ru_slice_cache_put_locked(resource_user, block)) {
+    block = nullptr;
+  }
   gpr_mu_unlock(&resource_user->mu);
+  gpr_free(block);
   ru_unref_by(resource_user, (gpr_atm)size);
 }
 
@@ -859,9 +1160,31 @@ void grpc_resource_user_slice_allocator_init(
 void grpc_resource_user_alloc_slices(
     grpc_resource_user_slice_allocator* slice_allocator, size_t length,
     size_t count, grpc_slice_buffer* dest) {
+  grpc_resource_user* resource_user = slice_allocator->resource_user;
   slice_allocator->length = length;
   slice_allocator->count = count;
   slice_allocator->dest = dest;
-  grpc_resource_user_alloc(slice_allocator->resource_user, count * length,
-                           &slice_allocator->on_allocated);
+  int size_class = ru_slice_size_class(length);
+  gpr_mu_lock(&resource_user->mu);
+  /* cached blocks these slices will reuse need no more of the free pool */
+  int64_t reused = 0;
+  if (size_class >= 0) {
+    reused = (int64_t)GPR_MIN(
+                 count, (size_t)resource_user->slice_cache_count[size_class]) *
+             (int64_t)ru_slice_charge(length);
+  }
+  ru_alloc_locked(resource_user, count * ru_slice_charge(length),
+                  &slice_allocator->on_allocated);
+  ru_slice_refcount* blocks =
+      ru_slice_cache_trim_locked(resource_user, size_class, reused);
+  gpr_mu_unlock(&resource_user->mu);
+  ru_slice_cache_free_blocks(blocks);
+}
+
+int64_t grpc_resource_user_slice_cache_bytes_for_testing(
+    grpc_resource_user* resource_user) {
+  gpr_mu_lock(&resource_user->mu);
+  int64_t bytes = resource_user->slice_cache_bytes;
+  gpr_mu_unlock(&resource_user->mu);
+  return bytes;
 }
@@ -132,11 +132,17 @@ void grpc_resource_user_slice_allocator_init(
     grpc_resource_user* resource_user, grpc_iomgr_cb_func cb, void* p);
 
 /* Allocate \a count slices of length \a length into \a dest. Only one request
-   can be outstanding at a time. */
+   can be outstanding at a time.
+   Slices of up to 8KB are rounded up (and charged) to a power of two size
+   class, and their memory is recycled by the resource user once released. */
 void grpc_resource_user_alloc_slices(
     grpc_resource_user_slice_allocator* slice_allocator, size_t length,
     size_t count, grpc_slice_buffer* dest);
 
+/* Bytes held in \a resource_user's cache of released slice blocks */
+int64_t grpc_resource_user_slice_cache_bytes_for_testing(
+    grpc_resource_user* resource_user);
+
 /* Allocate one slice of length \a size synchronously. */
 grpc_slice grpc_resource_user_slice_malloc(grpc_resource_user* resource_user,
                                            size_t size);
@@ -43,6 +43,14 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/iomgr/sockaddr_utils.h"
 
+#if defined(GRPC_LINUX_ERRQUEUE) && !defined(SO_ZEROCOPY)
+#define SO_ZEROCOPY 60
+#endif
+
+#ifdef GRPC_LINUX_ERRQUEUE
+#include <linux/net_tstamp.h>
+#endif
+
 /* set a socket to non blocking mode */
 grpc_error* grpc_set_socket_nonblocking(int fd, int non_blocking) {
   int oldflags = fcntl(fd, F_GETFL, 0);
@@ -178,6 +186,84 @@ grpc_error* grpc_set_socket_reuse_port(int fd, int reuse) {
 #endif
 }
 
+/* set SO_ZEROCOPY */
+grpc_error* grpc_set_socket_zerocopy(int fd) {
+#ifndef GRPC_LINUX_ERRQUEUE
+  return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "MSG_ZEROCOPY unavailable on compiling system");
+#else
+  const int enable = 1;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_ZEROCOPY)");
+  }
+  return GRPC_ERROR_NONE;
+#endif
+}
+
+/* set SO_TIMESTAMPING */
+grpc_error* grpc_set_socket_timestamping(int fd) {
+#ifndef GRPC_LINUX_ERRQUEUE
+  return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "SO_TIMESTAMPING unavailable on compiling system");
+#else
+  int protocol;
+  socklen_t len = sizeof(protocol);
+  if (0 != getsockopt(fd, SOL_SOCKET, SO_PROTOCOL, &protocol, &len)) {
+    return GRPC_OS_ERROR(errno, "getsockopt(SO_PROTOCOL)");
+  }
+  if (protocol != IPPROTO_TCP) {
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "SO_TIMESTAMPING only supported on TCP sockets");
+  }
+  /* transmit timestamps are requested per sendmsg; these flags only choose
+     how they are reported */
+  const int flags = SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_RX_SOFTWARE |
+                    SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_TIMESTAMPING)");
+  }
+  return GRPC_ERROR_NONE;
+#endif
+}
+
+/* set SO_BUSY_POLL */
+grpc_error* grpc_set_socket_busy_poll(int fd, int usec) {
+#ifndef SO_BUSY_POLL
+  return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "SO_BUSY_POLL unavailable on compiling system");
+#else
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_BUSY_POLL)");
+  }
+  return GRPC_ERROR_NONE;
+#endif
+}
+
+grpc_error* grpc_set_socket_incoming_cpu(int fd, int cpu) {
+#ifndef SO_INCOMING_CPU
+  return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "SO_INCOMING_CPU unavailable on compiling system");
+#else
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_INCOMING_CPU)");
+  }
+  return GRPC_ERROR_NONE;
+#endif
+}
+
+grpc_error* grpc_set_socket_notsent_lowat(int fd, int bytes) {
+#ifndef TCP_NOTSENT_LOWAT
+  return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "TCP_NOTSENT_LOWAT unavailable on compiling system");
+#else
+  if (0 !=
+      setsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &bytes, sizeof(bytes))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(TCP_NOTSENT_LOWAT)");
+  }
+  return GRPC_ERROR_NONE;
+#endif
+}
+
 /* disable nagle */
 grpc_error* grpc_set_socket_low_latency(int fd, int low_latency) {
   int val = (low_latency != 0);
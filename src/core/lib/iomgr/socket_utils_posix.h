@@ -48,6 +48,27 @@ grpc_error* grpc_set_socket_low_latency(int fd, int low_latency);
 /* set SO_REUSEPORT */
 grpc_error* grpc_set_socket_reuse_port(int fd, int reuse);
 
+/* set SO_ZEROCOPY, allowing MSG_ZEROCOPY sends on this socket */
+grpc_error* grpc_set_socket_zerocopy(int fd);
+
+/* set SO_TIMESTAMPING, reporting software receive timestamps with every read
+   and transmit timestamps, keyed by byte count, on the error queue: fails if
+   fd is not a TCP socket */
+grpc_error* grpc_set_socket_timestamping(int fd);
+
+/* set SO_BUSY_POLL: blocking receives busy poll the device queue for up to
+   usec microseconds */
+grpc_error* grpc_set_socket_busy_poll(int fd, int usec);
+
+/* set SO_INCOMING_CPU: of a group of SO_REUSEPORT listeners, the kernel
+   prefers to queue a new connection on the one whose cpu is the CPU that
+   received the connection's packets */
+grpc_error* grpc_set_socket_incoming_cpu(int fd, int cpu);
+
+/* set TCP_NOTSENT_LOWAT: the socket polls writable only while it holds fewer
+   than bytes of data not yet sent */
+grpc_error* grpc_set_socket_notsent_lowat(int fd, int bytes);
+
 /* Returns true if this system can create AF_INET6 sockets bound to ::1.
    The value is probed once, and cached for the life of the process.
 
@@ -0,0 +1,550 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_IO_URING
+
+#include "src/core/lib/iomgr/tcp_io_uring_linux.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <grpc/slice.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/useful.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/iomgr/ev_io_uring_linux.h"
+#include "src/core/lib/iomgr/network_status_tracker.h"
+#include "src/core/lib/iomgr/tcp_posix.h"
+#include "src/core/lib/profiling/timers.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_string_helpers.h"
+
+#ifdef GRPC_HAVE_MSG_NOSIGNAL
+#define SENDMSG_FLAGS MSG_NOSIGNAL
+#else
+#define SENDMSG_FLAGS 0
+#endif
+
+#define MAX_WRITE_IOVEC 256
+
+namespace {
+struct grpc_tcp {
+  grpc_endpoint base;
+  grpc_fd* em_fd;
+  int fd;
+  gpr_refcount refcount;
+  int read_chunk_size;
+
+  grpc_slice_buffer* incoming_buffer;
+  grpc_closure* read_cb;
+  /* whether the read in flight lets the kernel pick a provided buffer, rather
+     than reading into incoming_buffer */
+  bool read_provided;
+  uint8_t* read_buf;
+  size_t read_len;
+  grpc_io_uring_op read_op;
+  grpc_closure read_done_closure;
+  grpc_closure read_charged_closure;
+
+  grpc_slice_buffer* outgoing_buffer;
+  /** slice of outgoing_buffer, and byte within it, to write next */
+  size_t outgoing_slice_idx;
+  size_t outgoing_byte_idx;
+  grpc_closure* write_cb;
+  /* referenced by the write in flight: must not move until it completes */
+  struct msghdr write_msg;
+  struct iovec write_iov[MAX_WRITE_IOVEC];
+  grpc_io_uring_op write_op;
+  grpc_closure write_done_closure;
+
+  char* peer_string;
+
+  grpc_resource_user* resource_user;
+  grpc_resource_user_slice_allocator slice_allocator;
+};
+}  // namespace
+
+static grpc_error* tcp_annotate_error(grpc_error* src_error, grpc_tcp* tcp) {
+  return grpc_error_set_str(
+      grpc_error_set_int(src_error, GRPC_ERROR_INT_FD, tcp->fd),
+      GRPC_ERROR_STR_TARGET_ADDRESS,
+      grpc_slice_from_copied_string(tcp->peer_string));
+}
+
+static void tcp_shutdown(grpc_endpoint* ep, grpc_error* why) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  /* shutdown(2) completes any read or write in flight */
+  grpc_fd_shutdown(tcp->em_fd, why);
+  grpc_resource_user_shutdown(tcp->resource_user);
+}
+
+static void tcp_free(grpc_tcp* tcp) {
+  grpc_fd_orphan(tcp->em_fd, nullptr, nullptr, false /* already_closed */,
+                 "tcp_unref_orphan");
+  grpc_resource_user_unref(tcp->resource_user);
+  gpr_free(tcp->peer_string);
+  gpr_free(tcp);
+}
+
+#ifndef NDEBUG
+#define TCP_UNREF(tcp, reason) tcp_unref((tcp), (reason), __FILE__, __LINE__)
+#define TCP_REF(tcp, reason) tcp_ref((tcp), (reason), __FILE__, __LINE__)
+static void tcp_unref(grpc_tcp* tcp, const char* reason, const char* file,
+                      int line) {
+  if (grpc_tcp_trace.enabled()) {
+    gpr_atm val = gpr_atm_no_barrier_load(&tcp->refcount.count);
+    gpr_log(file, line, GPR_LOG_SEVERITY_DEBUG,
+            "TCP unref %p : %s %" PRIdPTR " -> %" PRIdPTR, tcp, reason, val,
+            val - 1);
+  }
+  if (gpr_unref(&tcp->refcount)) {
+    tcp_free(tcp);
+  }
+}
+
+static void tcp_ref(grpc_tcp* tcp, const char* reason, const char* file,
+                    int line) {
+  if (grpc_tcp_trace.enabled()) {
+    gpr_atm val = gpr_atm_no_barrier_load(&tcp->refcount.count);
+    gpr_log(file, line, GPR_LOG_SEVERITY_DEBUG,
+            "TCP   ref %p : %s %" PRIdPTR " -> %" PRIdPTR, tcp, reason, val,
+            val + 1);
+  }
+  gpr_ref(&tcp->refcount);
+}
+#else
+#define TCP_UNREF(tcp, reason) tcp_unref((tcp))
+#define TCP_REF(tcp, reason) tcp_ref((tcp))
+static void tcp_unref(grpc_tcp* tcp) {
+  if (gpr_unref(&tcp->refcount)) {
+    tcp_free(tcp);
+  }
+}
+
+static void tcp_ref(grpc_tcp* tcp) { gpr_ref(&tcp->refcount); }
+#endif
+
+static void tcp_destroy(grpc_endpoint* ep) {
+  grpc_network_status_unregister_endpoint(ep);
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  TCP_UNREF(tcp, "destroy");
+}
+
+static void call_read_cb(grpc_tcp* tcp, grpc_error* error) {
+  grpc_closure* cb = tcp->read_cb;
+
+  if (grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "TCP:%p call_cb %p %p:%p", tcp, cb, cb->cb, cb->cb_arg);
+    size_t i;
+    const char* str = grpc_error_string(error);
+    gpr_log(GPR_DEBUG, "read: error=%s", str);
+
+    for (i = 0; i < tcp->incoming_buffer->count; i++) {
+      char* dump = grpc_dump_slice(tcp->incoming_buffer->slices[i],
+                                   GPR_DUMP_HEX | GPR_DUMP_ASCII);
+      gpr_log(GPR_DEBUG, "READ %p (peer=%s): %s", tcp, tcp->peer_string, dump);
+      gpr_free(dump);
+    }
+  }
+
+  tcp->read_cb = nullptr;
+  tcp->incoming_buffer = nullptr;
+  GRPC_CLOSURE_RUN(cb, error);
+}
+
+/* (Re)submit the read described by read_provided, read_buf and read_len */
+static void tcp_submit_read(grpc_tcp* tcp) {
+  struct io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_RECV;
+  sqe.fd = tcp->fd;
+  if (tcp->read_provided) {
+    /* the kernel caps the length at the size of the buffer it picks */
+    sqe.flags = IOSQE_BUFFER_SELECT;
+    sqe.buf_group = (uint16_t)grpc_io_uring_buffer_group();
+    sqe.len = (uint32_t)tcp->read_chunk_size;
+  } else {
+    sqe.addr = (uint64_t)(uintptr_t)tcp->read_buf;
+    sqe.len = (uint32_t)tcp->read_len;
+  }
+  GRPC_STATS_INC_TCP_READ_OFFER(sqe.len);
+  grpc_io_uring_submit(&sqe, &tcp->read_op);
+}
+
+static void tcp_read_allocation_done(void* tcpp, grpc_error* error) {
+  grpc_tcp* tcp = (grpc_tcp*)tcpp;
+  if (grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "TCP:%p read_allocation_done: %s", tcp,
+            grpc_error_string(error));
+  }
+  if (error != GRPC_ERROR_NONE) {
+    grpc_slice_buffer_reset_and_unref_internal(tcp->incoming_buffer);
+    call_read_cb(tcp, GRPC_ERROR_REF(error));
+    TCP_UNREF(tcp, "read");
+  } else {
+    GPR_ASSERT(tcp->incoming_buffer->count == 1);
+    tcp->read_buf = GRPC_SLICE_START_PTR(tcp->incoming_buffer->slices[0]);
+    tcp->read_len = GRPC_SLICE_LENGTH(tcp->incoming_buffer->slices[0]);
+    tcp_submit_read(tcp);
+  }
+}
+
+static void tcp_start_read_into_slice(grpc_tcp* tcp) {
+  tcp->read_provided = false;
+  grpc_resource_user_alloc_slices(&tcp->slice_allocator,
+                                  (size_t)tcp->read_chunk_size, 1,
+                                  tcp->incoming_buffer);
+}
+
+/* A read waits for data without holding any memory: the kernel picks one of
+   the engine's provided buffers once data arrives. Only when none is left (eg.
+   when the transport holds on to many earlier reads), or the kernel cannot
+   provide buffers at all, does the read go into a slice allocated up front. */
+static void tcp_start_read(grpc_tcp* tcp) {
+  if (grpc_io_uring_buffer_group() >= 0) {
+    tcp->read_provided = true;
+    tcp_submit_read(tcp);
+  } else {
+    tcp_start_read_into_slice(tcp);
+  }
+}
+
+static void tcp_handle_read(void* arg /* grpc_tcp */, grpc_error* error) {
+  GPR_TIMER_SCOPE("tcp_handle_read", 0);
+  grpc_tcp* tcp = (grpc_tcp*)arg;
+  int32_t res = tcp->read_op.res;
+  if (grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "TCP:%p got_read: %d", tcp, res);
+  }
+
+  if (res == -EINTR || res == -EAGAIN) {
+    tcp_submit_read(tcp);
+    return;
+  }
+  if (res == -ENOBUFS && tcp->read_provided) {
+    GRPC_STATS_INC_TCP_READ_PROVIDED_BUFFER_EXHAUSTED();
+    tcp_start_read_into_slice(tcp);
+    return;
+  }
+  if (res > 0) {
+    GRPC_STATS_INC_TCP_READ_SIZE(res);
+    if (tcp->read_provided) {
+      /* the buffer the kernel picked is charged to this endpoint for as long
+         as the transport holds on to it */
+      GRPC_STATS_INC_TCP_READ_PROVIDED_BUFFER();
+      grpc_resource_user_alloc(tcp->resource_user,
+                               grpc_io_uring_provided_buffer_size(),
+                               &tcp->read_charged_closure);
+      return;
+    } else if ((size_t)res < tcp->incoming_buffer->length) {
+      grpc_slice_buffer garbage;
+      grpc_slice_buffer_init(&garbage);
+      grpc_slice_buffer_trim_end(tcp->incoming_buffer,
+                                 tcp->incoming_buffer->length - (size_t)res,
+                                 &garbage);
+      grpc_slice_buffer_destroy_internal(&garbage);
+    }
+    call_read_cb(tcp, GRPC_ERROR_NONE);
+  } else {
+    if (tcp->read_provided && (tcp->read_op.flags & IORING_CQE_F_BUFFER)) {
+      /* end of stream may still have consumed a buffer: give it back */
+      grpc_slice_unref_internal(
+          grpc_io_uring_provided_buffer_slice(tcp->read_op.flags, 0, nullptr));
+    }
+    grpc_slice_buffer_reset_and_unref_internal(tcp->incoming_buffer);
+    /* 0 read size ==> end of stream */
+    call_read_cb(
+        tcp, tcp_annotate_error(
+                 res == 0
+                     ? GRPC_ERROR_CREATE_FROM_STATIC_STRING("Socket closed")
+                     : GRPC_OS_ERROR(-res, "recv"),
+                 tcp));
+  }
+  TCP_UNREF(tcp, "read");
+}
+
+static void tcp_read_charged(void* arg /* grpc_tcp */, grpc_error* error) {
+  grpc_tcp* tcp = (grpc_tcp*)arg;
+  if (error != GRPC_ERROR_NONE) {
+    /* the resource user was shut down: the charge was never made */
+    grpc_slice_unref_internal(grpc_io_uring_provided_buffer_slice(
+        tcp->read_op.flags, 0, nullptr));
+    call_read_cb(tcp, GRPC_ERROR_REF(error));
+  } else {
+    grpc_slice_buffer_add(
+        tcp->incoming_buffer,
+        grpc_io_uring_provided_buffer_slice(
+            tcp->read_op.flags, (size_t)tcp->read_op.res, tcp->resource_user));
+    call_read_cb(tcp, GRPC_ERROR_NONE);
+  }
+  TCP_UNREF(tcp, "read");
+}
+
+static void tcp_read(grpc_endpoint* ep, grpc_slice_buffer* incoming_buffer,
+                     grpc_closure* cb) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  GPR_ASSERT(tcp->read_cb == nullptr);
+  tcp->read_cb = cb;
+  tcp->incoming_buffer = incoming_buffer;
+  grpc_slice_buffer_reset_and_unref_internal(incoming_buffer);
+  TCP_REF(tcp, "read");
+  tcp_start_read(tcp);
+}
+
+/* Move past sent bytes of outgoing_buffer (and any empty slices) */
+static void tcp_advance_outgoing(grpc_tcp* tcp, size_t sent) {
+  grpc_slice_buffer* buf = tcp->outgoing_buffer;
+  while (tcp->outgoing_slice_idx < buf->count) {
+    size_t remaining =
+        GRPC_SLICE_LENGTH(buf->slices[tcp->outgoing_slice_idx]) -
+        tcp->outgoing_byte_idx;
+    if (sent < remaining) {
+      tcp->outgoing_byte_idx += sent;
+      return;
+    }
+    sent -= remaining;
+    tcp->outgoing_slice_idx++;
+    tcp->outgoing_byte_idx = 0;
+  }
+  GPR_ASSERT(sent == 0);
+}
+
+static void tcp_submit_write(grpc_tcp* tcp) {
+  grpc_slice_buffer* buf = tcp->outgoing_buffer;
+  size_t iov_size = 0;
+  size_t sending_length = 0;
+  for (size_t i = tcp->outgoing_slice_idx;
+       i < buf->count && iov_size != MAX_WRITE_IOVEC; i++) {
+    size_t offset = i == tcp->outgoing_slice_idx ? tcp->outgoing_byte_idx : 0;
+    size_t length = GRPC_SLICE_LENGTH(buf->slices[i]) - offset;
+    if (length == 0) continue;
+    tcp->write_iov[iov_size].iov_base =
+        GRPC_SLICE_START_PTR(buf->slices[i]) + offset;
+    tcp->write_iov[iov_size].iov_len = length;
+    sending_length += length;
+    iov_size++;
+  }
+  memset(&tcp->write_msg, 0, sizeof(tcp->write_msg));
+  tcp->write_msg.msg_iov = tcp->write_iov;
+  tcp->write_msg.msg_iovlen = iov_size;
+
+  GRPC_STATS_INC_TCP_WRITE_SIZE(sending_length);
+  GRPC_STATS_INC_TCP_WRITE_IOV_SIZE(iov_size);
+
+  struct io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_SENDMSG;
+  sqe.fd = tcp->fd;
+  sqe.addr = (uint64_t)(uintptr_t)&tcp->write_msg;
+  sqe.len = 1;
+  sqe.msg_flags = SENDMSG_FLAGS;
+  grpc_io_uring_submit(&sqe, &tcp->write_op);
+}
+
+static void tcp_handle_write(void* arg /* grpc_tcp */, grpc_error* error) {
+  GPR_TIMER_SCOPE("tcp_handle_write", 0);
+  grpc_tcp* tcp = (grpc_tcp*)arg;
+  int32_t res = tcp->write_op.res;
+
+  if (res == -EINTR || res == -EAGAIN) {
+    tcp_submit_write(tcp);
+    return;
+  }
+  if (res >= 0) {
+    tcp_advance_outgoing(tcp, (size_t)res);
+    if (tcp->outgoing_slice_idx != tcp->outgoing_buffer->count) {
+      if (grpc_tcp_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "write: delayed");
+      }
+      tcp_submit_write(tcp);
+      return;
+    }
+  } else {
+    error = tcp_annotate_error(GRPC_OS_ERROR(-res, "sendmsg"), tcp);
+  }
+
+  grpc_closure* cb = tcp->write_cb;
+  tcp->write_cb = nullptr;
+  tcp->outgoing_buffer = nullptr;
+  if (grpc_tcp_trace.enabled()) {
+    const char* str = grpc_error_string(error);
+    gpr_log(GPR_DEBUG, "write: %s", str);
+  }
+  GRPC_CLOSURE_RUN(cb, error);
+  TCP_UNREF(tcp, "write");
+}
+
+static void tcp_write(grpc_endpoint* ep, grpc_slice_buffer* buf,
+                      grpc_closure* cb) {
+  GPR_TIMER_SCOPE("tcp_write", 0);
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+
+  if (grpc_tcp_trace.enabled()) {
+    size_t i;
+
+    for (i = 0; i < buf->count; i++) {
+      char* data =
+          grpc_dump_slice(buf->slices[i], GPR_DUMP_HEX | GPR_DUMP_ASCII);
+      gpr_log(GPR_DEBUG, "WRITE %p (peer=%s): %s", tcp, tcp->peer_string, data);
+      gpr_free(data);
+    }
+  }
+
+  GPR_ASSERT(tcp->write_cb == nullptr);
+
+  if (buf->length == 0) {
+    GRPC_CLOSURE_SCHED(
+        cb, grpc_fd_is_shutdown(tcp->em_fd)
+                ? tcp_annotate_error(
+                      GRPC_ERROR_CREATE_FROM_STATIC_STRING("EOF"), tcp)
+                : GRPC_ERROR_NONE);
+    return;
+  }
+  tcp->outgoing_buffer = buf;
+  tcp->outgoing_slice_idx = 0;
+  tcp->outgoing_byte_idx = 0;
+  tcp_advance_outgoing(tcp, 0);
+  tcp->write_cb = cb;
+  TCP_REF(tcp, "write");
+  tcp_submit_write(tcp);
+}
+
+static void tcp_add_to_pollset(grpc_endpoint* ep, grpc_pollset* pollset) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  grpc_pollset_add_fd(pollset, tcp->em_fd);
+}
+
+static void tcp_add_to_pollset_set(grpc_endpoint* ep,
+                                   grpc_pollset_set* pollset_set) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  grpc_pollset_set_add_fd(pollset_set, tcp->em_fd);
+}
+
+static void tcp_delete_from_pollset_set(grpc_endpoint* ep,
+                                        grpc_pollset_set* pollset_set) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  grpc_pollset_set_del_fd(pollset_set, tcp->em_fd);
+}
+
+static char* tcp_get_peer(grpc_endpoint* ep) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  return gpr_strdup(tcp->peer_string);
+}
+
+static int tcp_get_fd(grpc_endpoint* ep) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  return tcp->fd;
+}
+
+static grpc_resource_user* tcp_get_resource_user(grpc_endpoint* ep) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  return tcp->resource_user;
+}
+
+static bool tcp_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer) {
+  return false;
+}
+
+static const grpc_endpoint_vtable vtable = {tcp_read,
+                                            tcp_write,
+                                            tcp_add_to_pollset,
+                                            tcp_add_to_pollset_set,
+                                            tcp_delete_from_pollset_set,
+                                            tcp_shutdown,
+                                            tcp_destroy,
+                                            tcp_get_resource_user,
+                                            tcp_get_peer,
+                                            tcp_get_fd,
+                                            tcp_set_tracer};
+
+#define MAX_CHUNK_SIZE 32 * 1024 * 1024
+
+grpc_endpoint* grpc_tcp_io_uring_create(grpc_fd* em_fd,
+                                        const grpc_channel_args* channel_args,
+                                        const char* peer_string) {
+  if (!grpc_io_uring_active()) {
+    return nullptr;
+  }
+  int tcp_read_chunk_size = GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
+  grpc_resource_quota* resource_quota = grpc_resource_quota_create(nullptr);
+  if (channel_args != nullptr) {
+    for (size_t i = 0; i < channel_args->num_args; i++) {
+      if (0 ==
+          strcmp(channel_args->args[i].key, GRPC_ARG_TCP_READ_CHUNK_SIZE)) {
+        grpc_integer_options options = {(int)tcp_read_chunk_size, 1,
+                                        MAX_CHUNK_SIZE};
+        tcp_read_chunk_size =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 ==
+                 strcmp(channel_args->args[i].key, GRPC_ARG_RESOURCE_QUOTA)) {
+        grpc_resource_quota_unref_internal(resource_quota);
+        resource_quota = grpc_resource_quota_ref_internal(
+            (grpc_resource_quota*)channel_args->args[i].value.pointer.p);
+      }
+    }
+  }
+
+  grpc_tcp* tcp = (grpc_tcp*)gpr_malloc(sizeof(grpc_tcp));
+  tcp->base.vtable = &vtable;
+  tcp->peer_string = gpr_strdup(peer_string);
+  tcp->fd = grpc_fd_wrapped_fd(em_fd);
+  tcp->em_fd = em_fd;
+  tcp->read_chunk_size = tcp_read_chunk_size;
+  tcp->read_cb = nullptr;
+  tcp->write_cb = nullptr;
+  tcp->incoming_buffer = nullptr;
+  tcp->outgoing_buffer = nullptr;
+  tcp->read_op.on_done = GRPC_CLOSURE_INIT(
+      &tcp->read_done_closure, tcp_handle_read, tcp, grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&tcp->read_charged_closure, tcp_read_charged, tcp,
+                    grpc_schedule_on_exec_ctx);
+  tcp->write_op.on_done =
+      GRPC_CLOSURE_INIT(&tcp->write_done_closure, tcp_handle_write, tcp,
+                        grpc_schedule_on_exec_ctx);
+  /* paired with unref in tcp_destroy */
+  gpr_ref_init(&tcp->refcount, 1);
+  tcp->resource_user = grpc_resource_user_create(resource_quota, peer_string);
+  grpc_resource_user_slice_allocator_init(
+      &tcp->slice_allocator, tcp->resource_user, tcp_read_allocation_done, tcp);
+  /* Tell network status tracker about new endpoint */
+  grpc_network_status_register_endpoint(&tcp->base);
+  grpc_resource_quota_unref_internal(resource_quota);
+
+  return &tcp->base;
+}
+
+#else /* defined(GRPC_LINUX_IO_URING) */
+#ifdef GRPC_POSIX_SOCKET
+#include "src/core/lib/iomgr/tcp_io_uring_linux.h"
+
+/* Without io_uring there is never an engine to submit to */
+grpc_endpoint* grpc_tcp_io_uring_create(grpc_fd* em_fd,
+                                        const grpc_channel_args* channel_args,
+                                        const char* peer_string) {
+  return nullptr;
+}
+#endif /* defined(GRPC_POSIX_SOCKET) */
+#endif /* !defined(GRPC_LINUX_IO_URING) */
@@ -0,0 +1,38 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_TCP_IO_URING_LINUX_H
+#define GRPC_CORE_LIB_IOMGR_TCP_IO_URING_LINUX_H
+/*
+   TCP endpoint that hands its socket reads and writes to the io_uring polling
+   engine as asynchronous operations, rather than waiting for readiness and
+   then issuing recvmsg/sendmsg itself (see tcp_posix.h). Reads go into buffers
+   registered with the ring, which are passed up as slices without a copy.
+*/
+
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+
+/* Create an io_uring tcp endpoint. Returns nullptr, leaving fd untouched, if
+   the io_uring polling engine is not in use; otherwise takes ownership of
+   fd. */
+grpc_endpoint* grpc_tcp_io_uring_create(grpc_fd* fd,
+                                        const grpc_channel_args* args,
+                                        const char* peer_string);
+
+#endif /* GRPC_CORE_LIB_IOMGR_TCP_IO_URING_LINUX_H */
@@ -24,9 +24,12 @@
 #include "src/core/lib/iomgr/tcp_posix.h"
 
 #include <errno.h>
+#include <limits.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -45,10 +48,46 @@
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/iomgr/ev_posix.h"
 #include "src/core/lib/iomgr/executor.h"
+#include "src/core/lib/iomgr/socket_utils_posix.h"
+#include "src/core/lib/iomgr/tcp_io_uring_linux.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 
+#ifdef GRPC_HAVE_TCP_INQ
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#ifndef TCP_INQ
+#define TCP_INQ 36
+#define TCP_CM_INQ TCP_INQ
+#endif
+#endif
+
+#ifdef GRPC_LINUX_ERRQUEUE
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include <netinet/in.h>
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
+#ifndef SO_EE_ORIGIN_TIMESTAMPING
+#define SO_EE_ORIGIN_TIMESTAMPING 4
+#endif
+#define ZEROCOPY_SENDMSG_FLAGS MSG_ZEROCOPY
+#else
+#define ZEROCOPY_SENDMSG_FLAGS 0
+#endif
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -64,19 +103,49 @@ typedef size_t msg_iovlen_type;
 grpc_core::TraceFlag grpc_tcp_trace(false, "tcp");
 
 namespace {
+/* The slices backing one MSG_ZEROCOPY sendmsg: they must stay alive (and
+   unmodified) until the kernel reports the send complete on the socket error
+   queue. Records are completed by sequence number, which the kernel assigns
+   per successful zerocopy sendmsg, starting at zero. */
+struct zerocopy_send_record {
+  bool done;
+  grpc_slice_buffer slices;
+};
+
+/* A write whose last byte the kernel was asked to timestamp. The kernel
+   identifies it by key: the count of bytes sent before that byte since
+   SO_TIMESTAMPING was enabled. */
+struct timestamped_write {
+  uint32_t key;
+  /* the write's number for the tracer (0 if none was set) */
+  uint64_t seq;
+  gpr_timespec sent_at;
+};
+
+#define MAX_TIMESTAMPED_WRITES 64
+
 struct grpc_tcp {
   grpc_endpoint base;
   grpc_fd* em_fd;
   int fd;
   bool finished_edge;
-  double target_length;
-  double bytes_read_this_round;
   gpr_refcount refcount;
   gpr_atm shutdown_count;
 
+  /* read buffers are sized to the bytes the kernel reports pending, clamped
+     to [min_read_chunk_size, max_read_chunk_size]; read_chunk_size is used
+     when the kernel cannot tell */
+  int read_chunk_size;
   int min_read_chunk_size;
   int max_read_chunk_size;
 
+  /* TCP_INQ is enabled: each recvmsg reports the bytes still queued in the
+     socket after it returns, saving an ioctl(FIONREAD) per read */
+  bool inq_capable;
+  /* bytes left in the socket after the last read, as reported by TCP_INQ
+     (-1 if unknown) */
+  int inq;
+
   /* garbage after the last read */
   grpc_slice_buffer last_read_buffer;
 
@@ -84,6 +153,9 @@ struct grpc_tcp {
   grpc_slice_buffer* outgoing_buffer;
   /** byte within outgoing_buffer->slices[0] to write next */
   size_t outgoing_byte_idx;
+  /* TCP_NOTSENT_LOWAT is set to this many bytes, and writes complete only
+     once the socket is writable again (0 if not pacing writes) */
+  int notsent_lowat;
 
   grpc_closure* read_cb;
   grpc_closure* write_cb;
@@ -97,6 +169,42 @@ struct grpc_tcp {
 
   grpc_resource_user* resource_user;
   grpc_resource_user_slice_allocator slice_allocator;
+
+  /* MSG_ZEROCOPY state: only used if zerocopy_enabled */
+  bool zerocopy_enabled;
+  size_t zerocopy_threshold;
+  /* slices referenced by the sendmsg currently being attempted */
+  grpc_slice_buffer zerocopy_pending;
+  /* protects the ring of outstanding sends below, which is appended to by the
+     writer and drained by whoever processes the error queue */
+  gpr_mu zerocopy_mu;
+  zerocopy_send_record* zerocopy_records;
+  size_t zerocopy_max_records;
+  size_t zerocopy_head;
+  size_t zerocopy_count;
+  /* sequence number of zerocopy_records[zerocopy_head] */
+  uint32_t zerocopy_head_seq;
+  /* once the endpoint is gone, checks the error queue until the kernel has
+     completed every outstanding send */
+  grpc_timer zerocopy_drain_timer;
+  grpc_closure zerocopy_drain_closure;
+
+  /* SO_TIMESTAMPING state: only used if timestamping_enabled */
+  bool timestamping_enabled;
+  /* bytes sent since SO_TIMESTAMPING was enabled, modulo 2^32 */
+  uint32_t bytes_sent;
+  /* writes made since the tracer was set */
+  uint64_t write_seq;
+  /* protects the tracer and the ring of timestamped writes below, which is
+     appended to by the writer and drained by whoever processes the error
+     queue. The tracer is called with it held, so that tcp_destroy() cannot
+     return while a callback is still running: it comes before any lock the
+     tracer takes */
+  gpr_mu timestamps_mu;
+  grpc_endpoint_tracer* tracer;
+  timestamped_write timestamped_writes[MAX_TIMESTAMPED_WRITES];
+  size_t timestamped_head;
+  size_t timestamped_count;
 };
 
 struct backup_poller {
@@ -234,33 +342,30 @@ static void tcp_drop_uncovered_then_handle_write(void* arg, grpc_error* error) {
   tcp_handle_write(arg, error);
 }
 
-static void add_to_estimate(grpc_tcp* tcp, size_t bytes) {
-  tcp->bytes_read_this_round += (double)bytes;
-}
-
-static void finish_estimate(grpc_tcp* tcp) {
-  /* If we read >80% of the target buffer in one read loop, increase the size
-     of the target buffer to either the amount read, or twice its previous
-     value */
-  if (tcp->bytes_read_this_round > tcp->target_length * 0.8) {
-    tcp->target_length =
-        GPR_MAX(2 * tcp->target_length, tcp->bytes_read_this_round);
-  } else {
-    tcp->target_length =
-        0.99 * tcp->target_length + 0.01 * tcp->bytes_read_this_round;
+/* Ask the kernel how many bytes are waiting to be read: the TCP_INQ value
+   returned with the previous read if there is one, otherwise FIONREAD.
+   Returns -1 if the kernel cannot tell. */
+static int get_pending_read_bytes(grpc_tcp* tcp) {
+  if (tcp->inq_capable && tcp->inq > 0) {
+    return tcp->inq;
+  }
+  int pending;
+  if (ioctl(tcp->fd, FIONREAD, &pending) != 0) {
+    return -1;
   }
-  tcp->bytes_read_this_round = 0;
+  return pending;
 }
 
 static size_t get_target_read_size(grpc_tcp* tcp) {
   grpc_resource_quota* rq = grpc_resource_user_quota(tcp->resource_user);
   double pressure = grpc_resource_quota_get_memory_pressure(rq);
-  double target =
-      tcp->target_length * (pressure > 0.8 ? (1.0 - pressure) / 0.2 : 1.0);
-  size_t sz = (((size_t)GPR_CLAMP(target, tcp->min_read_chunk_size,
-                                  tcp->max_read_chunk_size)) +
-               255) &
-              ~(size_t)255;
+  int pending = get_pending_read_bytes(tcp);
+  double target = pending < 0 ? tcp->read_chunk_size : pending;
+  if (pressure > 0.8) {
+    target *= (1.0 - pressure) / 0.2;
+  }
+  size_t sz = (size_t)GPR_CLAMP(target, tcp->min_read_chunk_size,
+                                tcp->max_read_chunk_size);
   /* don't use more than 1/16th of the overall resource quota for a single read
    * alloc */
   size_t rqmax = grpc_resource_quota_peek_size(rq);
@@ -281,6 +386,221 @@ static grpc_error* tcp_annotate_error(grpc_error* src_error, grpc_tcp* tcp) {
       grpc_slice_from_copied_string(tcp->peer_string));
 }
 
+/* Mark sends [lo, hi] complete, and release the slices of every completed
+   send at the head of the ring. Must be called with zerocopy_mu held. */
+static void zerocopy_complete_locked(grpc_tcp* tcp, uint32_t lo, uint32_t hi) {
+  uint32_t first = lo - tcp->zerocopy_head_seq;
+  uint32_t last = hi - tcp->zerocopy_head_seq;
+  for (uint32_t i = first; i <= last && i < tcp->zerocopy_count; i++) {
+    tcp->zerocopy_records[(tcp->zerocopy_head + i) % tcp->zerocopy_max_records]
+        .done = true;
+  }
+  while (tcp->zerocopy_count > 0 &&
+         tcp->zerocopy_records[tcp->zerocopy_head].done) {
+    zerocopy_send_record* r = &tcp->zerocopy_records[tcp->zerocopy_head];
+    grpc_slice_buffer_reset_and_unref_internal(&r->slices);
+    r->done = false;
+    tcp->zerocopy_head = (tcp->zerocopy_head + 1) % tcp->zerocopy_max_records;
+    tcp->zerocopy_head_seq++;
+    tcp->zerocopy_count--;
+  }
+}
+
+static int64_t timespec_diff_us(gpr_timespec a, gpr_timespec b) {
+  gpr_timespec d = gpr_time_sub(a, b);
+  return (int64_t)d.tv_sec * GPR_US_PER_SEC + d.tv_nsec / GPR_NS_PER_US;
+}
+
+/* Remember the write just completed as timestamped, with its last byte sent
+   before tcp->bytes_sent */
+static void timestamps_record_write(grpc_tcp* tcp) {
+  gpr_mu_lock(&tcp->timestamps_mu);
+  if (tcp->timestamped_count == MAX_TIMESTAMPED_WRITES) {
+    /* the oldest write's timestamps are overdue: stop waiting for them */
+    tcp->timestamped_head =
+        (tcp->timestamped_head + 1) % MAX_TIMESTAMPED_WRITES;
+    tcp->timestamped_count--;
+  }
+  timestamped_write* w =
+      &tcp->timestamped_writes[(tcp->timestamped_head +
+                                tcp->timestamped_count) %
+                               MAX_TIMESTAMPED_WRITES];
+  w->key = tcp->bytes_sent - 1;
+  w->seq = tcp->tracer != nullptr ? tcp->write_seq : 0;
+  w->sent_at = gpr_now(GPR_CLOCK_REALTIME);
+  tcp->timestamped_count++;
+  gpr_mu_unlock(&tcp->timestamps_mu);
+}
+
+/* The last byte of the timestamped write identified by key reached stage at
+   ts: record it and tell the tracer */
+static void timestamps_process(grpc_tcp* tcp, uint32_t key,
+                               grpc_endpoint_write_stage stage,
+                               gpr_timespec ts) {
+  gpr_mu_lock(&tcp->timestamps_mu);
+  for (size_t i = 0; i < tcp->timestamped_count; i++) {
+    timestamped_write* w =
+        &tcp->timestamped_writes[(tcp->timestamped_head + i) %
+                                 MAX_TIMESTAMPED_WRITES];
+    if (w->key != key) continue;
+    int64_t delay_us = GPR_MAX(0, timespec_diff_us(ts, w->sent_at));
+    switch (stage) {
+      case GRPC_ENDPOINT_WRITE_SCHEDULED:
+        GRPC_STATS_INC_TCP_WRITE_SCHEDULED_US(delay_us);
+        break;
+      case GRPC_ENDPOINT_WRITE_SENT:
+        GRPC_STATS_INC_TCP_WRITE_SENT_US(delay_us);
+        break;
+      case GRPC_ENDPOINT_WRITE_ACKED:
+        GRPC_STATS_INC_TCP_WRITE_ACKED_US(delay_us);
+        break;
+    }
+    if (tcp->tracer != nullptr && w->seq != 0) {
+      tcp->tracer->vtable->on_write(tcp->tracer, w->seq, stage, ts);
+    }
+    if (stage == GRPC_ENDPOINT_WRITE_ACKED) {
+      /* acks are cumulative: this write and any before it are done */
+      tcp->timestamped_head =
+          (tcp->timestamped_head + i + 1) % MAX_TIMESTAMPED_WRITES;
+      tcp->timestamped_count -= i + 1;
+    }
+    break;
+  }
+  gpr_mu_unlock(&tcp->timestamps_mu);
+}
+
+/* Drain the socket error queue of MSG_ZEROCOPY completion notifications and
+   transmit timestamps. Returns true if any notification was read. */
+static bool tcp_process_errors(grpc_tcp* tcp) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  bool processed = false;
+  for (;;) {
+    struct msghdr msg;
+    union {
+      char rbuf[CMSG_SPACE(sizeof(struct scm_timestamping)) +
+                CMSG_SPACE(sizeof(struct sock_extended_err) +
+                           sizeof(struct sockaddr_in6))];
+      struct cmsghdr align;
+    } control;
+    msg.msg_name = nullptr;
+    msg.msg_namelen = 0;
+    msg.msg_iov = nullptr;
+    msg.msg_iovlen = 0;
+    msg.msg_control = control.rbuf;
+    msg.msg_controllen = sizeof(control.rbuf);
+    msg.msg_flags = 0;
+
+    int r;
+    do {
+      r = recvmsg(tcp->fd, &msg, MSG_ERRQUEUE);
+    } while (r < 0 && errno == EINTR);
+    if (r < 0) {
+      /* EAGAIN: the error queue is empty */
+      return processed;
+    }
+    if (grpc_tcp_trace.enabled() && (msg.msg_flags & MSG_CTRUNC) != 0) {
+      gpr_log(GPR_DEBUG, "TCP:%p error queue control message truncated", tcp);
+    }
+    /* a timestamp arrives as SCM_TIMESTAMPING followed by the error
+       identifying the write it belongs to */
+    const struct scm_timestamping* tss = nullptr;
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+      if (cmsg->cmsg_level == SOL_SOCKET &&
+          cmsg->cmsg_type == SCM_TIMESTAMPING) {
+        tss = (const struct scm_timestamping*)CMSG_DATA(cmsg);
+        continue;
+      }
+      if (!((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+            (cmsg->cmsg_level == SOL_IPV6 &&
+             cmsg->cmsg_type == IPV6_RECVERR))) {
+        continue;
+      }
+      const struct sock_extended_err* serr =
+          (const struct sock_extended_err*)CMSG_DATA(cmsg);
+      if (serr->ee_errno == ENOMSG &&
+          serr->ee_origin == SO_EE_ORIGIN_TIMESTAMPING && tss != nullptr) {
+        gpr_timespec ts = {tss->ts[0].tv_sec, (int32_t)tss->ts[0].tv_nsec,
+                           GPR_CLOCK_REALTIME};
+        switch (serr->ee_info) {
+          case SCM_TSTAMP_SCHED:
+            timestamps_process(tcp, serr->ee_data,
+                               GRPC_ENDPOINT_WRITE_SCHEDULED, ts);
+            break;
+          case SCM_TSTAMP_SND:
+            timestamps_process(tcp, serr->ee_data, GRPC_ENDPOINT_WRITE_SENT,
+                               ts);
+            break;
+          case SCM_TSTAMP_ACK:
+            timestamps_process(tcp, serr->ee_data, GRPC_ENDPOINT_WRITE_ACKED,
+                               ts);
+            break;
+        }
+        tss = nullptr;
+        processed = true;
+        continue;
+      }
+      if (serr->ee_errno != 0 || serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+        continue;
+      }
+      if (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) {
+        GRPC_STATS_INC_TCP_WRITE_ZEROCOPY_COPIED();
+      }
+      if (grpc_tcp_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "TCP:%p zerocopy sends %u..%u complete", tcp,
+                serr->ee_info, serr->ee_data);
+      }
+      gpr_mu_lock(&tcp->zerocopy_mu);
+      zerocopy_complete_locked(tcp, serr->ee_info, serr->ee_data);
+      gpr_mu_unlock(&tcp->zerocopy_mu);
+      processed = true;
+    }
+  }
+#else
+  return false;
+#endif
+}
+
+/* Returns true if there is room to track one more zerocopy send */
+static bool zerocopy_reserve(grpc_tcp* tcp) {
+  gpr_mu_lock(&tcp->zerocopy_mu);
+  bool ok = tcp->zerocopy_count < tcp->zerocopy_max_records;
+  gpr_mu_unlock(&tcp->zerocopy_mu);
+  if (!ok && tcp_process_errors(tcp)) {
+    gpr_mu_lock(&tcp->zerocopy_mu);
+    ok = tcp->zerocopy_count < tcp->zerocopy_max_records;
+    gpr_mu_unlock(&tcp->zerocopy_mu);
+  }
+  return ok;
+}
+
+/* Take ownership of tcp->zerocopy_pending as the record of the send just
+   made */
+static void zerocopy_commit(grpc_tcp* tcp) {
+  gpr_mu_lock(&tcp->zerocopy_mu);
+  GPR_ASSERT(tcp->zerocopy_count < tcp->zerocopy_max_records);
+  zerocopy_send_record* r =
+      &tcp->zerocopy_records[(tcp->zerocopy_head + tcp->zerocopy_count) %
+                             tcp->zerocopy_max_records];
+  grpc_slice_buffer_swap(&r->slices, &tcp->zerocopy_pending);
+  r->done = false;
+  tcp->zerocopy_count++;
+  gpr_mu_unlock(&tcp->zerocopy_mu);
+}
+
+/* How often an endpoint freed with zerocopy sends outstanding checks for
+   their completion */
+#define ZEROCOPY_DRAIN_INTERVAL_MS 100
+
+/* Returns true if the kernel has completed every zerocopy send */
+static bool zerocopy_drained(grpc_tcp* tcp) {
+  tcp_process_errors(tcp);
+  gpr_mu_lock(&tcp->zerocopy_mu);
+  bool drained = tcp->zerocopy_count == 0;
+  gpr_mu_unlock(&tcp->zerocopy_mu);
+  return drained;
+}
+
 static void tcp_handle_read(void* arg /* grpc_tcp */, grpc_error* error);
 static void tcp_handle_write(void* arg /* grpc_tcp */, grpc_error* error);
 
@@ -290,7 +610,18 @@ static void tcp_shutdown(grpc_endpoint* ep, grpc_error* why) {
   grpc_resource_user_shutdown(tcp->resource_user);
 }
 
-static void tcp_free(grpc_tcp* tcp) {
+static void tcp_free_now(grpc_tcp* tcp) {
+  if (tcp->zerocopy_enabled) {
+    for (size_t i = 0; i < tcp->zerocopy_max_records; i++) {
+      grpc_slice_buffer_destroy_internal(&tcp->zerocopy_records[i].slices);
+    }
+    gpr_free(tcp->zerocopy_records);
+    grpc_slice_buffer_destroy_internal(&tcp->zerocopy_pending);
+    gpr_mu_destroy(&tcp->zerocopy_mu);
+  }
+  if (tcp->timestamping_enabled) {
+    gpr_mu_destroy(&tcp->timestamps_mu);
+  }
   grpc_fd_orphan(tcp->em_fd, tcp->release_fd_cb, tcp->release_fd,
                  false /* already_closed */, "tcp_unref_orphan");
   grpc_slice_buffer_destroy_internal(&tcp->last_read_buffer);
@@ -299,6 +630,41 @@ static void tcp_free(grpc_tcp* tcp) {
   gpr_free(tcp);
 }
 
+static void zerocopy_drain(void* arg, grpc_error* error);
+
+/* The kernel may still be reading from the pages of outstanding zerocopy
+   sends, and reports their completion on the socket's error queue: until it
+   has, keep the socket and the slices open, checking back every
+   ZEROCOPY_DRAIN_INTERVAL_MS. A peer that stops reading holds them for as
+   long as the kernel keeps the connection up. */
+static void tcp_free(grpc_tcp* tcp) {
+  if (tcp->zerocopy_enabled && !zerocopy_drained(tcp)) {
+    if (grpc_tcp_trace.enabled()) {
+      gpr_log(GPR_DEBUG, "TCP:%p waiting for zerocopy sends to complete", tcp);
+    }
+    GRPC_CLOSURE_INIT(&tcp->zerocopy_drain_closure, zerocopy_drain, tcp,
+                      grpc_schedule_on_exec_ctx);
+    grpc_timer_init(
+        &tcp->zerocopy_drain_timer,
+        grpc_core::ExecCtx::Get()->Now() + ZEROCOPY_DRAIN_INTERVAL_MS,
+        &tcp->zerocopy_drain_closure);
+    return;
+  }
+  tcp_free_now(tcp);
+}
+
+static void zerocopy_drain(void* arg, grpc_error* error) {
+  grpc_tcp* tcp = (grpc_tcp*)arg;
+  /* iomgr shutdown cancels timers, or fires them with the clock run out: the
+     process is exiting, so stop waiting and release the slices */
+  if (error != GRPC_ERROR_NONE ||
+      grpc_core::ExecCtx::Get()->Now() == GRPC_MILLIS_INF_FUTURE) {
+    tcp_free_now(tcp);
+    return;
+  }
+  tcp_free(tcp);
+}
+
 #ifndef NDEBUG
 #define TCP_UNREF(tcp, reason) tcp_unref((tcp), (reason), __FILE__, __LINE__)
 #define TCP_REF(tcp, reason) tcp_ref((tcp), (reason), __FILE__, __LINE__)
@@ -340,6 +706,12 @@ static void tcp_ref(grpc_tcp* tcp) { gpr_ref(&tcp->refcount); }
 static void tcp_destroy(grpc_endpoint* ep) {
   grpc_network_status_unregister_endpoint(ep);
   grpc_tcp* tcp = (grpc_tcp*)ep;
+  if (tcp->timestamping_enabled) {
+    /* the tracer may go away with the caller: stop reporting to it */
+    gpr_mu_lock(&tcp->timestamps_mu);
+    tcp->tracer = nullptr;
+    gpr_mu_unlock(&tcp->timestamps_mu);
+  }
   grpc_slice_buffer_reset_and_unref_internal(&tcp->last_read_buffer);
   TCP_UNREF(tcp, "destroy");
 }
@@ -389,6 +761,18 @@ static void tcp_do_read(grpc_tcp* tcp) {
   msg.msg_control = nullptr;
   msg.msg_controllen = 0;
   msg.msg_flags = 0;
+#if defined(GRPC_HAVE_TCP_INQ) || defined(GRPC_LINUX_ERRQUEUE)
+  /* room for TCP_CM_INQ and SCM_TIMESTAMPING (three timespecs) */
+  union {
+    char buf[CMSG_SPACE(sizeof(int)) +
+             CMSG_SPACE(3 * sizeof(struct timespec))];
+    struct cmsghdr align;
+  } cmsgbuf;
+  if (tcp->inq_capable || tcp->timestamping_enabled) {
+    msg.msg_control = cmsgbuf.buf;
+    msg.msg_controllen = sizeof(cmsgbuf.buf);
+  }
+#endif
 
   GRPC_STATS_INC_TCP_READ_OFFER(tcp->incoming_buffer->length);
   GRPC_STATS_INC_TCP_READ_OFFER_IOV_SIZE(tcp->incoming_buffer->count);
@@ -403,7 +787,6 @@ static void tcp_do_read(grpc_tcp* tcp) {
     /* NB: After calling call_read_cb a parallel call of the read handler may
      * be running. */
     if (errno == EAGAIN) {
-      finish_estimate(tcp);
       /* We've consumed the edge, request a new one */
       notify_on_read(tcp);
     } else {
@@ -421,7 +804,47 @@ static void tcp_do_read(grpc_tcp* tcp) {
     TCP_UNREF(tcp, "read");
   } else {
     GRPC_STATS_INC_TCP_READ_SIZE(read_bytes);
-    add_to_estimate(tcp, (size_t)read_bytes);
+#ifdef GRPC_LINUX_ERRQUEUE
+    if (tcp->timestamping_enabled) {
+      for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+           cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET &&
+            cmsg->cmsg_type == SCM_TIMESTAMPING) {
+          struct scm_timestamping tss;
+          memcpy(&tss, CMSG_DATA(cmsg), sizeof(tss));
+          gpr_timespec ts = {tss.ts[0].tv_sec, (int32_t)tss.ts[0].tv_nsec,
+                             GPR_CLOCK_REALTIME};
+          GRPC_STATS_INC_TCP_READ_QUEUED_US(GPR_MAX(
+              0, timespec_diff_us(gpr_now(GPR_CLOCK_REALTIME), ts)));
+          gpr_mu_lock(&tcp->timestamps_mu);
+          if (tcp->tracer != nullptr) {
+            tcp->tracer->vtable->on_read(tcp->tracer, ts);
+          }
+          gpr_mu_unlock(&tcp->timestamps_mu);
+          break;
+        }
+      }
+    }
+#endif
+#ifdef GRPC_HAVE_TCP_INQ
+    if (tcp->inq_capable) {
+      tcp->inq = -1;
+      for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+           cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level == IPPROTO_TCP && cmsg->cmsg_type == TCP_CM_INQ &&
+            cmsg->cmsg_len == CMSG_LEN(sizeof(int))) {
+          memcpy(&tcp->inq, CMSG_DATA(cmsg), sizeof(int));
+          break;
+        }
+      }
+      /* The socket is drained (the kernel reports a pending EOF or error as
+         one byte), so the next read would only return EAGAIN: wait for the
+         next edge instead */
+      if (tcp->inq == 0) {
+        tcp->finished_edge = true;
+      }
+    }
+#endif
     GPR_ASSERT((size_t)read_bytes <= tcp->incoming_buffer->length);
     if ((size_t)read_bytes < tcp->incoming_buffer->length) {
       grpc_slice_buffer_trim_end(
@@ -481,6 +904,10 @@ static void tcp_handle_read(void* arg /* grpc_tcp */, grpc_error* error) {
     call_read_cb(tcp, GRPC_ERROR_REF(error));
     TCP_UNREF(tcp, "read");
   } else {
+    /* zerocopy completions and transmit timestamps also wake up readers */
+    if (tcp->zerocopy_enabled || tcp->timestamping_enabled) {
+      tcp_process_errors(tcp);
+    }
     tcp_continue_read(tcp);
   }
 }
@@ -502,42 +929,137 @@ static void tcp_read(grpc_endpoint* ep, grpc_slice_buffer* incoming_buffer,
   }
 }
 
-/* returns true if done, false if pending; if returning true, *error is set */
 #define MAX_WRITE_IOVEC 1000
+/* Slices this small are copied into a contiguous scratch buffer when several
+   of them are adjacent, so that a run of frame headers, HPACK blocks and short
+   messages takes one iovec entry (and fewer sendmsg calls) rather than one
+   entry each. Larger slices are always sent in place. */
+#define MAX_COALESCED_SLICE_SIZE 256
+#define WRITE_COALESCE_BUFFER_SIZE 8192
+
+/* Fill iov from tcp->outgoing_buffer, starting at slice *slice_idx (and byte
+   tcp->outgoing_byte_idx of it), and advance *slice_idx past the slices
+   covered. Returns the number of iovec entries used and sets *sending_length
+   to the number of bytes they cover. Runs of small slices are coalesced into
+   scratch (at most WRITE_COALESCE_BUFFER_SIZE bytes) unless it is null. */
+static msg_iovlen_type fill_write_iov(grpc_tcp* tcp, struct iovec* iov,
+                                      size_t* slice_idx,
+                                      size_t* sending_length,
+                                      uint8_t* scratch) {
+  grpc_slice_buffer* outgoing = tcp->outgoing_buffer;
+  msg_iovlen_type iov_size = 0;
+  size_t scratch_used = 0;
+  bool in_run = false;
+  *sending_length = 0;
+  while (*slice_idx != outgoing->count && iov_size != MAX_WRITE_IOVEC) {
+    uint8_t* data = GRPC_SLICE_START_PTR(outgoing->slices[*slice_idx]) +
+                    tcp->outgoing_byte_idx;
+    size_t length = GRPC_SLICE_LENGTH(outgoing->slices[*slice_idx]) -
+                    tcp->outgoing_byte_idx;
+    bool coalesce = false;
+    if (scratch != nullptr && length <= MAX_COALESCED_SLICE_SIZE &&
+        scratch_used + length <= WRITE_COALESCE_BUFFER_SIZE) {
+      if (in_run) {
+        coalesce = true;
+      } else if (*slice_idx + 1 != outgoing->count) {
+        /* only start a run if the next slice can join it */
+        size_t next_length =
+            GRPC_SLICE_LENGTH(outgoing->slices[*slice_idx + 1]);
+        coalesce = next_length <= MAX_COALESCED_SLICE_SIZE &&
+                   scratch_used + length + next_length <=
+                       WRITE_COALESCE_BUFFER_SIZE;
+      }
+    }
+    if (coalesce) {
+      memcpy(scratch + scratch_used, data, length);
+      if (in_run) {
+        iov[iov_size - 1].iov_len += length;
+      } else {
+        iov[iov_size].iov_base = scratch + scratch_used;
+        iov[iov_size].iov_len = length;
+        iov_size++;
+        in_run = true;
+      }
+      scratch_used += length;
+    } else {
+      iov[iov_size].iov_base = data;
+      iov[iov_size].iov_len = length;
+      iov_size++;
+      in_run = false;
+    }
+    *sending_length += length;
+    (*slice_idx)++;
+    tcp->outgoing_byte_idx = 0;
+  }
+  return iov_size;
+}
+
+/* returns true if done, false if pending; if returning true, *error is set */
 static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
   struct msghdr msg;
   struct iovec iov[MAX_WRITE_IOVEC];
+  /* sendmsg copies out of this before returning, so one buffer per call is
+     enough */
+  uint8_t scratch[WRITE_COALESCE_BUFFER_SIZE];
   msg_iovlen_type iov_size;
   ssize_t sent_length;
   size_t sending_length;
   size_t trailing;
   size_t unwind_slice_idx;
   size_t unwind_byte_idx;
+  bool zerocopy;
+  bool zerocopy_allowed = true;
+  bool timestamp;
+#ifdef GRPC_LINUX_ERRQUEUE
+  union {
+    char buf[CMSG_SPACE(sizeof(uint32_t))];
+    struct cmsghdr align;
+  } tsbuf;
+#endif
 
   // We always start at zero, because we eagerly unref and trim the slice
   // buffer as we write
   size_t outgoing_slice_idx = 0;
 
   for (;;) {
-    sending_length = 0;
     unwind_slice_idx = outgoing_slice_idx;
     unwind_byte_idx = tcp->outgoing_byte_idx;
-    for (iov_size = 0; outgoing_slice_idx != tcp->outgoing_buffer->count &&
-                       iov_size != MAX_WRITE_IOVEC;
-         iov_size++) {
-      iov[iov_size].iov_base =
-          GRPC_SLICE_START_PTR(
-              tcp->outgoing_buffer->slices[outgoing_slice_idx]) +
-          tcp->outgoing_byte_idx;
-      iov[iov_size].iov_len =
-          GRPC_SLICE_LENGTH(tcp->outgoing_buffer->slices[outgoing_slice_idx]) -
-          tcp->outgoing_byte_idx;
-      sending_length += iov[iov_size].iov_len;
-      outgoing_slice_idx++;
-      tcp->outgoing_byte_idx = 0;
-    }
+    iov_size = fill_write_iov(tcp, iov, &outgoing_slice_idx, &sending_length,
+                              scratch);
     GPR_ASSERT(iov_size > 0);
 
+    zerocopy = zerocopy_allowed && tcp->zerocopy_enabled &&
+               sending_length >= tcp->zerocopy_threshold &&
+               zerocopy_reserve(tcp);
+    if (zerocopy) {
+      /* The kernel reads zerocopy sends after sendmsg returns, by which time
+         the scratch buffer is gone: lay the iovec out over the slices
+         themselves, one entry per slice. */
+      outgoing_slice_idx = unwind_slice_idx;
+      tcp->outgoing_byte_idx = unwind_byte_idx;
+      iov_size = fill_write_iov(tcp, iov, &outgoing_slice_idx, &sending_length,
+                                nullptr);
+      /* Hold a ref to every slice being sent until the kernel is done with
+         it. Inlined slices live in the caller's slice buffer, which may be
+         reused as soon as the write completes, so send from copies of those
+         instead. */
+      for (size_t idx = unwind_slice_idx; idx < outgoing_slice_idx; idx++) {
+        grpc_slice slice = tcp->outgoing_buffer->slices[idx];
+        if (slice.refcount != nullptr) {
+          grpc_slice_buffer_add(&tcp->zerocopy_pending,
+                                grpc_slice_ref_internal(slice));
+        } else {
+          grpc_slice copy = grpc_slice_malloc_large(GRPC_SLICE_LENGTH(slice));
+          memcpy(GRPC_SLICE_START_PTR(copy), GRPC_SLICE_START_PTR(slice),
+                 GRPC_SLICE_LENGTH(slice));
+          iov[idx - unwind_slice_idx].iov_base =
+              GRPC_SLICE_START_PTR(copy) +
+              (idx == unwind_slice_idx ? unwind_byte_idx : 0);
+          grpc_slice_buffer_add(&tcp->zerocopy_pending, copy);
+        }
+      }
+    }
+
     msg.msg_name = nullptr;
     msg.msg_namelen = 0;
     msg.msg_iov = iov;
@@ -546,6 +1068,24 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
     msg.msg_controllen = 0;
     msg.msg_flags = 0;
 
+    /* ask for the last byte of the write to be timestamped */
+    timestamp = tcp->timestamping_enabled &&
+                outgoing_slice_idx == tcp->outgoing_buffer->count;
+#ifdef GRPC_LINUX_ERRQUEUE
+    if (timestamp) {
+      msg.msg_control = tsbuf.buf;
+      msg.msg_controllen = sizeof(tsbuf.buf);
+      struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+      cmsg->cmsg_level = SOL_SOCKET;
+      cmsg->cmsg_type = SO_TIMESTAMPING;
+      cmsg->cmsg_len = CMSG_LEN(sizeof(uint32_t));
+      const uint32_t tsflags = SOF_TIMESTAMPING_TX_SCHED |
+                               SOF_TIMESTAMPING_TX_SOFTWARE |
+                               SOF_TIMESTAMPING_TX_ACK;
+      memcpy(CMSG_DATA(cmsg), &tsflags, sizeof(tsflags));
+    }
+#endif
+
     GRPC_STATS_INC_TCP_WRITE_SIZE(sending_length);
     GRPC_STATS_INC_TCP_WRITE_IOV_SIZE(iov_size);
 
@@ -553,9 +1093,30 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
     do {
       /* TODO(klempner): Cork if this is a partial write */
       GRPC_STATS_INC_SYSCALL_WRITE();
-      sent_length = sendmsg(tcp->fd, &msg, SENDMSG_FLAGS);
+      sent_length = sendmsg(
+          tcp->fd, &msg,
+          SENDMSG_FLAGS | (zerocopy ? ZEROCOPY_SENDMSG_FLAGS : 0));
     } while (sent_length < 0 && errno == EINTR);
 
+    if (zerocopy) {
+      if (sent_length >= 0) {
+        GRPC_STATS_INC_TCP_WRITE_ZEROCOPY();
+        GRPC_STATS_INC_TCP_WRITE_ZEROCOPY_SIZE(sending_length);
+        zerocopy_commit(tcp);
+      } else {
+        grpc_slice_buffer_reset_and_unref_internal(&tcp->zerocopy_pending);
+        if (errno == ENOBUFS) {
+          /* out of socket option memory to pin pages with: send this batch
+             the ordinary way */
+          outgoing_slice_idx = unwind_slice_idx;
+          tcp->outgoing_byte_idx = unwind_byte_idx;
+          zerocopy_allowed = false;
+          continue;
+        }
+      }
+    }
+    zerocopy_allowed = true;
+
     if (sent_length < 0) {
       if (errno == EAGAIN) {
         tcp->outgoing_byte_idx = unwind_byte_idx;
@@ -578,6 +1139,7 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
     }
 
     GPR_ASSERT(tcp->outgoing_byte_idx == 0);
+    tcp->bytes_sent += (uint32_t)sent_length;
     trailing = sending_length - (size_t)sent_length;
     while (trailing > 0) {
       size_t slice_length;
@@ -594,6 +1156,9 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
     }
 
     if (outgoing_slice_idx == tcp->outgoing_buffer->count) {
+      if (timestamp) {
+        timestamps_record_write(tcp);
+      }
       *error = GRPC_ERROR_NONE;
       grpc_slice_buffer_reset_and_unref_internal(tcp->outgoing_buffer);
       return true;
@@ -601,6 +1166,38 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error** error) {
   }
 }
 
+/* With TCP_NOTSENT_LOWAT set, the socket polls writable only while the kernel
+   holds fewer than notsent_lowat unsent bytes. Polling it here also arms the
+   kernel's wakeup for when it drains, which a sendmsg that accepted all of
+   its data does not. */
+static bool tcp_socket_writable(grpc_tcp* tcp) {
+  struct pollfd pfd;
+  int r;
+  pfd.fd = tcp->fd;
+  pfd.events = POLLOUT;
+  pfd.revents = 0;
+  do {
+    r = poll(&pfd, 1, 0);
+  } while (r < 0 && errno == EINTR);
+  /* on error, let the write complete: the next operation reports it */
+  return r != 0;
+}
+
+/* As tcp_flush, but when pacing writes also keep the write pending until the
+   socket is writable again, so that the caller forms its next write only once
+   the kernel can take it */
+static bool tcp_flush_paced(grpc_tcp* tcp, grpc_error** error) {
+  if (tcp->outgoing_buffer->length > 0) {
+    if (!tcp_flush(tcp, error)) return false;
+    if (*error != GRPC_ERROR_NONE) return true;
+  }
+  if (tcp->notsent_lowat > 0 && !tcp_socket_writable(tcp)) {
+    GRPC_STATS_INC_TCP_WRITE_PACED();
+    return false;
+  }
+  return true;
+}
+
 static void tcp_handle_write(void* arg /* grpc_tcp */, grpc_error* error) {
   grpc_tcp* tcp = (grpc_tcp*)arg;
   grpc_closure* cb;
@@ -613,7 +1210,13 @@ static void tcp_handle_write(void* arg /* grpc_tcp */, grpc_error* error) {
     return;
   }
 
-  if (!tcp_flush(tcp, &error)) {
+  /* an error queue notification may be what woke us: drain it so that level
+     triggered pollers do not keep reporting it */
+  if (tcp->zerocopy_enabled || tcp->timestamping_enabled) {
+    tcp_process_errors(tcp);
+  }
+
+  if (!tcp_flush_paced(tcp, &error)) {
     if (grpc_tcp_trace.enabled()) {
       gpr_log(GPR_DEBUG, "write: delayed");
     }
@@ -660,8 +1263,9 @@ static void tcp_write(grpc_endpoint* ep, grpc_slice_buffer* buf,
   }
   tcp->outgoing_buffer = buf;
   tcp->outgoing_byte_idx = 0;
+  tcp->write_seq++;
 
-  if (!tcp_flush(tcp, &error)) {
+  if (!tcp_flush_paced(tcp, &error)) {
     TCP_REF(tcp, "write");
     tcp->write_cb = cb;
     if (grpc_tcp_trace.enabled()) {
@@ -709,6 +1313,16 @@ static grpc_resource_user* tcp_get_resource_user(grpc_endpoint* ep) {
   return tcp->resource_user;
 }
 
+static bool tcp_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer) {
+  grpc_tcp* tcp = (grpc_tcp*)ep;
+  if (!tcp->timestamping_enabled) return false;
+  gpr_mu_lock(&tcp->timestamps_mu);
+  tcp->tracer = tracer;
+  tcp->write_seq = 0;
+  gpr_mu_unlock(&tcp->timestamps_mu);
+  return true;
+}
+
 static const grpc_endpoint_vtable vtable = {tcp_read,
                                             tcp_write,
                                             tcp_add_to_pollset,
@@ -718,7 +1332,8 @@ static const grpc_endpoint_vtable vtable = {tcp_read,
                                             tcp_destroy,
                                             tcp_get_resource_user,
                                             tcp_get_peer,
-                                            tcp_get_fd};
+                                            tcp_get_fd,
+                                            tcp_set_tracer};
 
 #define MAX_CHUNK_SIZE 32 * 1024 * 1024
 
@@ -728,6 +1343,13 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   int tcp_read_chunk_size = GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
   int tcp_max_read_chunk_size = 4 * 1024 * 1024;
   int tcp_min_read_chunk_size = 256;
+  bool tcp_tx_zerocopy_enabled = false;
+  int tcp_tx_zerocopy_send_bytes_threshold = 16 * 1024;
+  int tcp_tx_zerocopy_max_simultaneous_sends = 4;
+  bool tcp_io_uring_enabled = false;
+  int tcp_busy_poll_us = 0;
+  int tcp_notsent_lowat = 0;
+  bool tcp_timestamping_enabled = false;
   grpc_resource_quota* resource_quota = grpc_resource_quota_create(nullptr);
   if (channel_args != nullptr) {
     for (size_t i = 0; i < channel_args->num_args; i++) {
@@ -754,7 +1376,63 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
         grpc_resource_quota_unref_internal(resource_quota);
         resource_quota = grpc_resource_quota_ref_internal(
             (grpc_resource_quota*)channel_args->args[i].value.pointer.p);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) {
+        tcp_tx_zerocopy_enabled = grpc_channel_arg_get_bool(
+            &channel_args->args[i], tcp_tx_zerocopy_enabled);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD)) {
+        grpc_integer_options options = {tcp_tx_zerocopy_send_bytes_threshold,
+                                        0, INT_MAX};
+        tcp_tx_zerocopy_send_bytes_threshold =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULTANEOUS_SENDS)) {
+        grpc_integer_options options = {tcp_tx_zerocopy_max_simultaneous_sends,
+                                        1, 1024};
+        tcp_tx_zerocopy_max_simultaneous_sends =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_IO_URING_ENABLED)) {
+        tcp_io_uring_enabled = grpc_channel_arg_get_bool(
+            &channel_args->args[i], tcp_io_uring_enabled);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_BUSY_POLL_US)) {
+        grpc_integer_options options = {tcp_busy_poll_us, 0, INT_MAX};
+        tcp_busy_poll_us =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_NOTSENT_LOWAT)) {
+        grpc_integer_options options = {tcp_notsent_lowat, 0, INT_MAX};
+        tcp_notsent_lowat =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_TIMESTAMPING)) {
+        tcp_timestamping_enabled = grpc_channel_arg_get_bool(
+            &channel_args->args[i], tcp_timestamping_enabled);
+      }
+    }
+  }
+
+  if (tcp_busy_poll_us > 0) {
+    /* best effort: the kernel may refuse values above net.core.busy_read */
+    grpc_error* err =
+        grpc_set_socket_busy_poll(grpc_fd_wrapped_fd(em_fd), tcp_busy_poll_us);
+    if (err != GRPC_ERROR_NONE) {
+      if (grpc_tcp_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "%s: SO_BUSY_POLL not set: %s", peer_string,
+                grpc_error_string(err));
       }
+      GRPC_ERROR_UNREF(err);
+    }
+  }
+
+  if (tcp_io_uring_enabled) {
+    grpc_endpoint* ep =
+        grpc_tcp_io_uring_create(em_fd, channel_args, peer_string);
+    if (ep != nullptr) {
+      grpc_resource_quota_unref_internal(resource_quota);
+      return ep;
     }
   }
 
@@ -773,10 +1451,34 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   tcp->release_fd_cb = nullptr;
   tcp->release_fd = nullptr;
   tcp->incoming_buffer = nullptr;
-  tcp->target_length = (double)tcp_read_chunk_size;
+  tcp->read_chunk_size = tcp_read_chunk_size;
   tcp->min_read_chunk_size = tcp_min_read_chunk_size;
   tcp->max_read_chunk_size = tcp_max_read_chunk_size;
-  tcp->bytes_read_this_round = 0;
+  tcp->inq_capable = false;
+  tcp->inq = -1;
+  tcp->notsent_lowat = 0;
+  if (tcp_notsent_lowat > 0) {
+    grpc_error* err =
+        grpc_set_socket_notsent_lowat(tcp->fd, tcp_notsent_lowat);
+    if (err == GRPC_ERROR_NONE) {
+      tcp->notsent_lowat = tcp_notsent_lowat;
+    } else {
+      if (grpc_tcp_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "TCP:%p TCP_NOTSENT_LOWAT not set: %s", tcp,
+                grpc_error_string(err));
+      }
+      GRPC_ERROR_UNREF(err);
+    }
+  }
+#ifdef GRPC_HAVE_TCP_INQ
+  const int one = 1;
+  if (setsockopt(tcp->fd, IPPROTO_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
+    tcp->inq_capable = true;
+  } else if (grpc_tcp_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "TCP:%p TCP_INQ unavailable: %s", tcp,
+            strerror(errno));
+  }
+#endif
   tcp->finished_edge = true;
   /* paired with unref in grpc_tcp_destroy */
   gpr_ref_init(&tcp->refcount, 1);
@@ -786,6 +1488,52 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   tcp->resource_user = grpc_resource_user_create(resource_quota, peer_string);
   grpc_resource_user_slice_allocator_init(
       &tcp->slice_allocator, tcp->resource_user, tcp_read_allocation_done, tcp);
+  tcp->zerocopy_enabled = false;
+  if (tcp_tx_zerocopy_enabled) {
+    grpc_error* err = grpc_set_socket_zerocopy(tcp->fd);
+    if (err == GRPC_ERROR_NONE) {
+      tcp->zerocopy_enabled = true;
+      tcp->zerocopy_threshold = (size_t)tcp_tx_zerocopy_send_bytes_threshold;
+      grpc_slice_buffer_init(&tcp->zerocopy_pending);
+      gpr_mu_init(&tcp->zerocopy_mu);
+      tcp->zerocopy_max_records =
+          (size_t)tcp_tx_zerocopy_max_simultaneous_sends;
+      tcp->zerocopy_records = (zerocopy_send_record*)gpr_malloc(
+          sizeof(*tcp->zerocopy_records) * tcp->zerocopy_max_records);
+      for (size_t i = 0; i < tcp->zerocopy_max_records; i++) {
+        tcp->zerocopy_records[i].done = false;
+        grpc_slice_buffer_init(&tcp->zerocopy_records[i].slices);
+      }
+      tcp->zerocopy_head = 0;
+      tcp->zerocopy_count = 0;
+      tcp->zerocopy_head_seq = 0;
+    } else {
+      if (grpc_tcp_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "TCP:%p zerocopy unavailable: %s", tcp,
+                grpc_error_string(err));
+      }
+      GRPC_ERROR_UNREF(err);
+    }
+  }
+  tcp->timestamping_enabled = false;
+  if (tcp_timestamping_enabled) {
+    grpc_error* err = grpc_set_socket_timestamping(tcp->fd);
+    if (err == GRPC_ERROR_NONE) {
+      tcp->timestamping_enabled = true;
+      tcp->bytes_sent = 0;
+      tcp->write_seq = 0;
+      gpr_mu_init(&tcp->timestamps_mu);
+      tcp->tracer = nullptr;
+      tcp->timestamped_head = 0;
+      tcp->timestamped_count = 0;
+    } else {
+      if (grpc_tcp_trace.enabled()) {
+        gpr_log(GPR_DEBUG, "TCP:%p timestamping unavailable: %s", tcp,
+                grpc_error_string(err));
+      }
+      GRPC_ERROR_UNREF(err);
+    }
+  }
   /* Tell network status tracker about new endpoint */
   grpc_network_status_register_endpoint(&tcp->base);
   grpc_resource_quota_unref_internal(resource_quota);
@@ -38,6 +38,7 @@
 #include <unistd.h>
 
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
@@ -75,6 +76,7 @@ grpc_error* grpc_tcp_server_create(grpc_closure* shutdown_complete,
 
   grpc_tcp_server* s = (grpc_tcp_server*)gpr_zalloc(sizeof(grpc_tcp_server));
   s->so_reuseport = has_so_reuseport;
+  s->reuseport_cpu_affinity = false;
   s->expand_wildcard_addrs = false;
   for (size_t i = 0; i < (args == nullptr ? 0 : args->num_args); i++) {
     if (0 == strcmp(GRPC_ARG_ALLOW_REUSEPORT, args->args[i].key)) {
@@ -86,6 +88,15 @@ grpc_error* grpc_tcp_server_create(grpc_closure* shutdown_complete,
         return GRPC_ERROR_CREATE_FROM_STATIC_STRING(GRPC_ARG_ALLOW_REUSEPORT
                                                     " must be an integer");
       }
+    } else if (0 ==
+               strcmp(GRPC_ARG_REUSEPORT_CPU_AFFINITY, args->args[i].key)) {
+      if (args->args[i].type == GRPC_ARG_INTEGER) {
+        s->reuseport_cpu_affinity = (args->args[i].value.integer != 0);
+      } else {
+        gpr_free(s);
+        return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            GRPC_ARG_REUSEPORT_CPU_AFFINITY " must be an integer");
+      }
     } else if (0 == strcmp(GRPC_ARG_EXPAND_WILDCARD_ADDRS, args->args[i].key)) {
       if (args->args[i].type == GRPC_ARG_INTEGER) {
         s->expand_wildcard_addrs = (args->args[i].value.integer != 0);
@@ -201,10 +212,14 @@ static void on_read(void* arg, grpc_error* err) {
     goto error;
   }
 
-  read_notifier_pollset =
-      sp->server->pollsets[(size_t)gpr_atm_no_barrier_fetch_add(
-                               &sp->server->next_pollset_to_assign, 1) %
-                           sp->server->pollset_count];
+  if (sp->pollset != nullptr) {
+    read_notifier_pollset = sp->pollset;
+  } else {
+    read_notifier_pollset =
+        sp->server->pollsets[(size_t)gpr_atm_no_barrier_fetch_add(
+                                 &sp->server->next_pollset_to_assign, 1) %
+                             sp->server->pollset_count];
+  }
 
   /* loop until accept4 returns EAGAIN, and then re-arm notification */
   for (;;) {
@@ -379,6 +394,7 @@ static grpc_error* clone_port(grpc_tcp_listener* listener, unsigned count) {
     sp->port = port;
     sp->port_index = listener->port_index;
     sp->fd_index = listener->fd_index + count - i;
+    sp->pollset = nullptr;
     GPR_ASSERT(sp->emfd);
     while (listener->server->tail->next != nullptr) {
       listener->server->tail = listener->server->tail->next;
@@ -480,6 +496,17 @@ int grpc_tcp_server_port_fd(grpc_tcp_server* s, unsigned port_index,
   return -1;
 }
 
+/* Have the kernel queue connections received on the CPU for pollset_index on
+   sp, and assign them to that pollset. */
+static void steer_to_cpu(grpc_tcp_listener* sp, grpc_pollset* pollset,
+                         size_t pollset_index) {
+  int cpu = (int)(pollset_index % gpr_cpu_num_cores());
+  if (GRPC_LOG_IF_ERROR("steer_to_cpu",
+                        grpc_set_socket_incoming_cpu(sp->fd, cpu))) {
+    sp->pollset = pollset;
+  }
+}
+
 void grpc_tcp_server_start(grpc_tcp_server* s, grpc_pollset** pollsets,
                            size_t pollset_count,
                            grpc_tcp_server_cb on_accept_cb,
@@ -501,6 +528,9 @@ void grpc_tcp_server_start(grpc_tcp_server* s, grpc_pollset** pollsets,
       GPR_ASSERT(GRPC_LOG_IF_ERROR(
           "clone_port", clone_port(sp, (unsigned)(pollset_count - 1))));
       for (i = 0; i < pollset_count; i++) {
+        if (s->reuseport_cpu_affinity) {
+          steer_to_cpu(sp, pollsets[i], i);
+        }
         grpc_pollset_add_fd(pollsets[i], sp->emfd);
         GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
                           grpc_schedule_on_exec_ctx);
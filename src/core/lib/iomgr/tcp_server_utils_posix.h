@@ -35,6 +35,10 @@ typedef struct grpc_tcp_listener {
   unsigned fd_index;
   grpc_closure read_closure;
   grpc_closure destroyed_closure;
+  /* if not NULL, the pollset to which accepted connections are assigned (see
+     GRPC_ARG_REUSEPORT_CPU_AFFINITY); otherwise they are spread over all the
+     server's pollsets */
+  grpc_pollset* pollset;
   struct grpc_tcp_listener* next;
   /* sibling is a linked list of all listeners for a given port. add_port and
      clone_port place all new listeners in the same sibling list. A member of
@@ -66,6 +70,8 @@ struct grpc_tcp_server {
   bool shutdown_listeners;
   /* use SO_REUSEPORT */
   bool so_reuseport;
+  /* steer connections to the listener (and pollset) for their CPU */
+  bool reuseport_cpu_affinity;
   /* expand wildcard addresses to a list of all local addresses */
   bool expand_wildcard_addrs;
 
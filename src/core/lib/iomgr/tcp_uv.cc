@@ -375,6 +375,10 @@ static grpc_resource_user* uv_get_resource_user(grpc_endpoint* ep) {
 
 static int uv_get_fd(grpc_endpoint* ep) { return -1; }
 
+static bool uv_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer) {
+  return false;
+}
+
 static grpc_endpoint_vtable vtable = {uv_endpoint_read,
                                       uv_endpoint_write,
                                       uv_add_to_pollset,
@@ -384,7 +388,8 @@ static grpc_endpoint_vtable vtable = {uv_endpoint_read,
                                       uv_destroy,
                                       uv_get_resource_user,
                                       uv_get_peer,
-                                      uv_get_fd};
+                                      uv_get_fd,
+                                      uv_set_tracer};
 
 grpc_endpoint* grpc_tcp_create(uv_tcp_t* handle,
                                grpc_resource_quota* resource_quota,
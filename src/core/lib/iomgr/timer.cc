@@ -0,0 +1,83 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+#include "src/core/lib/iomgr/timer.h"
+
+#include <string.h>
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/env.h"
+
+grpc_core::TraceFlag grpc_timer_trace(false, "timer");
+grpc_core::TraceFlag grpc_timer_check_trace(false, "timer_check");
+
+static const grpc_timer_vtable* g_timer_impl;
+
+void grpc_set_timer_impl(const grpc_timer_vtable* vtable) {
+  g_timer_impl = vtable;
+}
+
+static const grpc_timer_vtable* default_timer_impl() {
+#ifdef GRPC_UV
+  return &grpc_uv_timer_vtable;
+#else
+  const grpc_timer_vtable* impl = &grpc_generic_timer_vtable;
+  char* s = gpr_getenv("GRPC_TIMER_STRATEGY");
+  if (s != nullptr) {
+    if (0 == strcmp(s, grpc_wheel_timer_vtable.name)) {
+      impl = &grpc_wheel_timer_vtable;
+    } else if (0 != strcmp(s, grpc_generic_timer_vtable.name)) {
+      gpr_log(GPR_ERROR, "Unknown timer strategy '%s', using '%s'", s,
+              impl->name);
+    }
+    gpr_free(s);
+  }
+  return impl;
+#endif
+}
+
+void grpc_timer_init(grpc_timer* timer, grpc_millis deadline,
+                     grpc_closure* closure) {
+  g_timer_impl->init(timer, deadline, closure);
+}
+
+void grpc_timer_init_unset(grpc_timer* timer) {
+  g_timer_impl->init_unset(timer);
+}
+
+void grpc_timer_cancel(grpc_timer* timer) { g_timer_impl->cancel(timer); }
+
+grpc_timer_check_result grpc_timer_check(grpc_millis* next) {
+  return g_timer_impl->check(next);
+}
+
+void grpc_timer_list_init() {
+  if (g_timer_impl == nullptr) {
+    g_timer_impl = default_timer_impl();
+  }
+  g_timer_impl->list_init();
+}
+
+void grpc_timer_list_shutdown() { g_timer_impl->list_shutdown(); }
+
+void grpc_timer_consume_kick(void) { g_timer_impl->consume_kick(); }
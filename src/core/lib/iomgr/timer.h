@@ -101,4 +101,32 @@ void grpc_timer_consume_kick(void);
 
 void grpc_kick_poller(void);
 
+/* An implementation of the timer API above. grpc_timer_list_init() picks one
+   if none was set: the uv timer under GRPC_UV, otherwise the one named by the
+   GRPC_TIMER_STRATEGY environment variable ("heap" or "wheel", defaulting to
+   "heap"). */
+typedef struct grpc_timer_vtable {
+  void (*init)(grpc_timer* timer, grpc_millis deadline, grpc_closure* closure);
+  void (*init_unset)(grpc_timer* timer);
+  void (*cancel)(grpc_timer* timer);
+  grpc_timer_check_result (*check)(grpc_millis* next);
+  void (*list_init)();
+  void (*list_shutdown)();
+  void (*consume_kick)(void);
+  const char* name;
+} grpc_timer_vtable;
+
+#ifdef GRPC_UV
+extern const grpc_timer_vtable grpc_uv_timer_vtable;
+#else
+/* Sharded heaps of near timers, with an unordered list for far ones */
+extern const grpc_timer_vtable grpc_generic_timer_vtable;
+/* Sharded hierarchical timing wheels: O(1) init and cancel */
+extern const grpc_timer_vtable grpc_wheel_timer_vtable;
+#endif
+
+/* Select the timer implementation. Must be called before
+   grpc_timer_list_init(), i.e. before grpc_init(). */
+void grpc_set_timer_impl(const grpc_timer_vtable* vtable);
+
 #endif /* GRPC_CORE_LIB_IOMGR_TIMER_H */
@@ -29,9 +29,6 @@
 
 #include <uv.h>
 
-grpc_core::TraceFlag grpc_timer_trace(false, "timer");
-grpc_core::TraceFlag grpc_timer_check_trace(false, "timer_check");
-
 static void timer_close_callback(uv_handle_t* handle) { gpr_free(handle); }
 
 static void stop_uv_timer(uv_timer_t* handle) {
@@ -50,8 +47,8 @@ void run_expired_timer(uv_timer_t* handle) {
   stop_uv_timer(handle);
 }
 
-void grpc_timer_init(grpc_timer* timer, grpc_millis deadline,
-                     grpc_closure* closure) {
+static void timer_init(grpc_timer* timer, grpc_millis deadline,
+                       grpc_closure* closure) {
   uint64_t timeout;
   uv_timer_t* uv_timer;
   GRPC_UV_ASSERT_SAME_THREAD();
@@ -74,9 +71,9 @@ void grpc_timer_init(grpc_timer* timer, grpc_millis deadline,
   uv_unref((uv_handle_t*)uv_timer);
 }
 
-void grpc_timer_init_unset(grpc_timer* timer) { timer->pending = 0; }
+static void timer_init_unset(grpc_timer* timer) { timer->pending = 0; }
 
-void grpc_timer_cancel(grpc_timer* timer) {
+static void timer_cancel(grpc_timer* timer) {
   GRPC_UV_ASSERT_SAME_THREAD();
   if (timer->pending) {
     timer->pending = 0;
@@ -85,13 +82,17 @@ void grpc_timer_cancel(grpc_timer* timer) {
   }
 }
 
-grpc_timer_check_result grpc_timer_check(grpc_millis* next) {
+static grpc_timer_check_result timer_check(grpc_millis* next) {
   return GRPC_TIMERS_NOT_CHECKED;
 }
 
-void grpc_timer_list_init() {}
-void grpc_timer_list_shutdown() {}
+static void timer_list_init() {}
+static void timer_list_shutdown() {}
+
+static void timer_consume_kick(void) {}
 
-void grpc_timer_consume_kick(void) {}
+const grpc_timer_vtable grpc_uv_timer_vtable = {
+    timer_init,      timer_init_unset,    timer_cancel,       timer_check,
+    timer_list_init, timer_list_shutdown, timer_consume_kick, "uv"};
 
 #endif /* GRPC_UV */
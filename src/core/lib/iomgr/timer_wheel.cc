@@ -0,0 +1,480 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+#include <inttypes.h>
+
+#ifdef GRPC_TIMER_USE_GENERIC
+
+#include "src/core/lib/iomgr/timer.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/tls.h>
+#include <grpc/support/useful.h>
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/spinlock.h"
+
+/* Each level of a wheel has 64 slots, and each of its slots spans as much
+   time as a whole revolution of the level below: 1ms slots at level 0, up to
+   about 12 days at level 5. Timers due beyond the top level's revolution wait
+   on an overflow list until the wheel gets there. */
+#define LEVEL_BITS 6
+#define NUM_SLOTS (1u << LEVEL_BITS)
+#define NUM_LEVELS 6
+#define WHEEL_BITS (LEVEL_BITS * NUM_LEVELS)
+
+/* heap_index of a timer on the overflow list; other timers store their
+   level * NUM_SLOTS + slot there */
+#define OVERFLOW_SLOT (NUM_LEVELS * NUM_SLOTS)
+
+extern grpc_core::TraceFlag grpc_timer_trace;
+extern grpc_core::TraceFlag grpc_timer_check_trace;
+
+/* A "timer shard": one timing wheel and the lock protecting it.
+
+   A timer lives at the lowest level whose current revolution contains its
+   deadline, in the slot covering its deadline. When time reaches the start of
+   a slot at level > 0, the timers in that slot are cascaded down into finer
+   slots; when it reaches a slot at level 0, the timers there expire. Adding
+   and cancelling a timer are therefore O(1), and each timer is moved at most
+   NUM_LEVELS - 1 times before it fires. */
+typedef struct {
+  gpr_mu mu;
+  /* All slots covering times before this have been processed */
+  grpc_millis base;
+  /* Nothing in this shard needs processing before this time. Written under
+     mu, read without it. */
+  gpr_atm min_deadline;
+  /* Bit i of occupied[level] is set iff slots[level][i] is non-empty */
+  uint64_t occupied[NUM_LEVELS];
+  grpc_timer* slots[NUM_LEVELS][NUM_SLOTS];
+  grpc_timer* overflow;
+} timer_shard;
+
+static size_t g_num_shards;
+
+/* Array of timer shards. Whenever a timer (grpc_timer *) is added, its address
+ * is hashed to select the timer shard to add the timer to */
+static timer_shard* g_shards;
+
+/* Thread local variable that stores the deadline of the next timer the thread
+ * has last-seen. This is an optimization to prevent the thread from checking
+ * shared_mutables.min_timer */
+GPR_TLS_DECL(g_last_seen_min_timer);
+
+struct shared_mutables {
+  /* No shard needs processing before this time */
+  gpr_atm min_timer;
+  /* Allow only one run_some_expired_timers at once */
+  gpr_spinlock checker_mu;
+  bool initialized;
+  /* Orders updates of min_timer */
+  gpr_mu mu;
+} GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE);
+
+static struct shared_mutables g_shared_mutables;
+
+static uint32_t lowest_set_bit(uint64_t x) {
+#ifdef __GNUC__
+  return (uint32_t)__builtin_ctzll(x);
+#else
+  uint32_t n = 0;
+  while ((x & 1) == 0) {
+    x >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+static grpc_timer** slot_head(timer_shard* shard, uint32_t slot) {
+  return slot == OVERFLOW_SLOT
+             ? &shard->overflow
+             : &shard->slots[slot / NUM_SLOTS][slot % NUM_SLOTS];
+}
+
+/* Returns the slot for a timer due at deadline: at the lowest level whose
+   current revolution contains the deadline. Slots at each level therefore
+   never precede the one holding base. */
+static uint32_t slot_for(timer_shard* shard, grpc_millis deadline) {
+  uint64_t b = (uint64_t)shard->base;
+  /* Timers set by a thread with a stale clock are due right away */
+  uint64_t d = (uint64_t)GPR_MAX(deadline, shard->base);
+  for (uint32_t level = 0; level < NUM_LEVELS; level++) {
+    uint32_t shift = level * LEVEL_BITS;
+    if ((d >> (shift + LEVEL_BITS)) == (b >> (shift + LEVEL_BITS))) {
+      return level * NUM_SLOTS + (uint32_t)((d >> shift) & (NUM_SLOTS - 1));
+    }
+  }
+  return OVERFLOW_SLOT;
+}
+
+static void wheel_add(timer_shard* shard, grpc_timer* timer) {
+  uint32_t slot = slot_for(shard, timer->deadline);
+  grpc_timer** head = slot_head(shard, slot);
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = *head;
+  if (*head != nullptr) {
+    (*head)->prev = timer;
+  }
+  *head = timer;
+  if (slot != OVERFLOW_SLOT) {
+    shard->occupied[slot / NUM_SLOTS] |= (uint64_t)1 << (slot % NUM_SLOTS);
+  }
+}
+
+static void wheel_remove(timer_shard* shard, grpc_timer* timer) {
+  if (timer->next != nullptr) {
+    timer->next->prev = timer->prev;
+  }
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+    return;
+  }
+  uint32_t slot = timer->heap_index;
+  *slot_head(shard, slot) = timer->next;
+  if (timer->next == nullptr && slot != OVERFLOW_SLOT) {
+    shard->occupied[slot / NUM_SLOTS] &= ~((uint64_t)1 << (slot % NUM_SLOTS));
+  }
+}
+
+/* Unlink and return the list of timers in a slot. */
+static grpc_timer* take_slot(timer_shard* shard, uint32_t slot) {
+  grpc_timer** head = slot_head(shard, slot);
+  grpc_timer* list = *head;
+  *head = nullptr;
+  if (slot != OVERFLOW_SLOT) {
+    shard->occupied[slot / NUM_SLOTS] &= ~((uint64_t)1 << (slot % NUM_SLOTS));
+  }
+  return list;
+}
+
+/* Returns the earliest time at which a slot of shard needs processing, or
+   GPR_ATM_MAX if shard is empty.
+   REQUIRES: shard->mu locked */
+static gpr_atm next_event(timer_shard* shard) {
+  uint64_t b = (uint64_t)shard->base;
+  gpr_atm next = GPR_ATM_MAX;
+  for (uint32_t level = 0; level < NUM_LEVELS; level++) {
+    uint64_t occupied = shard->occupied[level];
+    if (occupied == 0) continue;
+    uint32_t shift = level * LEVEL_BITS;
+    uint64_t current = (b >> shift) & (NUM_SLOTS - 1);
+    uint64_t slot_start =
+        ((b >> shift) - current + lowest_set_bit(occupied)) << shift;
+    next = GPR_MIN(next, GPR_MAX((gpr_atm)slot_start, shard->base));
+  }
+  if (shard->overflow != nullptr) {
+    /* The start of the next revolution of the top level (or of the current
+       one, if base is at its start and it has not been processed yet) */
+    uint64_t span = ((uint64_t)1) << WHEEL_BITS;
+    next = GPR_MIN(next, (gpr_atm)((b + span - 1) & ~(span - 1)));
+  }
+  return next;
+}
+
+static size_t expire_list(grpc_timer* timer, grpc_millis now,
+                          grpc_error* error) {
+  size_t n = 0;
+  while (timer != nullptr) {
+    grpc_timer* next = timer->next;
+    if (grpc_timer_trace.enabled()) {
+      gpr_log(GPR_DEBUG, "TIMER %p: FIRE %" PRIdPTR "ms late via %s scheduler",
+              timer, now - timer->deadline,
+              timer->closure->scheduler->vtable->name);
+    }
+    timer->pending = false;
+    GRPC_CLOSURE_SCHED(timer->closure, GRPC_ERROR_REF(error));
+    timer = next;
+    n++;
+  }
+  return n;
+}
+
+/* Process the slots starting at shard->base: cascade the timers of each
+   higher level slot starting now into finer slots, then expire those of the
+   level 0 slot. Returns the number of timers expired.
+   REQUIRES: shard->mu locked */
+static size_t process_slots(timer_shard* shard, grpc_error* error) {
+  uint64_t b = (uint64_t)shard->base;
+  if ((b & ((((uint64_t)1) << WHEEL_BITS) - 1)) == 0) {
+    grpc_timer* timer = take_slot(shard, OVERFLOW_SLOT);
+    while (timer != nullptr) {
+      grpc_timer* next = timer->next;
+      wheel_add(shard, timer);
+      timer = next;
+    }
+  }
+  for (uint32_t level = NUM_LEVELS - 1; level > 0; level--) {
+    uint32_t shift = level * LEVEL_BITS;
+    if ((b & ((((uint64_t)1) << shift) - 1)) != 0) continue;
+    uint32_t slot =
+        level * NUM_SLOTS + (uint32_t)((b >> shift) & (NUM_SLOTS - 1));
+    grpc_timer* timer = take_slot(shard, slot);
+    while (timer != nullptr) {
+      grpc_timer* next = timer->next;
+      wheel_add(shard, timer);
+      timer = next;
+    }
+  }
+  return expire_list(take_slot(shard, (uint32_t)(b & (NUM_SLOTS - 1))),
+                     shard->base, error);
+}
+
+/* Expire every timer in shard that is due at or before now, and recompute
+   shard->min_deadline. Expires everything if now is GPR_ATM_MAX.
+   REQUIRES: shard->mu locked */
+static size_t advance(timer_shard* shard, gpr_atm now, grpc_error* error) {
+  size_t n = 0;
+  if (now == GPR_ATM_MAX) {
+    for (uint32_t slot = 0; slot <= OVERFLOW_SLOT; slot++) {
+      n += expire_list(take_slot(shard, slot), now, error);
+    }
+  } else {
+    for (;;) {
+      gpr_atm next = next_event(shard);
+      if (next > now) break;
+      shard->base = next;
+      n += process_slots(shard, error);
+      shard->base = next + 1;
+    }
+    shard->base = GPR_MAX(shard->base, now + 1);
+  }
+  gpr_atm_no_barrier_store(&shard->min_deadline, next_event(shard));
+  return n;
+}
+
+static void timer_list_init() {
+  g_num_shards = GPR_MAX(1, 2 * gpr_cpu_num_cores());
+  g_shards = (timer_shard*)gpr_zalloc(g_num_shards * sizeof(*g_shards));
+
+  g_shared_mutables.initialized = true;
+  g_shared_mutables.checker_mu = GPR_SPINLOCK_INITIALIZER;
+  gpr_mu_init(&g_shared_mutables.mu);
+  g_shared_mutables.min_timer = grpc_core::ExecCtx::Get()->Now();
+  gpr_tls_init(&g_last_seen_min_timer);
+  gpr_tls_set(&g_last_seen_min_timer, 0);
+
+  for (size_t i = 0; i < g_num_shards; i++) {
+    timer_shard* shard = &g_shards[i];
+    gpr_mu_init(&shard->mu);
+    shard->base = g_shared_mutables.min_timer;
+    shard->min_deadline = GPR_ATM_MAX;
+  }
+}
+
+static grpc_timer_check_result run_some_expired_timers(gpr_atm now,
+                                                       gpr_atm* next,
+                                                       grpc_error* error);
+
+static void timer_list_shutdown() {
+  run_some_expired_timers(
+      GPR_ATM_MAX, nullptr,
+      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Timer list shutdown"));
+  for (size_t i = 0; i < g_num_shards; i++) {
+    gpr_mu_destroy(&g_shards[i].mu);
+  }
+  gpr_mu_destroy(&g_shared_mutables.mu);
+  gpr_tls_destroy(&g_last_seen_min_timer);
+  gpr_free(g_shards);
+  g_shared_mutables.initialized = false;
+}
+
+static void timer_init_unset(grpc_timer* timer) { timer->pending = false; }
+
+static void timer_init(grpc_timer* timer, grpc_millis deadline,
+                       grpc_closure* closure) {
+  timer_shard* shard = &g_shards[GPR_HASH_POINTER(timer, g_num_shards)];
+  timer->closure = closure;
+  timer->deadline = deadline;
+
+  if (grpc_timer_trace.enabled()) {
+    gpr_log(GPR_DEBUG,
+            "TIMER %p: SET %" PRIdPTR " now %" PRIdPTR " call %p[%p]", timer,
+            deadline, grpc_core::ExecCtx::Get()->Now(), closure, closure->cb);
+  }
+
+  if (!g_shared_mutables.initialized) {
+    timer->pending = false;
+    GRPC_CLOSURE_SCHED(timer->closure,
+                       GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                           "Attempt to create timer before initialization"));
+    return;
+  }
+
+  gpr_mu_lock(&shard->mu);
+  timer->pending = true;
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  if (deadline <= now) {
+    timer->pending = false;
+    GRPC_CLOSURE_SCHED(timer->closure, GRPC_ERROR_NONE);
+    gpr_mu_unlock(&shard->mu);
+    /* early out */
+    return;
+  }
+  wheel_add(shard, timer);
+  bool is_first_timer = deadline < shard->min_deadline;
+  if (is_first_timer) {
+    gpr_atm_no_barrier_store(&shard->min_deadline, deadline);
+  }
+  if (grpc_timer_trace.enabled()) {
+    gpr_log(GPR_DEBUG,
+            "  .. add to shard %d slot %" PRIu32 " => is_first_timer=%s",
+            (int)(shard - g_shards), timer->heap_index,
+            is_first_timer ? "true" : "false");
+  }
+  gpr_mu_unlock(&shard->mu);
+
+  /* A concurrent run_some_expired_timers may already have read this shard's
+     old min_deadline, but it holds g_shared_mutables.mu until it has
+     published the global minimum, so the update below lands after its. */
+  if (is_first_timer) {
+    gpr_mu_lock(&g_shared_mutables.mu);
+    if (deadline < gpr_atm_no_barrier_load(&g_shared_mutables.min_timer)) {
+      gpr_atm_no_barrier_store(&g_shared_mutables.min_timer, deadline);
+      grpc_kick_poller();
+    }
+    gpr_mu_unlock(&g_shared_mutables.mu);
+  }
+}
+
+static void timer_consume_kick(void) {
+  /* force re-evaluation of last seeen min */
+  gpr_tls_set(&g_last_seen_min_timer, 0);
+}
+
+static void timer_cancel(grpc_timer* timer) {
+  if (!g_shared_mutables.initialized) {
+    /* must have already been cancelled, also the shard mutex is invalid */
+    return;
+  }
+
+  timer_shard* shard = &g_shards[GPR_HASH_POINTER(timer, g_num_shards)];
+  gpr_mu_lock(&shard->mu);
+  if (grpc_timer_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "TIMER %p: CANCEL pending=%s", timer,
+            timer->pending ? "true" : "false");
+  }
+  /* shard->min_deadline is left alone: it only has to be a lower bound */
+  if (timer->pending) {
+    GRPC_CLOSURE_SCHED(timer->closure, GRPC_ERROR_CANCELLED);
+    timer->pending = false;
+    wheel_remove(shard, timer);
+  }
+  gpr_mu_unlock(&shard->mu);
+}
+
+static grpc_timer_check_result run_some_expired_timers(gpr_atm now,
+                                                       gpr_atm* next,
+                                                       grpc_error* error) {
+  grpc_timer_check_result result = GRPC_TIMERS_NOT_CHECKED;
+
+  gpr_atm min_timer = gpr_atm_no_barrier_load(&g_shared_mutables.min_timer);
+  gpr_tls_set(&g_last_seen_min_timer, min_timer);
+  if (now < min_timer) {
+    if (next != nullptr) *next = GPR_MIN(*next, min_timer);
+    return GRPC_TIMERS_CHECKED_AND_EMPTY;
+  }
+
+  if (gpr_spinlock_trylock(&g_shared_mutables.checker_mu)) {
+    gpr_mu_lock(&g_shared_mutables.mu);
+    result = GRPC_TIMERS_CHECKED_AND_EMPTY;
+    gpr_atm new_min_timer = GPR_ATM_MAX;
+    for (size_t i = 0; i < g_num_shards; i++) {
+      timer_shard* shard = &g_shards[i];
+      if (gpr_atm_no_barrier_load(&shard->min_deadline) <= now) {
+        gpr_mu_lock(&shard->mu);
+        size_t n = advance(shard, now, error);
+        gpr_mu_unlock(&shard->mu);
+        if (n > 0) {
+          result = GRPC_TIMERS_FIRED;
+        }
+        if (grpc_timer_check_trace.enabled()) {
+          gpr_log(GPR_DEBUG,
+                  "  .. shard[%d] popped %" PRIdPTR
+                  ", min_deadline --> %" PRIdPTR,
+                  (int)i, n, gpr_atm_no_barrier_load(&shard->min_deadline));
+        }
+      }
+      new_min_timer = GPR_MIN(new_min_timer,
+                              gpr_atm_no_barrier_load(&shard->min_deadline));
+    }
+
+    if (next) {
+      *next = GPR_MIN(*next, new_min_timer);
+    }
+
+    gpr_atm_no_barrier_store(&g_shared_mutables.min_timer, new_min_timer);
+    gpr_mu_unlock(&g_shared_mutables.mu);
+    gpr_spinlock_unlock(&g_shared_mutables.checker_mu);
+  }
+
+  GRPC_ERROR_UNREF(error);
+
+  return result;
+}
+
+static grpc_timer_check_result timer_check(grpc_millis* next) {
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+
+  /* fetch from a thread-local first: this avoids contention on a globally
+     mutable cacheline in the common case */
+  grpc_millis min_timer = gpr_tls_get(&g_last_seen_min_timer);
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = GPR_MIN(*next, min_timer);
+    }
+    if (grpc_timer_check_trace.enabled()) {
+      gpr_log(GPR_DEBUG,
+              "TIMER CHECK SKIP: now=%" PRIdPTR " min_timer=%" PRIdPTR, now,
+              min_timer);
+    }
+    return GRPC_TIMERS_CHECKED_AND_EMPTY;
+  }
+
+  grpc_error* shutdown_error =
+      now != GRPC_MILLIS_INF_FUTURE
+          ? GRPC_ERROR_NONE
+          : GRPC_ERROR_CREATE_FROM_STATIC_STRING("Shutting down timer system");
+
+  if (grpc_timer_check_trace.enabled()) {
+    gpr_log(GPR_DEBUG,
+            "TIMER CHECK BEGIN: now=%" PRIdPTR " tls_min=%" PRIdPTR
+            " glob_min=%" PRIdPTR,
+            now, gpr_tls_get(&g_last_seen_min_timer),
+            gpr_atm_no_barrier_load(&g_shared_mutables.min_timer));
+  }
+  grpc_timer_check_result r =
+      run_some_expired_timers(now, next, shutdown_error);
+  if (grpc_timer_check_trace.enabled()) {
+    gpr_log(GPR_DEBUG, "TIMER CHECK END: r=%d", r);
+  }
+  return r;
+}
+
+const grpc_timer_vtable grpc_wheel_timer_vtable = {
+    timer_init,      timer_init_unset,    timer_cancel,       timer_check,
+    timer_list_init, timer_list_shutdown, timer_consume_kick, "wheel"};
+
+#endif /* GRPC_TIMER_USE_GENERIC */
@@ -380,6 +380,14 @@ static int endpoint_get_fd(grpc_endpoint* secure_ep) {
   return grpc_endpoint_get_fd(ep->wrapped_ep);
 }
 
+/* each write is protected into a single write of the wrapped endpoint, so
+   write numbering carries through */
+static bool endpoint_set_tracer(grpc_endpoint* secure_ep,
+                                grpc_endpoint_tracer* tracer) {
+  secure_endpoint* ep = (secure_endpoint*)secure_ep;
+  return grpc_endpoint_set_tracer(ep->wrapped_ep, tracer);
+}
+
 static grpc_resource_user* endpoint_get_resource_user(
     grpc_endpoint* secure_ep) {
   secure_endpoint* ep = (secure_endpoint*)secure_ep;
@@ -395,7 +403,8 @@ static const grpc_endpoint_vtable vtable = {endpoint_read,
                                             endpoint_destroy,
                                             endpoint_get_resource_user,
                                             endpoint_get_peer,
-                                            endpoint_get_fd};
+                                            endpoint_get_fd,
+                                            endpoint_set_tracer};
 
 grpc_endpoint* grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
@@ -22,11 +22,21 @@
 #include <string.h>
 
 #include <grpc/support/alloc.h>
+#include <grpc/support/atm.h>
 #include <grpc/support/log.h>
 #include <grpc/support/useful.h>
 
 #include "src/core/lib/slice/slice_internal.h"
 
+/* The vector paths are compiled for their own targets with function
+   attributes, and picked at runtime: no build flags needed */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || __GNUC__ > 4 ||                           \
+     (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define GRPC_BASE64_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
 /* --- Constants. --- */
 
 static const int8_t base64_bytes[] = {
@@ -52,6 +62,250 @@ static const char base64_url_safe_chars[] =
 #define GRPC_BASE64_MULTILINE_LINE_LEN 76
 #define GRPC_BASE64_MULTILINE_NUM_BLOCKS (GRPC_BASE64_MULTILINE_LINE_LEN / 4)
 
+/* --- Vectorized bulk paths. --- */
+
+/* detected level + 1 (0: not detected yet) */
+static gpr_atm g_detected_simd_level;
+/* grpc_base64_test_only_set_simd_level() */
+static gpr_atm g_max_simd_level = GRPC_BASE64_SIMD_AVX2;
+
+static grpc_base64_simd_level detect_simd_level(void) {
+#ifdef GRPC_BASE64_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return GRPC_BASE64_SIMD_AVX2;
+  if (__builtin_cpu_supports("sse4.1")) return GRPC_BASE64_SIMD_SSE4_1;
+#endif
+  return GRPC_BASE64_SIMD_NONE;
+}
+
+grpc_base64_simd_level grpc_base64_get_simd_level(void) {
+  gpr_atm detected = gpr_atm_no_barrier_load(&g_detected_simd_level);
+  if (detected == 0) {
+    detected = detect_simd_level() + 1;
+    gpr_atm_no_barrier_store(&g_detected_simd_level, detected);
+  }
+  return (grpc_base64_simd_level)GPR_MIN(
+      detected - 1, gpr_atm_no_barrier_load(&g_max_simd_level));
+}
+
+void grpc_base64_test_only_set_simd_level(grpc_base64_simd_level level) {
+  gpr_atm_no_barrier_store(&g_max_simd_level, level);
+}
+
+#ifdef GRPC_BASE64_X86_SIMD
+
+#define SSE4_1_TARGET __attribute__((target("ssse3,sse4.1")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+/* Encoding: spread each input triplet over a 32 bit lane, move its four 6 bit
+   indices into the low bits of the lane's bytes with two multiplies, then map
+   the indices to characters by adding an offset that depends on their range
+   (A-Z, a-z, 0-9, and the last two characters). See Wojciech Muła and Daniel
+   Lemire, "Faster Base64 Encoding and Decoding Using AVX2 Instructions" */
+
+SSE4_1_TARGET static __m128i enc_reshuffle_sse(__m128i in) {
+  in = _mm_shuffle_epi8(
+      in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t1, t3);
+}
+
+SSE4_1_TARGET static __m128i enc_translate_sse(__m128i indices,
+                                                __m128i offsets) {
+  /* 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12 */
+  __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+SSE4_1_TARGET static __m128i enc_offsets_sse(bool url_safe) {
+  const char c62 = url_safe ? '-' : '+';
+  const char c63 = url_safe ? '_' : '/';
+  return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, (char)(c62 - 62), (char)(c63 - 63), 'A', 0,
+                       0);
+}
+
+SSE4_1_TARGET static size_t encode_sse(const uint8_t* in, size_t in_len,
+                                       char* out, bool url_safe) {
+  const __m128i offsets = enc_offsets_sse(url_safe);
+  size_t done = 0;
+  /* each round reads 16 bytes and encodes the first 12 of them */
+  while (in_len - done >= 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(in + done));
+    v = enc_translate_sse(enc_reshuffle_sse(v), offsets);
+    _mm_storeu_si128((__m128i*)out, v);
+    out += 16;
+    done += 12;
+  }
+  return done;
+}
+
+AVX2_TARGET static size_t encode_avx2(const uint8_t* in, size_t in_len,
+                                      char* out, bool url_safe) {
+  const __m256i shuffle = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5,
+      4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m256i offsets =
+      _mm256_broadcastsi128_si256(enc_offsets_sse(url_safe));
+  size_t done = 0;
+  /* each round reads 28 bytes and encodes the first 24 of them: 12 per lane */
+  while (in_len - done >= 28) {
+    __m256i v = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(in + done))),
+        _mm_loadu_si128((const __m128i*)(in + done + 12)), 1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    const __m256i t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    range =
+        _mm256_or_si256(range, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+    v = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+    _mm256_storeu_si256((__m256i*)out, v);
+    out += 32;
+    done += 24;
+  }
+  /* the SSE code is not VEX encoded: leaving the upper halves of the registers
+     dirty would make it pay for a state transition */
+  _mm256_zeroupper();
+  return done + encode_sse(in + done, in_len - done, out, url_safe);
+}
+
+/* Decoding: classify each character by its low and high nibble, and stop at
+   blocks with characters outside of the alphabet; map characters to their
+   values by adding an offset picked by the high nibble (and by whether the
+   character is '/', the only one sharing its offset's nibble with another
+   range); then pack the four 6 bit values of each 32 bit lane into three
+   bytes with two multiply-adds */
+
+SSE4_1_TARGET static __m128i dec_lut_lo_sse(void) {
+  return _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                       0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+}
+
+SSE4_1_TARGET static __m128i dec_lut_hi_sse(void) {
+  return _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+                       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+}
+
+SSE4_1_TARGET static __m128i dec_lut_roll_sse(void) {
+  return _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0,
+                       0);
+}
+
+SSE4_1_TARGET static size_t decode_sse(const uint8_t* in, size_t in_len,
+                                       uint8_t* out, size_t out_len) {
+  const __m128i lut_lo = dec_lut_lo_sse();
+  const __m128i lut_hi = dec_lut_hi_sse();
+  const __m128i lut_roll = dec_lut_roll_sse();
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  size_t done = 0;
+  size_t written = 0;
+  /* each round decodes 16 characters into 12 bytes, but stores 16 bytes */
+  while (in_len - done >= 16 && out_len - written >= 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)(in + done));
+    const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(v, 4), nibble);
+    const __m128i lo_nibbles = _mm_and_si128(v, nibble);
+    if (!_mm_testz_si128(_mm_shuffle_epi8(lut_lo, lo_nibbles),
+                         _mm_shuffle_epi8(lut_hi, hi_nibbles))) {
+      break;
+    }
+    const __m128i is_slash = _mm_cmpeq_epi8(v, _mm_set1_epi8('/'));
+    const __m128i roll =
+        _mm_shuffle_epi8(lut_roll, _mm_add_epi8(is_slash, hi_nibbles));
+    const __m128i values = _mm_add_epi8(v, roll);
+    const __m128i pairs =
+        _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i packed = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    packed = _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                                    14, 13, 12, -1, -1, -1,
+                                                    -1));
+    _mm_storeu_si128((__m128i*)(out + written), packed);
+    done += 16;
+    written += 12;
+  }
+  return done;
+}
+
+AVX2_TARGET static size_t decode_avx2(const uint8_t* in, size_t in_len,
+                                      uint8_t* out, size_t out_len) {
+  const __m256i lut_lo = _mm256_broadcastsi128_si256(dec_lut_lo_sse());
+  const __m256i lut_hi = _mm256_broadcastsi128_si256(dec_lut_hi_sse());
+  const __m256i lut_roll = _mm256_broadcastsi128_si256(dec_lut_roll_sse());
+  const __m256i nibble = _mm256_set1_epi8(0x0f);
+  const __m256i pack_lanes = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4,
+      10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  size_t done = 0;
+  size_t written = 0;
+  /* each round decodes 32 characters into 24 bytes, but stores 32 bytes */
+  while (in_len - done >= 32 && out_len - written >= 32) {
+    const __m256i v = _mm256_loadu_si256((const __m256i*)(in + done));
+    const __m256i hi_nibbles =
+        _mm256_and_si256(_mm256_srli_epi32(v, 4), nibble);
+    const __m256i lo_nibbles = _mm256_and_si256(v, nibble);
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo_nibbles),
+                            _mm256_shuffle_epi8(lut_hi, hi_nibbles))) {
+      break;
+    }
+    const __m256i is_slash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/'));
+    const __m256i roll =
+        _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(is_slash, hi_nibbles));
+    const __m256i values = _mm256_add_epi8(v, roll);
+    const __m256i pairs =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    __m256i packed = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    packed = _mm256_shuffle_epi8(packed, pack_lanes);
+    packed = _mm256_permutevar8x32_epi32(
+        packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    _mm256_storeu_si256((__m256i*)(out + written), packed);
+    done += 32;
+    written += 24;
+  }
+  _mm256_zeroupper();
+  return done +
+         decode_sse(in + done, in_len - done, out + written, out_len - written);
+}
+
+#endif /* GRPC_BASE64_X86_SIMD */
+
+size_t grpc_base64_encode_bulk(const uint8_t* in, size_t in_len, char* out,
+                               bool url_safe) {
+  switch (grpc_base64_get_simd_level()) {
+#ifdef GRPC_BASE64_X86_SIMD
+    case GRPC_BASE64_SIMD_AVX2:
+      return encode_avx2(in, in_len, out, url_safe);
+    case GRPC_BASE64_SIMD_SSE4_1:
+      return encode_sse(in, in_len, out, url_safe);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t grpc_base64_decode_bulk(const uint8_t* in, size_t in_len, uint8_t* out,
+                               size_t out_len) {
+  switch (grpc_base64_get_simd_level()) {
+#ifdef GRPC_BASE64_X86_SIMD
+    case GRPC_BASE64_SIMD_AVX2:
+      return decode_avx2(in, in_len, out, out_len);
+    case GRPC_BASE64_SIMD_SSE4_1:
+      return decode_sse(in, in_len, out, out_len);
+#endif
+    default:
+      return 0;
+  }
+}
+
 /* --- base64 functions. --- */
 
 char* grpc_base64_encode(const void* vdata, size_t data_size, int url_safe,
@@ -85,6 +339,12 @@ void grpc_base64_encode_core(char* result, const void* vdata, size_t data_size,
   size_t num_blocks = 0;
   size_t i = 0;
 
+  if (!multiline) {
+    i = grpc_base64_encode_bulk(data, data_size, current, url_safe != 0);
+    current += i / 3 * 4;
+    data_size -= i;
+  }
+
   /* Encode each block. */
   while (data_size >= 3) {
     *current++ = base64_chars[(data[i] >> 2) & 0x3F];
@@ -192,6 +452,14 @@ grpc_slice grpc_base64_decode_with_len(const char* b64, size_t b64_len,
   unsigned char codes[4];
   size_t num_codes = 0;
 
+  if (!url_safe) {
+    size_t consumed =
+        grpc_base64_decode_bulk((const uint8_t*)b64, b64_len, current, b64_len);
+    b64 += consumed;
+    b64_len -= consumed;
+    result_size = consumed / 4 * 3;
+  }
+
   while (b64_len--) {
     unsigned char c = (unsigned char)(*b64++);
     signed char code;
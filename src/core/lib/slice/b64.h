@@ -19,6 +19,9 @@
 #ifndef GRPC_CORE_LIB_SLICE_B64_H
 #define GRPC_CORE_LIB_SLICE_B64_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include <grpc/slice.h>
 
 /* Encodes data using base64. It is the caller's responsability to free
@@ -46,4 +49,36 @@ grpc_slice grpc_base64_decode(const char* b64, int url_safe);
 grpc_slice grpc_base64_decode_with_len(const char* b64, size_t b64_len,
                                        int url_safe);
 
+/* Bulk paths, shared with chttp2's binary header codec. They use SSE4.1 or AVX2
+   when the cpu has them, and do nothing otherwise: callers finish the job with
+   their scalar code. */
+
+/* Encodes as much of \a in as is worth encoding in bulk (none of it without
+   vector instructions), and returns the number of input bytes consumed: a
+   multiple of 3, encoded into 4/3 as many characters at \a out. */
+size_t grpc_base64_encode_bulk(const uint8_t* in, size_t in_len, char* out,
+                               bool url_safe);
+
+/* Decodes non url safe base64 from \a in up to the first block containing
+   anything else than the 64 characters of the alphabet (padding, line breaks,
+   invalid characters: the caller's scalar code deals with those), and returns
+   the number of characters consumed: a multiple of 4, decoded into 3/4 as many
+   bytes at \a out. May write scratch bytes anywhere in the \a out_len bytes at
+   \a out. */
+size_t grpc_base64_decode_bulk(const uint8_t* in, size_t in_len, uint8_t* out,
+                               size_t out_len);
+
+typedef enum {
+  GRPC_BASE64_SIMD_NONE,
+  GRPC_BASE64_SIMD_SSE4_1,
+  GRPC_BASE64_SIMD_AVX2,
+} grpc_base64_simd_level;
+
+/* The vector instructions the bulk paths use */
+grpc_base64_simd_level grpc_base64_get_simd_level(void);
+
+/* Make the bulk paths use at most \a level (they never use instructions that
+   the cpu doesn't have): for tests and benchmarks */
+void grpc_base64_test_only_set_simd_level(grpc_base64_simd_level level);
+
 #endif /* GRPC_CORE_LIB_SLICE_B64_H */
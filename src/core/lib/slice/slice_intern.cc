@@ -24,6 +24,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/epoch_reclaim.h"
 #include "src/core/lib/gpr/murmur_hash.h"
 #include "src/core/lib/iomgr/iomgr_internal.h" /* for iomgr_abort_on_leaks() */
 #include "src/core/lib/profiling/timers.h"
@@ -37,20 +38,33 @@
 #define TABLE_IDX(hash, capacity) (((hash) >> LOG2_SHARD_COUNT) % (capacity))
 #define SHARD_IDX(hash) ((hash) & ((1 << LOG2_SHARD_COUNT) - 1))
 
+/* Lookups of already interned strings (the common case) take no lock: they
+   find strings by walking the shard's table with acquire loads, and only take
+   a ref on strings whose refcount is not already zero. Inserts, removals and
+   table growth still serialize on the shard's mutex. Memory that a lookup may
+   still be reading (removed strings, tables replaced by growth) is retired
+   instead of freed (see epoch_reclaim.h) */
+
 typedef struct interned_slice_refcount {
   grpc_slice_refcount base;
   grpc_slice_refcount sub;
   size_t length;
   gpr_atm refcnt;
   uint32_t hash;
-  struct interned_slice_refcount* bucket_next;
+  gpr_atm bucket_next; /* interned_slice_refcount* */
 } interned_slice_refcount;
 
+typedef struct slice_table {
+  size_t capacity;
+  /* followed by capacity buckets: gpr_atm (interned_slice_refcount*) */
+} slice_table;
+
+#define TABLE_BUCKETS(table) ((gpr_atm*)((table) + 1))
+
 typedef struct slice_shard {
   gpr_mu mu;
-  interned_slice_refcount** strs;
-  size_t count;
-  size_t capacity;
+  gpr_atm table; /* slice_table*: replaced (under mu) when the shard grows */
+  size_t count;  /* guarded by mu */
 } slice_shard;
 
 /* hash seed: decided at initialization time */
@@ -69,24 +83,48 @@ static static_metadata_hash_ent
 static uint32_t max_static_metadata_hash_probe;
 static uint32_t static_metadata_hash_values[GRPC_STATIC_MDSTR_COUNT];
 
+static slice_table* table_create(size_t capacity) {
+  slice_table* table = (slice_table*)gpr_zalloc(sizeof(slice_table) +
+                                                capacity * sizeof(gpr_atm));
+  table->capacity = capacity;
+  return table;
+}
+
+static interned_slice_refcount* bucket_next(interned_slice_refcount* s) {
+  return (interned_slice_refcount*)gpr_atm_acq_load(&s->bucket_next);
+}
+
 static void interned_slice_ref(void* p) {
   interned_slice_refcount* s = (interned_slice_refcount*)p;
   GPR_ASSERT(gpr_atm_no_barrier_fetch_add(&s->refcnt, 1) > 0);
 }
 
+/* Take a ref unless the string is already dying (its refcount hit zero: it is
+   about to be removed from the table, and must not be handed out again) */
+static bool interned_slice_ref_if_alive(interned_slice_refcount* s) {
+  gpr_atm refcnt = gpr_atm_no_barrier_load(&s->refcnt);
+  while (refcnt > 0) {
+    if (gpr_atm_no_barrier_cas(&s->refcnt, refcnt, refcnt + 1)) return true;
+    refcnt = gpr_atm_no_barrier_load(&s->refcnt);
+  }
+  return false;
+}
+
 static void interned_slice_destroy(interned_slice_refcount* s) {
   slice_shard* shard = &g_shards[SHARD_IDX(s->hash)];
   gpr_mu_lock(&shard->mu);
   GPR_ASSERT(0 == gpr_atm_no_barrier_load(&s->refcnt));
-  interned_slice_refcount** prev_next;
+  slice_table* table = (slice_table*)gpr_atm_no_barrier_load(&shard->table);
+  gpr_atm* prev_next;
   interned_slice_refcount* cur;
-  for (prev_next = &shard->strs[TABLE_IDX(s->hash, shard->capacity)],
-      cur = *prev_next;
-       cur != s; prev_next = &cur->bucket_next, cur = cur->bucket_next)
+  for (prev_next = &TABLE_BUCKETS(table)[TABLE_IDX(s->hash, table->capacity)],
+      cur = (interned_slice_refcount*)gpr_atm_no_barrier_load(prev_next);
+       cur != s; prev_next = &cur->bucket_next, cur = bucket_next(cur))
     ;
-  *prev_next = cur->bucket_next;
+  /* lookups already at s can still go on from it: leave its bucket_next be */
+  gpr_atm_rel_store(prev_next, gpr_atm_no_barrier_load(&cur->bucket_next));
   shard->count--;
-  gpr_free(s);
+  gpr_epoch_retire(s);
   gpr_mu_unlock(&shard->mu);
 }
 
@@ -121,28 +159,29 @@ static const grpc_slice_refcount_vtable interned_slice_sub_vtable = {
     interned_slice_sub_ref, interned_slice_sub_unref,
     grpc_slice_default_eq_impl, grpc_slice_default_hash_impl};
 
+/* Called with shard->mu held. Lookups running concurrently may miss strings
+   that are being moved to the new table; the locked search finds them */
 static void grow_shard(slice_shard* shard) {
   GPR_TIMER_SCOPE("grow_strtab", 0);
 
-  size_t capacity = shard->capacity * 2;
+  slice_table* old_table = (slice_table*)gpr_atm_no_barrier_load(&shard->table);
+  slice_table* table = table_create(old_table->capacity * 2);
   size_t i;
-  interned_slice_refcount** strtab;
   interned_slice_refcount *s, *next;
 
-  strtab = (interned_slice_refcount**)gpr_zalloc(
-      sizeof(interned_slice_refcount*) * capacity);
-
-  for (i = 0; i < shard->capacity; i++) {
-    for (s = shard->strs[i]; s; s = next) {
-      size_t idx = TABLE_IDX(s->hash, capacity);
-      next = s->bucket_next;
-      s->bucket_next = strtab[idx];
-      strtab[idx] = s;
+  for (i = 0; i < old_table->capacity; i++) {
+    for (s = (interned_slice_refcount*)gpr_atm_no_barrier_load(
+             &TABLE_BUCKETS(old_table)[i]);
+         s; s = next) {
+      gpr_atm* bucket =
+          &TABLE_BUCKETS(table)[TABLE_IDX(s->hash, table->capacity)];
+      next = bucket_next(s);
+      gpr_atm_rel_store(&s->bucket_next, gpr_atm_no_barrier_load(bucket));
+      gpr_atm_no_barrier_store(bucket, (gpr_atm)s);
     }
   }
-  gpr_free(shard->strs);
-  shard->strs = strtab;
-  shard->capacity = capacity;
+  gpr_atm_rel_store(&shard->table, (gpr_atm)table);
+  gpr_epoch_retire(old_table);
 }
 
 static grpc_slice materialize(interned_slice_refcount* s) {
@@ -215,23 +254,31 @@ grpc_slice grpc_slice_intern(grpc_slice slice) {
   interned_slice_refcount* s;
   slice_shard* shard = &g_shards[SHARD_IDX(hash)];
 
+  /* search for an existing string, without locking */
+  gpr_atm* reader = gpr_epoch_read_begin();
+  slice_table* table = (slice_table*)gpr_atm_acq_load(&shard->table);
+  for (s = (interned_slice_refcount*)gpr_atm_acq_load(
+           &TABLE_BUCKETS(table)[TABLE_IDX(hash, table->capacity)]);
+       s; s = bucket_next(s)) {
+    if (s->hash == hash && grpc_slice_eq(slice, materialize(s)) &&
+        interned_slice_ref_if_alive(s)) {
+      gpr_epoch_read_end(reader);
+      return materialize(s);
+    }
+  }
+  gpr_epoch_read_end(reader);
+
   gpr_mu_lock(&shard->mu);
 
-  /* search for an existing string */
-  size_t idx = TABLE_IDX(hash, shard->capacity);
-  for (s = shard->strs[idx]; s; s = s->bucket_next) {
-    if (s->hash == hash && grpc_slice_eq(slice, materialize(s))) {
-      if (gpr_atm_no_barrier_fetch_add(&s->refcnt, 1) == 0) {
-        /* If we get here, we've added a ref to something that was about to
-         * die - drop it immediately.
-         * The *only* possible path here (given the shard mutex) should be to
-         * drop from one ref back to zero - assert that with a CAS */
-        GPR_ASSERT(gpr_atm_rel_cas(&s->refcnt, 1, 0));
-        /* and treat this as if we were never here... sshhh */
-      } else {
-        gpr_mu_unlock(&shard->mu);
-        return materialize(s);
-      }
+  /* search again (we may have raced with an insert or with growth) */
+  table = (slice_table*)gpr_atm_no_barrier_load(&shard->table);
+  gpr_atm* bucket = &TABLE_BUCKETS(table)[TABLE_IDX(hash, table->capacity)];
+  for (s = (interned_slice_refcount*)gpr_atm_no_barrier_load(bucket); s;
+       s = bucket_next(s)) {
+    if (s->hash == hash && grpc_slice_eq(slice, materialize(s)) &&
+        interned_slice_ref_if_alive(s)) {
+      gpr_mu_unlock(&shard->mu);
+      return materialize(s);
     }
   }
 
@@ -246,13 +293,14 @@ grpc_slice grpc_slice_intern(grpc_slice slice) {
   s->base.sub_refcount = &s->sub;
   s->sub.vtable = &interned_slice_sub_vtable;
   s->sub.sub_refcount = &s->sub;
-  s->bucket_next = shard->strs[idx];
-  shard->strs[idx] = s;
+  gpr_atm_no_barrier_store(&s->bucket_next, gpr_atm_no_barrier_load(bucket));
   memcpy(s + 1, GRPC_SLICE_START_PTR(slice), GRPC_SLICE_LENGTH(slice));
+  /* publish s only once it is fully initialized */
+  gpr_atm_rel_store(bucket, (gpr_atm)s);
 
   shard->count++;
 
-  if (shard->count > shard->capacity * 2) {
+  if (shard->count > table->capacity * 2) {
     grow_shard(shard);
   }
 
@@ -274,9 +322,8 @@ void grpc_slice_intern_init(void) {
     slice_shard* shard = &g_shards[i];
     gpr_mu_init(&shard->mu);
     shard->count = 0;
-    shard->capacity = INITIAL_SHARD_CAPACITY;
-    shard->strs = (interned_slice_refcount**)gpr_zalloc(sizeof(*shard->strs) *
-                                                        shard->capacity);
+    gpr_atm_no_barrier_store(&shard->table,
+                             (gpr_atm)table_create(INITIAL_SHARD_CAPACITY));
   }
   for (size_t i = 0; i < GPR_ARRAY_SIZE(static_metadata_hash); i++) {
     static_metadata_hash[i].hash = 0;
@@ -304,14 +351,17 @@ void grpc_slice_intern_init(void) {
 void grpc_slice_intern_shutdown(void) {
   for (size_t i = 0; i < SHARD_COUNT; i++) {
     slice_shard* shard = &g_shards[i];
+    slice_table* table = (slice_table*)gpr_atm_no_barrier_load(&shard->table);
     gpr_mu_destroy(&shard->mu);
     /* TODO(ctiller): GPR_ASSERT(shard->count == 0); */
     if (shard->count != 0) {
       gpr_log(GPR_DEBUG, "WARNING: %" PRIuPTR " metadata strings were leaked",
               shard->count);
-      for (size_t j = 0; j < shard->capacity; j++) {
-        for (interned_slice_refcount* s = shard->strs[j]; s;
-             s = s->bucket_next) {
+      for (size_t j = 0; j < table->capacity; j++) {
+        for (interned_slice_refcount* s =
+                 (interned_slice_refcount*)gpr_atm_no_barrier_load(
+                     &TABLE_BUCKETS(table)[j]);
+             s; s = bucket_next(s)) {
           char* text =
               grpc_dump_slice(materialize(s), GPR_DUMP_HEX | GPR_DUMP_ASCII);
           gpr_log(GPR_DEBUG, "LEAKED: %s", text);
@@ -322,6 +372,6 @@ void grpc_slice_intern_shutdown(void) {
         abort();
       }
     }
-    gpr_free(shard->strs);
+    gpr_free(table);
   }
 }
@@ -47,6 +47,7 @@
 #include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/metadata.h"
+#include "src/core/lib/transport/network_timeline.h"
 #include "src/core/lib/transport/static_metadata.h"
 #include "src/core/lib/transport/transport.h"
 
@@ -635,6 +636,15 @@ char* grpc_call_get_peer(grpc_call* call) {
   return gpr_strdup("unknown");
 }
 
+int grpc_call_get_network_timeline(grpc_call* call,
+                                   grpc_call_network_timeline* timeline) {
+  GRPC_API_TRACE("grpc_call_get_network_timeline(call=%p, timeline=%p)", 2,
+                 (call, timeline));
+  grpc_network_timeline* t = (grpc_network_timeline*)
+      call->context[GRPC_CONTEXT_NETWORK_TIMELINE].value;
+  return t != nullptr && grpc_network_timeline_get(t, timeline);
+}
+
 grpc_call* grpc_call_from_top_element(grpc_call_element* elem) {
   return CALL_FROM_TOP_ELEM(elem);
 }
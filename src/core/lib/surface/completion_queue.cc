@@ -1251,3 +1251,10 @@ grpc_pollset* grpc_cq_pollset(grpc_completion_queue* cq) {
 bool grpc_cq_can_listen(grpc_completion_queue* cq) {
   return cq->poller_vtable->can_listen;
 }
+
+void grpc_cq_configure_spin(grpc_completion_queue* cq, int spin_budget_us) {
+  grpc_pollset* pollset = grpc_cq_pollset(cq);
+  if (pollset != nullptr) {
+    grpc_pollset_configure_spin(pollset, spin_budget_us);
+  }
+}
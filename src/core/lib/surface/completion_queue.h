@@ -81,6 +81,10 @@ grpc_pollset* grpc_cq_pollset(grpc_completion_queue* cc);
 
 bool grpc_cq_can_listen(grpc_completion_queue* cc);
 
+/* Sets the spin budget (see grpc_pollset_configure_spin()) of the cq's pollset,
+   if it has one */
+void grpc_cq_configure_spin(grpc_completion_queue* cc, int spin_budget_us);
+
 grpc_cq_completion_type grpc_get_cq_completion_type(grpc_completion_queue* cc);
 
 int grpc_get_cq_poll_num(grpc_completion_queue* cc);
@@ -28,8 +28,12 @@
 static grpc_completion_queue* default_create(
     const grpc_completion_queue_factory* factory,
     const grpc_completion_queue_attributes* attr) {
-  return grpc_completion_queue_create_internal(attr->cq_completion_type,
-                                               attr->cq_polling_type);
+  grpc_completion_queue* cq = grpc_completion_queue_create_internal(
+      attr->cq_completion_type, attr->cq_polling_type);
+  if (attr->version >= 2 && attr->cq_spin_budget_us > 0) {
+    grpc_cq_configure_spin(cq, attr->cq_spin_budget_us);
+  }
+  return cq;
 }
 
 static grpc_completion_queue_factory_vtable default_vtable = {default_create};
@@ -46,8 +50,9 @@ const grpc_completion_queue_factory* grpc_completion_queue_factory_lookup(
   GPR_ASSERT(attributes->version >= 1 &&
              attributes->version <= GRPC_CQ_CURRENT_VERSION);
 
-  /* The default factory can handle version 1 of the attributes structure. We
-     may have to change this as more fields are added to the structure */
+  /* The default factory can handle versions 1 and 2 of the attributes
+     structure. We may have to change this as more fields are added to the
+     structure */
   return &g_default_cq_factory;
 }
 
@@ -58,14 +63,14 @@ const grpc_completion_queue_factory* grpc_completion_queue_factory_lookup(
 grpc_completion_queue* grpc_completion_queue_create_for_next(void* reserved) {
   GPR_ASSERT(!reserved);
   grpc_completion_queue_attributes attr = {1, GRPC_CQ_NEXT,
-                                           GRPC_CQ_DEFAULT_POLLING};
+                                           GRPC_CQ_DEFAULT_POLLING, 0};
   return g_default_cq_factory.vtable->create(&g_default_cq_factory, &attr);
 }
 
 grpc_completion_queue* grpc_completion_queue_create_for_pluck(void* reserved) {
   GPR_ASSERT(!reserved);
   grpc_completion_queue_attributes attr = {1, GRPC_CQ_PLUCK,
-                                           GRPC_CQ_DEFAULT_POLLING};
+                                           GRPC_CQ_DEFAULT_POLLING, 0};
   return g_default_cq_factory.vtable->create(&g_default_cq_factory, &attr);
 }
 
@@ -31,6 +31,8 @@
 #include "src/core/lib/channel/handshaker_registry.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/arena.h"
+#include "src/core/lib/gpr/epoch_reclaim.h"
 #include "src/core/lib/gpr/fork.h"
 #include "src/core/lib/gpr/thd_internal.h"
 #include "src/core/lib/http/parser.h"
@@ -126,6 +128,7 @@ void grpc_init(void) {
     gpr_time_init();
     gpr_thd_init();
     grpc_stats_init();
+    gpr_epoch_init();
     grpc_slice_intern_init();
     grpc_mdctx_global_init();
     grpc_channel_init_init();
@@ -177,7 +180,9 @@ void grpc_shutdown(void) {
       grpc_mdctx_global_shutdown();
       grpc_handshaker_factory_registry_shutdown();
       grpc_slice_intern_shutdown();
+      gpr_epoch_shutdown();
       grpc_stats_shutdown();
+      gpr_arena_cache_drain();
     }
     grpc_core::ExecCtx::GlobalShutdown();
   }
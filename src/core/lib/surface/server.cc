@@ -1023,7 +1023,14 @@ void grpc_server_start(grpc_server* server) {
   server->pollset_count = 0;
   server->pollsets =
       (grpc_pollset**)gpr_malloc(sizeof(grpc_pollset*) * server->cq_count);
+  const int spin_budget_us = grpc_channel_arg_get_integer(
+      grpc_channel_args_find(server->channel_args,
+                             GRPC_ARG_POLLSET_SPIN_BUDGET_US),
+      {0, 0, INT_MAX});
   for (i = 0; i < server->cq_count; i++) {
+    if (spin_budget_us > 0) {
+      grpc_cq_configure_spin(server->cqs[i], spin_budget_us);
+    }
     if (grpc_cq_can_listen(server->cqs[i])) {
       server->pollsets[server->pollset_count++] =
           grpc_cq_pollset(server->cqs[i]);
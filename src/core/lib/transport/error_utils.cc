@@ -23,13 +23,17 @@
 #include "src/core/lib/transport/status_conversion.h"
 
 static grpc_error* recursively_find_error_with_field(grpc_error* error,
+                                                     grpc_error_ints which);
+
+// Searches the children of error, including those of the errors it was
+// derived from (which were added first).
+static grpc_error* find_error_with_field_in_children(grpc_error* error,
                                                      grpc_error_ints which) {
-  // If the error itself has a status code, return it.
-  if (grpc_error_get_int(error, which, nullptr)) {
-    return error;
+  if (error->parent != nullptr) {
+    grpc_error* result =
+        find_error_with_field_in_children(error->parent, which);
+    if (result) return result;
   }
-  if (grpc_error_is_special(error)) return nullptr;
-  // Otherwise, search through its children.
   uint8_t slot = error->first_err;
   while (slot != UINT8_MAX) {
     grpc_linked_error* lerr = (grpc_linked_error*)(error->arena + slot);
@@ -40,6 +44,17 @@ static grpc_error* recursively_find_error_with_field(grpc_error* error,
   return nullptr;
 }
 
+static grpc_error* recursively_find_error_with_field(grpc_error* error,
+                                                     grpc_error_ints which) {
+  // If the error itself has a status code, return it.
+  if (grpc_error_get_int(error, which, nullptr)) {
+    return error;
+  }
+  if (grpc_error_is_special(error)) return nullptr;
+  // Otherwise, search through its children.
+  return find_error_with_field_in_children(error, which);
+}
+
 void grpc_error_get_status(grpc_error* error, grpc_millis deadline,
                            grpc_status_code* code, grpc_slice* slice,
                            grpc_http2_error_code* http_error,
@@ -101,13 +116,15 @@ bool grpc_error_has_clear_grpc_status(grpc_error* error) {
   if (grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, nullptr)) {
     return true;
   }
-  uint8_t slot = error->first_err;
-  while (slot != UINT8_MAX) {
-    grpc_linked_error* lerr = (grpc_linked_error*)(error->arena + slot);
-    if (grpc_error_has_clear_grpc_status(lerr->err)) {
-      return true;
+  for (; error != nullptr; error = error->parent) {
+    uint8_t slot = error->first_err;
+    while (slot != UINT8_MAX) {
+      grpc_linked_error* lerr = (grpc_linked_error*)(error->arena + slot);
+      if (grpc_error_has_clear_grpc_status(lerr->err)) {
+        return true;
+      }
+      slot = lerr->next;
     }
-    slot = lerr->next;
   }
   return false;
 }
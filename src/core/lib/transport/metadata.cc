@@ -23,6 +23,10 @@
 #include <stddef.h>
 #include <string.h>
 
+#ifdef GPR_POSIX_SYNC
+#include <pthread.h>
+#endif
+
 #include <grpc/compression.h>
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
@@ -30,7 +34,9 @@
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
+#include <grpc/support/tls.h>
 
+#include "src/core/lib/gpr/epoch_reclaim.h"
 #include "src/core/lib/gpr/murmur_hash.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
@@ -53,11 +59,12 @@ grpc_core::DebugOnlyTraceFlag grpc_trace_metadata(false, "metadata");
 #ifndef NDEBUG
 #define DEBUG_ARGS , const char *file, int line
 #define FWD_DEBUG_ARGS , file, line
-#define REF_MD_LOCKED(shard, s) ref_md_locked((shard), (s), __FILE__, __LINE__)
+#define REF_MD_IF_ALIVE(shard, s) \
+  ref_md_if_alive((shard), (s), __FILE__, __LINE__)
 #else
 #define DEBUG_ARGS
 #define FWD_DEBUG_ARGS
-#define REF_MD_LOCKED(shard, s) ref_md_locked((shard), (s))
+#define REF_MD_IF_ALIVE(shard, s) ref_md_if_alive((shard), (s))
 #endif
 
 #define INITIAL_SHARD_CAPACITY 8
@@ -67,6 +74,24 @@ grpc_core::DebugOnlyTraceFlag grpc_trace_metadata(false, "metadata");
 #define TABLE_IDX(hash, capacity) (((hash) >> (LOG2_SHARD_COUNT)) % (capacity))
 #define SHARD_IDX(hash) ((hash) & ((1 << (LOG2_SHARD_COUNT)) - 1))
 
+/* Lookups of existing elements (the common case) take no lock: they walk the
+   shard's table with acquire loads, and revive elements whose refcount is zero
+   with a CAS. Inserts, growth and gc_mdtab() serialize on the shard's mutex;
+   gc_mdtab() claims an unreferenced element by swapping its refcount from zero
+   to MD_DEAD, after which lookups leave it alone. Memory that a lookup may
+   still be reading (collected elements, tables replaced by growth) is retired
+   instead of freed (see epoch_reclaim.h) */
+#define MD_DEAD ((gpr_atm)-1)
+
+/* Each thread also keeps a small direct mapped cache of the elements it
+   created or looked up last. Entries hold no ref: an entry is only trusted
+   while no gc_mdtab() pass has collected anything since it was filled (see
+   g_gc_generation). Where pthreads are available a thread's cache is handed
+   back when it exits; elsewhere it lasts until grpc_mdctx_global_shutdown() */
+#define MDELEM_CACHE_SIZE 64
+/* Threads beyond this many go without a cache */
+#define MAX_MDELEM_CACHES 256
+
 typedef void (*destroy_user_data_func)(void* user_data);
 
 /* Shadow structure for grpc_mdelem_data for interned elements */
@@ -82,7 +107,7 @@ typedef struct interned_metadata {
   gpr_atm destroy_user_data;
   gpr_atm user_data;
 
-  struct interned_metadata* bucket_next;
+  gpr_atm bucket_next; /* interned_metadata* */
 } interned_metadata;
 
 /* Shadow structure for grpc_mdelem_data for allocated elements */
@@ -95,11 +120,17 @@ typedef struct allocated_metadata {
   gpr_atm refcnt;
 } allocated_metadata;
 
+typedef struct mdtab {
+  size_t capacity;
+  /* followed by capacity buckets: gpr_atm (interned_metadata*) */
+} mdtab;
+
+#define MDTAB_BUCKETS(table) ((gpr_atm*)((table) + 1))
+
 typedef struct mdtab_shard {
   gpr_mu mu;
-  interned_metadata** elems;
-  size_t count;
-  size_t capacity;
+  gpr_atm table; /* mdtab*: replaced (under mu) when the shard grows */
+  size_t count;  /* guarded by mu */
   /** Estimate of the number of unreferenced mdelems in the hash table.
       This will eventually converge to the exact number, but it's instantaneous
       accuracy is not guaranteed */
@@ -108,8 +139,58 @@ typedef struct mdtab_shard {
 
 static mdtab_shard g_shards[SHARD_COUNT];
 
+typedef struct mdelem_cache_entry {
+  interned_metadata* md;
+  gpr_atm gc_generation; /* g_gc_generation when md was last seen alive */
+} mdelem_cache_entry;
+
+typedef struct mdelem_cache {
+  mdelem_cache_entry entries[MDELEM_CACHE_SIZE];
+} mdelem_cache;
+
+/* Bumped once by every gc_mdtab() pass that collects anything, after
+   claiming the elements and before retiring them */
+static gpr_atm g_gc_generation;
+/* Bumped by every grpc_mdctx_global_init(): caches made before then are gone */
+static gpr_atm g_init_generation;
+static gpr_mu g_caches_mu;
+static mdelem_cache* g_caches[MAX_MDELEM_CACHES]; /* guarded by g_caches_mu */
+static size_t g_num_caches;                       /* guarded by g_caches_mu */
+GPR_TLS_DECL(g_thread_cache);
+GPR_TLS_DECL(g_thread_cache_init_generation);
+#ifdef GPR_POSIX_SYNC
+/* Its value is the thread's cache, which release_thread_cache() frees */
+static pthread_key_t g_thread_cache_key;
+#endif
+
 static void gc_mdtab(mdtab_shard* shard);
 
+#ifdef GPR_POSIX_SYNC
+/* Runs as a thread exits: give the thread's cache slot to the next thread */
+static void release_thread_cache(void* cache) {
+  gpr_mu_lock(&g_caches_mu);
+  for (size_t i = 0; i < g_num_caches; i++) {
+    if (g_caches[i] == cache) {
+      g_caches[i] = g_caches[--g_num_caches];
+      break;
+    }
+  }
+  gpr_mu_unlock(&g_caches_mu);
+  gpr_free(cache);
+}
+#endif
+
+static mdtab* mdtab_create(size_t capacity) {
+  mdtab* table =
+      (mdtab*)gpr_zalloc(sizeof(mdtab) + capacity * sizeof(gpr_atm));
+  table->capacity = capacity;
+  return table;
+}
+
+static interned_metadata* bucket_next(interned_metadata* md) {
+  return (interned_metadata*)gpr_atm_acq_load(&md->bucket_next);
+}
+
 void grpc_mdctx_global_init(void) {
   /* initialize shards */
   for (size_t i = 0; i < SHARD_COUNT; i++) {
@@ -117,10 +198,17 @@ void grpc_mdctx_global_init(void) {
     gpr_mu_init(&shard->mu);
     shard->count = 0;
     gpr_atm_no_barrier_store(&shard->free_estimate, 0);
-    shard->capacity = INITIAL_SHARD_CAPACITY;
-    shard->elems = (interned_metadata**)gpr_zalloc(sizeof(*shard->elems) *
-                                                   shard->capacity);
+    gpr_atm_no_barrier_store(&shard->table,
+                             (gpr_atm)mdtab_create(INITIAL_SHARD_CAPACITY));
   }
+  gpr_mu_init(&g_caches_mu);
+  gpr_tls_init(&g_thread_cache);
+  gpr_tls_init(&g_thread_cache_init_generation);
+#ifdef GPR_POSIX_SYNC
+  GPR_ASSERT(pthread_key_create(&g_thread_cache_key, release_thread_cache) ==
+             0);
+#endif
+  gpr_atm_no_barrier_fetch_add(&g_init_generation, 1);
 }
 
 void grpc_mdctx_global_shutdown() {
@@ -136,8 +224,26 @@ void grpc_mdctx_global_shutdown() {
         abort();
       }
     }
-    gpr_free(shard->elems);
+    gpr_free((void*)gpr_atm_no_barrier_load(&shard->table));
+  }
+#ifdef GPR_POSIX_SYNC
+  /* threads exiting from now on leave their caches to be freed here */
+  pthread_key_delete(g_thread_cache_key);
+#endif
+  for (size_t i = 0; i < g_num_caches; i++) {
+    gpr_free(g_caches[i]);
   }
+  g_num_caches = 0;
+  gpr_mu_destroy(&g_caches_mu);
+  gpr_tls_destroy(&g_thread_cache);
+  gpr_tls_destroy(&g_thread_cache_init_generation);
+}
+
+size_t grpc_mdelem_thread_cache_count_for_testing(void) {
+  gpr_mu_lock(&g_caches_mu);
+  size_t count = g_num_caches;
+  gpr_mu_unlock(&g_caches_mu);
+  return count;
 }
 
 static int is_mdelem_static(grpc_mdelem e) {
@@ -146,8 +252,9 @@ static int is_mdelem_static(grpc_mdelem e) {
              &grpc_static_mdelem_table[GRPC_STATIC_MDELEM_COUNT];
 }
 
-static void ref_md_locked(mdtab_shard* shard,
-                          interned_metadata* md DEBUG_ARGS) {
+/* Take a ref on md unless gc_mdtab() has already claimed it */
+static bool ref_md_if_alive(mdtab_shard* shard,
+                            interned_metadata* md DEBUG_ARGS) {
 #ifndef NDEBUG
   if (grpc_trace_metadata.enabled()) {
     char* key_str = grpc_slice_to_c_string(md->key);
@@ -160,80 +267,141 @@ static void ref_md_locked(mdtab_shard* shard,
     gpr_free(value_str);
   }
 #endif
-  if (0 == gpr_atm_no_barrier_fetch_add(&md->refcnt, 1)) {
-    gpr_atm_no_barrier_fetch_add(&shard->free_estimate, -1);
+  gpr_atm refcnt = gpr_atm_no_barrier_load(&md->refcnt);
+  while (refcnt != MD_DEAD) {
+    if (gpr_atm_no_barrier_cas(&md->refcnt, refcnt, refcnt + 1)) {
+      if (refcnt == 0) {
+        gpr_atm_no_barrier_fetch_add(&shard->free_estimate, -1);
+      }
+      return true;
+    }
+    refcnt = gpr_atm_no_barrier_load(&md->refcnt);
   }
+  return false;
 }
 
 static void gc_mdtab(mdtab_shard* shard) {
   GPR_TIMER_SCOPE("gc_mdtab", 0);
 
+  mdtab* table = (mdtab*)gpr_atm_no_barrier_load(&shard->table);
   size_t i;
-  interned_metadata** prev_next;
+  gpr_atm* prev_next;
   interned_metadata *md, *next;
   gpr_atm num_freed = 0;
-
-  for (i = 0; i < shard->capacity; i++) {
-    prev_next = &shard->elems[i];
-    for (md = shard->elems[i]; md; md = next) {
-      void* user_data = (void*)gpr_atm_no_barrier_load(&md->user_data);
-      next = md->bucket_next;
-      if (gpr_atm_acq_load(&md->refcnt) == 0) {
+  /* collected elements, retired once the thread caches stop trusting them */
+  interned_metadata** freed =
+      (interned_metadata**)gpr_malloc(shard->count * sizeof(*freed));
+
+  for (i = 0; i < table->capacity; i++) {
+    prev_next = &MDTAB_BUCKETS(table)[i];
+    for (md = (interned_metadata*)gpr_atm_no_barrier_load(prev_next); md;
+         md = next) {
+      next = bucket_next(md);
+      /* claim md: lookups can no longer revive it */
+      if (gpr_atm_acq_cas(&md->refcnt, 0, MD_DEAD)) {
+        void* user_data = (void*)gpr_atm_no_barrier_load(&md->user_data);
         grpc_slice_unref_internal(md->key);
         grpc_slice_unref_internal(md->value);
-        if (md->user_data) {
+        if (user_data) {
           ((destroy_user_data_func)gpr_atm_no_barrier_load(
               &md->destroy_user_data))(user_data);
         }
-        gpr_free(md);
-        *prev_next = next;
-        num_freed++;
+        /* lookups already at md can still go on from it: leave its
+           bucket_next be */
+        gpr_atm_rel_store(prev_next, (gpr_atm)next);
+        freed[num_freed++] = md;
         shard->count--;
       } else {
         prev_next = &md->bucket_next;
       }
     }
   }
+  if (num_freed > 0) {
+    /* invalidates the thread caches' entries for the elements before they
+       can be freed */
+    gpr_atm_full_fetch_add(&g_gc_generation, 1);
+    for (i = 0; i < (size_t)num_freed; i++) {
+      gpr_epoch_retire(freed[i]);
+    }
+  }
+  gpr_free(freed);
   gpr_atm_no_barrier_fetch_add(&shard->free_estimate, -num_freed);
 }
 
+/* Lookups running concurrently may miss elements that are being moved to the
+   new table; the locked search finds them */
 static void grow_mdtab(mdtab_shard* shard) {
   GPR_TIMER_SCOPE("grow_mdtab", 0);
 
-  size_t capacity = shard->capacity * 2;
+  mdtab* old_table = (mdtab*)gpr_atm_no_barrier_load(&shard->table);
+  mdtab* table = mdtab_create(old_table->capacity * 2);
   size_t i;
-  interned_metadata** mdtab;
   interned_metadata *md, *next;
   uint32_t hash;
 
-  mdtab =
-      (interned_metadata**)gpr_zalloc(sizeof(interned_metadata*) * capacity);
-
-  for (i = 0; i < shard->capacity; i++) {
-    for (md = shard->elems[i]; md; md = next) {
-      size_t idx;
+  for (i = 0; i < old_table->capacity; i++) {
+    for (md = (interned_metadata*)gpr_atm_no_barrier_load(
+             &MDTAB_BUCKETS(old_table)[i]);
+         md; md = next) {
       hash = GRPC_MDSTR_KV_HASH(grpc_slice_hash(md->key),
                                 grpc_slice_hash(md->value));
-      next = md->bucket_next;
-      idx = TABLE_IDX(hash, capacity);
-      md->bucket_next = mdtab[idx];
-      mdtab[idx] = md;
+      gpr_atm* bucket = &MDTAB_BUCKETS(table)[TABLE_IDX(hash, table->capacity)];
+      next = bucket_next(md);
+      gpr_atm_rel_store(&md->bucket_next, gpr_atm_no_barrier_load(bucket));
+      gpr_atm_no_barrier_store(bucket, (gpr_atm)md);
     }
   }
-  gpr_free(shard->elems);
-  shard->elems = mdtab;
-  shard->capacity = capacity;
+  gpr_atm_rel_store(&shard->table, (gpr_atm)table);
+  gpr_epoch_retire(old_table);
 }
 
 static void rehash_mdtab(mdtab_shard* shard) {
+  mdtab* table = (mdtab*)gpr_atm_no_barrier_load(&shard->table);
   if (gpr_atm_no_barrier_load(&shard->free_estimate) >
-      (gpr_atm)(shard->capacity / 4)) {
+      (gpr_atm)(table->capacity / 4)) {
     gc_mdtab(shard);
   } else {
     grow_mdtab(shard);
   }
 }
 
+/* The calling thread's cache entry for elements with \a hash, or null if the
+   thread has no cache */
+static mdelem_cache_entry* thread_cache_entry(uint32_t hash) {
+  gpr_atm init_generation = gpr_atm_no_barrier_load(&g_init_generation);
+  mdelem_cache* cache;
+  if (gpr_tls_get(&g_thread_cache_init_generation) == init_generation) {
+    cache = (mdelem_cache*)gpr_tls_get(&g_thread_cache);
+  } else {
+    cache = nullptr;
+    gpr_mu_lock(&g_caches_mu);
+    if (g_num_caches < MAX_MDELEM_CACHES) {
+      cache = (mdelem_cache*)gpr_zalloc(sizeof(*cache));
+      g_caches[g_num_caches++] = cache;
+    }
+    gpr_mu_unlock(&g_caches_mu);
+    gpr_tls_set(&g_thread_cache, (intptr_t)cache);
+    gpr_tls_set(&g_thread_cache_init_generation, init_generation);
+#ifdef GPR_POSIX_SYNC
+    if (cache != nullptr) pthread_setspecific(g_thread_cache_key, cache);
+#endif
+  }
+  return cache == nullptr ? nullptr
+                          : &cache->entries[hash % MDELEM_CACHE_SIZE];
+}
+
+/* Called holding a ref on md */
+static void fill_cache_entry(mdelem_cache_entry* entry, interned_metadata* md) {
+  if (entry == nullptr) return;
+  entry->md = md;
+  entry->gc_generation = gpr_atm_acq_load(&g_gc_generation);
+}
+
+static bool md_matches(interned_metadata* md, grpc_slice key,
+                       grpc_slice value) {
+  return grpc_slice_eq(key, md->key) && grpc_slice_eq(value, md->value);
+}
+
 grpc_mdelem grpc_mdelem_create(
     grpc_slice key, grpc_slice value,
     grpc_mdelem_data* compatible_external_backing_store) {
@@ -275,18 +443,42 @@ grpc_mdelem grpc_mdelem_create(
       GRPC_MDSTR_KV_HASH(grpc_slice_hash(key), grpc_slice_hash(value));
   interned_metadata* md;
   mdtab_shard* shard = &g_shards[SHARD_IDX(hash)];
-  size_t idx;
+  mdelem_cache_entry* cache_entry = thread_cache_entry(hash);
 
   GPR_TIMER_SCOPE("grpc_mdelem_from_metadata_strings", 0);
 
+  /* search for an existing pair, without locking */
+  gpr_atm* reader = gpr_epoch_read_begin();
+  md = cache_entry != nullptr ? cache_entry->md : nullptr;
+  if (md != nullptr && cache_entry->gc_generation ==
+                           gpr_atm_acq_load(&g_gc_generation)) {
+    if (md_matches(md, key, value) && REF_MD_IF_ALIVE(shard, md)) {
+      gpr_epoch_read_end(reader);
+      return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
+    }
+  }
+  mdtab* table = (mdtab*)gpr_atm_acq_load(&shard->table);
+  for (md = (interned_metadata*)gpr_atm_acq_load(
+           &MDTAB_BUCKETS(table)[TABLE_IDX(hash, table->capacity)]);
+       md; md = bucket_next(md)) {
+    if (md_matches(md, key, value) && REF_MD_IF_ALIVE(shard, md)) {
+      gpr_epoch_read_end(reader);
+      fill_cache_entry(cache_entry, md);
+      return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
+    }
+  }
+  gpr_epoch_read_end(reader);
+
   gpr_mu_lock(&shard->mu);
 
-  idx = TABLE_IDX(hash, shard->capacity);
-  /* search for an existing pair */
-  for (md = shard->elems[idx]; md; md = md->bucket_next) {
-    if (grpc_slice_eq(key, md->key) && grpc_slice_eq(value, md->value)) {
-      REF_MD_LOCKED(shard, md);
+  /* search again (we may have raced with an insert or with growth) */
+  table = (mdtab*)gpr_atm_no_barrier_load(&shard->table);
+  gpr_atm* bucket = &MDTAB_BUCKETS(table)[TABLE_IDX(hash, table->capacity)];
+  for (md = (interned_metadata*)gpr_atm_no_barrier_load(bucket); md;
+       md = bucket_next(md)) {
+    if (md_matches(md, key, value) && REF_MD_IF_ALIVE(shard, md)) {
       gpr_mu_unlock(&shard->mu);
+      fill_cache_entry(cache_entry, md);
       return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
     }
   }
@@ -298,9 +490,10 @@ grpc_mdelem grpc_mdelem_create(
   md->value = grpc_slice_ref_internal(value);
   md->user_data = 0;
   md->destroy_user_data = 0;
-  md->bucket_next = shard->elems[idx];
-  shard->elems[idx] = md;
   gpr_mu_init(&md->mu_user_data);
+  gpr_atm_no_barrier_store(&md->bucket_next, gpr_atm_no_barrier_load(bucket));
+  /* publish md only once it is fully initialized */
+  gpr_atm_rel_store(bucket, (gpr_atm)md);
 #ifndef NDEBUG
   if (grpc_trace_metadata.enabled()) {
     char* key_str = grpc_slice_to_c_string(md->key);
@@ -313,12 +506,14 @@ grpc_mdelem grpc_mdelem_create(
 #endif
   shard->count++;
 
-  if (shard->count > shard->capacity * 2) {
+  if (shard->count > table->capacity * 2) {
     rehash_mdtab(shard);
   }
 
   gpr_mu_unlock(&shard->mu);
 
+  fill_cache_entry(cache_entry, md);
+
   return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
 }
 
@@ -160,4 +160,7 @@ void grpc_mdelem_unref(grpc_mdelem md);
 void grpc_mdctx_global_init(void);
 void grpc_mdctx_global_shutdown();
 
+/* Number of threads currently holding an interned mdelem cache */
+size_t grpc_mdelem_thread_cache_count_for_testing(void);
+
 #endif /* GRPC_CORE_LIB_TRANSPORT_METADATA_H */
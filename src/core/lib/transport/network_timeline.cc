@@ -0,0 +1,94 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/transport/network_timeline.h"
+
+#include <grpc/support/alloc.h>
+
+grpc_network_timeline* grpc_network_timeline_create() {
+  grpc_network_timeline* timeline =
+      (grpc_network_timeline*)gpr_malloc(sizeof(*timeline));
+  gpr_ref_init(&timeline->refs, 1);
+  gpr_mu_init(&timeline->mu);
+  timeline->recorded = false;
+  const gpr_timespec never = gpr_inf_past(GPR_CLOCK_REALTIME);
+  timeline->timeline.sent_scheduled = never;
+  timeline->timeline.sent = never;
+  timeline->timeline.acked = never;
+  timeline->timeline.first_received = never;
+  timeline->timeline.last_received = never;
+  return timeline;
+}
+
+grpc_network_timeline* grpc_network_timeline_ref(
+    grpc_network_timeline* timeline) {
+  gpr_ref(&timeline->refs);
+  return timeline;
+}
+
+void grpc_network_timeline_unref(grpc_network_timeline* timeline) {
+  if (gpr_unref(&timeline->refs)) {
+    gpr_mu_destroy(&timeline->mu);
+    gpr_free(timeline);
+  }
+}
+
+/* reports for successive writes may interleave: keep the latest */
+static void note_latest(gpr_timespec* field, gpr_timespec ts) {
+  if (gpr_time_cmp(ts, *field) > 0) *field = ts;
+}
+
+void grpc_network_timeline_note_write(grpc_network_timeline* timeline,
+                                      grpc_endpoint_write_stage stage,
+                                      gpr_timespec ts) {
+  gpr_mu_lock(&timeline->mu);
+  switch (stage) {
+    case GRPC_ENDPOINT_WRITE_SCHEDULED:
+      note_latest(&timeline->timeline.sent_scheduled, ts);
+      break;
+    case GRPC_ENDPOINT_WRITE_SENT:
+      note_latest(&timeline->timeline.sent, ts);
+      break;
+    case GRPC_ENDPOINT_WRITE_ACKED:
+      note_latest(&timeline->timeline.acked, ts);
+      break;
+  }
+  timeline->recorded = true;
+  gpr_mu_unlock(&timeline->mu);
+}
+
+void grpc_network_timeline_note_read(grpc_network_timeline* timeline,
+                                     gpr_timespec ts) {
+  gpr_mu_lock(&timeline->mu);
+  if (gpr_time_cmp(timeline->timeline.first_received,
+                   gpr_inf_past(GPR_CLOCK_REALTIME)) == 0) {
+    timeline->timeline.first_received = ts;
+  }
+  note_latest(&timeline->timeline.last_received, ts);
+  timeline->recorded = true;
+  gpr_mu_unlock(&timeline->mu);
+}
+
+bool grpc_network_timeline_get(grpc_network_timeline* timeline,
+                               grpc_call_network_timeline* out) {
+  gpr_mu_lock(&timeline->mu);
+  bool recorded = timeline->recorded;
+  *out = timeline->timeline;
+  gpr_mu_unlock(&timeline->mu);
+  return recorded;
+}
@@ -0,0 +1,56 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_TRANSPORT_NETWORK_TIMELINE_H
+#define GRPC_CORE_LIB_TRANSPORT_NETWORK_TIMELINE_H
+
+#include <grpc/grpc.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/iomgr/endpoint.h"
+
+/* The kernel timestamps a transport has attributed to one call (see
+   GRPC_ARG_TCP_TIMESTAMPING). The call holds it in its
+   GRPC_CONTEXT_NETWORK_TIMELINE context element; the transport holds refs
+   for writes whose timestamps have yet to arrive, which may be after the call
+   is gone, and records them from whichever thread the endpoint reports on. */
+typedef struct grpc_network_timeline {
+  gpr_refcount refs;
+  gpr_mu mu;
+  bool recorded;
+  grpc_call_network_timeline timeline;
+} grpc_network_timeline;
+
+grpc_network_timeline* grpc_network_timeline_create();
+grpc_network_timeline* grpc_network_timeline_ref(
+    grpc_network_timeline* timeline);
+void grpc_network_timeline_unref(grpc_network_timeline* timeline);
+
+/* A write carrying frames of the call reached stage at ts */
+void grpc_network_timeline_note_write(grpc_network_timeline* timeline,
+                                      grpc_endpoint_write_stage stage,
+                                      gpr_timespec ts);
+/* A read carrying frames of the call was received at ts */
+void grpc_network_timeline_note_read(grpc_network_timeline* timeline,
+                                     gpr_timespec ts);
+
+/* Copy out the timestamps recorded so far. Returns false if there are none. */
+bool grpc_network_timeline_get(grpc_network_timeline* timeline,
+                               grpc_call_network_timeline* out);
+
+#endif /* GRPC_CORE_LIB_TRANSPORT_NETWORK_TIMELINE_H */
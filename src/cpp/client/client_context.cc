@@ -125,6 +125,12 @@ grpc::string ClientContext::peer() const {
   return peer;
 }
 
+bool ClientContext::GetNetworkTimeline(
+    grpc_call_network_timeline* timeline) const {
+  return call_ != nullptr &&
+         grpc_call_get_network_timeline(call_, timeline) != 0;
+}
+
 void ClientContext::SetGlobalCallbacks(GlobalCallbacks* client_callbacks) {
   GPR_ASSERT(g_client_callbacks == &g_default_client_callbacks);
   GPR_ASSERT(client_callbacks != nullptr);
@@ -214,6 +214,12 @@ const struct census_context* ServerContext::census_context() const {
   return grpc_census_call_get_context(call_);
 }
 
+bool ServerContext::GetNetworkTimeline(
+    grpc_call_network_timeline* timeline) const {
+  return call_ != nullptr &&
+         grpc_call_get_network_timeline(call_, timeline) != 0;
+}
+
 void ServerContext::SetLoadReportingCosts(
     const std::vector<grpc::string>& cost_data) {
   if (call_ == nullptr) return;
@@ -27,6 +27,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/gpr/env_linux.cc',
     'src/core/lib/gpr/env_posix.cc',
     'src/core/lib/gpr/env_windows.cc',
+    'src/core/lib/gpr/epoch_reclaim.cc',
     'src/core/lib/gpr/fork.cc',
     'src/core/lib/gpr/host_port.cc',
     'src/core/lib/gpr/log.cc',
@@ -90,6 +91,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/iomgr/ev_epoll1_linux.cc',
     'src/core/lib/iomgr/ev_epollex_linux.cc',
     'src/core/lib/iomgr/ev_epollsig_linux.cc',
+    'src/core/lib/iomgr/ev_io_uring_linux.cc',
     'src/core/lib/iomgr/ev_poll_posix.cc',
     'src/core/lib/iomgr/ev_posix.cc',
     'src/core/lib/iomgr/ev_windows.cc',
@@ -130,6 +132,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/iomgr/tcp_client_posix.cc',
     'src/core/lib/iomgr/tcp_client_uv.cc',
     'src/core/lib/iomgr/tcp_client_windows.cc',
+    'src/core/lib/iomgr/tcp_io_uring_linux.cc',
     'src/core/lib/iomgr/tcp_posix.cc',
     'src/core/lib/iomgr/tcp_server_posix.cc',
     'src/core/lib/iomgr/tcp_server_utils_posix_common.cc',
@@ -140,10 +143,12 @@ CORE_SOURCE_FILES = [
     'src/core/lib/iomgr/tcp_uv.cc',
     'src/core/lib/iomgr/tcp_windows.cc',
     'src/core/lib/iomgr/time_averaged_stats.cc',
+    'src/core/lib/iomgr/timer.cc',
     'src/core/lib/iomgr/timer_generic.cc',
     'src/core/lib/iomgr/timer_heap.cc',
     'src/core/lib/iomgr/timer_manager.cc',
     'src/core/lib/iomgr/timer_uv.cc',
+    'src/core/lib/iomgr/timer_wheel.cc',
     'src/core/lib/iomgr/udp_server.cc',
     'src/core/lib/iomgr/unix_sockets_posix.cc',
     'src/core/lib/iomgr/unix_sockets_posix_noop.cc',
@@ -188,6 +193,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/transport/error_utils.cc',
     'src/core/lib/transport/metadata.cc',
     'src/core/lib/transport/metadata_batch.cc',
+    'src/core/lib/transport/network_timeline.cc',
     'src/core/lib/transport/pid_controller.cc',
     'src/core/lib/transport/service_config.cc',
     'src/core/lib/transport/static_metadata.cc',
@@ -285,6 +291,9 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/client/insecure/channel_create_posix.cc',
     'src/core/ext/transport/inproc/inproc_plugin.cc',
     'src/core/ext/transport/inproc/inproc_transport.cc',
+    'src/core/ext/transport/shm/shm_endpoint.cc',
+    'src/core/ext/transport/shm/shm_plugin.cc',
+    'src/core/ext/transport/shm/shm_transport.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/client_load_reporting_filter.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_channel_secure.cc',
@@ -181,6 +181,9 @@ extern grpc_call_start_batch_type grpc_call_start_batch_import;
 typedef char*(*grpc_call_get_peer_type)(grpc_call* call);
 extern grpc_call_get_peer_type grpc_call_get_peer_import;
 #define grpc_call_get_peer grpc_call_get_peer_import
+typedef int(*grpc_call_get_network_timeline_type)(grpc_call* call, grpc_call_network_timeline* timeline);
+extern grpc_call_get_network_timeline_type grpc_call_get_network_timeline_import;
+#define grpc_call_get_network_timeline grpc_call_get_network_timeline_import
 typedef void(*grpc_census_call_set_context_type)(grpc_call* call, struct census_context* context);
 extern grpc_census_call_set_context_type grpc_census_call_set_context_import;
 #define grpc_census_call_set_context grpc_census_call_set_context_import
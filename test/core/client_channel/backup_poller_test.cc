@@ -0,0 +1,194 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+// This test won't work except with posix sockets enabled
+#ifdef GRPC_POSIX_SOCKET
+
+#include "src/core/ext/filters/client_channel/backup_poller.h"
+
+#include <unistd.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+#include <grpc/support/useful.h>
+
+#include "src/core/lib/gpr/env.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/pollset_set.h"
+#include "test/core/util/test_config.h"
+
+#define POLL_INTERVAL_MS 100
+/* as many shards as backup_poller.cc ever creates */
+#define MAX_SHARDS 16
+
+/* Wait up to 5 seconds for the backup poller's polling interval to satisfy
+   pred */
+static bool wait_for_interval(grpc_client_channel_backup_poller* poller,
+                              bool (*pred)(grpc_millis interval)) {
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(5);
+  while (!pred(grpc_client_channel_backup_poller_get_interval_for_testing(
+      poller))) {
+    if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) > 0) {
+      return false;
+    }
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+  }
+  return true;
+}
+
+static bool is_disarmed(grpc_millis interval) { return interval == 0; }
+static bool is_shortened(grpc_millis interval) {
+  return interval > 0 && interval < POLL_INTERVAL_MS;
+}
+static bool is_full(grpc_millis interval) {
+  return interval == POLL_INTERVAL_MS;
+}
+
+/* Channels are spread round-robin over the shards, one per core */
+static void test_shards(void) {
+  gpr_log(GPR_INFO, "test_shards");
+  grpc_core::ExecCtx exec_ctx;
+  size_t num_shards = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_SHARDS);
+  grpc_pollset_set* interested_parties[2 * MAX_SHARDS];
+  grpc_client_channel_backup_poller* pollers[2 * MAX_SHARDS];
+  for (size_t i = 0; i < 2 * MAX_SHARDS; i++) {
+    interested_parties[i] = grpc_pollset_set_create();
+    pollers[i] =
+        grpc_client_channel_start_backup_polling(interested_parties[i]);
+    GPR_ASSERT(pollers[i] != nullptr);
+  }
+  grpc_pollset* pollsets[2 * MAX_SHARDS];
+  for (size_t i = 0; i < 2 * MAX_SHARDS; i++) {
+    pollsets[i] =
+        grpc_client_channel_backup_poller_get_pollset_for_testing(pollers[i]);
+    for (size_t j = 0; j < i; j++) {
+      GPR_ASSERT((pollsets[i] == pollsets[j]) == ((i - j) % num_shards == 0));
+    }
+  }
+  for (size_t i = 0; i < 2 * MAX_SHARDS; i++) {
+    /* nothing is in flight: no shard polls */
+    GPR_ASSERT(grpc_client_channel_backup_poller_get_interval_for_testing(
+                   pollers[i]) == 0);
+    grpc_client_channel_stop_backup_polling(pollers[i], interested_parties[i]);
+    grpc_pollset_set_destroy(interested_parties[i]);
+  }
+}
+
+static void set_flag(void* arg, grpc_error* error) {
+  gpr_atm_rel_store((gpr_atm*)arg, 1);
+}
+
+/* Wait up to 'ms' for flag to be set */
+static bool wait_for_flag(gpr_atm* flag, int ms) {
+  gpr_timespec deadline = grpc_timeout_milliseconds_to_deadline(ms);
+  while (!gpr_atm_acq_load(flag)) {
+    if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) > 0) {
+      return false;
+    }
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+  }
+  return true;
+}
+
+/* Nothing but the backup poller polls in this test: an fd in the channel's
+   interested parties is only noticed while the poller is armed, i.e. while
+   the channel has calls in flight or is connected. Polls that find events
+   shorten the interval; it grows back once they stop */
+static void test_lazy_arming(void) {
+  gpr_log(GPR_INFO, "test_lazy_arming");
+  grpc_core::ExecCtx exec_ctx;
+  int pipe_fds[2];
+  GPR_ASSERT(pipe(pipe_fds) == 0);
+  grpc_fd* fd = grpc_fd_create(pipe_fds[0], "test_lazy_arming");
+  grpc_pollset_set* interested_parties = grpc_pollset_set_create();
+  grpc_pollset_set_add_fd(interested_parties, fd);
+  grpc_client_channel_backup_poller* poller =
+      grpc_client_channel_start_backup_polling(interested_parties);
+  GPR_ASSERT(poller != nullptr);
+  gpr_atm readable = 0;
+  grpc_closure on_readable;
+  GRPC_CLOSURE_INIT(&on_readable, set_flag, &readable,
+                    grpc_schedule_on_exec_ctx);
+  grpc_fd_notify_on_read(fd, &on_readable);
+  grpc_core::ExecCtx::Get()->Flush();
+
+  /* idle: the data goes unnoticed */
+  GPR_ASSERT(write(pipe_fds[1], "x", 1) == 1);
+  GPR_ASSERT(!wait_for_flag(&readable, 5 * POLL_INTERVAL_MS));
+  GPR_ASSERT(grpc_client_channel_backup_poller_get_interval_for_testing(
+                 poller) == 0);
+
+  /* a call in flight arms the poller, which finds the data */
+  grpc_client_channel_backup_poller_call_started(poller);
+  GPR_ASSERT(wait_for_flag(&readable, 5000));
+
+  /* while its polls keep finding data, the interval shortens... */
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(5);
+  do {
+    GPR_ASSERT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) < 0);
+    gpr_atm_rel_store(&readable, 0);
+    grpc_fd_notify_on_read(fd, &on_readable);
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(write(pipe_fds[1], "x", 1) == 1);
+    GPR_ASSERT(wait_for_flag(&readable, 5000));
+  } while (!is_shortened(
+      grpc_client_channel_backup_poller_get_interval_for_testing(poller)));
+  /* ...and it grows back once they stop */
+  GPR_ASSERT(wait_for_interval(poller, is_full));
+
+  /* once the call is done, the poller disarms when it next fires */
+  grpc_client_channel_backup_poller_call_finished(poller);
+  GPR_ASSERT(wait_for_interval(poller, is_disarmed));
+
+  /* a connected channel keeps it armed too */
+  grpc_client_channel_backup_poller_set_connected(poller, true);
+  grpc_client_channel_backup_poller_set_connected(poller, true);
+  GPR_ASSERT(grpc_client_channel_backup_poller_get_interval_for_testing(
+                 poller) > 0);
+  grpc_client_channel_backup_poller_set_connected(poller, false);
+  GPR_ASSERT(wait_for_interval(poller, is_disarmed));
+
+  grpc_client_channel_stop_backup_polling(poller, interested_parties);
+  grpc_pollset_set_del_fd(interested_parties, fd);
+  grpc_pollset_set_destroy(interested_parties);
+  int release_fd;
+  grpc_fd_orphan(fd, nullptr, &release_fd, false, "test_lazy_arming");
+  close(release_fd);
+  close(pipe_fds[1]);
+}
+
+int main(int argc, char** argv) {
+  grpc_test_init(argc, argv);
+  /* poll every POLL_INTERVAL_MS */
+  gpr_setenv("GRPC_CLIENT_CHANNEL_BACKUP_POLL_INTERVAL_MS", "100");
+  grpc_init();
+  test_shards();
+  test_lazy_arming();
+  grpc_shutdown();
+  return 0;
+}
+
+#else /* GRPC_POSIX_SOCKET */
+
+int main(int argc, char** argv) { return 1; }
+
+#endif /* GRPC_POSIX_SOCKET */
@@ -98,6 +98,8 @@ extern void negative_deadline(grpc_end2end_test_config config);
 extern void negative_deadline_pre_init(void);
 extern void network_status_change(grpc_end2end_test_config config);
 extern void network_status_change_pre_init(void);
+extern void network_timeline(grpc_end2end_test_config config);
+extern void network_timeline_pre_init(void);
 extern void no_logging(grpc_end2end_test_config config);
 extern void no_logging_pre_init(void);
 extern void no_op(grpc_end2end_test_config config);
@@ -187,6 +189,7 @@ void grpc_end2end_tests_pre_init(void) {
   max_message_length_pre_init();
   negative_deadline_pre_init();
   network_status_change_pre_init();
+  network_timeline_pre_init();
   no_logging_pre_init();
   no_op_pre_init();
   payload_pre_init();
@@ -255,6 +258,7 @@ void grpc_end2end_tests(int argc, char **argv,
     max_message_length(config);
     negative_deadline(config);
     network_status_change(config);
+    network_timeline(config);
     no_logging(config);
     no_op(config);
     payload(config);
@@ -420,6 +424,10 @@ void grpc_end2end_tests(int argc, char **argv,
       network_status_change(config);
       continue;
     }
+    if (0 == strcmp("network_timeline", argv[i])) {
+      network_timeline(config);
+      continue;
+    }
     if (0 == strcmp("no_logging", argv[i])) {
       no_logging(config);
       continue;
@@ -52,6 +52,8 @@ END2END_FIXTURES = {
         ci_mac=False, exclude_iomgrs=['uv']),
     'h2_proxy': default_unsecure_fixture_options._replace(
         includes_proxy=True, ci_mac=False, exclude_iomgrs=['uv']),
+    'h2_shm': uds_fixture_options._replace(
+        platforms=['linux'], ci_mac=False),
     'h2_sockpair_1byte': socketpair_unsecure_fixture_options._replace(
         ci_mac=False, exclude_configs=['msan'], large_writes=False,
         exclude_iomgrs=['uv']),
@@ -122,6 +124,7 @@ END2END_TESTS = {
     'max_message_length': default_test_options._replace(cpu_cost=LOWCPU),
     'negative_deadline': default_test_options,
     'network_status_change': default_test_options._replace(cpu_cost=LOWCPU),
+    'network_timeline': default_test_options._replace(cpu_cost=LOWCPU),
     'no_logging': default_test_options._replace(traceable=False),
     'no_op': default_test_options,
     'payload': default_test_options,
@@ -53,6 +53,7 @@ END2END_FIXTURES = {
     'h2_http_proxy': fixture_options(supports_proxy_auth=True),
     'h2_oauth2': fixture_options(),
     'h2_proxy': fixture_options(includes_proxy=True),
+    'h2_shm': fixture_options(dns_resolver=False, platforms=['linux']),
     'h2_sockpair_1byte': fixture_options(fullstack=False, dns_resolver=False),
     'h2_sockpair': fixture_options(fullstack=False, dns_resolver=False),
     'h2_sockpair+trace': fixture_options(fullstack=False, dns_resolver=False,
@@ -122,6 +123,7 @@ END2END_TESTS = {
     'max_message_length': test_options(),
     'negative_deadline': test_options(),
     'network_status_change': test_options(),
+    'network_timeline': test_options(),
     'no_logging': test_options(traceable=False),
     'no_op': test_options(),
     'payload': test_options(),
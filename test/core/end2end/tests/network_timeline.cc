@@ -0,0 +1,277 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "test/core/end2end/end2end_tests.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <grpc/byte_buffer.h>
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+#include <grpc/support/useful.h>
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/end2end/cq_verifier.h"
+
+static void* tag(intptr_t t) { return (void*)t; }
+
+static grpc_end2end_test_fixture begin_test(grpc_end2end_test_config config,
+                                            const char* test_name,
+                                            grpc_channel_args* client_args,
+                                            grpc_channel_args* server_args) {
+  grpc_end2end_test_fixture f;
+  gpr_log(GPR_INFO, "Running test: %s/%s", test_name, config.name);
+  f = config.create_fixture(client_args, server_args);
+  config.init_server(&f, server_args);
+  config.init_client(&f, client_args);
+  return f;
+}
+
+static gpr_timespec n_seconds_from_now(int n) {
+  return grpc_timeout_seconds_to_deadline(n);
+}
+
+static gpr_timespec five_seconds_from_now(void) {
+  return n_seconds_from_now(5);
+}
+
+static void drain_cq(grpc_completion_queue* cq) {
+  grpc_event ev;
+  do {
+    ev = grpc_completion_queue_next(cq, five_seconds_from_now(), nullptr);
+  } while (ev.type != GRPC_QUEUE_SHUTDOWN);
+}
+
+static void shutdown_server(grpc_end2end_test_fixture* f) {
+  if (!f->server) return;
+  grpc_server_shutdown_and_notify(f->server, f->shutdown_cq, tag(1000));
+  GPR_ASSERT(grpc_completion_queue_pluck(f->shutdown_cq, tag(1000),
+                                         grpc_timeout_seconds_to_deadline(5),
+                                         nullptr)
+                 .type == GRPC_OP_COMPLETE);
+  grpc_server_destroy(f->server);
+  f->server = nullptr;
+}
+
+static void shutdown_client(grpc_end2end_test_fixture* f) {
+  if (!f->client) return;
+  grpc_channel_destroy(f->client);
+  f->client = nullptr;
+}
+
+static void end_test(grpc_end2end_test_fixture* f) {
+  shutdown_server(f);
+  shutdown_client(f);
+
+  grpc_completion_queue_shutdown(f->cq);
+  drain_cq(f->cq);
+  grpc_completion_queue_destroy(f->cq);
+  grpc_completion_queue_destroy(f->shutdown_cq);
+}
+
+/* Run a unary call to completion on both sides, leaving its client and
+   server calls in *c and *s */
+static void run_call(grpc_end2end_test_config config,
+                     grpc_end2end_test_fixture f, grpc_call** c,
+                     grpc_call** s) {
+  cq_verifier* cqv = cq_verifier_create(f.cq);
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  int was_cancelled = 2;
+
+  gpr_timespec deadline = five_seconds_from_now();
+  *c = grpc_channel_create_call(
+      f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+      grpc_slice_from_static_string("/foo"),
+      get_host_override_slice("foo.test.google.fr:1234", config), deadline,
+      nullptr);
+  GPR_ASSERT(*c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_call_details_init(&call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(*c, ops, (size_t)(op - ops), tag(1), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  error =
+      grpc_server_request_call(f.server, s, &call_details,
+                               &request_metadata_recv, f.cq, f.cq, tag(101));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(101), 1);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_UNIMPLEMENTED;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(*s, ops, (size_t)(op - ops), tag(102), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(102), 1);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), 1);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_UNIMPLEMENTED);
+  GPR_ASSERT(was_cancelled == 1);
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+
+  cq_verifier_destroy(cqv);
+}
+
+static bool is_set(gpr_timespec ts) {
+  return gpr_time_cmp(ts, gpr_inf_past(GPR_CLOCK_REALTIME)) != 0;
+}
+
+/* Whether the fixture's calls must be timestamped */
+static bool expect_timestamps(grpc_end2end_test_config config) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  return (config.feature_mask & FEATURE_MASK_SUPPORTS_TCP_TIMESTAMPING) != 0;
+#else
+  return false;
+#endif
+}
+
+/* Fetch call's timeline into *timeline. If timestamps are expected, poll for
+   up to five seconds for the kernel to report both a write and a read of the
+   call, failing if it does not. Otherwise returns whether both are there */
+static bool get_timeline(grpc_end2end_test_config config,
+                         grpc_end2end_test_fixture f, grpc_call* call,
+                         grpc_call_network_timeline* timeline) {
+  gpr_timespec deadline = five_seconds_from_now();
+  while (!grpc_call_get_network_timeline(call, timeline) ||
+         !is_set(timeline->sent_scheduled) ||
+         !is_set(timeline->last_received)) {
+    if (!expect_timestamps(config)) return false;
+    GPR_ASSERT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) < 0);
+    GPR_ASSERT(grpc_completion_queue_next(
+                   f.cq, grpc_timeout_milliseconds_to_deadline(10), nullptr)
+                   .type == GRPC_QUEUE_TIMEOUT);
+  }
+  return true;
+}
+
+/* Check the timelines of a call made before split and of one made after it:
+   whatever the kernel reported must belong to the right call */
+static void check_timelines(grpc_end2end_test_config config,
+                            grpc_end2end_test_fixture f, grpc_call* before,
+                            grpc_call* after, gpr_timespec split) {
+  grpc_call_network_timeline timeline;
+  if (get_timeline(config, f, before, &timeline)) {
+    GPR_ASSERT(gpr_time_cmp(timeline.sent_scheduled, split) < 0);
+    GPR_ASSERT(gpr_time_cmp(timeline.first_received, timeline.last_received) <=
+               0);
+    GPR_ASSERT(gpr_time_cmp(timeline.last_received, split) < 0);
+  }
+  if (get_timeline(config, f, after, &timeline)) {
+    GPR_ASSERT(gpr_time_cmp(timeline.sent_scheduled, split) > 0);
+    GPR_ASSERT(gpr_time_cmp(timeline.first_received, split) > 0);
+    GPR_ASSERT(gpr_time_cmp(timeline.first_received, timeline.last_received) <=
+               0);
+  }
+}
+
+/* Two calls made one after the other on the same connection each get the
+   timestamps of their own traffic only, on both sides */
+static void test_timelines_per_call(grpc_end2end_test_config config) {
+  grpc_arg arg;
+  arg.type = GRPC_ARG_INTEGER;
+  arg.key = const_cast<char*>(GRPC_ARG_TCP_TIMESTAMPING);
+  arg.value.integer = 1;
+  grpc_channel_args args = {1, &arg};
+  grpc_end2end_test_fixture f =
+      begin_test(config, "test_timelines_per_call", &args, &args);
+  grpc_call* c1;
+  grpc_call* s1;
+  grpc_call* c2;
+  grpc_call* s2;
+
+  run_call(config, f, &c1, &s1);
+  gpr_timespec split = gpr_now(GPR_CLOCK_REALTIME);
+  run_call(config, f, &c2, &s2);
+
+  check_timelines(config, f, c1, c2, split);
+  check_timelines(config, f, s1, s2, split);
+
+  grpc_call_unref(c1);
+  grpc_call_unref(s1);
+  grpc_call_unref(c2);
+  grpc_call_unref(s2);
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+void network_timeline(grpc_end2end_test_config config) {
+  test_timelines_per_call(config);
+}
+
+void network_timeline_pre_init(void) {}
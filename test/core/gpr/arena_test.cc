@@ -115,6 +115,48 @@ static void concurrent_test(void) {
   gpr_arena_destroy(args.arena);
 }
 
+// Destroyed arenas get reused: memory from gpr_arena_alloc() must still be
+// zeroed
+static void test_recycled_memory_is_zeroed(void) {
+  gpr_log(GPR_DEBUG, "test_recycled_memory_is_zeroed");
+  for (int i = 0; i < 10; i++) {
+    gpr_arena* a = gpr_arena_create(1024);
+    for (int j = 0; j < 8; j++) {
+      char* p = static_cast<char*>(gpr_arena_alloc(a, 200));
+      for (int k = 0; k < 200; k++) {
+        GPR_ASSERT(p[k] == 0);
+      }
+      memset(p, 0xff, 200);
+    }
+    gpr_arena_destroy(a);
+  }
+}
+
+struct one_byte {
+  char c;
+};
+
+struct aligned_16 {
+  char c;
+} GPR_ALIGN_STRUCT(16);
+
+// Typed allocations only get the alignment they need, so they can be packed
+// more tightly than gpr_arena_alloc() allows, but never misaligned
+static void test_arena_new(void) {
+  gpr_log(GPR_DEBUG, "test_arena_new");
+  gpr_arena* a = gpr_arena_create(1024);
+  char* first = &grpc_core::ArenaNew<one_byte>(a)->c;
+  char* second = &grpc_core::ArenaNew<one_byte>(a)->c;
+  GPR_ASSERT(second == first + 1);
+  for (int i = 0; i < 100; i++) {
+    GPR_ASSERT(((intptr_t)grpc_core::ArenaNew<aligned_16>(a) & 0xf) == 0);
+    GPR_ASSERT(((intptr_t)grpc_core::ArenaNew<int64_t>(a, i) & 0x7) == 0);
+    GPR_ASSERT(*grpc_core::ArenaNew<int64_t>(a, i) == i);
+    grpc_core::ArenaNew<one_byte>(a);
+  }
+  gpr_arena_destroy(a);
+}
+
 int main(int argc, char* argv[]) {
   grpc_test_init(argc, argv);
 
@@ -126,6 +168,8 @@ int main(int argc, char* argv[]) {
   TEST(1_inc, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
   TEST(6_123, 6, 1, 2, 3);
   concurrent_test();
+  test_recycled_memory_is_zeroed();
+  test_arena_new();
 
   return 0;
 }
@@ -0,0 +1,177 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/gpr/epoch_reclaim.h"
+
+#include <stdlib.h>
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/thd.h>
+
+#include "test/core/util/test_config.h"
+
+/* Every allocation gets a header saying whether it is a test item, so that
+   freeing one can be noticed */
+#define HEADER_SIZE 16
+#define ITEM_TAG 0x17e3
+
+typedef struct item {
+  gpr_atm alive;
+} item;
+
+static gpr_atm g_items_freed;
+
+static void* test_malloc(size_t size) {
+  char* p = static_cast<char*>(malloc(HEADER_SIZE + size));
+  GPR_ASSERT(p != nullptr);
+  *(intptr_t*)p = 0;
+  return p + HEADER_SIZE;
+}
+
+static void* test_realloc(void* ptr, size_t size) {
+  if (ptr == nullptr) return test_malloc(size);
+  char* p = static_cast<char*>(realloc((char*)ptr - HEADER_SIZE,
+                                       HEADER_SIZE + size));
+  GPR_ASSERT(p != nullptr);
+  return p + HEADER_SIZE;
+}
+
+static void test_free(void* ptr) {
+  if (ptr == nullptr) return;
+  char* p = (char*)ptr - HEADER_SIZE;
+  if (*(intptr_t*)p == ITEM_TAG) {
+    /* poison it: readers that still see it notice */
+    gpr_atm_rel_store(&static_cast<item*>(ptr)->alive, 0);
+    gpr_atm_full_fetch_add(&g_items_freed, 1);
+  }
+  free(p);
+}
+
+static item* item_create(void) {
+  item* it = static_cast<item*>(gpr_malloc(sizeof(*it)));
+  *(intptr_t*)((char*)it - HEADER_SIZE) = ITEM_TAG;
+  gpr_atm_rel_store(&it->alive, 1);
+  return it;
+}
+
+static gpr_atm items_freed(void) { return gpr_atm_acq_load(&g_items_freed); }
+
+#define NUM_ITEMS 1000
+
+/* With no read sections, retired memory is freed as retiring goes on */
+static void test_freed_without_readers(void) {
+  gpr_log(GPR_INFO, "test_freed_without_readers");
+  gpr_epoch_init();
+  gpr_atm freed = items_freed();
+  for (int i = 0; i < NUM_ITEMS; i++) {
+    gpr_epoch_retire(item_create());
+  }
+  GPR_ASSERT(items_freed() - freed >= NUM_ITEMS / 2);
+  gpr_epoch_shutdown();
+  GPR_ASSERT(items_freed() - freed == NUM_ITEMS);
+}
+
+/* Nothing retired during a read section is freed before it ends */
+static void test_read_section_holds_back(void) {
+  gpr_log(GPR_INFO, "test_read_section_holds_back");
+  gpr_epoch_init();
+  item* held[NUM_ITEMS];
+  gpr_atm freed = items_freed();
+  gpr_atm* reader = gpr_epoch_read_begin();
+  for (int i = 0; i < NUM_ITEMS; i++) {
+    held[i] = item_create();
+    gpr_epoch_retire(held[i]);
+  }
+  GPR_ASSERT(items_freed() == freed);
+  for (int i = 0; i < NUM_ITEMS; i++) {
+    GPR_ASSERT(gpr_atm_acq_load(&held[i]->alive));
+  }
+  gpr_epoch_read_end(reader);
+  /* further retires free them */
+  for (int i = 0; i < NUM_ITEMS; i++) {
+    gpr_epoch_retire(item_create());
+  }
+  GPR_ASSERT(items_freed() - freed >= NUM_ITEMS);
+  gpr_epoch_shutdown();
+}
+
+#define NUM_WRITERS 4
+#define NUM_READERS 4
+#define WRITES_PER_WRITER 20000
+
+typedef struct concurrent_state {
+  gpr_atm current; /* item*: replaced and retired by the writers */
+  gpr_atm writers_done;
+} concurrent_state;
+
+static void writer(void* arg) {
+  concurrent_state* state = static_cast<concurrent_state*>(arg);
+  for (int i = 0; i < WRITES_PER_WRITER; i++) {
+    item* old =
+        (item*)gpr_atm_full_xchg(&state->current, (gpr_atm)item_create());
+    gpr_epoch_retire(old);
+  }
+  gpr_atm_full_fetch_add(&state->writers_done, 1);
+}
+
+static void reader(void* arg) {
+  concurrent_state* state = static_cast<concurrent_state*>(arg);
+  while (gpr_atm_acq_load(&state->writers_done) < NUM_WRITERS) {
+    gpr_atm* r = gpr_epoch_read_begin();
+    item* it = (item*)gpr_atm_acq_load(&state->current);
+    GPR_ASSERT(gpr_atm_acq_load(&it->alive));
+    gpr_epoch_read_end(r);
+  }
+}
+
+/* Readers never see retired memory freed under them while writers keep
+   replacing it */
+static void test_concurrent(void) {
+  gpr_log(GPR_INFO, "test_concurrent");
+  gpr_epoch_init();
+  concurrent_state state;
+  gpr_atm_rel_store(&state.current, (gpr_atm)item_create());
+  gpr_atm_rel_store(&state.writers_done, 0);
+  gpr_atm freed = items_freed();
+  gpr_thd_id thds[NUM_WRITERS + NUM_READERS];
+  for (int i = 0; i < NUM_WRITERS + NUM_READERS; i++) {
+    gpr_thd_options opt = gpr_thd_options_default();
+    gpr_thd_options_set_joinable(&opt);
+    GPR_ASSERT(gpr_thd_new(&thds[i], "grpc_epoch_reclaim_test",
+                           i < NUM_WRITERS ? writer : reader, &state, &opt));
+  }
+  for (int i = 0; i < NUM_WRITERS + NUM_READERS; i++) {
+    gpr_thd_join(thds[i]);
+  }
+  gpr_epoch_retire((void*)gpr_atm_acq_load(&state.current));
+  gpr_epoch_shutdown();
+  GPR_ASSERT(items_freed() - freed == NUM_WRITERS * WRITES_PER_WRITER + 1);
+}
+
+int main(int argc, char** argv) {
+  /* before anything is allocated */
+  gpr_allocation_functions fns = {test_malloc, nullptr, test_realloc,
+                                  test_free};
+  gpr_set_allocation_functions(fns);
+  grpc_test_init(argc, argv);
+  test_freed_without_readers();
+  test_read_section_holds_back();
+  test_concurrent();
+  return 0;
+}
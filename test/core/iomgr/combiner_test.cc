@@ -145,12 +145,38 @@ static void test_execute_finally(void) {
   GRPC_COMBINER_UNREF(lock, "test_execute_finally");
 }
 
+static void schedule_check_one(size_t* ctr, size_t value,
+                               grpc_closure_scheduler* scheduler) {
+  ex_args* c = static_cast<ex_args*>(gpr_malloc(sizeof(*c)));
+  c->ctr = ctr;
+  c->value = value;
+  GRPC_CLOSURE_SCHED(GRPC_CLOSURE_CREATE(check_one, c, scheduler),
+                     GRPC_ERROR_NONE);
+}
+
+static void test_execute_background(void) {
+  gpr_log(GPR_DEBUG, "test_execute_background");
+
+  grpc_combiner* lock = grpc_combiner_create();
+  grpc_core::ExecCtx exec_ctx;
+  size_t ctr = 0;
+  // Background work runs after latency-critical work scheduled later, and in
+  // order with other background work.
+  schedule_check_one(&ctr, 2, grpc_combiner_background_scheduler(lock));
+  schedule_check_one(&ctr, 3, grpc_schedule_on_exec_ctx_background);
+  schedule_check_one(&ctr, 1, grpc_combiner_scheduler(lock));
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(ctr == 3);
+  GRPC_COMBINER_UNREF(lock, "test_execute_background");
+}
+
 int main(int argc, char** argv) {
   grpc_test_init(argc, argv);
   grpc_init();
   test_no_op();
   test_execute_one();
   test_execute_finally();
+  test_execute_background();
   test_execute_many();
   grpc_shutdown();
 
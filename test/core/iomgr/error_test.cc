@@ -199,6 +199,80 @@ static void test_special() {
   GRPC_ERROR_UNREF(error);
 }
 
+static void test_for_status() {
+  GPR_ASSERT(grpc_error_for_status(GRPC_STATUS_OK) == GRPC_ERROR_NONE);
+  GPR_ASSERT(grpc_error_for_status(GRPC_STATUS_CANCELLED) ==
+             GRPC_ERROR_CANCELLED);
+
+  grpc_error* error = grpc_error_for_status(GRPC_STATUS_UNAVAILABLE);
+  GPR_ASSERT(error == grpc_error_for_status(GRPC_STATUS_UNAVAILABLE));
+  intptr_t i;
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_UNAVAILABLE);
+  grpc_slice str;
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_DESCRIPTION, &str));
+  GPR_ASSERT(!strncmp((char*)GRPC_SLICE_START_PTR(str), "Unavailable",
+                      GRPC_SLICE_LENGTH(str)));
+  GRPC_ERROR_UNREF(GRPC_ERROR_REF(error));
+
+  // setting an attribute leaves the preallocated error alone
+  grpc_error* derived = grpc_error_set_str(
+      error, GRPC_ERROR_STR_GRPC_MESSAGE, grpc_slice_from_static_string("msg"));
+  GPR_ASSERT(derived != error);
+  GPR_ASSERT(!grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  GPR_ASSERT(grpc_error_get_str(derived, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  GPR_ASSERT(grpc_error_get_int(derived, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_UNAVAILABLE);
+  GPR_ASSERT(strstr(grpc_error_string(derived), "\"Unavailable\""));
+  GPR_ASSERT(strstr(grpc_error_string(derived), "\"msg\""));
+  GRPC_ERROR_UNREF(derived);
+
+  error = grpc_error_for_status((grpc_status_code)100);
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == 100);
+  GRPC_ERROR_UNREF(error);
+}
+
+static void test_set_on_shared() {
+  grpc_error* error = grpc_error_add_child(
+      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Shared"),
+      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Child1"));
+  grpc_error* errors[8];
+  errors[0] = error;
+  // each error in turn is shared when an attribute is set on it
+  for (size_t n = 1; n < GPR_ARRAY_SIZE(errors); n++) {
+    errors[n] =
+        grpc_error_set_int(GRPC_ERROR_REF(errors[n - 1]),
+                           GRPC_ERROR_INT_SIZE, static_cast<intptr_t>(n));
+  }
+  errors[7] = grpc_error_add_child(
+      errors[7], GRPC_ERROR_CREATE_FROM_STATIC_STRING("Child2"));
+  // the errors were shared, so none of them changed
+  for (size_t n = 0; n < GPR_ARRAY_SIZE(errors); n++) {
+    intptr_t i;
+    if (n == 0) {
+      GPR_ASSERT(!grpc_error_get_int(errors[n], GRPC_ERROR_INT_SIZE, &i));
+    } else {
+      GPR_ASSERT(grpc_error_get_int(errors[n], GRPC_ERROR_INT_SIZE, &i));
+      GPR_ASSERT(i == static_cast<intptr_t>(n));
+    }
+    grpc_slice str;
+    GPR_ASSERT(grpc_error_get_str(errors[n], GRPC_ERROR_STR_DESCRIPTION, &str));
+    GPR_ASSERT(!strncmp((char*)GRPC_SLICE_START_PTR(str), "Shared",
+                        GRPC_SLICE_LENGTH(str)));
+  }
+  GPR_ASSERT(strstr(grpc_error_string(errors[6]), "Child2") == nullptr);
+  // children are listed in the order they were added
+  const char* s = grpc_error_string(errors[7]);
+  GPR_ASSERT(strstr(s, "Child1") != nullptr);
+  GPR_ASSERT(strstr(s, "Child1") < strstr(s, "Child2"));
+  GPR_ASSERT(strstr(s, "\"size\":7") != nullptr);
+  // errors keep the errors they were made from alive
+  for (size_t n = 0; n < GPR_ARRAY_SIZE(errors); n++) {
+    GRPC_ERROR_UNREF(errors[n]);
+  }
+}
+
 static void test_overflow() {
   grpc_error* error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Overflow");
 
@@ -238,6 +312,8 @@ int main(int argc, char** argv) {
   test_create_referencing();
   test_create_referencing_many();
   test_special();
+  test_for_status();
+  test_set_on_shared();
   test_overflow();
   grpc_shutdown();
 
@@ -0,0 +1,265 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "src/core/lib/iomgr/port.h"
+
+/* This test only relevant on linux systems where epoll() is available */
+#ifdef GRPC_LINUX_EPOLL
+#include "src/core/lib/iomgr/ev_epoll1_linux.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/thd.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/iomgr/iomgr.h"
+#include "test/core/util/test_config.h"
+
+typedef struct test_pollset {
+  grpc_pollset* pollset;
+  gpr_mu* mu;
+} test_pollset;
+
+static void test_pollset_init(test_pollset* tps) {
+  tps->pollset = (grpc_pollset*)gpr_zalloc(grpc_pollset_size());
+  grpc_pollset_init(tps->pollset, &tps->mu);
+}
+
+static void destroy_pollset(void* p, grpc_error* error) {
+  grpc_pollset_destroy((grpc_pollset*)p);
+}
+
+static void test_pollset_cleanup(test_pollset* tps) {
+  grpc_closure destroyed;
+  GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, tps->pollset,
+                    grpc_schedule_on_exec_ctx);
+  grpc_pollset_shutdown(tps->pollset, &destroyed);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_free(tps->pollset);
+}
+
+static int64_t counter_delta(const grpc_stats_data* before,
+                             const grpc_stats_data* after,
+                             grpc_stats_counters counter) {
+  return after->counters[counter] - before->counters[counter];
+}
+
+/* Run one pollset_work() call on tps, returning how long it took */
+static gpr_timespec work_once(test_pollset* tps, grpc_millis timeout_ms) {
+  gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  gpr_mu_lock(tps->mu);
+  GPR_ASSERT(GRPC_LOG_IF_ERROR(
+      "pollset_work",
+      grpc_pollset_work(tps->pollset, nullptr,
+                        grpc_core::ExecCtx::Get()->Now() + timeout_ms)));
+  gpr_mu_unlock(tps->mu);
+  grpc_core::ExecCtx::Get()->Flush();
+  return gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start);
+}
+
+/* With nothing to do, the designated poller spins through its whole budget and
+   then blocks; the spin counts as a single poll however many times it went
+   round */
+static void test_spin_miss(void) {
+  test_pollset tps;
+  grpc_stats_data before;
+  grpc_stats_data after;
+
+  test_pollset_init(&tps);
+  grpc_pollset_configure_spin(tps.pollset, 5000);
+
+  grpc_stats_collect(&before);
+  work_once(&tps, 50);
+  grpc_stats_collect(&after);
+
+  GPR_ASSERT(counter_delta(&before, &after,
+                           GRPC_STATS_COUNTER_POLLSET_SPIN_MISSES) == 1);
+  GPR_ASSERT(counter_delta(&before, &after,
+                           GRPC_STATS_COUNTER_POLLSET_SPIN_HITS) == 0);
+  /* one spin plus one blocking epoll_wait */
+  GPR_ASSERT(counter_delta(&before, &after, GRPC_STATS_COUNTER_SYSCALL_POLL) <=
+             2);
+
+  test_pollset_cleanup(&tps);
+}
+
+typedef struct delayed_write_args {
+  int fd;
+  int delay_ms;
+} delayed_write_args;
+
+static void delayed_write(void* arg) {
+  delayed_write_args* args = (delayed_write_args*)arg;
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(args->delay_ms));
+  GPR_ASSERT(write(args->fd, "x", 1) == 1);
+}
+
+/* An fd becoming readable while the designated poller spins is picked up
+   without blocking */
+static void test_spin_hit(void) {
+  test_pollset tps;
+  grpc_stats_data before;
+  grpc_stats_data after;
+  int fds[2];
+
+  GPR_ASSERT(pipe(fds) == 0);
+  grpc_fd* fd = grpc_fd_create(fds[0], "test_spin_hit");
+  test_pollset_init(&tps);
+  grpc_pollset_add_fd(tps.pollset, fd);
+  /* far longer than the write takes to arrive */
+  grpc_pollset_configure_spin(tps.pollset, 5 * GPR_US_PER_SEC);
+
+  delayed_write_args args = {fds[1], 20};
+  gpr_thd_id thd;
+  gpr_thd_options opt = gpr_thd_options_default();
+  gpr_thd_options_set_joinable(&opt);
+  grpc_stats_collect(&before);
+  GPR_ASSERT(gpr_thd_new(&thd, "grpc_delayed_write", delayed_write, &args,
+                         &opt));
+  gpr_timespec took = work_once(&tps, 10000);
+  gpr_thd_join(thd);
+  grpc_stats_collect(&after);
+
+  GPR_ASSERT(counter_delta(&before, &after,
+                           GRPC_STATS_COUNTER_POLLSET_SPIN_HITS) == 1);
+  GPR_ASSERT(counter_delta(&before, &after,
+                           GRPC_STATS_COUNTER_POLLSET_SPIN_MISSES) == 0);
+  GPR_ASSERT(counter_delta(&before, &after, GRPC_STATS_COUNTER_SYSCALL_POLL) ==
+             1);
+  GPR_ASSERT(gpr_time_cmp(took, gpr_time_from_seconds(5, GPR_TIMESPAN)) < 0);
+
+  int release_fd;
+  grpc_fd_orphan(fd, nullptr, &release_fd, false, "test_spin_hit");
+  test_pollset_cleanup(&tps);
+  close(fds[0]);
+  close(fds[1]);
+}
+
+#define HANDBACK_NUM_FDS 128
+
+typedef struct hold_first_set_args {
+  test_pollset* tps;
+  int write_fd;
+} hold_first_set_args;
+
+static void count_readable(void* arg, grpc_error* error) {
+  gpr_atm_no_barrier_fetch_add((gpr_atm*)arg, 1);
+}
+
+/* Claims g_epoll_sets[0] for 100ms, then makes the pipe readable once nobody
+   polls it any more */
+static void hold_first_set(void* arg) {
+  hold_first_set_args* args = (hold_first_set_args*)arg;
+  grpc_core::ExecCtx exec_ctx;
+  work_once(args->tps, 100);
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(200));
+  GPR_ASSERT(write(args->write_fd, "x", 1) == 1);
+}
+
+/* Sharded engine: a poller that leaves its set with events still to be
+   processed, and no worker to take over, hands them back to the poller of
+   g_epoll_sets[0] */
+static void test_leftover_events_handed_back(void) {
+  test_pollset first;
+  test_pollset tps;
+  grpc_fd* fds[HANDBACK_NUM_FDS];
+  grpc_closure on_readable[HANDBACK_NUM_FDS];
+  gpr_atm readable = 0;
+  int pipe_fds[2];
+
+  /* Every dup is an epoll registration of its own, so a single write makes
+     all of them ready at once. They are spread round-robin over the sets,
+     which gives every set at least two */
+  GPR_ASSERT(pipe(pipe_fds) == 0);
+  for (int i = 0; i < HANDBACK_NUM_FDS; i++) {
+    int fd = dup(pipe_fds[0]);
+    GPR_ASSERT(fd >= 0);
+    fds[i] = grpc_fd_create(fd, "test_leftover_events_handed_back");
+    GRPC_CLOSURE_INIT(&on_readable[i], count_readable, &readable,
+                      grpc_schedule_on_exec_ctx);
+    grpc_fd_notify_on_read(fds[i], &on_readable[i]);
+  }
+  test_pollset_init(&first);
+  test_pollset_init(&tps);
+
+  hold_first_set_args args = {&first, pipe_fds[1]};
+  gpr_thd_id thd;
+  gpr_thd_options opt = gpr_thd_options_default();
+  gpr_thd_options_set_joinable(&opt);
+  GPR_ASSERT(gpr_thd_new(&thd, "grpc_hold_first_set", hold_first_set, &args,
+                         &opt));
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(50));
+  /* With g_epoll_sets[0] taken this claims another set. It wakes up with all
+     of that set's events, processes one, and leaves: nobody is left to take
+     over the set */
+  work_once(&tps, 5000);
+  gpr_thd_join(thd);
+
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(5);
+  while (gpr_atm_no_barrier_load(&readable) < HANDBACK_NUM_FDS &&
+         gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) < 0) {
+    work_once(&tps, 100);
+  }
+  GPR_ASSERT(gpr_atm_no_barrier_load(&readable) == HANDBACK_NUM_FDS);
+
+  for (int i = 0; i < HANDBACK_NUM_FDS; i++) {
+    int release_fd;
+    grpc_fd_orphan(fds[i], nullptr, &release_fd, false,
+                   "test_leftover_events_handed_back");
+    close(release_fd);
+  }
+  test_pollset_cleanup(&first);
+  test_pollset_cleanup(&tps);
+  close(pipe_fds[0]);
+  close(pipe_fds[1]);
+}
+
+int main(int argc, char** argv) {
+  const char* poll_strategy = nullptr;
+  grpc_test_init(argc, argv);
+  grpc_init();
+  {
+    grpc_core::ExecCtx exec_ctx;
+
+    poll_strategy = grpc_get_poll_strategy_name();
+    if (poll_strategy != nullptr && strcmp(poll_strategy, "epoll1") == 0) {
+      test_spin_miss();
+      test_spin_hit();
+    } else if (poll_strategy != nullptr &&
+               strcmp(poll_strategy, "epoll1_sharded") == 0) {
+      test_leftover_events_handed_back();
+    } else {
+      gpr_log(GPR_INFO,
+              "Skipping the test. The test is only relevant for 'epoll1' and "
+              "'epoll1_sharded' strategies. and the current strategy is: '%s'",
+              poll_strategy);
+    }
+  }
+
+  grpc_shutdown();
+  return 0;
+}
+#else  /* defined(GRPC_LINUX_EPOLL) */
+int main(int argc, char** argv) { return 0; }
+#endif /* !defined(GRPC_LINUX_EPOLL) */
@@ -0,0 +1,78 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/executor.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+static void set_event_to_true(void* value, grpc_error* error) {
+  gpr_event_set(static_cast<gpr_event*>(value), (void*)1);
+}
+
+typedef struct {
+  gpr_event inner_done;
+  gpr_event done;
+} long_job_args;
+
+/* schedules a closure and blocks until it has run */
+static void long_job(void* arg, grpc_error* error) {
+  long_job_args* args = static_cast<long_job_args*>(arg);
+  GRPC_CLOSURE_SCHED(
+      GRPC_CLOSURE_CREATE(set_event_to_true, &args->inner_done,
+                          grpc_executor_scheduler(GRPC_EXECUTOR_SHORT)),
+      GRPC_ERROR_NONE);
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(gpr_event_wait(&args->inner_done,
+                            grpc_timeout_seconds_to_deadline(5)) != nullptr);
+  gpr_event_set(&args->done, (void*)1);
+}
+
+/* A closure scheduled by a long job must not wait behind it, even when the
+   executor has no other thread to run it yet */
+static void test_long_job_waits_for_closure(void) {
+  gpr_log(GPR_DEBUG, "test_long_job_waits_for_closure");
+
+  /* restart the executor with a single thread */
+  grpc_executor_set_threading(false);
+  grpc_executor_set_threading(true);
+
+  long_job_args args;
+  gpr_event_init(&args.inner_done);
+  gpr_event_init(&args.done);
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_CLOSURE_SCHED(
+      GRPC_CLOSURE_CREATE(long_job, &args,
+                          grpc_executor_scheduler(GRPC_EXECUTOR_LONG)),
+      GRPC_ERROR_NONE);
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(gpr_event_wait(&args.done, grpc_timeout_seconds_to_deadline(10)) !=
+             nullptr);
+}
+
+int main(int argc, char** argv) {
+  grpc_test_init(argc, argv);
+  grpc_init();
+  test_long_job_waits_for_closure();
+  grpc_shutdown();
+  return 0;
+}
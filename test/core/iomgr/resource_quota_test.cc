@@ -749,6 +749,184 @@ static void test_one_slice_deleted_late(void) {
   }
 }
 
+static void test_slices_are_recycled(void) {
+  gpr_log(GPR_INFO, "** test_slices_are_recycled **");
+
+  grpc_resource_quota* q =
+      grpc_resource_quota_create("test_slices_are_recycled");
+  grpc_resource_quota_resize(q, 1024 * 1024);
+
+  grpc_resource_user* usr = grpc_resource_user_create(q, "usr");
+
+  grpc_resource_user_slice_allocator alloc;
+  int num_allocs = 0;
+  grpc_resource_user_slice_allocator_init(&alloc, usr, inc_int_cb, &num_allocs);
+
+  grpc_slice_buffer buffer;
+  grpc_slice_buffer_init(&buffer);
+
+  uint8_t* first_block;
+  {
+    const int start_allocs = num_allocs;
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc_slices(&alloc, 1000, 1, &buffer);
+    grpc_core::ExecCtx::Get()->Flush();
+    assert_counter_becomes(&num_allocs, start_allocs + 1);
+    GPR_ASSERT(GRPC_SLICE_LENGTH(buffer.slices[0]) == 1000);
+    first_block = GRPC_SLICE_START_PTR(buffer.slices[0]);
+    grpc_slice_buffer_reset_and_unref_internal(&buffer);
+  }
+
+  {
+    /* same size class: the released block comes back */
+    const int start_allocs = num_allocs;
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc_slices(&alloc, 1024, 1, &buffer);
+    grpc_core::ExecCtx::Get()->Flush();
+    assert_counter_becomes(&num_allocs, start_allocs + 1);
+    GPR_ASSERT(GRPC_SLICE_LENGTH(buffer.slices[0]) == 1024);
+    GPR_ASSERT(GRPC_SLICE_START_PTR(buffer.slices[0]) == first_block);
+  }
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_slice_buffer_destroy_internal(&buffer);
+  }
+  destroy_user(usr);
+  grpc_resource_quota_unref(q);
+}
+
+/* a cached slice block must not stop the quota from handing its memory to
+   another user */
+static void test_recycled_slices_are_reclaimed(void) {
+  gpr_log(GPR_INFO, "** test_recycled_slices_are_reclaimed **");
+
+  grpc_resource_quota* q =
+      grpc_resource_quota_create("test_recycled_slices_are_reclaimed");
+  grpc_resource_quota_resize(q, 1024);
+
+  grpc_resource_user* usr1 = grpc_resource_user_create(q, "usr1");
+  grpc_resource_user* usr2 = grpc_resource_user_create(q, "usr2");
+
+  grpc_resource_user_slice_allocator alloc1;
+  grpc_resource_user_slice_allocator alloc2;
+  int num_allocs1 = 0;
+  int num_allocs2 = 0;
+  grpc_resource_user_slice_allocator_init(&alloc1, usr1, inc_int_cb,
+                                          &num_allocs1);
+  grpc_resource_user_slice_allocator_init(&alloc2, usr2, inc_int_cb,
+                                          &num_allocs2);
+
+  grpc_slice_buffer buffer;
+  grpc_slice_buffer_init(&buffer);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc_slices(&alloc1, 1024, 1, &buffer);
+    grpc_core::ExecCtx::Get()->Flush();
+    assert_counter_becomes(&num_allocs1, 1);
+    grpc_slice_buffer_reset_and_unref_internal(&buffer);
+  }
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc_slices(&alloc2, 1024, 1, &buffer);
+    grpc_core::ExecCtx::Get()->Flush();
+    assert_counter_becomes(&num_allocs2, 1);
+  }
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_slice_buffer_destroy_internal(&buffer);
+  }
+  destroy_user(usr1);
+  destroy_user(usr2);
+  grpc_resource_quota_unref(q);
+}
+
+/* releases 4 cached 1KB slice blocks into usr's slice cache */
+static void cache_four_blocks(grpc_resource_user_slice_allocator* alloc,
+                              int* num_allocs) {
+  grpc_slice_buffer buffer;
+  grpc_slice_buffer_init(&buffer);
+  const int start_allocs = *num_allocs;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_resource_user_alloc_slices(alloc, 1024, 4, &buffer);
+  grpc_core::ExecCtx::Get()->Flush();
+  assert_counter_becomes(num_allocs, start_allocs + 1);
+  grpc_slice_buffer_destroy_internal(&buffer);
+  GPR_ASSERT(grpc_resource_user_slice_cache_bytes_for_testing(
+                 alloc->resource_user) == 4096);
+}
+
+/* cached slice blocks are memory the quota counts as free in the resource
+   user's free pool: allocations that take that free pool must not leave them
+   cached, or the user holds more memory than the quota granted it */
+static void test_cached_slices_evicted_by_allocations(void) {
+  gpr_log(GPR_INFO, "** test_cached_slices_evicted_by_allocations **");
+
+  grpc_resource_quota* q =
+      grpc_resource_quota_create("test_cached_slices_evicted_by_allocations");
+  grpc_resource_quota_resize(q, 4096);
+
+  grpc_resource_user* usr = grpc_resource_user_create(q, "usr");
+
+  grpc_resource_user_slice_allocator alloc;
+  int num_allocs = 0;
+  grpc_resource_user_slice_allocator_init(&alloc, usr, inc_int_cb, &num_allocs);
+
+  grpc_slice_buffer buffer;
+  grpc_slice_buffer_init(&buffer);
+
+  double eps = 0.0001;
+  cache_four_blocks(&alloc, &num_allocs);
+  {
+    /* a plain allocation of the whole quota */
+    gpr_event ev;
+    gpr_event_init(&ev);
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc(usr, 4096, set_event(&ev));
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_seconds_to_deadline(5)) !=
+               nullptr);
+    GPR_ASSERT(grpc_resource_quota_get_memory_pressure(q) > 1 - eps);
+    GPR_ASSERT(grpc_resource_user_slice_cache_bytes_for_testing(usr) == 0);
+    grpc_resource_user_free(usr, 4096);
+  }
+
+  cache_four_blocks(&alloc, &num_allocs);
+  {
+    /* slices of another size class, missing the cache */
+    const int start_allocs = num_allocs;
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc_slices(&alloc, 2048, 2, &buffer);
+    grpc_core::ExecCtx::Get()->Flush();
+    assert_counter_becomes(&num_allocs, start_allocs + 1);
+    GPR_ASSERT(grpc_resource_quota_get_memory_pressure(q) > 1 - eps);
+    GPR_ASSERT(grpc_resource_user_slice_cache_bytes_for_testing(usr) == 0);
+    grpc_slice_buffer_reset_and_unref_internal(&buffer);
+  }
+
+  cache_four_blocks(&alloc, &num_allocs);
+  {
+    /* slices reusing half of the cache: the other half stays covered by the
+       free pool */
+    const int start_allocs = num_allocs;
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc_slices(&alloc, 1024, 2, &buffer);
+    grpc_core::ExecCtx::Get()->Flush();
+    assert_counter_becomes(&num_allocs, start_allocs + 1);
+    GPR_ASSERT(grpc_resource_user_slice_cache_bytes_for_testing(usr) == 2048);
+  }
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_slice_buffer_destroy_internal(&buffer);
+  }
+  destroy_user(usr);
+  grpc_resource_quota_unref(q);
+}
+
 static void test_resize_to_zero(void) {
   gpr_log(GPR_INFO, "** test_resize_to_zero **");
   grpc_resource_quota* q = grpc_resource_quota_create("test_resize_to_zero");
@@ -797,6 +975,89 @@ static void test_negative_rq_free_pool(void) {
   }
 }
 
+static void test_cpu_caches_are_reclaimed(void) {
+  gpr_log(GPR_INFO, "** test_cpu_caches_are_reclaimed **");
+  grpc_resource_quota* q =
+      grpc_resource_quota_create("test_cpu_caches_are_reclaimed");
+  grpc_resource_quota_resize(q, 1024 * 1024);
+  grpc_resource_user* usr1 = grpc_resource_user_create(q, "usr1");
+  grpc_resource_user* usr2 = grpc_resource_user_create(q, "usr2");
+  {
+    /* leaves the quota mostly free, so per-cpu caches get filled */
+    gpr_event ev;
+    gpr_event_init(&ev);
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc(usr1, 1024, set_event(&ev));
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_seconds_to_deadline(5)) !=
+               nullptr);
+  }
+  {
+    /* needs everything else, including what the caches hold */
+    gpr_event ev;
+    gpr_event_init(&ev);
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc(usr2, 1024 * 1024 - 1024, set_event(&ev));
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_seconds_to_deadline(5)) !=
+               nullptr);
+  }
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_free(usr1, 1024);
+    grpc_resource_user_free(usr2, 1024 * 1024 - 1024);
+  }
+  grpc_resource_quota_unref(q);
+  destroy_user(usr1);
+  destroy_user(usr2);
+}
+
+static void test_cpu_caches_respect_quota_size(void) {
+  gpr_log(GPR_INFO, "** test_cpu_caches_respect_quota_size **");
+  grpc_resource_quota* q =
+      grpc_resource_quota_create("test_cpu_caches_respect_quota_size");
+  grpc_resource_quota_resize(q, 64 * 1024);
+  grpc_resource_user* usrs[65];
+  for (int i = 0; i < 65; i++) {
+    usrs[i] = grpc_resource_user_create(q, "usr");
+  }
+  int num_allocs = 0;
+  for (int i = 0; i < 64; i++) {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc(
+        usrs[i], 1024,
+        GRPC_CLOSURE_CREATE(inc_int_cb, &num_allocs,
+                            grpc_schedule_on_exec_ctx));
+  }
+  assert_counter_becomes(&num_allocs, 64);
+  gpr_event ev;
+  gpr_event_init(&ev);
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_alloc(usrs[64], 1, set_event(&ev));
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(gpr_event_wait(
+                   &ev, grpc_timeout_milliseconds_to_deadline(100)) == nullptr);
+  }
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_resource_user_free(usrs[0], 1024);
+  }
+  GPR_ASSERT(gpr_event_wait(&ev, grpc_timeout_seconds_to_deadline(5)) !=
+             nullptr);
+  {
+    grpc_core::ExecCtx exec_ctx;
+    for (int i = 1; i < 64; i++) {
+      grpc_resource_user_free(usrs[i], 1024);
+    }
+    grpc_resource_user_free(usrs[64], 1);
+  }
+  grpc_resource_quota_unref(q);
+  for (int i = 0; i < 65; i++) {
+    destroy_user(usrs[i]);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc_test_init(argc, argv);
   grpc_init();
@@ -822,8 +1083,13 @@ int main(int argc, char** argv) {
   test_reclaimers_can_be_posted_repeatedly();
   test_one_slice();
   test_one_slice_deleted_late();
+  test_slices_are_recycled();
+  test_recycled_slices_are_reclaimed();
+  test_cached_slices_evicted_by_allocations();
   test_resize_to_zero();
   test_negative_rq_free_pool();
+  test_cpu_caches_are_reclaimed();
+  test_cpu_caches_respect_quota_size();
   gpr_mu_destroy(&g_mu);
   gpr_cv_destroy(&g_cv);
   grpc_shutdown();
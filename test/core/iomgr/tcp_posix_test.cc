@@ -25,6 +25,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <netinet/in.h>
 #include <string.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -36,6 +37,7 @@
 #include <grpc/support/time.h>
 #include <grpc/support/useful.h>
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "test/core/iomgr/endpoint_tests.h"
 #include "test/core/util/test_config.h"
@@ -68,6 +70,34 @@ static void create_sockets(int sv[2]) {
   GPR_ASSERT(fcntl(sv[1], F_SETFL, flags | O_NONBLOCK) == 0);
 }
 
+/* Connected TCP sockets over loopback: unlike a socketpair, these support
+   MSG_ZEROCOPY */
+static void create_inet_sockets(int sv[2]) {
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  int flags;
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  GPR_ASSERT(listener >= 0);
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  GPR_ASSERT(bind(listener, (struct sockaddr*)&addr, sizeof(addr)) == 0);
+  GPR_ASSERT(listen(listener, 1) == 0);
+  GPR_ASSERT(getsockname(listener, (struct sockaddr*)&addr, &len) == 0);
+  sv[0] = socket(AF_INET, SOCK_STREAM, 0);
+  GPR_ASSERT(sv[0] >= 0);
+  GPR_ASSERT(connect(sv[0], (struct sockaddr*)&addr, sizeof(addr)) == 0);
+  do {
+    sv[1] = accept(listener, nullptr, nullptr);
+  } while (sv[1] < 0 && errno == EINTR);
+  GPR_ASSERT(sv[1] >= 0);
+  close(listener);
+  flags = fcntl(sv[0], F_GETFL, 0);
+  GPR_ASSERT(fcntl(sv[0], F_SETFL, flags | O_NONBLOCK) == 0);
+  flags = fcntl(sv[1], F_GETFL, 0);
+  GPR_ASSERT(fcntl(sv[1], F_SETFL, flags | O_NONBLOCK) == 0);
+}
+
 static ssize_t fill_socket(int fd) {
   ssize_t write_bytes;
   ssize_t total_bytes = 0;
@@ -254,6 +284,77 @@ static void large_read_test(size_t slice_size) {
   grpc_endpoint_destroy(ep);
 }
 
+/* Write a small message, then read it with a large read chunk size: the read
+   buffer should be sized from the bytes the kernel reports pending, not from
+   the chunk size. */
+static void exact_read_size_test(bool inet) {
+  const size_t num_bytes = 1000;
+  int sv[2];
+  grpc_endpoint* ep;
+  struct read_socket_state state;
+  grpc_stats_data before;
+  grpc_stats_data after;
+  grpc_stats_data diff;
+  grpc_millis deadline =
+      grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(20));
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "Exact read size test, inet %d", inet);
+
+  if (inet) {
+    create_inet_sockets(sv);
+  } else {
+    create_sockets(sv);
+  }
+
+  grpc_arg a[1];
+  a[0].key = const_cast<char*>(GRPC_ARG_TCP_READ_CHUNK_SIZE);
+  a[0].type = GRPC_ARG_INTEGER, a[0].value.integer = 64 * 1024;
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  ep = grpc_tcp_create(grpc_fd_create(sv[1], "exact_read_size_test"), &args,
+                       "test");
+  grpc_endpoint_add_to_pollset(ep, g_pollset);
+
+  GPR_ASSERT(fill_socket_partial(sv[0], num_bytes) == num_bytes);
+
+  state.ep = ep;
+  state.read_bytes = 0;
+  state.target_read_bytes = num_bytes;
+  grpc_slice_buffer_init(&state.incoming);
+  GRPC_CLOSURE_INIT(&state.read_cb, read_cb, &state, grpc_schedule_on_exec_ctx);
+
+  grpc_stats_collect(&before);
+  grpc_endpoint_read(ep, &state.incoming, &state.read_cb);
+
+  gpr_mu_lock(g_mu);
+  while (state.read_bytes < state.target_read_bytes) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+    gpr_mu_unlock(g_mu);
+
+    gpr_mu_lock(g_mu);
+  }
+  GPR_ASSERT(state.read_bytes == state.target_read_bytes);
+  gpr_mu_unlock(g_mu);
+  grpc_stats_collect(&after);
+  grpc_stats_diff(&after, &before, &diff);
+
+  /* no read was offered a buffer larger than the data available */
+  GPR_ASSERT(grpc_stats_histo_count(&diff, GRPC_STATS_HISTOGRAM_TCP_READ_OFFER) >
+             0);
+  const grpc_stats_histograms h = GRPC_STATS_HISTOGRAM_TCP_READ_OFFER;
+  for (int i = 0; i < grpc_stats_histo_buckets[h]; i++) {
+    if ((size_t)grpc_stats_histo_bucket_boundaries[h][i] > num_bytes) {
+      GPR_ASSERT(diff.histograms[grpc_stats_histo_start[h] + i] == 0);
+    }
+  }
+
+  grpc_slice_buffer_destroy_internal(&state.incoming);
+  grpc_endpoint_destroy(ep);
+  close(sv[0]);
+}
+
 struct write_socket_state {
   grpc_endpoint* ep;
   int write_done;
@@ -336,8 +437,9 @@ void drain_socket_blocking(int fd, size_t num_bytes, size_t read_size) {
 
 /* Write to a socket using the grpc_tcp API, then drain it directly.
    Note that if the write does not complete immediately we need to drain the
-   socket in parallel with the read. */
-static void write_test(size_t num_bytes, size_t slice_size) {
+   socket in parallel with the read. If zerocopy is set, the write goes over
+   loopback TCP with MSG_ZEROCOPY enabled for every send. */
+static void write_test(size_t num_bytes, size_t slice_size, bool zerocopy) {
   int sv[2];
   grpc_endpoint* ep;
   struct write_socket_state state;
@@ -351,14 +453,23 @@ static void write_test(size_t num_bytes, size_t slice_size) {
   grpc_core::ExecCtx exec_ctx;
 
   gpr_log(GPR_INFO,
-          "Start write test with %" PRIuPTR " bytes, slice size %" PRIuPTR,
-          num_bytes, slice_size);
+          "Start write test with %" PRIuPTR " bytes, slice size %" PRIuPTR
+          ", zerocopy %d",
+          num_bytes, slice_size, zerocopy);
 
-  create_sockets(sv);
+  if (zerocopy) {
+    create_inet_sockets(sv);
+  } else {
+    create_sockets(sv);
+  }
 
-  grpc_arg a[1];
+  grpc_arg a[3];
   a[0].key = const_cast<char*>(GRPC_ARG_TCP_READ_CHUNK_SIZE);
   a[0].type = GRPC_ARG_INTEGER, a[0].value.integer = (int)slice_size;
+  a[1].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED);
+  a[1].type = GRPC_ARG_INTEGER, a[1].value.integer = zerocopy;
+  a[2].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD);
+  a[2].type = GRPC_ARG_INTEGER, a[2].value.integer = 0;
   grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
   ep = grpc_tcp_create(grpc_fd_create(sv[1], "write_test"), &args, "test");
   grpc_endpoint_add_to_pollset(ep, g_pollset);
@@ -374,7 +485,13 @@ static void write_test(size_t num_bytes, size_t slice_size) {
                     grpc_schedule_on_exec_ctx);
 
   grpc_endpoint_write(ep, &outgoing, &write_done_closure);
+  /* if the socket was already writable again by the time the write had to
+     wait, its continuation is queued here: run it before blocking below */
+  grpc_core::ExecCtx::Get()->Flush();
   drain_socket_blocking(sv[0], num_bytes, num_bytes);
+  /* the write may have completed inline; loopback TCP need not generate
+     another event to wake the pollset for it */
+  grpc_core::ExecCtx::Get()->Flush();
   gpr_mu_lock(g_mu);
   for (;;) {
     grpc_pollset_worker* worker = nullptr;
@@ -401,6 +518,376 @@ void on_fd_released(void* arg, grpc_error* errors) {
       GRPC_LOG_IF_ERROR("pollset_kick", grpc_pollset_kick(g_pollset, nullptr)));
 }
 
+/* Write more than loopback TCP can buffer with zerocopy enabled, with a peer
+   that stops reading: destroying the endpoint must not block on the sends the
+   kernel still holds, but must keep the socket and their slices until the
+   kernel completes them, and only then release the fd. */
+static void zerocopy_stalled_peer_test(size_t num_bytes) {
+  int sv[2];
+  int fd;
+  grpc_endpoint* ep;
+  struct write_socket_state state;
+  size_t num_blocks;
+  grpc_slice* slices;
+  uint8_t current_data = 0;
+  grpc_slice_buffer outgoing;
+  grpc_closure write_done_closure;
+  grpc_closure fd_released_cb;
+  int fd_released_done = 0;
+  grpc_millis deadline =
+      grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(20));
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_CLOSURE_INIT(&fd_released_cb, &on_fd_released, &fd_released_done,
+                    grpc_schedule_on_exec_ctx);
+
+  gpr_log(GPR_INFO, "Start zerocopy stalled peer test with %" PRIuPTR " bytes",
+          num_bytes);
+
+  create_inet_sockets(sv);
+
+  grpc_arg a[2];
+  a[0].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED);
+  a[0].type = GRPC_ARG_INTEGER, a[0].value.integer = 1;
+  a[1].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD);
+  a[1].type = GRPC_ARG_INTEGER, a[1].value.integer = 0;
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  ep = grpc_tcp_create(grpc_fd_create(sv[1], "zerocopy_stalled_peer_test"),
+                       &args, "test");
+  grpc_endpoint_add_to_pollset(ep, g_pollset);
+
+  state.ep = ep;
+  state.write_done = 0;
+
+  slices = allocate_blocks(num_bytes, 65536, &num_blocks, &current_data);
+  grpc_slice_buffer_init(&outgoing);
+  grpc_slice_buffer_addn(&outgoing, slices, num_blocks);
+  GRPC_CLOSURE_INIT(&write_done_closure, write_done, &state,
+                    grpc_schedule_on_exec_ctx);
+
+  grpc_endpoint_write(ep, &outgoing, &write_done_closure);
+  grpc_core::ExecCtx::Get()->Flush();
+
+  /* the endpoint is freed once the failed write has been reported */
+  gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  grpc_endpoint_shutdown(
+      ep, GRPC_ERROR_CREATE_FROM_STATIC_STRING("zerocopy_stalled_peer_test"));
+  grpc_tcp_destroy_and_release_fd(ep, &fd, &fd_released_cb);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_mu_lock(g_mu);
+  while (!state.write_done) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(g_mu);
+  }
+  gpr_mu_unlock(g_mu);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_timespec elapsed = gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start);
+  gpr_log(GPR_INFO, "Destroy took %dms", gpr_time_to_millis(elapsed));
+  GPR_ASSERT(gpr_time_cmp(elapsed, gpr_time_from_seconds(1, GPR_TIMESPAN)) <
+             0);
+
+  /* the kernel still holds the unsent data: the fd stays with the endpoint */
+  grpc_millis stalled_deadline = grpc_timespec_to_millis_round_up(
+      grpc_timeout_milliseconds_to_deadline(500));
+  gpr_mu_lock(g_mu);
+  while (grpc_core::ExecCtx::Get()->Now() < stalled_deadline) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work",
+        grpc_pollset_work(g_pollset, &worker, stalled_deadline)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    grpc_core::ExecCtx::Get()->InvalidateNow();
+    gpr_mu_lock(g_mu);
+  }
+  gpr_mu_unlock(g_mu);
+  GPR_ASSERT(!fd_released_done);
+
+  /* closing the peer with unread data resets the connection, which completes
+     the sends */
+  close(sv[0]);
+  gpr_mu_lock(g_mu);
+  while (!fd_released_done) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(g_mu);
+  }
+  gpr_mu_unlock(g_mu);
+  GPR_ASSERT(fd == sv[1]);
+
+  close(fd);
+  grpc_slice_buffer_destroy_internal(&outgoing);
+  gpr_free(slices);
+}
+
+/* Write more than loopback TCP can buffer with TCP_NOTSENT_LOWAT set: the
+   write must stay pending until the peer reads, then deliver everything. */
+static void paced_write_test(size_t num_bytes, int notsent_lowat) {
+  int sv[2];
+  grpc_endpoint* ep;
+  struct write_socket_state state;
+  size_t num_blocks;
+  grpc_slice* slices;
+  uint8_t current_data = 0;
+  grpc_slice_buffer outgoing;
+  grpc_closure write_done_closure;
+  grpc_millis deadline =
+      grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(20));
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO,
+          "Start paced write test with %" PRIuPTR " bytes, lowat %d",
+          num_bytes, notsent_lowat);
+
+  create_inet_sockets(sv);
+
+  grpc_arg a[1];
+  a[0].key = const_cast<char*>(GRPC_ARG_TCP_NOTSENT_LOWAT);
+  a[0].type = GRPC_ARG_INTEGER, a[0].value.integer = notsent_lowat;
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  ep = grpc_tcp_create(grpc_fd_create(sv[1], "paced_write_test"), &args,
+                       "test");
+  grpc_endpoint_add_to_pollset(ep, g_pollset);
+
+  state.ep = ep;
+  state.write_done = 0;
+
+  slices = allocate_blocks(num_bytes, 8192, &num_blocks, &current_data);
+  grpc_slice_buffer_init(&outgoing);
+  grpc_slice_buffer_addn(&outgoing, slices, num_blocks);
+  GRPC_CLOSURE_INIT(&write_done_closure, write_done, &state,
+                    grpc_schedule_on_exec_ctx);
+
+  grpc_endpoint_write(ep, &outgoing, &write_done_closure);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_mu_lock(g_mu);
+  GPR_ASSERT(!state.write_done);
+  gpr_mu_unlock(g_mu);
+
+  drain_socket_blocking(sv[0], num_bytes, num_bytes);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_mu_lock(g_mu);
+  while (!state.write_done) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(g_mu);
+  }
+  gpr_mu_unlock(g_mu);
+
+  grpc_slice_buffer_destroy_internal(&outgoing);
+  grpc_endpoint_destroy(ep);
+  gpr_free(slices);
+}
+
+typedef struct {
+  grpc_endpoint_tracer base;
+  int reads;
+  gpr_timespec last_read;
+  uint64_t reported_seq[3];
+} timestamp_tracer;
+
+static void timestamp_tracer_on_read(grpc_endpoint_tracer* tracer,
+                                     gpr_timespec ts) {
+  timestamp_tracer* t = (timestamp_tracer*)tracer;
+  gpr_mu_lock(g_mu);
+  t->reads++;
+  t->last_read = ts;
+  gpr_mu_unlock(g_mu);
+}
+
+static void timestamp_tracer_on_write(grpc_endpoint_tracer* tracer,
+                                      uint64_t seq,
+                                      grpc_endpoint_write_stage stage,
+                                      gpr_timespec ts) {
+  timestamp_tracer* t = (timestamp_tracer*)tracer;
+  gpr_mu_lock(g_mu);
+  GPR_ASSERT(gpr_time_cmp(ts, gpr_time_0(GPR_CLOCK_REALTIME)) > 0);
+  t->reported_seq[stage] = GPR_MAX(t->reported_seq[stage], seq);
+  GPR_ASSERT(
+      GRPC_LOG_IF_ERROR("pollset_kick", grpc_pollset_kick(g_pollset, nullptr)));
+  gpr_mu_unlock(g_mu);
+}
+
+static const grpc_endpoint_tracer_vtable timestamp_tracer_vtable = {
+    timestamp_tracer_on_read, timestamp_tracer_on_write};
+
+/* With GRPC_ARG_TCP_TIMESTAMPING, a write over loopback TCP is reported as
+   scheduled, sent and acked, and a read reports when its data arrived. */
+static void timestamping_test(void) {
+  int sv[2];
+  grpc_endpoint* ep;
+  struct write_socket_state write_state;
+  struct read_socket_state read_state;
+  timestamp_tracer tracer;
+  size_t num_blocks;
+  grpc_slice* slices;
+  uint8_t current_data = 0;
+  grpc_slice_buffer outgoing;
+  grpc_closure write_done_closure;
+  grpc_millis deadline =
+      grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(20));
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "Start timestamping test");
+
+  create_inet_sockets(sv);
+
+  grpc_arg a[1];
+  a[0].key = const_cast<char*>(GRPC_ARG_TCP_TIMESTAMPING);
+  a[0].type = GRPC_ARG_INTEGER, a[0].value.integer = 1;
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  ep = grpc_tcp_create(grpc_fd_create(sv[1], "timestamping_test"), &args,
+                       "test");
+  grpc_endpoint_add_to_pollset(ep, g_pollset);
+
+  memset(&tracer, 0, sizeof(tracer));
+  tracer.base.vtable = &timestamp_tracer_vtable;
+#ifdef GRPC_LINUX_ERRQUEUE
+  GPR_ASSERT(grpc_endpoint_set_tracer(ep, &tracer.base));
+#else
+  GPR_ASSERT(!grpc_endpoint_set_tracer(ep, &tracer.base));
+  grpc_endpoint_destroy(ep);
+  close(sv[0]);
+  return;
+#endif
+
+  /* keep a read pending: transmit timestamps are picked up by the reader */
+  read_state.ep = ep;
+  read_state.read_bytes = 0;
+  read_state.target_read_bytes = 100;
+  grpc_slice_buffer_init(&read_state.incoming);
+  GRPC_CLOSURE_INIT(&read_state.read_cb, read_cb, &read_state,
+                    grpc_schedule_on_exec_ctx);
+  grpc_endpoint_read(ep, &read_state.incoming, &read_state.read_cb);
+
+  write_state.ep = ep;
+  write_state.write_done = 0;
+  slices = allocate_blocks(1000, 1000, &num_blocks, &current_data);
+  grpc_slice_buffer_init(&outgoing);
+  grpc_slice_buffer_addn(&outgoing, slices, num_blocks);
+  GRPC_CLOSURE_INIT(&write_done_closure, write_done, &write_state,
+                    grpc_schedule_on_exec_ctx);
+  grpc_endpoint_write(ep, &outgoing, &write_done_closure);
+  grpc_core::ExecCtx::Get()->Flush();
+  drain_socket_blocking(sv[0], 1000, 1000);
+
+  gpr_mu_lock(g_mu);
+  while (!write_state.write_done ||
+         tracer.reported_seq[GRPC_ENDPOINT_WRITE_ACKED] < 1) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(g_mu);
+  }
+  GPR_ASSERT(tracer.reported_seq[GRPC_ENDPOINT_WRITE_SCHEDULED] == 1);
+  GPR_ASSERT(tracer.reported_seq[GRPC_ENDPOINT_WRITE_SENT] == 1);
+  GPR_ASSERT(tracer.reported_seq[GRPC_ENDPOINT_WRITE_ACKED] == 1);
+  GPR_ASSERT(tracer.reads == 0);
+  gpr_mu_unlock(g_mu);
+
+  /* the kernel turns receive timestamps on asynchronously the first time a
+     socket asks for them: until then reads go unreported */
+  for (int attempt = 0;; attempt++) {
+    GPR_ASSERT(attempt < 100);
+    if (attempt > 0) {
+      gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+      read_state.read_bytes = 0;
+      grpc_endpoint_read(ep, &read_state.incoming, &read_state.read_cb);
+    }
+    GPR_ASSERT(fill_socket_partial(sv[0], 100) == 100);
+    gpr_mu_lock(g_mu);
+    while (read_state.read_bytes < read_state.target_read_bytes) {
+      grpc_pollset_worker* worker = nullptr;
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "pollset_work", grpc_pollset_work(g_pollset, &worker, deadline)));
+      gpr_mu_unlock(g_mu);
+      grpc_core::ExecCtx::Get()->Flush();
+      gpr_mu_lock(g_mu);
+    }
+    bool reported = tracer.reads > 0;
+    gpr_mu_unlock(g_mu);
+    if (reported) break;
+  }
+  GPR_ASSERT(gpr_time_cmp(tracer.last_read,
+                          gpr_time_0(GPR_CLOCK_REALTIME)) > 0);
+
+  grpc_slice_buffer_destroy_internal(&read_state.incoming);
+  grpc_slice_buffer_destroy_internal(&outgoing);
+  grpc_endpoint_destroy(ep);
+  gpr_free(slices);
+  close(sv[0]);
+}
+
+/* Write many tiny slices: they should be coalesced into a single iovec entry
+   and sent with one sendmsg. */
+static void coalesced_write_test(void) {
+  const size_t num_bytes = 900;
+  const size_t slice_size = 9;
+  int sv[2];
+  grpc_endpoint* ep;
+  struct write_socket_state state;
+  size_t num_blocks;
+  grpc_slice* slices;
+  uint8_t current_data = 0;
+  grpc_slice_buffer outgoing;
+  grpc_closure write_done_closure;
+  grpc_stats_data before;
+  grpc_stats_data after;
+  grpc_stats_data diff;
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "Start coalesced write test");
+
+  create_sockets(sv);
+  ep = grpc_tcp_create(grpc_fd_create(sv[1], "coalesced_write_test"), nullptr,
+                       "test");
+  grpc_endpoint_add_to_pollset(ep, g_pollset);
+
+  state.ep = ep;
+  state.write_done = 0;
+
+  slices = allocate_blocks(num_bytes, slice_size, &num_blocks, &current_data);
+  grpc_slice_buffer_init(&outgoing);
+  grpc_slice_buffer_addn(&outgoing, slices, num_blocks);
+  GRPC_CLOSURE_INIT(&write_done_closure, write_done, &state,
+                    grpc_schedule_on_exec_ctx);
+
+  grpc_stats_collect(&before);
+  grpc_endpoint_write(ep, &outgoing, &write_done_closure);
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_stats_collect(&after);
+  grpc_stats_diff(&after, &before, &diff);
+  GPR_ASSERT(state.write_done);
+  drain_socket_blocking(sv[0], num_bytes, num_bytes);
+
+  GPR_ASSERT(diff.counters[GRPC_STATS_COUNTER_SYSCALL_WRITE] == 1);
+  GPR_ASSERT(grpc_stats_histo_count(&diff,
+                                    GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE) ==
+             1);
+  const grpc_stats_histograms h = GRPC_STATS_HISTOGRAM_TCP_WRITE_IOV_SIZE;
+  for (int i = 0; i < grpc_stats_histo_buckets[h]; i++) {
+    if (grpc_stats_histo_bucket_boundaries[h][i] > 1) {
+      GPR_ASSERT(diff.histograms[grpc_stats_histo_start[h] + i] == 0);
+    }
+  }
+
+  grpc_slice_buffer_destroy_internal(&outgoing);
+  grpc_endpoint_destroy(ep);
+  gpr_free(slices);
+  close(sv[0]);
+}
+
 /* Do a read_test, then release fd and try to read/write again. Verify that
    grpc_tcp_fd() is available before the fd is released. */
 static void release_fd_test(size_t num_bytes, size_t slice_size) {
@@ -487,17 +974,31 @@ void run_tests(void) {
   read_test(10000, 1);
   large_read_test(8192);
   large_read_test(1);
+  exact_read_size_test(false);
+  exact_read_size_test(true);
 
-  write_test(100, 8192);
-  write_test(100, 1);
-  write_test(100000, 8192);
-  write_test(100000, 1);
-  write_test(100000, 137);
+  write_test(100, 8192, false);
+  write_test(100, 1, false);
+  write_test(100000, 8192, false);
+  write_test(100000, 1, false);
+  write_test(100000, 137, false);
 
   for (i = 1; i < 1000; i = GPR_MAX(i + 1, i * 5 / 4)) {
-    write_test(40320, i);
+    write_test(40320, i, false);
   }
 
+  write_test(100, 8192, true);
+  write_test(100000, 8192, true);
+  write_test(100000, 1, true);
+  write_test(100000, 137, true);
+  zerocopy_stalled_peer_test(16 * 1024 * 1024);
+
+  paced_write_test(4 * 1024 * 1024, 16 * 1024);
+
+  timestamping_test();
+
+  coalesced_write_test();
+
   release_fd_test(100, 8192);
 }
 
@@ -528,8 +1029,66 @@ static grpc_endpoint_test_fixture create_fixture_tcp_socketpair(
   return f;
 }
 
+static grpc_endpoint_test_fixture create_fixture_tcp_loopback_zerocopy(
+    size_t slice_size) {
+  int sv[2];
+  grpc_endpoint_test_fixture f;
+  grpc_core::ExecCtx exec_ctx;
+
+  create_inet_sockets(sv);
+  grpc_arg a[3];
+  a[0].key = const_cast<char*>(GRPC_ARG_TCP_READ_CHUNK_SIZE);
+  a[0].type = GRPC_ARG_INTEGER;
+  a[0].value.integer = (int)slice_size;
+  a[1].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED);
+  a[1].type = GRPC_ARG_INTEGER;
+  a[1].value.integer = 1;
+  a[2].key = const_cast<char*>(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD);
+  a[2].type = GRPC_ARG_INTEGER;
+  a[2].value.integer = 0;
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  f.client_ep =
+      grpc_tcp_create(grpc_fd_create(sv[0], "fixture:client"), &args, "test");
+  f.server_ep =
+      grpc_tcp_create(grpc_fd_create(sv[1], "fixture:server"), &args, "test");
+  grpc_endpoint_add_to_pollset(f.client_ep, g_pollset);
+  grpc_endpoint_add_to_pollset(f.server_ep, g_pollset);
+
+  return f;
+}
+
+/* Only differs from tcp_socketpair when run under the io_uring engine */
+static grpc_endpoint_test_fixture create_fixture_tcp_socketpair_io_uring(
+    size_t slice_size) {
+  int sv[2];
+  grpc_endpoint_test_fixture f;
+  grpc_core::ExecCtx exec_ctx;
+
+  create_sockets(sv);
+  grpc_arg a[2];
+  a[0].key = const_cast<char*>(GRPC_ARG_TCP_READ_CHUNK_SIZE);
+  a[0].type = GRPC_ARG_INTEGER;
+  a[0].value.integer = (int)slice_size;
+  a[1].key = const_cast<char*>(GRPC_ARG_TCP_IO_URING_ENABLED);
+  a[1].type = GRPC_ARG_INTEGER;
+  a[1].value.integer = 1;
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  f.client_ep =
+      grpc_tcp_create(grpc_fd_create(sv[0], "fixture:client"), &args, "test");
+  f.server_ep =
+      grpc_tcp_create(grpc_fd_create(sv[1], "fixture:server"), &args, "test");
+  grpc_endpoint_add_to_pollset(f.client_ep, g_pollset);
+  grpc_endpoint_add_to_pollset(f.server_ep, g_pollset);
+
+  return f;
+}
+
 static grpc_endpoint_test_config configs[] = {
     {"tcp/tcp_socketpair", create_fixture_tcp_socketpair, clean_up},
+    {"tcp/tcp_loopback_zerocopy", create_fixture_tcp_loopback_zerocopy,
+     clean_up},
+    {"tcp/tcp_socketpair_io_uring", create_fixture_tcp_socketpair_io_uring,
+     clean_up},
 };
 
 static void destroy_pollset(void* p, grpc_error* error) {
@@ -545,6 +1104,8 @@ int main(int argc, char** argv) {
     g_pollset = (grpc_pollset*)gpr_zalloc(grpc_pollset_size());
     grpc_pollset_init(g_pollset, &g_mu);
     grpc_endpoint_tests(configs[0], g_pollset, g_mu);
+    grpc_endpoint_tests(configs[1], g_pollset, g_mu);
+    grpc_endpoint_tests(configs[2], g_pollset, g_mu);
     run_tests();
     GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
                       grpc_schedule_on_exec_ctx);
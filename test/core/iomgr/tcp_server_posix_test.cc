@@ -34,9 +34,11 @@
 
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
+#include <grpc/support/useful.h>
 
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/iomgr.h"
@@ -417,6 +419,68 @@ static void test_connect(size_t num_connects,
   GPR_ASSERT(weak_ref.server == nullptr);
 }
 
+/* Tests a tcp server with GRPC_ARG_REUSEPORT_CPU_AFFINITY started with two
+   pollsets: if SO_REUSEPORT is available, it listens on the port twice, and
+   steers the n'th listener to CPU n. */
+static void test_reuseport_cpu_affinity(void) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_arg arg;
+  arg.type = GRPC_ARG_INTEGER;
+  arg.key = const_cast<char*>(GRPC_ARG_REUSEPORT_CPU_AFFINITY);
+  arg.value.integer = 1;
+  const grpc_channel_args channel_args = {1, &arg};
+  grpc_resolved_address resolved_addr;
+  struct sockaddr_in* addr = (struct sockaddr_in*)resolved_addr.addr;
+  grpc_tcp_server* s;
+  grpc_pollset* pollsets[] = {g_pollset, g_pollset};
+  int port = -1;
+  LOG_TEST("test_reuseport_cpu_affinity");
+  GPR_ASSERT(GRPC_ERROR_NONE ==
+             grpc_tcp_server_create(nullptr, &channel_args, &s));
+  memset(&resolved_addr, 0, sizeof(resolved_addr));
+  resolved_addr.len = sizeof(struct sockaddr_in);
+  addr->sin_family = AF_INET;
+  addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  /* Listeners cloned for a wildcard port would each get a port of their own */
+  const int requested_port = grpc_pick_unused_port_or_die();
+  grpc_sockaddr_set_port(&resolved_addr, requested_port);
+  GPR_ASSERT(grpc_tcp_server_add_port(s, &resolved_addr, &port) ==
+                 GRPC_ERROR_NONE &&
+             port == requested_port);
+
+  grpc_tcp_server_start(s, pollsets, GPR_ARRAY_SIZE(pollsets), on_connect,
+                        nullptr);
+
+  const unsigned num_fds = grpc_tcp_server_port_fd_count(s, 0);
+  GPR_ASSERT(num_fds == 1 || num_fds == GPR_ARRAY_SIZE(pollsets));
+  for (unsigned fd_num = 0; fd_num < num_fds; ++fd_num) {
+    int fd = grpc_tcp_server_port_fd(s, 0, fd_num);
+    GPR_ASSERT(fd >= 0);
+#ifdef SO_INCOMING_CPU
+    if (num_fds > 1) {
+      int cpu = -1;
+      socklen_t len = sizeof(cpu);
+      GPR_ASSERT(getsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len) == 0);
+      GPR_ASSERT(cpu == (int)(fd_num % gpr_cpu_num_cores()));
+    }
+#endif
+    test_addr dst;
+    on_connect_result result;
+    dst.addr.len = sizeof(dst.addr.addr);
+    GPR_ASSERT(getsockname(fd, (struct sockaddr*)dst.addr.addr,
+                           (socklen_t*)&dst.addr.len) == 0);
+    GPR_ASSERT(grpc_sockaddr_get_port(&dst.addr) == port);
+    test_addr_init_str(&dst);
+    on_connect_result_init(&result);
+    GPR_ASSERT(GRPC_LOG_IF_ERROR("tcp_connect", tcp_connect(&dst, &result)));
+    GPR_ASSERT(result.server == s);
+    GPR_ASSERT(result.port_index == 0);
+  }
+
+  grpc_tcp_server_unref(s);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
 static void destroy_pollset(void* p, grpc_error* error) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
@@ -486,6 +550,8 @@ int main(int argc, char** argv) {
     /* Test connect(2) with dst_addrs. */
     test_connect(10, &channel_args, dst_addrs, false);
 
+    test_reuseport_cpu_affinity();
+
     GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
                       grpc_schedule_on_exec_ctx);
     grpc_pollset_shutdown(g_pollset, &destroyed);
@@ -18,7 +18,7 @@
 
 #include "src/core/lib/iomgr/port.h"
 
-// This test only works with the generic timer implementation
+// This test only works with the generic timer implementations
 #ifdef GRPC_TIMER_USE_GENERIC
 
 #include "src/core/lib/iomgr/timer.h"
@@ -27,6 +27,7 @@
 
 #include <grpc/grpc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/useful.h>
 #include "src/core/lib/debug/trace.h"
 #include "test/core/util/test_config.h"
 #include "test/core/util/tracer_util.h"
@@ -150,12 +151,62 @@ void destruction_test(void) {
   GPR_ASSERT(1 == cb_called[2][0]);
 }
 
+/* Timers spread over many orders of magnitude, up to beyond the span of a
+   timing wheel. */
+static void long_range_test(void) {
+  const grpc_millis deadlines[] = {63,     64,      4097,
+                                   300000, 3600000, ((grpc_millis)1) << 37};
+  const int num_deadlines = GPR_ARRAY_SIZE(deadlines);
+  grpc_timer timers[GPR_ARRAY_SIZE(deadlines) + 1];
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "long_range_test");
+
+  grpc_core::ExecCtx::Get()->TestOnlySetNow(0);
+  grpc_timer_list_init();
+  memset(cb_called, 0, sizeof(cb_called));
+
+  for (int i = 0; i < num_deadlines; i++) {
+    grpc_timer_init(
+        &timers[i], deadlines[i],
+        GRPC_CLOSURE_CREATE(cb, (void*)(intptr_t)i, grpc_schedule_on_exec_ctx));
+  }
+  grpc_timer_init(&timers[num_deadlines], ((grpc_millis)1) << 40,
+                  GRPC_CLOSURE_CREATE(cb, (void*)(intptr_t)num_deadlines,
+                                      grpc_schedule_on_exec_ctx));
+
+  for (int i = 0; i < num_deadlines; i++) {
+    grpc_core::ExecCtx::Get()->TestOnlySetNow(deadlines[i] - 1);
+    grpc_timer_check(nullptr);
+    grpc_core::ExecCtx::Get()->Flush();
+    GPR_ASSERT(cb_called[i][1] == 0);
+    grpc_core::ExecCtx::Get()->TestOnlySetNow(deadlines[i]);
+    GPR_ASSERT(grpc_timer_check(nullptr) == GRPC_TIMERS_FIRED);
+    grpc_core::ExecCtx::Get()->Flush();
+    for (int j = 0; j <= num_deadlines; j++) {
+      GPR_ASSERT(cb_called[j][1] == (j <= i));
+      GPR_ASSERT(cb_called[j][0] == 0);
+    }
+  }
+
+  grpc_timer_list_shutdown();
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(1 == cb_called[num_deadlines][0]);
+}
+
 int main(int argc, char** argv) {
+  const grpc_timer_vtable* impls[] = {&grpc_generic_timer_vtable,
+                                      &grpc_wheel_timer_vtable};
   grpc_test_init(argc, argv);
   grpc_core::ExecCtx::GlobalInit();
   gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
-  add_test();
-  destruction_test();
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(impls); i++) {
+    gpr_log(GPR_INFO, "timer implementation: %s", impls[i]->name);
+    grpc_set_timer_impl(impls[i]);
+    add_test();
+    destruction_test();
+    long_range_test();
+  }
   grpc_core::ExecCtx::GlobalShutdown();
   return 0;
 }
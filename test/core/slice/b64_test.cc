@@ -200,6 +200,74 @@ static void test_unpadded_decode(void) {
   GPR_ASSERT(GRPC_SLICE_IS_EMPTY(decoded));
 }
 
+static bool slices_equal(grpc_slice a, grpc_slice b) {
+  return GRPC_SLICE_LENGTH(a) == GRPC_SLICE_LENGTH(b) &&
+         buffers_are_equal(GRPC_SLICE_START_PTR(a), GRPC_SLICE_START_PTR(b),
+                           GRPC_SLICE_LENGTH(a));
+}
+
+/* Decode \a b64 with the scalar code and with \a level: both must agree */
+static void expect_decode_agrees(const char* b64, int url_safe,
+                                 grpc_base64_simd_level level) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_NONE);
+  grpc_slice expected = grpc_base64_decode(b64, url_safe);
+  grpc_base64_test_only_set_simd_level(level);
+  grpc_slice actual = grpc_base64_decode(b64, url_safe);
+  GPR_ASSERT(slices_equal(expected, actual));
+  grpc_slice_unref_internal(expected);
+  grpc_slice_unref_internal(actual);
+}
+
+static void test_simd_level_matches_scalar(grpc_base64_simd_level level) {
+  grpc_base64_test_only_set_simd_level(level);
+  if (grpc_base64_get_simd_level() != level) {
+    gpr_log(GPR_INFO, "simd level %d not supported: skipped", level);
+    return;
+  }
+  gpr_log(GPR_INFO, "test_simd_level_matches_scalar: %d", level);
+
+  unsigned char data[300];
+  uint32_t rnd = 42;
+  for (size_t i = 0; i < sizeof(data); i++) {
+    rnd = rnd * 1103515245 + 12345;
+    data[i] = (unsigned char)(rnd >> 16);
+  }
+
+  /* all lengths, both alphabets: same output, and it decodes back */
+  for (size_t len = 0; len <= sizeof(data); len++) {
+    for (int url_safe = 0; url_safe <= 1; url_safe++) {
+      grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_NONE);
+      char* expected = grpc_base64_encode(data, len, url_safe, 0);
+      grpc_base64_test_only_set_simd_level(level);
+      char* actual = grpc_base64_encode(data, len, url_safe, 0);
+      GPR_ASSERT(strcmp(expected, actual) == 0);
+      grpc_core::ExecCtx exec_ctx;
+      grpc_slice decoded = grpc_base64_decode(actual, url_safe);
+      GPR_ASSERT(GRPC_SLICE_LENGTH(decoded) == len);
+      GPR_ASSERT(buffers_are_equal(data, GRPC_SLICE_START_PTR(decoded), len));
+      grpc_slice_unref_internal(decoded);
+      gpr_free(expected);
+      gpr_free(actual);
+    }
+  }
+
+  /* every byte value at every position of a block: decoding fails, or skips
+     it, exactly like the scalar code does */
+  char* b64 = grpc_base64_encode(data, 96, 0, 0);
+  for (size_t pos = 0; pos < 64; pos += 7) {
+    char saved = b64[pos];
+    for (int c = 1; c < 256; c++) {
+      b64[pos] = (char)c;
+      expect_decode_agrees(b64, 0, level);
+    }
+    b64[pos] = saved;
+  }
+  gpr_free(b64);
+
+  grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_AVX2);
+}
+
 int main(int argc, char** argv) {
   grpc_test_init(argc, argv);
   grpc_init();
@@ -214,6 +282,8 @@ int main(int argc, char** argv) {
   test_url_safe_unsafe_mismatch_failure();
   test_rfc4648_test_vectors();
   test_unpadded_decode();
+  test_simd_level_matches_scalar(GRPC_BASE64_SIMD_SSE4_1);
+  test_simd_level_matches_scalar(GRPC_BASE64_SIMD_AVX2);
   grpc_shutdown();
   return 0;
 }
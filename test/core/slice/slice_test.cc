@@ -23,6 +23,8 @@
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/thd.h>
 
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/transport/static_metadata.h"
@@ -260,6 +262,57 @@ static void test_slice_interning(void) {
   grpc_shutdown();
 }
 
+#define CONCURRENT_INTERNING_THREADS 8
+#define CONCURRENT_INTERNING_STRINGS 256
+
+static void concurrent_interning_body(void* arg) {
+  grpc_slice* held = static_cast<grpc_slice*>(arg);
+  for (int round = 0; round < 20; round++) {
+    for (int i = 0; i < CONCURRENT_INTERNING_STRINGS; i++) {
+      char* str;
+      gpr_asprintf(&str, "concurrent-interning-%d", i);
+      grpc_slice src = grpc_slice_from_copied_string(str);
+      grpc_slice interned = grpc_slice_intern(src);
+      GPR_ASSERT(grpc_slice_eq(interned, src));
+      // strings that are held elsewhere must come back as the same slice; the
+      // others get created and destroyed concurrently
+      if (i % 2 == 0) {
+        GPR_ASSERT(interned.refcount == held[i].refcount);
+      }
+      grpc_slice_unref(interned);
+      grpc_slice_unref(src);
+      gpr_free(str);
+    }
+  }
+}
+
+static void test_concurrent_slice_interning(void) {
+  LOG_TEST_NAME("test_concurrent_slice_interning");
+
+  grpc_init();
+  grpc_slice held[CONCURRENT_INTERNING_STRINGS];
+  for (int i = 0; i < CONCURRENT_INTERNING_STRINGS; i += 2) {
+    char* str;
+    gpr_asprintf(&str, "concurrent-interning-%d", i);
+    held[i] = grpc_slice_intern(grpc_slice_from_static_string(str));
+    gpr_free(str);
+  }
+  gpr_thd_id thds[CONCURRENT_INTERNING_THREADS];
+  for (int i = 0; i < CONCURRENT_INTERNING_THREADS; i++) {
+    gpr_thd_options opt = gpr_thd_options_default();
+    gpr_thd_options_set_joinable(&opt);
+    GPR_ASSERT(gpr_thd_new(&thds[i], "grpc_concurrent_interning",
+                           concurrent_interning_body, held, &opt));
+  }
+  for (int i = 0; i < CONCURRENT_INTERNING_THREADS; i++) {
+    gpr_thd_join(thds[i]);
+  }
+  for (int i = 0; i < CONCURRENT_INTERNING_STRINGS; i += 2) {
+    grpc_slice_unref(held[i]);
+  }
+  grpc_shutdown();
+}
+
 static void test_static_slice_interning(void) {
   LOG_TEST_NAME("test_static_slice_interning");
 
@@ -304,6 +357,7 @@ int main(int argc, char** argv) {
   }
   test_slice_from_copied_string_works();
   test_slice_interning();
+  test_concurrent_slice_interning();
   test_static_slice_interning();
   test_static_slice_copy_interning();
   grpc_shutdown();
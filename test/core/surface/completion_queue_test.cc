@@ -22,7 +22,12 @@
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 #include <grpc/support/useful.h>
+#include <string.h>
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/iomgr/iomgr.h"
+#ifdef GRPC_POSIX_SOCKET
+#include "src/core/lib/iomgr/ev_posix.h"
+#endif
 #include "test/core/util/test_config.h"
 
 #define LOG_TEST(x) gpr_log(GPR_INFO, "%s", x)
@@ -121,6 +126,37 @@ static void test_wait_empty(void) {
   }
 }
 
+/* a cq created with a spin budget still times out, and (under epoll1) the
+   poller spun before blocking */
+static void test_wait_empty_with_spin(void) {
+  grpc_completion_queue* cc;
+  grpc_completion_queue_attributes attr;
+  grpc_event event;
+  grpc_stats_data before;
+  grpc_stats_data after;
+
+  LOG_TEST("test_wait_empty_with_spin");
+
+  attr.version = 2;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  attr.cq_polling_type = GRPC_CQ_DEFAULT_POLLING;
+  attr.cq_spin_budget_us = 1000;
+  cc = grpc_completion_queue_create(grpc_completion_queue_factory_lookup(&attr),
+                                    &attr, nullptr);
+  grpc_stats_collect(&before);
+  event = grpc_completion_queue_next(
+      cc, grpc_timeout_milliseconds_to_deadline(100), nullptr);
+  GPR_ASSERT(event.type == GRPC_QUEUE_TIMEOUT);
+  grpc_stats_collect(&after);
+#ifdef GRPC_POSIX_SOCKET
+  if (0 == strcmp(grpc_get_poll_strategy_name(), "epoll1")) {
+    GPR_ASSERT(after.counters[GRPC_STATS_COUNTER_POLLSET_SPIN_MISSES] >
+               before.counters[GRPC_STATS_COUNTER_POLLSET_SPIN_MISSES]);
+  }
+#endif
+  shutdown_and_destroy(cc);
+}
+
 static void do_nothing_end_completion(void* arg, grpc_cq_completion* c) {}
 
 static void test_cq_end_op(void) {
@@ -361,6 +397,7 @@ int main(int argc, char** argv) {
   test_no_op();
   test_pollset_conversion();
   test_wait_empty();
+  test_wait_empty_with_spin();
   test_shutdown_then_next_polling();
   test_shutdown_then_next_with_timeout();
   test_cq_end_op();
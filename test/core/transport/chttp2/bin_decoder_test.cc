@@ -76,6 +76,35 @@ static grpc_slice base64_decode_with_length(const char* s,
   EXPECT_SLICE_EQ(           \
       s, grpc_chttp2_base64_decode_with_length(base64_encode(s), strlen(s)));
 
+/* Long inputs take the vectorized decoding paths, which must stop and hand over
+   to the scalar code at the right place */
+static void expect_long_inputs_round_trip(void) {
+  char buf[1000];
+  uint32_t rnd = 7;
+  for (size_t i = 0; i < sizeof(buf); i++) {
+    rnd = rnd * 1103515245 + 12345;
+    buf[i] = (char)(rnd >> 16);
+  }
+  for (size_t len = 0; len <= sizeof(buf); len += 5) {
+    grpc_slice input = grpc_slice_from_copied_buffer(buf, len);
+    grpc_slice encoded = grpc_chttp2_base64_encode(input);
+    expect_slice_eq(grpc_slice_ref_internal(input),
+                    grpc_chttp2_base64_decode_with_length(encoded, len),
+                    "long input", __LINE__);
+    /* An invalid char anywhere makes the whole decode fail */
+    if (GRPC_SLICE_LENGTH(encoded) > 0) {
+      grpc_slice bad = grpc_slice_copy(encoded);
+      GRPC_SLICE_START_PTR(bad)[GRPC_SLICE_LENGTH(bad) * 2 / 3] = ':';
+      expect_slice_eq(grpc_empty_slice(),
+                      grpc_chttp2_base64_decode_with_length(bad, len),
+                      "long input with an invalid char", __LINE__);
+      grpc_slice_unref_internal(bad);
+    }
+    grpc_slice_unref_internal(encoded);
+    grpc_slice_unref_internal(input);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc_init();
   {
@@ -131,6 +160,8 @@ int main(int argc, char** argv) {
     // Test illegal charactors in grpc_chttp2_base64_decode_with_length
     EXPECT_SLICE_EQ("", base64_decode_with_length("Zm:v", 3));
     EXPECT_SLICE_EQ("", base64_decode_with_length("Zm=v", 3));
+
+    expect_long_inputs_round_trip();
   }
   grpc_shutdown();
   return all_ok ? 0 : 1;
@@ -27,6 +27,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 
 static int all_ok = 1;
@@ -90,6 +91,38 @@ static void expect_combined_equiv(const char* s, size_t len, int line) {
 #define EXPECT_COMBINED_EQUIV(x) \
   expect_combined_equiv(x, sizeof(x) - 1, __LINE__)
 
+/* Long inputs go through the vectorized paths, and through the chunks of the
+   combined encoder: both encoders must match their scalar versions */
+static void expect_long_inputs_equiv(void) {
+  char buf[1000];
+  uint32_t rnd = 42;
+  for (size_t i = 0; i < sizeof(buf); i++) {
+    rnd = rnd * 1103515245 + 12345;
+    buf[i] = (char)(rnd >> 16);
+  }
+  for (size_t len = 0; len <= sizeof(buf); len += 7) {
+    grpc_slice input = grpc_slice_from_copied_buffer(buf, len);
+    grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_NONE);
+    grpc_slice scalar_base64 = grpc_chttp2_base64_encode(input);
+    grpc_slice scalar_combined =
+        grpc_chttp2_base64_encode_and_huffman_compress(input);
+    grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_AVX2);
+    grpc_slice base64 = grpc_chttp2_base64_encode(input);
+    grpc_slice combined = grpc_chttp2_base64_encode_and_huffman_compress(input);
+    if (!grpc_slice_eq(scalar_base64, base64) ||
+        !grpc_slice_eq(scalar_combined, combined)) {
+      gpr_log(GPR_ERROR, "FAILED: long input of %d bytes", (int)len);
+      all_ok = 0;
+    }
+    expect_combined_equiv(buf, len, __LINE__);
+    grpc_slice_unref(input);
+    grpc_slice_unref(scalar_base64);
+    grpc_slice_unref(scalar_combined);
+    grpc_slice_unref(base64);
+    grpc_slice_unref(combined);
+  }
+}
+
 static void expect_binary_header(const char* hdr, int binary) {
   if (grpc_is_binary_header(grpc_slice_from_static_string(hdr)) != binary) {
     gpr_log(GPR_ERROR, "FAILED: expected header '%s' to be %s", hdr,
@@ -167,6 +200,8 @@ int main(int argc, char** argv) {
       "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
       "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff");
 
+  expect_long_inputs_equiv();
+
   expect_binary_header("foo-bin", 1);
   expect_binary_header("foo-bar", 0);
   expect_binary_header("-bin", 0);
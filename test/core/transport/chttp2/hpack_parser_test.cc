@@ -19,11 +19,13 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 
 #include <stdarg.h>
+#include <string.h>
 
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "test/core/util/parse_hexstring.h"
 #include "test/core/util/slice_splitter.h"
 #include "test/core/util/test_config.h"
@@ -205,11 +207,101 @@ static void test_vectors(grpc_slice_split_mode mode) {
   grpc_chttp2_hpack_parser_destroy(&parser);
 }
 
+typedef struct {
+  grpc_slice expected_value;
+  int headers;
+} value_checker;
+
+static void onhdr_check_value(void* ud, grpc_mdelem md) {
+  value_checker* chk = static_cast<value_checker*>(ud);
+  GPR_ASSERT(grpc_slice_str_cmp(GRPC_MDKEY(md), "foo") == 0);
+  GPR_ASSERT(grpc_slice_eq(GRPC_MDVALUE(md), chk->expected_value));
+  chk->headers++;
+  GRPC_MDELEM_UNREF(md);
+}
+
+/* parse a literal header (without indexing) with a huffman coded value */
+static void test_huffman_value(grpc_chttp2_hpack_parser* parser,
+                               grpc_slice_split_mode mode, grpc_slice value) {
+  grpc_slice huff = grpc_chttp2_huffman_compress(value);
+  size_t huff_length = GRPC_SLICE_LENGTH(huff);
+  grpc_slice input = grpc_slice_malloc(huff_length + 16);
+  uint8_t* p = GRPC_SLICE_START_PTR(input);
+  *p++ = 0x00;
+  *p++ = 0x03;
+  *p++ = 'f';
+  *p++ = 'o';
+  *p++ = 'o';
+  /* the value length: an integer with a 7 bit prefix, after the huffman bit */
+  if (huff_length < 127) {
+    *p++ = (uint8_t)(0x80 | huff_length);
+  } else {
+    *p++ = 0xff;
+    size_t rest = huff_length - 127;
+    while (rest >= 128) {
+      *p++ = (uint8_t)(0x80 | (rest & 0x7f));
+      rest >>= 7;
+    }
+    *p++ = (uint8_t)rest;
+  }
+  memcpy(p, GRPC_SLICE_START_PTR(huff), huff_length);
+  p += huff_length;
+  input = grpc_slice_sub_no_ref(input, 0,
+                                (size_t)(p - GRPC_SLICE_START_PTR(input)));
+
+  value_checker chk = {value, 0};
+  parser->on_header = onhdr_check_value;
+  parser->on_header_user_data = &chk;
+
+  grpc_slice* slices;
+  size_t nslices;
+  grpc_split_slices(mode, &input, 1, &slices, &nslices);
+  for (size_t i = 0; i < nslices; i++) {
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(grpc_chttp2_hpack_parser_parse(parser, slices[i]) ==
+               GRPC_ERROR_NONE);
+    grpc_slice_unref(slices[i]);
+  }
+  gpr_free(slices);
+  GPR_ASSERT(chk.headers == 1);
+
+  grpc_slice_unref(input);
+  grpc_slice_unref(huff);
+}
+
+/* huffman coded values decode the same however they are split: every byte
+   value, codes of every length, values longer than a decoding batch */
+static void test_huffman_values(grpc_slice_split_mode mode) {
+  grpc_chttp2_hpack_parser parser;
+  grpc_core::ExecCtx exec_ctx;
+  uint8_t buf[1000];
+
+  grpc_chttp2_hpack_parser_init(&parser);
+  for (size_t i = 0; i < 256; i++) {
+    buf[i] = (uint8_t)i;
+  }
+  for (size_t length = 0; length <= 256; length += 16) {
+    test_huffman_value(&parser, mode,
+                       grpc_slice_from_static_buffer(buf + 256 - length,
+                                                     length));
+  }
+  for (size_t i = 0; i < sizeof(buf); i++) {
+    buf[i] = (uint8_t)("abcdefghijklmnopqrstuvwxyz0123456789-_/.:~"[i % 42]);
+  }
+  for (size_t length = 1; length <= sizeof(buf); length = length * 3 + 1) {
+    test_huffman_value(&parser, mode,
+                       grpc_slice_from_static_buffer(buf, length));
+  }
+  grpc_chttp2_hpack_parser_destroy(&parser);
+}
+
 int main(int argc, char** argv) {
   grpc_test_init(argc, argv);
   grpc_init();
   test_vectors(GRPC_SLICE_SPLIT_MERGE_ALL);
   test_vectors(GRPC_SLICE_SPLIT_ONE_BYTE);
+  test_huffman_values(GRPC_SLICE_SPLIT_MERGE_ALL);
+  test_huffman_values(GRPC_SLICE_SPLIT_ONE_BYTE);
   grpc_shutdown();
   return 0;
 }
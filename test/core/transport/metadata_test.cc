@@ -25,6 +25,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
+#include <grpc/support/thd.h>
 
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/lib/gpr/string.h"
@@ -173,6 +174,100 @@ static void test_spin_creating_the_same_thing(bool intern_keys,
   grpc_shutdown();
 }
 
+#define CONCURRENT_THREADS 8
+#define CONCURRENT_ELEMS 512
+
+static grpc_mdelem concurrent_elem(int i) {
+  char* value;
+  gpr_asprintf(&value, "concurrent-%d", i);
+  grpc_mdelem md = grpc_mdelem_from_slices(
+      grpc_slice_intern(grpc_slice_from_static_string("a")),
+      grpc_slice_intern(grpc_slice_from_copied_string(value)));
+  gpr_free(value);
+  return md;
+}
+
+static void concurrent_creation_body(void* arg) {
+  grpc_mdelem* held = static_cast<grpc_mdelem*>(arg);
+  grpc_core::ExecCtx exec_ctx;
+  for (int round = 0; round < 20; round++) {
+    for (int i = 0; i < CONCURRENT_ELEMS; i++) {
+      grpc_mdelem md = concurrent_elem(i);
+      /* elements that are held elsewhere must come back as the same element;
+         the others get created and collected concurrently */
+      if (i % 2 == 0) {
+        GPR_ASSERT(md.payload == held[i].payload);
+      } else {
+        char* value;
+        gpr_asprintf(&value, "concurrent-%d", i);
+        GPR_ASSERT(grpc_slice_str_cmp(GRPC_MDVALUE(md), value) == 0);
+        gpr_free(value);
+      }
+      GRPC_MDELEM_UNREF(md);
+    }
+  }
+}
+
+static void test_concurrent_creation(void) {
+  gpr_log(GPR_INFO, "test_concurrent_creation");
+
+  grpc_init();
+  grpc_core::ExecCtx exec_ctx;
+  grpc_mdelem held[CONCURRENT_ELEMS];
+  for (int i = 0; i < CONCURRENT_ELEMS; i += 2) {
+    held[i] = concurrent_elem(i);
+  }
+  gpr_thd_id thds[CONCURRENT_THREADS];
+  for (int i = 0; i < CONCURRENT_THREADS; i++) {
+    gpr_thd_options opt = gpr_thd_options_default();
+    gpr_thd_options_set_joinable(&opt);
+    GPR_ASSERT(gpr_thd_new(&thds[i], "grpc_concurrent_mdelems",
+                           concurrent_creation_body, held, &opt));
+  }
+  for (int i = 0; i < CONCURRENT_THREADS; i++) {
+    gpr_thd_join(thds[i]);
+  }
+  for (int i = 0; i < CONCURRENT_ELEMS; i += 2) {
+    GRPC_MDELEM_UNREF(held[i]);
+  }
+
+  grpc_shutdown();
+}
+
+#define SHORT_LIVED_THREADS 300
+
+static void create_interned_elem(void* caches) {
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_MDELEM_UNREF(concurrent_elem(0));
+  *(size_t*)caches = grpc_mdelem_thread_cache_count_for_testing();
+}
+
+/* A thread's mdelem cache is handed back when it exits, so that threads
+   started later get one too */
+static void test_thread_caches_released(void) {
+  gpr_log(GPR_INFO, "test_thread_caches_released");
+
+  grpc_init();
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_MDELEM_UNREF(concurrent_elem(0));
+  size_t caches = grpc_mdelem_thread_cache_count_for_testing();
+  for (int i = 0; i < SHORT_LIVED_THREADS; i++) {
+    size_t caches_in_thread = 0;
+    gpr_thd_id thd;
+    gpr_thd_options opt = gpr_thd_options_default();
+    gpr_thd_options_set_joinable(&opt);
+    GPR_ASSERT(gpr_thd_new(&thd, "grpc_short_lived", create_interned_elem,
+                           &caches_in_thread, &opt));
+    gpr_thd_join(thd);
+#ifdef GPR_POSIX_SYNC
+    GPR_ASSERT(caches_in_thread == caches + 1);
+    GPR_ASSERT(grpc_mdelem_thread_cache_count_for_testing() == caches);
+#endif
+  }
+
+  grpc_shutdown();
+}
+
 static void test_identity_laws(bool intern_keys, bool intern_values) {
   gpr_log(GPR_INFO, "test_identity_laws: intern_keys=%d intern_values=%d",
           intern_keys, intern_values);
@@ -384,6 +479,8 @@ int main(int argc, char** argv) {
   test_create_many_persistant_metadata();
   test_things_stick_around();
   test_user_data_works();
+  test_concurrent_creation();
+  test_thread_caches_released();
   grpc_shutdown();
   return 0;
 }
@@ -103,6 +103,10 @@ static grpc_resource_user* me_get_resource_user(grpc_endpoint* ep) {
 
 static int me_get_fd(grpc_endpoint* ep) { return -1; }
 
+static bool me_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer) {
+  return false;
+}
+
 static const grpc_endpoint_vtable vtable = {
     me_read,
     me_write,
@@ -114,6 +118,7 @@ static const grpc_endpoint_vtable vtable = {
     me_get_resource_user,
     me_get_peer,
     me_get_fd,
+    me_set_tracer,
 };
 
 grpc_endpoint* grpc_mock_endpoint_create(void (*on_write)(grpc_slice slice),
@@ -154,6 +154,10 @@ static char* me_get_peer(grpc_endpoint* ep) {
 
 static int me_get_fd(grpc_endpoint* ep) { return -1; }
 
+static bool me_set_tracer(grpc_endpoint* ep, grpc_endpoint_tracer* tracer) {
+  return false;
+}
+
 static grpc_resource_user* me_get_resource_user(grpc_endpoint* ep) {
   half* m = (half*)ep;
   return m->resource_user;
@@ -170,6 +174,7 @@ static const grpc_endpoint_vtable vtable = {
     me_get_resource_user,
     me_get_peer,
     me_get_fd,
+    me_set_tracer,
 };
 
 static void half_init(half* m, passthru_endpoint* parent,
@@ -38,7 +38,10 @@
 #include "src/core/ext/filters/client_channel/resolver/fake/fake_resolver.h"
 #include "src/core/ext/filters/client_channel/subchannel_index.h"
 #include "src/core/lib/backoff/backoff.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gpr/env.h"
+#include "src/core/lib/iomgr/sockaddr_utils.h"
+#include "src/core/lib/iomgr/timer.h"
 
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/core/util/port.h"
@@ -78,6 +81,59 @@ void tcp_client_connect_with_delay(grpc_closure* closure, grpc_endpoint** ep,
                           deadline + delay_ms);
 }
 
+// Connection attempts to this port are held back for kSlowConnectMs without
+// blocking the connecting thread, so that other attempts can race them.
+gpr_atm g_slow_connect_port;
+constexpr int kSlowConnectMs = 5000;
+
+struct SlowConnect {
+  grpc_timer timer;
+  grpc_closure on_timer;
+  grpc_closure* closure;
+  grpc_endpoint** ep;
+  grpc_pollset_set* interested_parties;
+  grpc_channel_args* channel_args;
+  grpc_resolved_address addr;
+  grpc_millis deadline;
+};
+
+void slow_connect_start(void* arg, grpc_error* error) {
+  SlowConnect* c = static_cast<SlowConnect*>(arg);
+  if (error == GRPC_ERROR_NONE) {
+    original_tcp_connect_fn(c->closure, c->ep, c->interested_parties,
+                            c->channel_args, &c->addr, c->deadline);
+  } else {
+    GRPC_CLOSURE_SCHED(c->closure, GRPC_ERROR_REF(error));
+  }
+  grpc_channel_args_destroy(c->channel_args);
+  delete c;
+}
+
+void tcp_client_connect_slow_port(grpc_closure* closure, grpc_endpoint** ep,
+                                  grpc_pollset_set* interested_parties,
+                                  const grpc_channel_args* channel_args,
+                                  const grpc_resolved_address* addr,
+                                  grpc_millis deadline) {
+  if (grpc_sockaddr_get_port(addr) != gpr_atm_acq_load(&g_slow_connect_port)) {
+    original_tcp_connect_fn(closure, ep, interested_parties, channel_args,
+                            addr, deadline);
+    return;
+  }
+  *ep = nullptr;
+  SlowConnect* c = new SlowConnect;
+  c->closure = closure;
+  c->ep = ep;
+  c->interested_parties = interested_parties;
+  c->channel_args = grpc_channel_args_copy(channel_args);
+  c->addr = *addr;
+  c->deadline = deadline + kSlowConnectMs;
+  GRPC_CLOSURE_INIT(&c->on_timer, slow_connect_start, c,
+                    grpc_schedule_on_exec_ctx);
+  grpc_timer_init(&c->timer,
+                  grpc_core::ExecCtx::Get()->Now() + kSlowConnectMs,
+                  &c->on_timer);
+}
+
 // Subclass of TestServiceImpl that increments a request counter for
 // every call to the Echo RPC.
 class MyTestServiceImpl : public TestServiceImpl {
@@ -368,6 +424,34 @@ TEST_F(ClientLbEnd2endTest, PickFirstBackOffMinReconnect) {
   gpr_atm_rel_store(&g_connection_delay_ms, 0);
 }
 
+TEST_F(ClientLbEnd2endTest, PickFirstHappyEyeballs) {
+  // Connecting to the first server hangs, so the attempt to the second
+  // server, started after the attempt delay, wins the race.
+  StartServers(2);
+  ChannelArguments args;
+  constexpr int kAttemptDelayMs = 100;
+  args.SetInt(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS,
+              kAttemptDelayMs);
+  const std::vector<int> ports = GetServersPorts();
+  gpr_atm_rel_store(&g_slow_connect_port, ports[0]);
+  grpc_tcp_client_connect_impl = tcp_client_connect_slow_port;
+  ResetStub(ports, "pick_first", args);
+  SetNextResolution(ports);
+  const gpr_timespec t0 = gpr_now(GPR_CLOCK_MONOTONIC);
+  ASSERT_TRUE(channel_->WaitForConnected(
+      grpc_timeout_milliseconds_to_deadline(kSlowConnectMs / 2)));
+  const gpr_timespec t1 = gpr_now(GPR_CLOCK_MONOTONIC);
+  const grpc_millis waited_ms = gpr_time_to_millis(gpr_time_sub(t1, t0));
+  gpr_log(GPR_DEBUG, "Waited %ld ms", waited_ms);
+  // We should have waited for the attempt delay before racing the second
+  // server. We substract one to account for test and precision accuracy drift.
+  EXPECT_GE(waited_ms, kAttemptDelayMs - 1);
+  CheckRpcSendOk();
+  EXPECT_EQ(0, servers_[0]->service_.request_count());
+  EXPECT_EQ(1, servers_[1]->service_.request_count());
+  grpc_tcp_client_connect_impl = original_tcp_connect_fn;
+}
+
 TEST_F(ClientLbEnd2endTest, PickFirstUpdates) {
   // Start servers and send one RPC per server.
   const int kNumServers = 3;
@@ -45,6 +45,29 @@ static void BM_Arena_ManyAlloc(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_ManyAlloc)->Ranges({{1, 1024 * 1024}, {1, 32 * 1024}});
 
+template <size_t kPointers>
+struct Pointers {
+  void* p[kPointers];
+};
+
+// Typed allocations only take the alignment (and space) the type needs
+template <class T>
+static void BM_Arena_ManyNew(benchmark::State& state) {
+  gpr_arena* a = gpr_arena_create(state.range(0));
+  const size_t realloc_after = 1024 * 1024 * 1024 / sizeof(T);
+  while (state.KeepRunning()) {
+    grpc_core::ArenaNew<T>(a);
+    // periodically recreate arena to avoid OOM
+    if (state.iterations() % realloc_after == 0) {
+      gpr_arena_destroy(a);
+      a = gpr_arena_create(state.range(0));
+    }
+  }
+  gpr_arena_destroy(a);
+}
+BENCHMARK_TEMPLATE(BM_Arena_ManyNew, Pointers<1>)->Range(1, 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_Arena_ManyNew, Pointers<3>)->Range(1, 1024 * 1024);
+
 static void BM_Arena_Batch(benchmark::State& state) {
   while (state.KeepRunning()) {
     gpr_arena* a = gpr_arena_create(state.range(0));
@@ -38,6 +38,7 @@
 #include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/connected_channel.h"
+#include "src/core/lib/gpr/arena.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/surface/channel.h"
@@ -73,6 +74,32 @@ BENCHMARK(BM_Zalloc)
     ->Arg(6144)
     ->Arg(7168);
 
+void BM_CallArena(benchmark::State& state) {
+  // what a call pays for its arena: one sized by the call size estimate, which
+  // the call and its stack are allocated from; compare with BM_Zalloc
+  TrackCounters track_counters;
+  size_t sz = state.range(0);
+  while (state.KeepRunning()) {
+    gpr_arena* arena = gpr_arena_create(sz);
+    gpr_arena_alloc(arena, sz);
+    gpr_arena_destroy(arena);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_CallArena)
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256)
+    ->Arg(512)
+    ->Arg(1024)
+    ->Arg(1536)
+    ->Arg(2048)
+    ->Arg(3072)
+    ->Arg(4096)
+    ->Arg(5120)
+    ->Arg(6144)
+    ->Arg(7168);
+
 ////////////////////////////////////////////////////////////////////////////////
 // Benchmarks creating full stacks
 
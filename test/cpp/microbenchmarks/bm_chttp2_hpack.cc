@@ -23,8 +23,11 @@
 #include <string.h>
 #include <sstream>
 
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/static_metadata.h"
@@ -441,25 +444,35 @@ static void UnrefHeader(void* user_data, grpc_mdelem md) {
   GRPC_MDELEM_UNREF(md);
 }
 
+template <void (*OnHeader)(void*, grpc_mdelem)>
+static void CountHeader(void* user_data, grpc_mdelem md) {
+  ++*static_cast<int64_t*>(user_data);
+  OnHeader(nullptr, md);
+}
+
 template <class Fixture, void (*OnHeader)(void*, grpc_mdelem)>
 static void BM_HpackParserParseHeader(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_core::ExecCtx exec_ctx;
   std::vector<grpc_slice> init_slices = Fixture::GetInitSlices();
   std::vector<grpc_slice> benchmark_slices = Fixture::GetBenchmarkSlices();
+  int64_t headers = 0;
   grpc_chttp2_hpack_parser p;
   grpc_chttp2_hpack_parser_init(&p);
-  p.on_header = OnHeader;
-  p.on_header_user_data = nullptr;
+  p.on_header = CountHeader<OnHeader>;
+  p.on_header_user_data = &headers;
   for (auto slice : init_slices) {
     GPR_ASSERT(GRPC_ERROR_NONE == grpc_chttp2_hpack_parser_parse(&p, slice));
   }
+  headers = 0;
   while (state.KeepRunning()) {
     for (auto slice : benchmark_slices) {
       GPR_ASSERT(GRPC_ERROR_NONE == grpc_chttp2_hpack_parser_parse(&p, slice));
     }
     grpc_core::ExecCtx::Get()->Flush();
   }
+  // items per second: headers parsed per second
+  state.SetItemsProcessed(headers);
   for (auto slice : init_slices) grpc_slice_unref(slice);
   for (auto slice : benchmark_slices) grpc_slice_unref(slice);
   grpc_chttp2_hpack_parser_destroy(&p);
@@ -757,6 +770,56 @@ class RepresentativeServerTrailingMetadata {
   }
 };
 
+// Appends a literal header field without indexing, with a huffman coded key
+// and value, the way peers that huffman code every string send headers
+static void AppendHuffmanLiteral(std::vector<uint8_t>* v, const char* key,
+                                 const char* value) {
+  v->push_back(0x00);
+  for (const char* s : {key, value}) {
+    grpc_slice huff =
+        grpc_chttp2_huffman_compress(grpc_slice_from_static_string(s));
+    // keep to single byte lengths
+    GPR_ASSERT(GRPC_SLICE_LENGTH(huff) < 127);
+    v->push_back(static_cast<uint8_t>(0x80 | GRPC_SLICE_LENGTH(huff)));
+    v->insert(v->end(), GRPC_SLICE_START_PTR(huff), GRPC_SLICE_END_PTR(huff));
+    grpc_slice_unref(huff);
+  }
+}
+
+// test/cpp/microbenchmarks/representative_server_initial_metadata.headers,
+// huffman coded and not indexed: every header goes through huffman decoding
+class HuffmanServerInitialMetadata {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> v;
+    AppendHuffmanLiteral(&v, ":status", "200");
+    AppendHuffmanLiteral(&v, "content-type", "application/grpc");
+    AppendHuffmanLiteral(&v, "grpc-accept-encoding", "identity,deflate,gzip");
+    return {MakeSlice(v)};
+  }
+};
+
+// The non binary headers of MoreRepresentativeClientInitialMetadata, huffman
+// coded and not indexed
+class HuffmanClientInitialMetadata {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> v;
+    AppendHuffmanLiteral(&v, ":scheme", "http");
+    AppendHuffmanLiteral(&v, ":method", "POST");
+    AppendHuffmanLiteral(&v, ":path", "/grpc.test.FooService/BarMethod");
+    AppendHuffmanLiteral(&v, ":authority", "localhost");
+    AppendHuffmanLiteral(&v, "content-type", "application/grpc");
+    AppendHuffmanLiteral(&v, "grpc-accept-encoding", "identity,deflate,gzip");
+    AppendHuffmanLiteral(&v, "te", "trailers");
+    AppendHuffmanLiteral(&v, "user-agent",
+                         "bad-client grpc-c/0.12.0.0 (linux)");
+    return {MakeSlice(v)};
+  }
+};
+
 static void free_timeout(void* p) { gpr_free(p); }
 
 // New implementation.
@@ -845,9 +908,84 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata, UnrefHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerTrailingMetadata, UnrefHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, HuffmanServerInitialMetadata,
+                   UnrefHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, HuffmanClientInitialMetadata,
+                   UnrefHeader);
 
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline, OnHeaderNew);
 
 }  // namespace hpack_parser_fixtures
 
+////////////////////////////////////////////////////////////////////////////////
+// Binary header codec
+//
+
+// Args: value size in bytes, grpc_base64_simd_level to cap the codec at
+static grpc_slice MakeBinaryValue(benchmark::State& state) {
+  grpc_base64_test_only_set_simd_level(
+      static_cast<grpc_base64_simd_level>(state.range(1)));
+  grpc_slice s = grpc_slice_malloc(state.range(0));
+  uint8_t* p = GRPC_SLICE_START_PTR(s);
+  for (size_t i = 0; i < GRPC_SLICE_LENGTH(s); i++) {
+    p[i] = static_cast<uint8_t>(i * 131 + 7);
+  }
+  return s;
+}
+
+static void BinaryValueArgs(benchmark::internal::Benchmark* b) {
+  for (int level = GRPC_BASE64_SIMD_NONE; level <= GRPC_BASE64_SIMD_AVX2;
+       level++) {
+    for (int size : {16, 64, 256, 1024, 4096}) {
+      b->Args({size, level});
+    }
+  }
+}
+
+static void BM_Base64Encode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice value = MakeBinaryValue(state);
+  while (state.KeepRunning()) {
+    grpc_slice_unref_internal(grpc_chttp2_base64_encode(value));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref_internal(value);
+  grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_AVX2);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Encode)->Apply(BinaryValueArgs);
+
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice value = MakeBinaryValue(state);
+  while (state.KeepRunning()) {
+    grpc_slice_unref_internal(
+        grpc_chttp2_base64_encode_and_huffman_compress(value));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref_internal(value);
+  grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_AVX2);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)->Apply(BinaryValueArgs);
+
+static void BM_Base64Decode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice value = MakeBinaryValue(state);
+  grpc_slice encoded = grpc_chttp2_base64_encode(value);
+  while (state.KeepRunning()) {
+    grpc_slice_unref_internal(
+        grpc_chttp2_base64_decode_with_length(encoded, state.range(0)));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref_internal(encoded);
+  grpc_slice_unref_internal(value);
+  grpc_base64_test_only_set_simd_level(GRPC_BASE64_SIMD_AVX2);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Decode)->Apply(BinaryValueArgs);
+
 BENCHMARK_MAIN();
@@ -63,6 +63,26 @@ static void BM_ErrorCreateAndSetStatus(benchmark::State& state) {
 }
 BENCHMARK(BM_ErrorCreateAndSetStatus);
 
+static void BM_ErrorForStatus(benchmark::State& state) {
+  TrackCounters track_counters;
+  while (state.KeepRunning()) {
+    GRPC_ERROR_UNREF(grpc_error_for_status(GRPC_STATUS_ABORTED));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorForStatus);
+
+static void BM_ErrorForStatusAndSetMessage(benchmark::State& state) {
+  TrackCounters track_counters;
+  while (state.KeepRunning()) {
+    GRPC_ERROR_UNREF(grpc_error_set_str(
+        grpc_error_for_status(GRPC_STATUS_ABORTED),
+        GRPC_ERROR_STR_GRPC_MESSAGE, grpc_slice_from_static_string("message")));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorForStatusAndSetMessage);
+
 static void BM_ErrorCreateAndSetIntAndStr(benchmark::State& state) {
   TrackCounters track_counters;
   while (state.KeepRunning()) {
@@ -101,6 +121,21 @@ static void BM_ErrorCreateAndSetStrLoop(benchmark::State& state) {
 }
 BENCHMARK(BM_ErrorCreateAndSetStrLoop);
 
+static void BM_ErrorSetIntOnShared(benchmark::State& state) {
+  TrackCounters track_counters;
+  ErrorPtr shared(grpc_error_set_str(
+      grpc_error_set_int(GRPC_ERROR_CREATE_FROM_STATIC_STRING("Error"),
+                         GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNAVAILABLE),
+      GRPC_ERROR_STR_TARGET_ADDRESS,
+      grpc_slice_from_static_string("ipv4:127.0.0.1:1234")));
+  while (state.KeepRunning()) {
+    GRPC_ERROR_UNREF(grpc_error_set_int(GRPC_ERROR_REF(shared.get()),
+                                        GRPC_ERROR_INT_STREAM_ID, 1));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorSetIntOnShared);
+
 static void BM_ErrorRefUnref(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_error* error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Error");
@@ -222,6 +257,28 @@ class ErrorWithNestedGrpcStatus {
       "Error", nested_errors_, 1)};
 };
 
+class StaticErrorWithGrpcStatus {
+ public:
+  grpc_millis deadline() const { return deadline_; }
+  grpc_error* error() const { return error_.get(); }
+
+ private:
+  const grpc_millis deadline_ = GRPC_MILLIS_INF_FUTURE;
+  ErrorPtr error_{grpc_error_for_status(GRPC_STATUS_UNIMPLEMENTED)};
+};
+
+class StaticErrorWithMessage {
+ public:
+  grpc_millis deadline() const { return deadline_; }
+  grpc_error* error() const { return error_.get(); }
+
+ private:
+  const grpc_millis deadline_ = GRPC_MILLIS_INF_FUTURE;
+  ErrorPtr error_{grpc_error_set_str(
+      grpc_error_for_status(GRPC_STATUS_UNIMPLEMENTED),
+      GRPC_ERROR_STR_GRPC_MESSAGE, grpc_slice_from_static_string("message"))};
+};
+
 template <class Fixture>
 static void BM_ErrorStringOnNewError(benchmark::State& state) {
   TrackCounters track_counters;
@@ -309,5 +366,7 @@ BENCHMARK_SUITE(SimpleError);
 BENCHMARK_SUITE(ErrorWithGrpcStatus);
 BENCHMARK_SUITE(ErrorWithHttpError);
 BENCHMARK_SUITE(ErrorWithNestedGrpcStatus);
+BENCHMARK_SUITE(StaticErrorWithGrpcStatus);
+BENCHMARK_SUITE(StaticErrorWithMessage);
 
 BENCHMARK_MAIN();
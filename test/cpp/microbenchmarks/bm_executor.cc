@@ -0,0 +1,157 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark the executor: batches of short closures scheduled from many
+   threads while long (blocking) closures occupy some executor threads */
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/time.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/executor.h"
+
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+
+auto& force_library_initialization = Library::get();
+
+/* Short closures scheduled per iteration */
+static const size_t kBatchSize = 64;
+/* How long a long closure blocks for, as a synchronous name lookup might */
+static const int kLongJobMillis = 2;
+
+namespace {
+
+/* A batch of short closures; Run() schedules them all and waits for them */
+class ShortJobs {
+ public:
+  ShortJobs() : closures_(kBatchSize), pending_(0) {
+    gpr_mu_init(&mu_);
+    gpr_cv_init(&cv_);
+    for (auto& closure : closures_) {
+      GRPC_CLOSURE_INIT(&closure, Done, this,
+                        grpc_executor_scheduler(GRPC_EXECUTOR_SHORT));
+    }
+  }
+
+  ~ShortJobs() {
+    gpr_mu_destroy(&mu_);
+    gpr_cv_destroy(&cv_);
+  }
+
+  void Run() {
+    pending_.store(kBatchSize);
+    {
+      grpc_core::ExecCtx exec_ctx;
+      for (auto& closure : closures_) {
+        GRPC_CLOSURE_SCHED(&closure, GRPC_ERROR_NONE);
+      }
+    }
+    gpr_mu_lock(&mu_);
+    while (pending_.load() > 0) {
+      gpr_cv_wait(&cv_, &mu_, gpr_inf_future(GPR_CLOCK_MONOTONIC));
+    }
+    gpr_mu_unlock(&mu_);
+  }
+
+ private:
+  static void Done(void* arg, grpc_error* error) {
+    ShortJobs* jobs = static_cast<ShortJobs*>(arg);
+    if (jobs->pending_.fetch_sub(1) == 1) {
+      gpr_mu_lock(&jobs->mu_);
+      gpr_cv_signal(&jobs->cv_);
+      gpr_mu_unlock(&jobs->mu_);
+    }
+  }
+
+  std::vector<grpc_closure> closures_;
+  std::atomic<size_t> pending_;
+  gpr_mu mu_;
+  gpr_cv cv_;
+};
+
+/* Long closures kept in flight: each is rescheduled by Rearm() once done */
+class LongJobs {
+ public:
+  explicit LongJobs(size_t count) : jobs_(count) {
+    for (auto& job : jobs_) {
+      job.reset(new Job());
+      GRPC_CLOSURE_INIT(&job->closure, Done, job.get(),
+                        grpc_executor_scheduler(GRPC_EXECUTOR_LONG));
+    }
+  }
+
+  ~LongJobs() {
+    for (auto& job : jobs_) {
+      while (job->in_flight.load()) {
+        gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(1));
+      }
+    }
+  }
+
+  void Rearm() {
+    grpc_core::ExecCtx exec_ctx;
+    for (auto& job : jobs_) {
+      if (!job->in_flight.load()) {
+        job->in_flight.store(true);
+        GRPC_CLOSURE_SCHED(&job->closure, GRPC_ERROR_NONE);
+      }
+    }
+  }
+
+ private:
+  struct Job {
+    grpc_closure closure;
+    std::atomic<bool> in_flight{false};
+  };
+
+  static void Done(void* arg, grpc_error* error) {
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(kLongJobMillis));
+    static_cast<Job*>(arg)->in_flight.store(false);
+  }
+
+  std::vector<std::unique_ptr<Job>> jobs_;
+};
+
+}  // namespace
+
+/* Args: long closures kept in flight per benchmark thread */
+static void BM_ExecutorMixedJobs(benchmark::State& state) {
+  TrackCounters track_counters;
+  ShortJobs short_jobs;
+  LongJobs long_jobs(state.range(0));
+  while (state.KeepRunning()) {
+    long_jobs.Rearm();
+    short_jobs.Run();
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ExecutorMixedJobs)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(4)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -67,6 +67,24 @@ static void BM_SliceReIntern(benchmark::State& state) {
 }
 BENCHMARK(BM_SliceReIntern);
 
+// Several threads interning strings that are already interned (method paths,
+// authorities, ...): the common case, which should not serialize the threads
+static void BM_SliceInternAlreadyInterned_MultiThreaded(
+    benchmark::State& state) {
+  TrackCounters track_counters;
+  gpr_slice slice =
+      grpc_slice_from_static_string("/grpc.testing.EchoTestService/Echo");
+  grpc_slice interned = grpc_slice_intern(slice);
+  while (state.KeepRunning()) {
+    grpc_slice_unref(grpc_slice_intern(slice));
+  }
+  grpc_slice_unref(interned);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SliceInternAlreadyInterned_MultiThreaded)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
 static void BM_SliceInternStaticMetadata(benchmark::State& state) {
   TrackCounters track_counters;
   while (state.KeepRunning()) {
@@ -132,6 +150,28 @@ static void BM_MetadataFromInternedSlicesAlreadyInIndex(
 }
 BENCHMARK(BM_MetadataFromInternedSlicesAlreadyInIndex);
 
+// Several threads parsing the same headers
+static void BM_MetadataFromInternedSlicesAlreadyInIndex_MultiThreaded(
+    benchmark::State& state) {
+  TrackCounters track_counters;
+  gpr_slice k = grpc_slice_intern(grpc_slice_from_static_string("user-agent"));
+  gpr_slice v = grpc_slice_intern(
+      grpc_slice_from_static_string("grpc-c++/1.10.0-dev grpc-c/5.0.0"));
+  grpc_core::ExecCtx exec_ctx;
+  grpc_mdelem seed = grpc_mdelem_create(k, v, nullptr);
+  while (state.KeepRunning()) {
+    GRPC_MDELEM_UNREF(grpc_mdelem_create(k, v, nullptr));
+  }
+  GRPC_MDELEM_UNREF(seed);
+
+  grpc_slice_unref(k);
+  grpc_slice_unref(v);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_MetadataFromInternedSlicesAlreadyInIndex_MultiThreaded)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
 static void BM_MetadataFromInternedKey(benchmark::State& state) {
   TrackCounters track_counters;
   gpr_slice k = grpc_slice_intern(grpc_slice_from_static_string("key"));
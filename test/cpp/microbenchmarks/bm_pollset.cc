@@ -32,6 +32,8 @@
 #include "third_party/benchmark/include/benchmark/benchmark.h"
 
 #include <string.h>
+#include <atomic>
+#include <thread>
 
 #ifdef GRPC_LINUX_MULTIPOLL_WITH_EPOLL
 #include <sys/epoll.h>
@@ -110,6 +112,7 @@ BENCHMARK(BM_PollEmptyPollset_SpeedOfLight)
 
 static void BM_PollEmptyPollset(benchmark::State& state) {
   TrackCounters track_counters;
+  track_counters.AddLabel(grpc_get_poll_strategy_name());
   size_t ps_sz = grpc_pollset_size();
   grpc_pollset* ps = static_cast<grpc_pollset*>(gpr_zalloc(ps_sz));
   gpr_mu* mu;
@@ -214,6 +217,7 @@ BENCHMARK(BM_SingleThreadPollOneFd_SpeedOfLight);
 
 static void BM_SingleThreadPollOneFd(benchmark::State& state) {
   TrackCounters track_counters;
+  track_counters.AddLabel(grpc_get_poll_strategy_name());
   size_t ps_sz = grpc_pollset_size();
   grpc_pollset* ps = static_cast<grpc_pollset*>(gpr_zalloc(ps_sz));
   gpr_mu* mu;
@@ -256,4 +260,44 @@ static void BM_SingleThreadPollOneFd(benchmark::State& state) {
 }
 BENCHMARK(BM_SingleThreadPollOneFd);
 
+// Another thread kicks the pollset continuously while this one polls it: with a
+// spin budget (the argument, in microseconds) most kicks find the poller
+// spinning and need no wakeup fd write (see the pollset_kick_* counters)
+static void BM_PollKickedFromOtherThread(benchmark::State& state) {
+  TrackCounters track_counters;
+  track_counters.AddLabel(grpc_get_poll_strategy_name());
+  size_t ps_sz = grpc_pollset_size();
+  grpc_pollset* ps = static_cast<grpc_pollset*>(gpr_zalloc(ps_sz));
+  gpr_mu* mu;
+  grpc_pollset_init(ps, &mu);
+  grpc_pollset_configure_spin(ps, static_cast<int>(state.range(0)));
+  grpc_core::ExecCtx exec_ctx;
+  std::atomic<bool> done(false);
+  std::thread kicker([&]() {
+    grpc_core::ExecCtx exec_ctx;
+    while (!done.load(std::memory_order_relaxed)) {
+      gpr_mu_lock(mu);
+      GRPC_ERROR_UNREF(grpc_pollset_kick(ps, nullptr));
+      gpr_mu_unlock(mu);
+    }
+  });
+  gpr_mu_lock(mu);
+  while (state.KeepRunning()) {
+    GRPC_ERROR_UNREF(grpc_pollset_work(ps, nullptr, GRPC_MILLIS_INF_FUTURE));
+  }
+  done.store(true, std::memory_order_relaxed);
+  gpr_mu_unlock(mu);
+  kicker.join();
+  grpc_closure shutdown_ps_closure;
+  GRPC_CLOSURE_INIT(&shutdown_ps_closure, shutdown_ps, ps,
+                    grpc_schedule_on_exec_ctx);
+  gpr_mu_lock(mu);
+  grpc_pollset_shutdown(ps, &shutdown_ps_closure);
+  gpr_mu_unlock(mu);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_free(ps);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_PollKickedFromOtherThread)->Arg(0)->Arg(100);
+
 BENCHMARK_MAIN();
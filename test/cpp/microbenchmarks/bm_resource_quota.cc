@@ -0,0 +1,90 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark resource quota allocations from many resource users (think one per
+   connection) on many threads at once */
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <vector>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/resource_quota.h"
+
+#include "test/cpp/microbenchmarks/helpers.h"
+
+auto& force_library_initialization = Library::get();
+
+static const size_t kNumResourceUsers = 10000;
+static const size_t kAllocationSize = 1024;
+
+static grpc_resource_quota* g_quota;
+static std::vector<grpc_resource_user*> g_users;
+/* bytes allocated (and not freed) by each user */
+static std::vector<size_t> g_allocated;
+
+static void Setup() {
+  g_quota = grpc_resource_quota_create("bm_resource_quota");
+  g_users.resize(kNumResourceUsers);
+  g_allocated.assign(kNumResourceUsers, 0);
+  for (size_t i = 0; i < kNumResourceUsers; i++) {
+    g_users[i] = grpc_resource_user_create(g_quota, nullptr);
+  }
+}
+
+static void Teardown() {
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = 0; i < kNumResourceUsers; i++) {
+    if (g_allocated[i] > 0) {
+      grpc_resource_user_free(g_users[i], g_allocated[i]);
+    }
+    grpc_resource_user_unref(g_users[i]);
+  }
+  grpc_resource_quota_unref_internal(g_quota);
+  g_users.clear();
+}
+
+/* Each iteration allocates (and holds) more memory for the next of this
+   thread's share of the resource users, so every allocation needs memory from
+   the quota rather than from a user's own free pool. Setup and teardown run on
+   thread 0 outside the timed loop: see bm_cq_multiple_threads.cc. */
+static void BM_ResourceUserAlloc(benchmark::State& state) {
+  TrackCounters track_counters;
+  if (state.thread_index == 0) {
+    Setup();
+  }
+  {
+    grpc_core::ExecCtx exec_ctx;
+    size_t i = (size_t)state.thread_index;
+    while (state.KeepRunning()) {
+      grpc_resource_user_alloc(g_users[i], kAllocationSize, nullptr);
+      g_allocated[i] += kAllocationSize;
+      i += (size_t)state.threads;
+      if (i >= kNumResourceUsers) i = (size_t)state.thread_index;
+      grpc_core::ExecCtx::Get()->Flush();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index == 0) {
+    Teardown();
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ResourceUserAlloc)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
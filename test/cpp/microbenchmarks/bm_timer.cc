@@ -0,0 +1,169 @@
+/*
+ *
+ * Copyright 2018 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark timer churn: arming and cancelling or firing timers while many
+   others are outstanding, as call deadlines, keepalives and backoffs do */
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/support/useful.h>
+#include <vector>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/timer.h"
+#include "src/core/lib/iomgr/timer_manager.h"
+
+#include "test/cpp/microbenchmarks/helpers.h"
+
+auto& force_library_initialization = Library::get();
+
+static const grpc_timer_vtable* const kTimerImpls[] = {
+    &grpc_generic_timer_vtable, &grpc_wheel_timer_vtable};
+
+/* Outstanding timers are spread over this many milliseconds */
+#define DEADLINE_SPREAD 600000
+
+static void DoNothing(void* arg, grpc_error* error) {}
+
+namespace {
+
+struct TestTimer {
+  grpc_timer timer;
+  grpc_closure closure;
+};
+
+/* Switches to a timer implementation for the duration of a benchmark. The
+   timer manager's threads are stopped meanwhile, so that only the benchmark
+   checks timers, and the list is rebuilt on exit as benchmarks may have moved
+   their clock forward. */
+class ScopedTimerImpl {
+ public:
+  explicit ScopedTimerImpl(benchmark::State& state)
+      : impl_(kTimerImpls[state.range(0)]) {
+    state.SetLabel(impl_->name);
+    grpc_timer_manager_set_threading(false);
+    Reset();
+  }
+
+  ~ScopedTimerImpl() {
+    Reset();
+    grpc_timer_manager_set_threading(true);
+  }
+
+ private:
+  void Reset() {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_timer_list_shutdown();
+    grpc_set_timer_impl(impl_);
+    grpc_timer_list_init();
+  }
+
+  const grpc_timer_vtable* impl_;
+};
+
+/* Timers armed for the duration of a benchmark, all due after first_deadline
+   and cancelled on destruction */
+class OutstandingTimers {
+ public:
+  OutstandingTimers(size_t count, grpc_millis first_deadline)
+      : timers_(count) {
+    for (size_t i = 0; i < count; i++) {
+      GRPC_CLOSURE_INIT(&timers_[i].closure, DoNothing, nullptr,
+                        grpc_schedule_on_exec_ctx);
+      grpc_timer_init(
+          &timers_[i].timer,
+          first_deadline + (grpc_millis)((i * 7919) % DEADLINE_SPREAD),
+          &timers_[i].closure);
+    }
+  }
+
+  ~OutstandingTimers() {
+    for (size_t i = 0; i < timers_.size(); i++) {
+      grpc_timer_cancel(&timers_[i].timer);
+    }
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+
+ private:
+  std::vector<TestTimer> timers_;
+};
+
+}  // namespace
+
+/* Args: timer implementation, number of outstanding timers */
+static void TimerArgs(benchmark::internal::Benchmark* b) {
+  for (int impl = 0; impl < (int)GPR_ARRAY_SIZE(kTimerImpls); impl++) {
+    for (int outstanding = 0; outstanding <= 100000;
+         outstanding = outstanding == 0 ? 1000 : outstanding * 100) {
+      b->Args({impl, outstanding});
+    }
+  }
+}
+
+/* The common case for deadlines: a timer armed and then cancelled before it
+   fires */
+static void BM_TimerInitCancel(benchmark::State& state) {
+  TrackCounters track_counters;
+  ScopedTimerImpl impl(state);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  OutstandingTimers outstanding(state.range(1), now + 1000);
+  TestTimer t;
+  GRPC_CLOSURE_INIT(&t.closure, DoNothing, nullptr, grpc_schedule_on_exec_ctx);
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    grpc_timer_init(&t.timer,
+                    now + 1000 + (grpc_millis)((i++ * 7919) % DEADLINE_SPREAD),
+                    &t.closure);
+    grpc_timer_cancel(&t.timer);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_TimerInitCancel)->Apply(TimerArgs);
+
+/* Batches of short timers that all fire, checked as the clock moves forward */
+static void BM_TimerExpiry(benchmark::State& state) {
+  TrackCounters track_counters;
+  ScopedTimerImpl impl(state);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  /* Far enough out not to fire however long the benchmark runs */
+  OutstandingTimers outstanding(state.range(1), now + 24 * 3600 * 1000);
+  const size_t kBatchSize = 100;
+  std::vector<TestTimer> batch(kBatchSize);
+  for (size_t i = 0; i < kBatchSize; i++) {
+    GRPC_CLOSURE_INIT(&batch[i].closure, DoNothing, nullptr,
+                      grpc_schedule_on_exec_ctx);
+  }
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < kBatchSize; i++) {
+      grpc_timer_init(&batch[i].timer, now + 1 + (grpc_millis)(i % 10),
+                      &batch[i].closure);
+    }
+    now += 10;
+    grpc_core::ExecCtx::Get()->TestOnlySetNow(now);
+    grpc_timer_check(nullptr);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_TimerExpiry)->Apply(TimerArgs);
+
+BENCHMARK_MAIN();
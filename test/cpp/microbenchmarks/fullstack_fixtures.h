@@ -319,6 +319,29 @@ typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 typedef MinStackize<InProcessCHTTP2> MinInProcessCHTTP2;
 
+////////////////////////////////////////////////////////////////////////////////
+// MSG_ZEROCOPY fixtures
+
+class ZerocopyConfiguration : public FixtureConfiguration {
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <class Base>
+class Zerocopyize : public Base {
+ public:
+  Zerocopyize(Service* service) : Base(service, ZerocopyConfiguration()) {}
+};
+
+typedef Zerocopyize<TCP> ZerocopyTCP;
+
 }  // namespace testing
 }  // namespace grpc
 
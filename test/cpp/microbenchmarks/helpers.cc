@@ -20,6 +20,18 @@
 
 #include "test/cpp/microbenchmarks/helpers.h"
 
+// Sum of the values recorded in a histogram, taking each sample to be the
+// lower bound of its bucket
+static double ApproximateHistogramSum(const grpc_stats_data* stats,
+                                      grpc_stats_histograms histogram) {
+  double sum = 0;
+  for (int i = 0; i < grpc_stats_histo_buckets[histogram]; i++) {
+    sum += (double)stats->histograms[grpc_stats_histo_start[histogram] + i] *
+           grpc_stats_histo_bucket_boundaries[histogram][i];
+  }
+  return sum;
+}
+
 void TrackCounters::Finish(benchmark::State& state) {
   std::ostringstream out;
   for (const auto& l : labels_) {
@@ -56,6 +68,15 @@ void TrackCounters::AddToLabel(std::ostream& out, benchmark::State& state) {
     state.counters[tail_ss.str()] = benchmark::Counter(
         grpc_stats_histo_percentile(&stats, (grpc_stats_histograms)i, 99.0));
   }
+  // read buffer bytes allocated (offered to recvmsg) vs. actually filled, per
+  // iteration: compare the two to see how well reads are sized
+  state.counters["tcp_read_offer-bytes/iter"] =
+      benchmark::Counter(ApproximateHistogramSum(
+                             &stats, GRPC_STATS_HISTOGRAM_TCP_READ_OFFER) /
+                         (double)state.iterations());
+  state.counters["tcp_read_size-bytes/iter"] = benchmark::Counter(
+      ApproximateHistogramSum(&stats, GRPC_STATS_HISTOGRAM_TCP_READ_SIZE) /
+      (double)state.iterations());
 #ifdef GPR_LOW_LEVEL_COUNTERS
   grpc_memory_counters counters_at_end = grpc_memory_counters_snapshot();
   out << " locks/iter:"
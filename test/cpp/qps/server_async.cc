@@ -23,6 +23,11 @@
 #include <mutex>
 #include <thread>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <grpc++/generic/async_generic_service.h>
 #include <grpc++/resource_quota.h>
 #include <grpc++/security/server_credentials.h>
@@ -43,6 +48,18 @@
 namespace grpc {
 namespace testing {
 
+// Runs the calling thread on cpu only
+static void PinThreadToCpu(int cpu) {
+#ifdef __linux__
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+    gpr_log(GPR_ERROR, "Failed to pin thread to CPU %d", cpu);
+  }
+#endif
+}
+
 template <class RequestType, class ResponseType, class ServiceType,
           class ServerContextType>
 class AsyncQpsServerTest final : public grpc::testing::Server {
@@ -102,6 +119,15 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
     for (int i = 0; i < num_threads; i++) {
       cq_.emplace_back(i % srv_cqs_.size());
     }
+    // Connections steered to the i'th completion queue should be served on
+    // CPU i
+    pin_threads_to_cq_cpu_ = false;
+    for (const auto& channel_arg : config.channel_args()) {
+      if (channel_arg.name() == GRPC_ARG_REUSEPORT_CPU_AFFINITY &&
+          channel_arg.int_value() != 0) {
+        pin_threads_to_cq_cpu_ = true;
+      }
+    }
 
     ApplyConfigToBuilder(config, &builder);
 
@@ -199,6 +225,9 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
   }
 
   void ThreadFunc(int thread_idx) {
+    if (pin_threads_to_cq_cpu_) {
+      PinThreadToCpu(cq_[thread_idx] % cores());
+    }
     // Wait until work is available or we are shutting down
     bool ok;
     void* got_tag;
@@ -521,6 +550,7 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
   std::unique_ptr<grpc::Server> server_;
   std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> srv_cqs_;
   std::vector<int> cq_;
+  bool pin_threads_to_cq_cpu_;
   ServiceType async_service_;
   std::vector<std::unique_ptr<ServerRpcContext>> contexts_;
 
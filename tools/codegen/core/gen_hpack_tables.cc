@@ -116,198 +116,107 @@ static void generate_first_byte_lut(void) {
  * Huffman decoder table generation
  */
 
-#define MAXHUFFSTATES 1024
+/* must match hpack_parser.cc */
+#define HUFF_FAST_BITS 11
+#define HUFF_MAX_CODE_LENGTH 30
 
-/* represents a set of symbols as an array of booleans indicating inclusion */
-typedef struct { char included[GRPC_CHTTP2_NUM_HUFFSYMS]; } symset;
-/* represents a lookup table indexed by a nibble */
-typedef struct { unsigned values[16]; } nibblelut;
-
-#define NOT_SET (~(unsigned)0)
-
-/* returns a symset that includes all possible symbols */
-static symset symset_all(void) {
-  symset x;
-  memset(x.included, 1, sizeof(x.included));
-  return x;
-}
-
-/* returns a symset that includes no symbols */
-static symset symset_none(void) {
-  symset x;
-  memset(x.included, 0, sizeof(x.included));
-  return x;
-}
-
-/* returns an empty nibblelut */
-static nibblelut nibblelut_empty(void) {
-  nibblelut x;
-  int i;
-  for (i = 0; i < 16; i++) {
-    x.values[i] = NOT_SET;
-  }
-  return x;
-}
-
-/* counts symbols in a symset - only used for debug builds */
-#ifndef NDEBUG
-static int nsyms(symset s) {
+/* returns the symbol whose code is the first \a length bits of the left
+   aligned \a window, or -1 if there is none */
+static int sym_with_code(unsigned window, unsigned length) {
   int i;
-  int c = 0;
   for (i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
-    c += s.included[i] != 0;
+    if (grpc_chttp2_huffsyms[i].length == length &&
+        grpc_chttp2_huffsyms[i].bits == window >> (32 - length)) {
+      return i;
+    }
   }
-  return c;
+  return -1;
 }
-#endif
-
-/* global table of discovered huffman decoding states */
-static struct {
-  /* the bit offset that this state starts at */
-  unsigned bitofs;
-  /* the set of symbols that this state started with */
-  symset syms;
-
-  /* lookup table for the next state */
-  nibblelut next;
-  /* lookup table for what to emit */
-  nibblelut emit;
-} huffstates[MAXHUFFSTATES];
-static unsigned nhuffstates = 0;
 
-/* given a number of decoded bits and a set of symbols that are live,
-   return the index into the decoder table for this state.
-   set isnew to 1 if this state was previously undiscovered */
-static unsigned state_index(unsigned bitofs, symset syms, unsigned *isnew) {
-  unsigned i;
-  for (i = 0; i < nhuffstates; i++) {
-    if (huffstates[i].bitofs != bitofs) continue;
-    if (0 != memcmp(huffstates[i].syms.included, syms.included,
-                    GRPC_CHTTP2_NUM_HUFFSYMS))
-      continue;
-    *isnew = 0;
-    return i;
+/* returns the symbol whose code starts the left aligned \a window, if that
+   code fits in \a max_length bits, or -1 */
+static int first_sym(unsigned window, unsigned max_length) {
+  unsigned length;
+  for (length = 1; length <= max_length; length++) {
+    int sym = sym_with_code(window, length);
+    if (sym != -1) return sym;
   }
-  GPR_ASSERT(nhuffstates != MAXHUFFSTATES);
- 
-  i = nhuffstates;
-  nhuffstates++;
-  
-  huffstates[i].bitofs = bitofs;
-  huffstates[i].syms = syms;
-  huffstates[i].next = nibblelut_empty();
-  huffstates[i].emit = nibblelut_empty();
-  *isnew = 1;
-  return i;
+  return -1;
 }
 
-/* recursively build a decoding table
-
-   state   - the huffman state that we are trying to fill in
-   nibble  - the current nibble
-   nibbits - the number of bits in the nibble that have been filled in
-   bitofs  - the number of bits of symbol that have been decoded
-   emit    - the symbol to emit on this nibble (or -1 if no symbol has been
-             found)
-   syms    - the set of symbols that could be matched */
-static void build_dec_tbl(unsigned state, unsigned nibble, int nibbits,
-                          unsigned bitofs, unsigned emit, symset syms) {
+static void generate_huff_fast_tbl(void) {
   unsigned i;
-  unsigned bit;
-
-  /* If we have four bits in the nibble we're looking at, then we can fill in
-     a slot in the lookup tables. */
-  if (nibbits == 4) {
-    unsigned isnew;
-    /* Find the state that we are in: this may be a new state, in which case
-       we recurse to fill it in, or we may have already seen this state, in
-       which case the recursion terminates */
-    unsigned st = state_index(bitofs, syms, &isnew);
-    GPR_ASSERT(huffstates[state].next.values[nibble] == NOT_SET);
-    huffstates[state].next.values[nibble] = st;
-    huffstates[state].emit.values[nibble] = emit;
-    if (isnew) {
-      build_dec_tbl(st, 0, 0, bitofs, NOT_SET, syms);
-    }
-    return;
-  }
-
-  assert(nsyms(syms));
-
-  /* A bit can be 0 or 1 */
-  for (bit = 0; bit < 2; bit++) {
-    /* walk over active symbols and see if they have this bit set */
-    symset nextsyms = symset_none();
-    for (i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
-      if (!syms.included[i]) continue; /* disregard inactive symbols */
-      if (((grpc_chttp2_huffsyms[i].bits >>
-            (grpc_chttp2_huffsyms[i].length - bitofs - 1)) &
-           1) == bit) {
-        /* the bit is set, include it in the next recursive set */
-        if (grpc_chttp2_huffsyms[i].length == bitofs + 1) {
-          /* additionally, we've gotten to the end of a symbol - this is a
-             special recursion step: re-activate all the symbols, reset
-             bitofs to zero, and recurse */
-          build_dec_tbl(state, (nibble << 1) | bit, nibbits + 1, 0, i,
-                        symset_all());
-          /* skip the remainder of this loop */
-          goto next;
-        }
-        nextsyms.included[i] = 1;
+  printf("static const uint32_t huff_fast_tbl[1 << HUFF_FAST_BITS] = {");
+  for (i = 0; i < (1u << HUFF_FAST_BITS); i++) {
+    unsigned window = i << (32 - HUFF_FAST_BITS);
+    unsigned entry = 0;
+    int sym0 = first_sym(window, HUFF_FAST_BITS);
+    /* EOS (and anything else past a byte) is left to the slow path */
+    if (sym0 != -1 && sym0 < 256) {
+      unsigned len0 = grpc_chttp2_huffsyms[sym0].length;
+      int sym1 = first_sym(window << len0, HUFF_FAST_BITS - len0);
+      entry = (unsigned)sym0 | (len0 << 16);
+      if (sym1 != -1 && sym1 < 256) {
+        entry |= ((unsigned)sym1 << 8) |
+                 ((len0 + grpc_chttp2_huffsyms[sym1].length) << 20);
       }
     }
-    /* recurse down for this bit */
-    build_dec_tbl(state, (nibble << 1) | bit, nibbits + 1, bitofs + 1, emit,
-                  nextsyms);
-  next:;
+    printf("%s0x%x,", i % 8 == 0 ? "\n" : " ", entry);
   }
+  printf("};\n");
 }
 
-static nibblelut ctbl[MAXHUFFSTATES];
-static int nctbl;
-
-static int ctbl_idx(nibblelut x) {
+/* codes longer than HUFF_FAST_BITS are decoded through their canonical code
+   ranges: codes of a given length are consecutive, and follow all the shorter
+   codes once left aligned */
+static void generate_huff_long_tbls(void) {
+  unsigned length;
   int i;
-  for (i = 0; i < nctbl; i++) {
-    if (0 == memcmp(&x, ctbl + i, sizeof(nibblelut))) return i;
+  unsigned long long next_code = 0;
+  int nsyms = 0;
+  int syms[GRPC_CHTTP2_NUM_HUFFSYMS];
+  unsigned long long max[HUFF_MAX_CODE_LENGTH + 1];
+  int base[HUFF_MAX_CODE_LENGTH + 1];
+
+  for (length = 1; length <= HUFF_MAX_CODE_LENGTH; length++) {
+    if (length > HUFF_FAST_BITS) {
+      base[length] = nsyms - (int)next_code;
+    }
+    for (i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+      if (grpc_chttp2_huffsyms[i].length != length) continue;
+      /* the hpack code is canonical, with symbols of a given code length
+         ordered by value */
+      GPR_ASSERT(grpc_chttp2_huffsyms[i].bits == next_code);
+      next_code++;
+      if (length > HUFF_FAST_BITS) syms[nsyms++] = i;
+    }
+    max[length] = (next_code << (32 - length)) - 1;
+    next_code <<= 1;
   }
-  ctbl[i] = x;
-  nctbl++;
-  return i;
-}
+  GPR_ASSERT(max[HUFF_MAX_CODE_LENGTH] == 0xffffffffu);
 
-static void dump_ctbl(const char *name) {
-  int i, j;
-  printf("static const gpr_int16 %s[%d*16] = {\n", name, nctbl);
-  for (i = 0; i < nctbl; i++) {
-    for (j = 0; j < 16; j++) {
-      printf("%d,", ctbl[i].values[j]);
-    }
-    printf("\n");
+  printf("static const uint32_t huff_long_max[%d] = {",
+         HUFF_MAX_CODE_LENGTH - HUFF_FAST_BITS);
+  for (length = HUFF_FAST_BITS + 1; length <= HUFF_MAX_CODE_LENGTH; length++) {
+    printf("0x%llx,", max[length]);
   }
   printf("};\n");
-}
-
-static void generate_huff_tables(void) {
-  unsigned i;
-  build_dec_tbl(state_index(0, symset_all(), &i), 0, 0, 0, NOT_SET,
-                symset_all());
-
-  nctbl = 0;
-  printf("static const gpr_uint8 next_tbl[%d] = {", nhuffstates);
-  for (i = 0; i < nhuffstates; i++) {
-    printf("%d,", ctbl_idx(huffstates[i].next));
+  printf("static const int32_t huff_long_base[%d] = {",
+         HUFF_MAX_CODE_LENGTH - HUFF_FAST_BITS);
+  for (length = HUFF_FAST_BITS + 1; length <= HUFF_MAX_CODE_LENGTH; length++) {
+    printf("%d,", base[length]);
   }
   printf("};\n");
-  dump_ctbl("next_sub_tbl");
-
-  nctbl = 0;
-  printf("static const gpr_uint16 emit_tbl[%d] = {", nhuffstates);
-  for (i = 0; i < nhuffstates; i++) {
-    printf("%d,", ctbl_idx(huffstates[i].emit));
+  printf("static const uint16_t huff_long_syms[%d] = {", nsyms);
+  for (i = 0; i < nsyms; i++) {
+    printf("%d,", syms[i]);
   }
   printf("};\n");
-  dump_ctbl("emit_sub_tbl");
+}
+
+static void generate_huff_tables(void) {
+  generate_huff_fast_tbl();
+  generate_huff_long_tbls();
 }
 
 static void generate_base64_huff_encoder_table(void) {
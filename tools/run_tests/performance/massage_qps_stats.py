@@ -41,6 +41,13 @@ def massage_qps_stats(scenario_result):
             core_stats, "syscall_poll")
         stats["core_syscall_wait"] = massage_qps_stats_helpers.counter(
             core_stats, "syscall_wait")
+        stats["core_pollset_spin_hits"] = massage_qps_stats_helpers.counter(
+            core_stats, "pollset_spin_hits")
+        stats["core_pollset_spin_misses"] = massage_qps_stats_helpers.counter(
+            core_stats, "pollset_spin_misses")
+        stats[
+            "core_pollset_epoll_set_drains"] = massage_qps_stats_helpers.counter(
+                core_stats, "pollset_epoll_set_drains")
         stats["core_pollset_kick"] = massage_qps_stats_helpers.counter(
             core_stats, "pollset_kick")
         stats[
@@ -57,6 +64,9 @@ def massage_qps_stats(scenario_result):
         stats[
             "core_pollset_kick_own_thread"] = massage_qps_stats_helpers.counter(
                 core_stats, "pollset_kick_own_thread")
+        stats[
+            "core_pollset_kick_suppressed"] = massage_qps_stats_helpers.counter(
+                core_stats, "pollset_kick_suppressed")
         stats[
             "core_histogram_slow_lookups"] = massage_qps_stats_helpers.counter(
                 core_stats, "histogram_slow_lookups")
@@ -70,6 +80,22 @@ def massage_qps_stats(scenario_result):
         stats[
             "core_tcp_backup_poller_polls"] = massage_qps_stats_helpers.counter(
                 core_stats, "tcp_backup_poller_polls")
+        stats["core_tcp_write_zerocopy"] = massage_qps_stats_helpers.counter(
+            core_stats, "tcp_write_zerocopy")
+        stats[
+            "core_tcp_write_zerocopy_copied"] = massage_qps_stats_helpers.counter(
+                core_stats, "tcp_write_zerocopy_copied")
+        stats[
+            "core_tcp_read_provided_buffer"] = massage_qps_stats_helpers.counter(
+                core_stats, "tcp_read_provided_buffer")
+        stats[
+            "core_tcp_read_provided_buffer_exhausted"] = massage_qps_stats_helpers.counter(
+                core_stats, "tcp_read_provided_buffer_exhausted")
+        stats["core_tcp_write_paced"] = massage_qps_stats_helpers.counter(
+            core_stats, "tcp_write_paced")
+        stats[
+            "core_io_uring_deferred_submit"] = massage_qps_stats_helpers.counter(
+                core_stats, "io_uring_deferred_submit")
         stats["core_http2_op_batches"] = massage_qps_stats_helpers.counter(
             core_stats, "http2_op_batches")
         stats["core_http2_op_cancel"] = massage_qps_stats_helpers.counter(
@@ -247,6 +273,12 @@ def massage_qps_stats(scenario_result):
         stats[
             "core_combiner_locks_offloaded"] = massage_qps_stats_helpers.counter(
                 core_stats, "combiner_locks_offloaded")
+        stats[
+            "core_combiner_locks_scheduled_background_items"] = massage_qps_stats_helpers.counter(
+                core_stats, "combiner_locks_scheduled_background_items")
+        stats[
+            "core_exec_ctx_background_closures"] = massage_qps_stats_helpers.counter(
+                core_stats, "exec_ctx_background_closures")
         stats[
             "core_call_combiner_locks_initiated"] = massage_qps_stats_helpers.counter(
                 core_stats, "call_combiner_locks_initiated")
@@ -276,6 +308,12 @@ def massage_qps_stats(scenario_result):
                 core_stats, "executor_queue_drained")
         stats["core_executor_push_retries"] = massage_qps_stats_helpers.counter(
             core_stats, "executor_push_retries")
+        stats[
+            "core_executor_closures_stolen"] = massage_qps_stats_helpers.counter(
+                core_stats, "executor_closures_stolen")
+        stats[
+            "core_executor_failed_steals"] = massage_qps_stats_helpers.counter(
+                core_stats, "executor_failed_steals")
         stats[
             "core_server_requested_calls"] = massage_qps_stats_helpers.counter(
                 core_stats, "server_requested_calls")
@@ -319,6 +357,21 @@ def massage_qps_stats(scenario_result):
         stats[
             "core_poll_events_returned_99p"] = massage_qps_stats_helpers.percentile(
                 h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(core_stats,
+                                                "pollset_spin_time_us")
+        stats["core_pollset_spin_time_us"] = ",".join(
+            "%f" % x for x in h.buckets)
+        stats["core_pollset_spin_time_us_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_pollset_spin_time_us_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_pollset_spin_time_us_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_pollset_spin_time_us_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
         h = massage_qps_stats_helpers.histogram(core_stats, "tcp_write_size")
         stats["core_tcp_write_size"] = ",".join("%f" % x for x in h.buckets)
         stats["core_tcp_write_size_bkts"] = ",".join(
@@ -378,6 +431,77 @@ def massage_qps_stats(scenario_result):
         stats[
             "core_tcp_read_offer_iov_size_99p"] = massage_qps_stats_helpers.percentile(
                 h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(core_stats,
+                                                "tcp_write_zerocopy_size")
+        stats["core_tcp_write_zerocopy_size"] = ",".join(
+            "%f" % x for x in h.buckets)
+        stats["core_tcp_write_zerocopy_size_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_tcp_write_zerocopy_size_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_tcp_write_zerocopy_size_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_tcp_write_zerocopy_size_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(core_stats,
+                                                "tcp_write_scheduled_us")
+        stats["core_tcp_write_scheduled_us"] = ",".join(
+            "%f" % x for x in h.buckets)
+        stats["core_tcp_write_scheduled_us_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_tcp_write_scheduled_us_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_tcp_write_scheduled_us_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_tcp_write_scheduled_us_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(core_stats, "tcp_write_sent_us")
+        stats["core_tcp_write_sent_us"] = ",".join("%f" % x for x in h.buckets)
+        stats["core_tcp_write_sent_us_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_tcp_write_sent_us_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_tcp_write_sent_us_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_tcp_write_sent_us_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(core_stats,
+                                                "tcp_write_acked_us")
+        stats["core_tcp_write_acked_us"] = ",".join("%f" % x for x in h.buckets)
+        stats["core_tcp_write_acked_us_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_tcp_write_acked_us_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_tcp_write_acked_us_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_tcp_write_acked_us_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(core_stats,
+                                                "tcp_read_queued_us")
+        stats["core_tcp_read_queued_us"] = ",".join("%f" % x for x in h.buckets)
+        stats["core_tcp_read_queued_us_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_tcp_read_queued_us_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_tcp_read_queued_us_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_tcp_read_queued_us_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
         h = massage_qps_stats_helpers.histogram(core_stats,
                                                 "http2_send_message_size")
         stats["core_http2_send_message_size"] = ",".join(
@@ -453,6 +577,51 @@ def massage_qps_stats(scenario_result):
         stats[
             "core_http2_send_flowctl_per_write_99p"] = massage_qps_stats_helpers.percentile(
                 h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(
+            core_stats, "exec_ctx_critical_queue_delay_us")
+        stats["core_exec_ctx_critical_queue_delay_us"] = ",".join(
+            "%f" % x for x in h.buckets)
+        stats["core_exec_ctx_critical_queue_delay_us_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_exec_ctx_critical_queue_delay_us_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_exec_ctx_critical_queue_delay_us_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_exec_ctx_critical_queue_delay_us_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(
+            core_stats, "exec_ctx_background_queue_delay_us")
+        stats["core_exec_ctx_background_queue_delay_us"] = ",".join(
+            "%f" % x for x in h.buckets)
+        stats["core_exec_ctx_background_queue_delay_us_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_exec_ctx_background_queue_delay_us_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_exec_ctx_background_queue_delay_us_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_exec_ctx_background_queue_delay_us_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
+        h = massage_qps_stats_helpers.histogram(core_stats,
+                                                "executor_queue_depth")
+        stats["core_executor_queue_depth"] = ",".join(
+            "%f" % x for x in h.buckets)
+        stats["core_executor_queue_depth_bkts"] = ",".join(
+            "%f" % x for x in h.boundaries)
+        stats[
+            "core_executor_queue_depth_50p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 50, h.boundaries)
+        stats[
+            "core_executor_queue_depth_95p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 95, h.boundaries)
+        stats[
+            "core_executor_queue_depth_99p"] = massage_qps_stats_helpers.percentile(
+                h.buckets, 99, h.boundaries)
         h = massage_qps_stats_helpers.histogram(core_stats,
                                                 "server_cqs_checked")
         stats["core_server_cqs_checked"] = ",".join("%f" % x for x in h.buckets)
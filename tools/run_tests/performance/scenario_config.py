@@ -282,6 +282,28 @@ class CXXLanguage:
             server_threads_per_cq=1,
             categories=[SMOKETEST] + [SCALABLE])
 
+        # Scale the server over cores (one thread and completion queue per
+        # core), with and without steering each connection to the core that
+        # receives its packets
+        for cores in geometric_progression(1, 64 + 1, 2):
+            for cpu_affinity in [False, True]:
+                scenario = _ping_pong_scenario(
+                    'cpp_protobuf_async_unary_qps_unconstrained_insecure_%dcores%s'
+                    % (cores, '_cpu_affinity' if cpu_affinity else ''),
+                    rpc_type='UNARY',
+                    client_type='ASYNC_CLIENT',
+                    server_type='ASYNC_SERVER',
+                    unconstrained_client='async',
+                    secure=False,
+                    minimal_stack=True,
+                    async_server_threads=cores,
+                    server_threads_per_cq=1,
+                    categories=[SWEEP])
+                if cpu_affinity:
+                    _add_channel_arg(scenario['server_config'],
+                                     'grpc.so_reuseport_cpu_affinity', 1)
+                yield scenario
+
         for secure in [True, False]:
             secstr = 'secure' if secure else 'insecure'
             smoketest_categories = ([SMOKETEST]
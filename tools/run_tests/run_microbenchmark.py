@@ -185,7 +185,7 @@ def collect_perf(bm_name, args):
         jobset.run(cleanup, maxjobs=multiprocessing.cpu_count())
 
 
-def run_summary(bm_name, cfg, base_json_name):
+def run_summary(bm_name, cfg, base_json_name, poll_strategy=None):
     subprocess.check_call([
         'make', bm_name,
         'CONFIG=%s' % cfg, '-j',
@@ -198,10 +198,25 @@ def run_summary(bm_name, cfg, base_json_name):
     ]
     if args.summary_time is not None:
         cmd += ['--benchmark_min_time=%d' % args.summary_time]
-    return subprocess.check_output(cmd)
+    env = None
+    if poll_strategy is not None:
+        env = os.environ.copy()
+        env['GRPC_POLL_STRATEGY'] = poll_strategy
+    return subprocess.check_output(cmd, env=env)
 
 
 def collect_summary(bm_name, args):
+    if args.poll_strategies:
+        # run the same benchmark once per polling engine so that engines can be
+        # compared side by side
+        for poll_strategy in args.poll_strategies:
+            json_name = '%s.%s' % (bm_name, poll_strategy)
+            heading('Summary: %s [%s, no counters]' % (bm_name, poll_strategy))
+            text(run_summary(bm_name, 'opt', json_name, poll_strategy))
+            heading('Summary: %s [%s, with counters]' % (bm_name,
+                                                         poll_strategy))
+            text(run_summary(bm_name, 'counters', json_name, poll_strategy))
+        return
     heading('Summary: %s [no counters]' % bm_name)
     text(run_summary(bm_name, 'opt', bm_name))
     heading('Summary: %s [with counters]' % bm_name)
@@ -248,6 +263,13 @@ argp.add_argument(
     action='store_const',
     const=True,
     help='Upload results from summary collection to bigquery')
+argp.add_argument(
+    '--poll_strategies',
+    default=[],
+    nargs='+',
+    type=str,
+    help='Run the summary collection once per GRPC_POLL_STRATEGY given (eg. '
+    '"epoll1 io_uring" to compare polling engines)')
 argp.add_argument(
     '--summary_time',
     default=None,
@@ -61,7 +61,9 @@ _FORCE_ENVIRON_FOR_WRAPPERS = {
 }
 
 _POLLING_STRATEGIES = {
-    'linux': ['epollex', 'epollsig', 'epoll1', 'poll', 'poll-cv'],
+    'linux': [
+        'epollex', 'epollsig', 'epoll1', 'epoll1_sharded', 'poll', 'poll-cv'
+    ],
     'mac': ['poll'],
 }
 